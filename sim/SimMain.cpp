@@ -0,0 +1,369 @@
+// Headless host driver for the TamaBouchi firmware.
+//
+// Runs the unmodified setup()/loop() from src/Main.cpp against the host
+// stand-ins in sim/stubs. Time is virtual: loop() idles through vTaskDelay(),
+// which only advances the simulated clock, so a run goes as fast as the host
+// can execute the game logic while keeping the 30 Hz tick cadence exact.
+//
+// Scripted actions are applied when the virtual clock reaches their time:
+//   --at <ms>:btn:<OK|UP|DOWN|LEFT|RIGHT>:<CLICK|LONG_PRESS|PRESS|RELEASE>
+//   --at <ms>:cmd:<serial command line>
+//   --at <ms>:ws:connect[:<bytes per loop>] | ws:disconnect[:<n>] | ws:<text message>
+//     Each connect adds another viewer client (numbered from 1) with its own
+//     link budget; disconnect closes viewer <n>, or the newest one.
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "SimHost.h"
+#include "ViewerDecoder.h"
+#include "espasyncbutton.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+void setup();
+void loop();
+extern AsyncWebServer* server_ptr;
+
+namespace {
+
+struct ScriptedAction {
+    unsigned long atMs;
+    std::string kind;
+    std::string arg;
+};
+
+struct Options {
+    unsigned long durationMs = 60000;
+    uint32_t seed = 1;
+    std::string dumpDir;
+    unsigned long dumpEvery = 0;
+    std::string corpusPath;
+    bool quiet = false;
+    bool perf = false;
+    size_t wsBytesPerLoop = 0; // 0 = deliver everything immediately
+    std::vector<ScriptedAction> actions;
+};
+
+struct RunStats {
+    unsigned long framesSent = 0;
+    unsigned long framesChanged = 0;
+    unsigned long framesDumped = 0;
+    unsigned long loopIterations = 0;
+    uint64_t lastFrameHash = 0;
+};
+
+// One scripted Screen Viewer connection and what it received.
+struct SimViewer {
+    int number = 0;
+    AsyncWebSocketClient* client = nullptr; // Null once disconnected
+    size_t bytesPerLoop = 0;
+    ViewerDecoder decoder;
+    size_t bytes = 0;
+    size_t messages = 0;
+    unsigned long framesDecoded = 0;
+    unsigned long decodeErrors = 0;
+    unsigned long unknownFrames = 0; // Decoded fine but never shown on the panel
+};
+
+Options g_options;
+RunStats g_stats;
+uint8_t g_lastFrame[1024];
+bool g_haveLastFrame = false;
+std::vector<std::unique_ptr<SimViewer>> g_viewers;
+std::unordered_set<uint64_t> g_viewerFrameHashes; // Every panel frame, as the viewer should see it
+FILE* g_corpus = nullptr;
+
+void printUsage(const char* argv0) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --duration <ms>       Virtual time to simulate (default 60000)\n"
+            "  --seed <n>            PRNG seed for esp_random()/random() (default 1)\n"
+            "  --dump-dir <dir>      Write changed frames as PBM images into <dir>\n"
+            "  --dump-every <n>      Only dump every n-th changed frame (default 1)\n"
+            "  --corpus <file>       Append every changed frame, as streamed, to <file>\n"
+            "  --ws-rate <bytes>     Default viewer link budget per loop() (default unlimited)\n"
+            "  --at <ms>:<action>    Scripted input, see SimMain.cpp (repeatable)\n"
+            "  --quiet               Silence firmware serial output\n"
+            "  --perf                Print the FrameProfiler report (GET /perf) at the end\n",
+            argv0);
+}
+
+bool parseAction(const std::string& spec, ScriptedAction& out) {
+    size_t c1 = spec.find(':');
+    if (c1 == std::string::npos) return false;
+    size_t c2 = spec.find(':', c1 + 1);
+    out.atMs = strtoul(spec.substr(0, c1).c_str(), nullptr, 10);
+    out.kind = spec.substr(c1 + 1, c2 == std::string::npos ? std::string::npos : c2 - c1 - 1);
+    out.arg = c2 == std::string::npos ? "" : spec.substr(c2 + 1);
+    return out.kind == "btn" || out.kind == "cmd" || out.kind == "ws";
+}
+
+bool parseArgs(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Missing value for %s\n", name);
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--duration") g_options.durationMs = strtoul(next("--duration"), nullptr, 10);
+        else if (a == "--seed") g_options.seed = (uint32_t)strtoul(next("--seed"), nullptr, 10);
+        else if (a == "--dump-dir") g_options.dumpDir = next("--dump-dir");
+        else if (a == "--dump-every") g_options.dumpEvery = strtoul(next("--dump-every"), nullptr, 10);
+        else if (a == "--corpus") g_options.corpusPath = next("--corpus");
+        else if (a == "--ws-rate") g_options.wsBytesPerLoop = strtoul(next("--ws-rate"), nullptr, 10);
+        else if (a == "--quiet") g_options.quiet = true;
+        else if (a == "--perf") g_options.perf = true;
+        else if (a == "--at") {
+            ScriptedAction action;
+            if (!parseAction(next("--at"), action)) {
+                fprintf(stderr, "Bad --at action: %s\n", argv[i]);
+                return false;
+            }
+            g_options.actions.push_back(action);
+        } else {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t fnv1a(const uint8_t* data, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= data[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Writes the frame as seen on the mounted panel. Main.cpp drives the display
+// with U8G2_R2, so the raw page buffer is rotated back by 180 degrees here,
+// just like ScreenStreamer does for the browser viewer.
+void dumpFrame(const uint8_t* buffer) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%08lu_%06lu.pbm", g_options.dumpDir.c_str(), millis(), g_stats.framesChanged);
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "sim: cannot write %s\n", path);
+        return;
+    }
+    fprintf(f, "P4\n128 64\n");
+    for (int y = 0; y < 64; y++) {
+        uint8_t row[16] = {0};
+        for (int x = 0; x < 128; x++) {
+            int px = 127 - x, py = 63 - y;
+            if (buffer[(py >> 3) * 128 + px] & (1 << (py & 7))) row[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+        }
+        fwrite(row, 1, sizeof(row), f);
+    }
+    fclose(f);
+    g_stats.framesDumped++;
+}
+
+void onFrame(const uint8_t* buffer, size_t len) {
+    g_stats.framesSent++;
+    if (len != sizeof(g_lastFrame)) return;
+    if (g_haveLastFrame && memcmp(buffer, g_lastFrame, len) == 0) return;
+    memcpy(g_lastFrame, buffer, len);
+    g_haveLastFrame = true;
+    g_stats.framesChanged++;
+    g_stats.lastFrameHash = fnv1a(buffer, len);
+    // The streamer flips the R2 page buffer, which is a plain byte reversal
+    // plus a bit reversal per byte.
+    uint8_t flipped[sizeof(g_lastFrame)];
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = buffer[len - 1 - i];
+        b = (uint8_t)(((b & 0xF0) >> 4) | ((b & 0x0F) << 4));
+        b = (uint8_t)(((b & 0xCC) >> 2) | ((b & 0x33) << 2));
+        flipped[i] = (uint8_t)(((b & 0xAA) >> 1) | ((b & 0x55) << 1));
+    }
+    g_viewerFrameHashes.insert(fnv1a(flipped, len));
+    if (g_corpus) fwrite(flipped, 1, len, g_corpus);
+    unsigned long every = g_options.dumpEvery ? g_options.dumpEvery : 1;
+    if (!g_options.dumpDir.empty() && (g_stats.framesChanged - 1) % every == 0) dumpFrame(buffer);
+}
+
+void printSummary(const char* reason) {
+    fflush(stdout);
+    if (g_corpus) fflush(g_corpus);
+    fprintf(stderr,
+            "\n--- sim summary ---\n"
+            "end reason:        %s\n"
+            "virtual time:      %lu ms\n"
+            "loop iterations:   %lu\n"
+            "frames sent:       %lu\n"
+            "frames changed:    %lu\n"
+            "frames dumped:     %lu\n"
+            "last frame hash:   %016llx\n"
+            "display tiles:     %llu (full flushes would be %lu)\n",
+            reason, millis(), g_stats.loopIterations, g_stats.framesSent, g_stats.framesChanged,
+            g_stats.framesDumped, (unsigned long long)g_stats.lastFrameHash,
+            (unsigned long long)sim::displayTilesSent(), g_stats.framesSent * 128UL);
+    for (const auto& v : g_viewers) {
+        fprintf(stderr, "viewer %d:          %zu messages (%zu bytes), %lu frames decoded, "
+                        "%lu decode errors, %lu not matching the panel\n",
+                v->number, v->messages, v->bytes, v->framesDecoded, v->decodeErrors, v->unknownFrames);
+    }
+    if (g_options.perf && server_ptr) {
+        int code = 0;
+        std::string body;
+        if (server_ptr->simGet("/perf", code, body)) fprintf(stderr, "perf:              %s\n", body.c_str());
+    }
+}
+
+bool buttonFromName(const std::string& name, gpio_num_t& pin) {
+    // Same GPIO numbers Main.cpp maps in HardwareInputController.
+    if (name == "OK") pin = GPIO_NUM_0;
+    else if (name == "LEFT") pin = (gpio_num_t)1;
+    else if (name == "RIGHT") pin = (gpio_num_t)2;
+    else if (name == "UP") pin = (gpio_num_t)34;
+    else if (name == "DOWN") pin = (gpio_num_t)35;
+    else return false;
+    return true;
+}
+
+bool eventFromName(const std::string& name, ESPButton::event_t& ev) {
+    if (name == "CLICK") ev = ESPButton::event_t::click;
+    else if (name == "LONG_PRESS") ev = ESPButton::event_t::longPress;
+    else if (name == "PRESS") ev = ESPButton::event_t::press;
+    else if (name == "RELEASE") ev = ESPButton::event_t::release;
+    else return false;
+    return true;
+}
+
+AsyncWebSocket* screenSocket() {
+    return server_ptr ? server_ptr->simWebSocket("/screenviewer/ws") : nullptr;
+}
+
+void applyAction(const ScriptedAction& action) {
+    if (action.kind == "btn") {
+        size_t c = action.arg.find(':');
+        gpio_num_t pin;
+        ESPButton::event_t ev;
+        if (c == std::string::npos || !buttonFromName(action.arg.substr(0, c), pin) ||
+            !eventFromName(action.arg.substr(c + 1), ev)) {
+            fprintf(stderr, "sim: bad button action '%s'\n", action.arg.c_str());
+            return;
+        }
+        EventMsg msg = {(int32_t)pin, 0};
+        esp_event_post(EBTN_EVENTS, static_cast<int32_t>(ev), &msg, sizeof(msg), 0);
+    } else if (action.kind == "cmd") {
+        sim::pushSerialInput(action.arg + "\n");
+    } else if (action.kind == "ws") {
+        AsyncWebSocket* ws = screenSocket();
+        if (!ws) return;
+        if (action.arg.rfind("connect", 0) == 0) {
+            auto viewer = std::unique_ptr<SimViewer>(new SimViewer());
+            viewer->number = (int)g_viewers.size() + 1;
+            viewer->bytesPerLoop = g_options.wsBytesPerLoop;
+            if (action.arg.size() > 8 && action.arg[7] == ':') {
+                viewer->bytesPerLoop = strtoul(action.arg.c_str() + 8, nullptr, 10);
+            }
+            viewer->client = ws->simConnect();
+            g_viewers.push_back(std::move(viewer));
+        } else if (action.arg.rfind("disconnect", 0) == 0) {
+            SimViewer* target = nullptr;
+            if (action.arg.size() > 11 && action.arg[10] == ':') {
+                size_t n = strtoul(action.arg.c_str() + 11, nullptr, 10);
+                if (n >= 1 && n <= g_viewers.size()) target = g_viewers[n - 1].get();
+            } else {
+                for (auto it = g_viewers.rbegin(); it != g_viewers.rend() && !target; ++it) {
+                    if ((*it)->client) target = it->get();
+                }
+            }
+            if (target && target->client) {
+                ws->simDisconnect(target->client->id());
+                target->client = nullptr;
+            }
+        } else {
+            for (const auto& v : g_viewers) {
+                if (!v->client) continue;
+                ws->simReceiveText(v->client->id(), String(action.arg.c_str()));
+                break;
+            }
+        }
+    }
+}
+
+void serviceViewer(SimViewer& viewer) {
+    AsyncWebSocketClient* client = viewer.client;
+    if (!client) return;
+    size_t budget = viewer.bytesPerLoop ? viewer.bytesPerLoop : (size_t)-1;
+    client->simDrain(budget);
+    for (const auto& m : client->simInbox()) {
+        viewer.messages++;
+        viewer.bytes += m.data->size();
+        if (m.type == WS_TEXT) {
+            // Answer the streamer's round-trip probes like the viewer page.
+            std::string text(m.data->begin(), m.data->end());
+            AsyncWebSocket* ws = screenSocket();
+            if (ws && text.rfind("ping:", 0) == 0) ws->simReceiveText(client->id(), String(("pong:" + text.substr(5)).c_str()));
+            continue;
+        }
+        if (m.type != WS_BINARY) continue;
+        if (!viewer.decoder.decode(m.data->data(), m.data->size())) {
+            viewer.decodeErrors++;
+            fprintf(stderr, "sim: viewer %d decode error at %lu ms: %s\n", viewer.number, millis(),
+                    viewer.decoder.lastError().c_str());
+            continue;
+        }
+        for (const auto& frame : viewer.decoder.frames()) {
+            viewer.framesDecoded++;
+            if (!g_viewerFrameHashes.count(fnv1a(frame.data(), frame.size()))) viewer.unknownFrames++;
+        }
+        viewer.decoder.clearFrames();
+    }
+    client->simClearInbox();
+}
+
+void serviceWebSocket() {
+    for (const auto& v : g_viewers) serviceViewer(*v);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (!parseArgs(argc, argv)) return 2;
+    if (g_options.quiet) {
+        if (!freopen("/dev/null", "w", stdout)) return 1;
+    }
+
+    if (!g_options.corpusPath.empty()) {
+        g_corpus = fopen(g_options.corpusPath.c_str(), "ab");
+        if (!g_corpus) {
+            fprintf(stderr, "sim: cannot write %s\n", g_options.corpusPath.c_str());
+            return 1;
+        }
+    }
+
+    sim::seedRandom(g_options.seed);
+    sim::setFrameSink(onFrame);
+    sim::setHaltHandler([](const char* reason) { printSummary(reason); });
+
+    setup();
+
+    size_t nextAction = 0;
+    std::stable_sort(g_options.actions.begin(), g_options.actions.end(),
+                     [](const ScriptedAction& a, const ScriptedAction& b) { return a.atMs < b.atMs; });
+
+    while (millis() < g_options.durationMs) {
+        while (nextAction < g_options.actions.size() && g_options.actions[nextAction].atMs <= millis()) {
+            applyAction(g_options.actions[nextAction++]);
+        }
+        sim::dispatchEvents();
+        loop();
+        serviceWebSocket();
+        g_stats.loopIterations++;
+    }
+
+    printSummary("duration reached");
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "ViewerDecoder.h"
+
+#include <cstring>
+
+namespace {
+
+uint32_t crc32(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+} // namespace
+
+bool ViewerDecoder::fail(const std::string& message) {
+    _lastError = message;
+    return false;
+}
+
+void ViewerDecoder::pushLatest() {
+    _frames.emplace_back(_latest, _latest + FRAME_SIZE);
+}
+
+bool ViewerDecoder::decompressRLE(const uint8_t* payload, size_t len, std::vector<uint8_t>& out) {
+    out.clear();
+    if (len % 2 != 0) return fail("RLE payload has odd length");
+    for (size_t i = 0; i + 1 < len; i += 2) out.insert(out.end(), payload[i], payload[i + 1]);
+    return true;
+}
+
+bool ViewerDecoder::applyDelta(const uint8_t* payload, size_t len) {
+    size_t i = 0;
+    while (i + 3 <= len) {
+        size_t offset = ((size_t)payload[i] << 8) | payload[i + 1];
+        size_t length = payload[i + 2];
+        i += 3;
+        if (i + length > len || offset + length > FRAME_SIZE) return fail("malformed delta run");
+        memcpy(_latest + offset, payload + i, length);
+        i += length;
+    }
+    if (i != len) return fail("trailing bytes after delta runs");
+    return true;
+}
+
+// XOR stream with zero runs; frame 0 is XORed onto `base` (null = zeros),
+// every later frame onto the one before it.
+bool ViewerDecoder::decodeXorZeroRun(const uint8_t* payload, size_t len, size_t frameCount, const uint8_t* base,
+                                     std::vector<uint8_t>& out) {
+    out.clear();
+    for (size_t i = 0; i < len; i++) {
+        if (payload[i] != 0) {
+            out.push_back(payload[i]);
+            continue;
+        }
+        if (i + 1 >= len || payload[i + 1] == 0) return fail("malformed XOR zero run");
+        out.insert(out.end(), payload[i + 1], 0);
+        i++;
+    }
+    if (out.size() != frameCount * FRAME_SIZE) return fail("XOR stream has wrong size");
+    for (size_t f = 0; f < frameCount; f++) {
+        uint8_t* frame = out.data() + f * FRAME_SIZE;
+        const uint8_t* ref = f > 0 ? frame - FRAME_SIZE : base;
+        if (!ref) continue;
+        for (size_t i = 0; i < FRAME_SIZE; i++) frame[i] ^= ref[i];
+    }
+    return true;
+}
+
+bool ViewerDecoder::decodeLzss(const uint8_t* payload, size_t len, std::vector<uint8_t>& out) {
+    out.clear();
+    size_t i = 0;
+    while (i < len) {
+        uint8_t flags = payload[i++];
+        for (int bit = 0; bit < 8 && i < len; bit++) {
+            if (!(flags & (1 << bit))) {
+                out.push_back(payload[i++]);
+                continue;
+            }
+            if (i + 2 > len) return fail("truncated LZSS match");
+            size_t offset = (((size_t)payload[i] << 4) | (payload[i + 1] >> 4)) + 1;
+            size_t length = (payload[i + 1] & 0x0F) + 3;
+            i += 2;
+            if (offset > out.size()) return fail("LZSS match before start");
+            size_t from = out.size() - offset;
+            for (size_t k = 0; k < length; k++) out.push_back(out[from + k]);
+        }
+    }
+    return true;
+}
+
+bool ViewerDecoder::decode(const uint8_t* data, size_t len) {
+    if (len < 1) return fail("empty message");
+    char header = (char)data[0];
+    const uint8_t* payload = data + 1;
+    size_t payloadLen = len - 1;
+
+    if (header == 'B') {
+        const size_t headerSize = 1 + 1 + 1 + 4;
+        if (payloadLen < headerSize) return fail("batch too short");
+        size_t frameCount = payload[0];
+        uint8_t codec = payload[2];
+        uint32_t receivedCrc;
+        memcpy(&receivedCrc, payload + 3, 4);
+        const uint8_t* body = payload + headerSize;
+        size_t bodyLen = payloadLen - headerSize;
+
+        std::vector<uint8_t> frames;
+        switch (codec) {
+            case 0: frames.assign(body, body + bodyLen); break;
+            case 1: if (!decompressRLE(body, bodyLen, frames)) return false; break;
+            case 2: if (!decodeXorZeroRun(body, bodyLen, frameCount, nullptr, frames)) return false; break;
+            case 3: if (!decodeLzss(body, bodyLen, frames)) return false; break;
+            default: return fail("unknown batch codec " + std::to_string(codec));
+        }
+        if (frames.size() != frameCount * FRAME_SIZE) return fail("batch size does not match frame count");
+        if (crc32(frames.data(), frames.size()) != receivedCrc) return fail("batch CRC mismatch");
+        for (size_t f = 0; f < frameCount; f++) {
+            memcpy(_latest, frames.data() + f * FRAME_SIZE, FRAME_SIZE);
+            pushLatest();
+        }
+        return true;
+    }
+    if (header == 'C' || header == 'U' || header == 'L' || header == 'X') {
+        std::vector<uint8_t> frame;
+        bool ok = true;
+        if (header == 'C') ok = decompressRLE(payload, payloadLen, frame);
+        else if (header == 'L') ok = decodeLzss(payload, payloadLen, frame);
+        else if (header == 'X') ok = decodeXorZeroRun(payload, payloadLen, 1, _latest, frame);
+        else frame.assign(payload, payload + payloadLen);
+        if (!ok) return false;
+        if (frame.size() != FRAME_SIZE) return fail(std::string("frame '") + header + "' has wrong size");
+        memcpy(_latest, frame.data(), FRAME_SIZE);
+        pushLatest();
+        return true;
+    }
+    if (header == 'D') {
+        if (!applyDelta(payload, payloadLen)) return false;
+        pushLatest();
+        return true;
+    }
+    return fail(std::string("unknown frame header '") + header + "'");
+}
@@ -0,0 +1,39 @@
+// Host copy of the Screen Viewer's frame decoder (the worker code in
+// src/System/ScreenWebPageGenerator/ScreenWebPage.html). The simulator feeds
+// it every binary message a virtual client receives, so protocol changes in
+// ScreenStreamer can be checked without a browser. Keep both in sync.
+#ifndef SIM_VIEWER_DECODER_H
+#define SIM_VIEWER_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+class ViewerDecoder {
+public:
+    static const size_t FRAME_SIZE = 1024;
+
+    // Decodes one message. Returns false and sets lastError() on a protocol
+    // error; decoded frames are appended to frames().
+    bool decode(const uint8_t* data, size_t len);
+
+    const std::vector<std::vector<uint8_t>>& frames() const { return _frames; }
+    void clearFrames() { _frames.clear(); }
+    const std::string& lastError() const { return _lastError; }
+
+private:
+    uint8_t _latest[FRAME_SIZE] = {0};
+    std::vector<std::vector<uint8_t>> _frames;
+    std::string _lastError;
+
+    bool fail(const std::string& message);
+    bool decompressRLE(const uint8_t* payload, size_t len, std::vector<uint8_t>& out);
+    bool applyDelta(const uint8_t* payload, size_t len);
+    bool decodeXorZeroRun(const uint8_t* payload, size_t len, size_t frameCount, const uint8_t* base,
+                          std::vector<uint8_t>& out);
+    bool decodeLzss(const uint8_t* payload, size_t len, std::vector<uint8_t>& out);
+    void pushLatest();
+};
+
+#endif // SIM_VIEWER_DECODER_H
@@ -0,0 +1,59 @@
+// Minimal micro-benchmark registry for the host build.
+//
+// Each benchmark is a function registered with TAMA_BENCH(name). It receives
+// a BenchRunner and times one or more variants of the code under test with
+// measure(), which repeats the body until enough host time has elapsed and
+// reports nanoseconds per call. Benchmarks are not tests: they only print.
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+class BenchRunner {
+public:
+    struct Result {
+        std::string label;
+        double nsPerCall;
+    };
+
+    // Times body() and prints one line. The first variant measured by a
+    // benchmark is the baseline the following ones are compared with.
+    double measure(const std::string& label, const std::function<void()>& body);
+    void note(const std::string& text);
+    void check(bool condition, const std::string& what);
+
+    void begin(const std::string& benchName);
+    bool failed() const { return _failed; }
+
+private:
+    std::vector<Result> _results;
+    bool _failed = false;
+};
+
+struct BenchCase {
+    const char* name;
+    void (*fn)(BenchRunner&);
+};
+
+std::vector<BenchCase>& benchRegistry();
+
+struct BenchRegistrar {
+    BenchRegistrar(const char* name, void (*fn)(BenchRunner&)) { benchRegistry().push_back({name, fn}); }
+};
+
+#define TAMA_BENCH(name) \
+    static void bench_##name(BenchRunner& bench); \
+    static BenchRegistrar benchRegistrar_##name(#name, bench_##name); \
+    static void bench_##name(BenchRunner& bench)
+
+// Keeps the optimiser from discarding results of the measured code.
+inline void benchKeep(const void* p) {
+    asm volatile("" : : "g"(p) : "memory");
+}
+
+#endif // SIM_BENCH_H
@@ -0,0 +1,66 @@
+// Host micro-benchmarks: ./tamabouchi_bench [name-filter]
+#include "Bench.h"
+
+#include <cstdio>
+#include <cstring>
+
+std::vector<BenchCase>& benchRegistry() {
+    static std::vector<BenchCase> registry;
+    return registry;
+}
+
+void BenchRunner::begin(const std::string& benchName) {
+    _results.clear();
+    printf("\n[%s]\n", benchName.c_str());
+}
+
+double BenchRunner::measure(const std::string& label, const std::function<void()>& body) {
+    using clock = std::chrono::steady_clock;
+    const auto minTime = std::chrono::milliseconds(200);
+
+    for (int i = 0; i < 3; i++) body(); // Warm-up
+
+    unsigned long iterations = 0;
+    auto start = clock::now();
+    auto elapsed = clock::duration::zero();
+    unsigned long batch = 1;
+    while (elapsed < minTime) {
+        for (unsigned long i = 0; i < batch; i++) body();
+        iterations += batch;
+        elapsed = clock::now() - start;
+        if (batch < (1ul << 20)) batch *= 2;
+    }
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() / (double)iterations;
+
+    if (_results.empty()) {
+        printf("  %-36s %12.1f ns/call\n", label.c_str(), ns);
+    } else {
+        printf("  %-36s %12.1f ns/call  (%.1fx vs %s)\n", label.c_str(), ns, _results[0].nsPerCall / ns,
+               _results[0].label.c_str());
+    }
+    _results.push_back({label, ns});
+    return ns;
+}
+
+void BenchRunner::note(const std::string& text) {
+    printf("  %s\n", text.c_str());
+}
+
+void BenchRunner::check(bool condition, const std::string& what) {
+    if (condition) return;
+    printf("  MISMATCH: %s\n", what.c_str());
+    _failed = true;
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    bool failed = false;
+    for (const BenchCase& c : benchRegistry()) {
+        if (filter && !strstr(c.name, filter)) continue;
+        BenchRunner runner;
+        runner.begin(c.name);
+        c.fn(runner);
+        failed |= runner.failed();
+    }
+    return failed ? 1 : 0;
+}
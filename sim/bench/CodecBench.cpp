@@ -0,0 +1,159 @@
+#include "Bench.h"
+#include "ViewerDecoder.h"
+#include "System/Crc32.h"
+#include "System/FrameCodec.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const size_t FRAME_SIZE = ViewerDecoder::FRAME_SIZE;
+const size_t BATCH_FRAMES = 8; // As Main.cpp streams batches
+const size_t BATCH_HEADER_SIZE = 8;
+
+// A corpus is a file of consecutive 1024-byte frames as the viewer shows
+// them, written by `tamabouchi_sim --corpus <file>`.
+bool loadCorpus(const char* path, std::vector<uint8_t>& frames) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t frame[FRAME_SIZE];
+    while (fread(frame, 1, FRAME_SIZE, f) == FRAME_SIZE) frames.insert(frames.end(), frame, frame + FRAME_SIZE);
+    fclose(f);
+    return !frames.empty();
+}
+
+bool sameFrame(const std::vector<uint8_t>& decoded, const uint8_t* expected) {
+    return decoded.size() == FRAME_SIZE && memcmp(decoded.data(), expected, FRAME_SIZE) == 0;
+}
+
+// Frame f against frame f-1, as sendFrame() does between keyframes. A codec
+// that cannot beat the raw frame counts as a raw 'U' packet.
+void benchSingleFrames(BenchRunner& bench, const std::vector<uint8_t>& corpus, size_t frameCount) {
+    size_t codecCount;
+    const FrameCodec* const* codecs = FrameCodec::all(codecCount);
+    std::vector<uint8_t> dest(FRAME_SIZE);
+    char line[160];
+
+    for (size_t c = 0; c < codecCount; ++c) {
+        const FrameCodec* codec = codecs[c];
+        size_t totalBytes = 0;
+        size_t fallbacks = 0;
+        bool roundTrip = true;
+        ViewerDecoder decoder;
+        for (size_t f = 1; f < frameCount; ++f) {
+            const uint8_t* previous = &corpus[(f - 1) * FRAME_SIZE];
+            const uint8_t* current = &corpus[f * FRAME_SIZE];
+            size_t len = codec->encode(current, 1, FRAME_SIZE, previous, dest.data(), FRAME_SIZE);
+            if (len == 0) {
+                fallbacks++;
+                totalBytes += 1 + FRAME_SIZE;
+                continue;
+            }
+            totalBytes += 1 + len;
+
+            std::vector<uint8_t> packet(1 + FRAME_SIZE);
+            packet[0] = 'U';
+            memcpy(&packet[1], previous, FRAME_SIZE);
+            decoder.decode(packet.data(), packet.size());
+            packet.assign(1, (uint8_t)codec->frameHeader());
+            packet.insert(packet.end(), dest.begin(), dest.begin() + len);
+            decoder.clearFrames();
+            if (!decoder.decode(packet.data(), packet.size()) || decoder.frames().empty() ||
+                !sameFrame(decoder.frames().back(), current)) {
+                roundTrip = false;
+            }
+        }
+        bench.check(roundTrip, std::string(codec->name()) + " single frames do not round-trip through ViewerDecoder");
+
+        double ns = bench.measure(std::string(codec->name()) + " single frame, whole corpus", [&] {
+            for (size_t f = 1; f < frameCount; ++f) {
+                codec->encode(&corpus[f * FRAME_SIZE], 1, FRAME_SIZE, &corpus[(f - 1) * FRAME_SIZE], dest.data(),
+                              FRAME_SIZE);
+            }
+            benchKeep(dest.data());
+        });
+        snprintf(line, sizeof(line), "%-6s single: %7.1f bytes/frame, %6.2f us/frame, %zu raw fallbacks",
+                 codec->name(), (double)totalBytes / (frameCount - 1), ns / 1000.0 / (frameCount - 1), fallbacks);
+        bench.note(line);
+    }
+}
+
+// Non-overlapping groups of BATCH_FRAMES frames, as sendBatchFrame() sends
+// them. A codec that cannot beat the raw batch counts as codec 0.
+void benchBatches(BenchRunner& bench, const std::vector<uint8_t>& corpus, size_t frameCount) {
+    size_t codecCount;
+    const FrameCodec* const* codecs = FrameCodec::all(codecCount);
+    const size_t batchCount = frameCount / BATCH_FRAMES;
+    const size_t batchBytes = BATCH_FRAMES * FRAME_SIZE;
+    std::vector<uint8_t> packet(BATCH_HEADER_SIZE + batchBytes);
+    char line[160];
+
+    for (size_t c = 0; c < codecCount; ++c) {
+        const FrameCodec* codec = codecs[c];
+        if (codec->batchMode() == 0) continue;
+        size_t totalBytes = 0;
+        size_t fallbacks = 0;
+        bool roundTrip = true;
+        ViewerDecoder decoder;
+        for (size_t b = 0; b < batchCount; ++b) {
+            const uint8_t* frames = &corpus[b * batchBytes];
+            size_t len = codec->encode(frames, BATCH_FRAMES, FRAME_SIZE, nullptr, &packet[BATCH_HEADER_SIZE], batchBytes);
+            if (len == 0) {
+                fallbacks++;
+                totalBytes += BATCH_HEADER_SIZE + batchBytes;
+                continue;
+            }
+            totalBytes += BATCH_HEADER_SIZE + len;
+
+            uint32_t crc = crc32Update(0, frames, batchBytes);
+            packet[0] = 'B';
+            packet[1] = (uint8_t)BATCH_FRAMES;
+            packet[2] = 30;
+            packet[3] = codec->batchMode();
+            for (int i = 0; i < 4; ++i) packet[4 + i] = (uint8_t)(crc >> (8 * i));
+            decoder.clearFrames();
+            bool ok = decoder.decode(packet.data(), BATCH_HEADER_SIZE + len) &&
+                      decoder.frames().size() == BATCH_FRAMES;
+            for (size_t f = 0; ok && f < BATCH_FRAMES; ++f) ok = sameFrame(decoder.frames()[f], frames + f * FRAME_SIZE);
+            if (!ok) roundTrip = false;
+        }
+        bench.check(roundTrip, std::string(codec->name()) + " batches do not round-trip through ViewerDecoder");
+
+        double ns = bench.measure(std::string(codec->name()) + " 8-frame batch, whole corpus", [&] {
+            for (size_t b = 0; b < batchCount; ++b) {
+                codec->encode(&corpus[b * batchBytes], BATCH_FRAMES, FRAME_SIZE, nullptr, &packet[BATCH_HEADER_SIZE],
+                              batchBytes);
+            }
+            benchKeep(packet.data());
+        });
+        snprintf(line, sizeof(line), "%-6s batch:  %7.1f bytes/frame, %6.2f us/frame, %zu raw fallbacks",
+                 codec->name(), (double)totalBytes / (batchCount * BATCH_FRAMES),
+                 ns / 1000.0 / (batchCount * BATCH_FRAMES), fallbacks);
+        bench.note(line);
+    }
+}
+
+} // namespace
+
+// Bytes per frame and encode time of every FrameCodec over a recorded frame
+// corpus (TAMA_FRAME_CORPUS). Sending raw frames costs 1025 bytes per frame,
+// single or batched.
+TAMA_BENCH(frame_codecs) {
+    const char* path = getenv("TAMA_FRAME_CORPUS");
+    std::vector<uint8_t> corpus;
+    if (!path || !loadCorpus(path, corpus)) {
+        bench.note("Set TAMA_FRAME_CORPUS to a file written by tamabouchi_sim --corpus; skipped.");
+        return;
+    }
+    size_t frameCount = corpus.size() / FRAME_SIZE;
+    bench.note("corpus: " + std::to_string(frameCount) + " frames from " + path);
+    if (frameCount < BATCH_FRAMES) {
+        bench.note("Corpus too small; skipped.");
+        return;
+    }
+    benchSingleFrames(bench, corpus, frameCount);
+    benchBatches(bench, corpus, frameCount);
+}
@@ -0,0 +1,59 @@
+#include "Bench.h"
+#include "System/Crc32.h"
+
+#include <cstring>
+#include <random>
+
+namespace {
+
+// The bitwise loop ScreenStreamer used before Crc32.
+uint32_t crc32Bitwise(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xffffffff;
+    while (length--) {
+        crc ^= *data++;
+        for (int j = 0; j < 8; j++) crc = (crc >> 1) ^ (0xedb88320 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// Classic one-table, byte-at-a-time variant, as in the viewer page.
+uint32_t crc32ByteTable(const uint8_t* data, size_t length) {
+    static uint32_t table[256];
+    static bool ready = false;
+    if (!ready) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int j = 0; j < 8; j++) c = (c >> 1) ^ (0xedb88320 & (0u - (c & 1)));
+            table[i] = c;
+        }
+        ready = true;
+    }
+    uint32_t crc = 0xffffffff;
+    while (length--) crc = (crc >> 8) ^ table[(crc ^ *data++) & 0xFF];
+    return ~crc;
+}
+
+} // namespace
+
+TAMA_BENCH(crc32_batch) {
+    // One full batch as Main streams it: 8 frames of 1024 bytes.
+    const size_t frameSize = 1024;
+    const size_t batchFrames = 8;
+    static uint8_t batch[frameSize * batchFrames];
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < sizeof(batch); i++) batch[i] = (uint8_t)rng();
+
+    uint32_t expected = crc32Bitwise(batch, sizeof(batch));
+    bench.check(crc32ByteTable(batch, sizeof(batch)) == expected, "byte table CRC differs from bitwise");
+    bench.check(crc32Update(0, batch, sizeof(batch)) == expected, "crc32Update differs from bitwise");
+    uint32_t chained = 0;
+    for (size_t f = 0; f < batchFrames; f++) chained = crc32Update(chained, batch + f * frameSize, frameSize);
+    bench.check(chained == expected, "per-frame crc32Update chain differs from one pass");
+
+    volatile uint32_t sink = 0;
+    bench.measure("bitwise (previous), 8 KB", [&] { sink = crc32Bitwise(batch, sizeof(batch)); });
+    bench.measure("byte table, 8 KB", [&] { sink = crc32ByteTable(batch, sizeof(batch)); });
+    bench.measure("crc32Update slice-by-8, 8 KB", [&] { sink = crc32Update(0, batch, sizeof(batch)); });
+    (void)sink;
+    bench.note("The ROM variant (esp_rom_crc32_le) is the device implementation and cannot run on the host.");
+}
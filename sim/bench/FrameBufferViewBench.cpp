@@ -0,0 +1,135 @@
+#include "Bench.h"
+#include "Helper/FrameBufferView.h"
+
+#include <Renderer.h>
+#include <U8g2lib.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+struct Target {
+    U8G2 u8g2;
+    DisplayConfig config;
+    Renderer renderer;
+
+    explicit Target(const u8g2_cb_t* rotation)
+        : u8g2(rotation), config(SSD1306, 0, 0, 0, rotation, U8G2::WIDTH, U8G2::HEIGHT, true),
+          renderer(&u8g2, config) {
+        for (size_t i = 0; i < U8G2::BUFFER_SIZE; ++i) u8g2.getBufferPtr()[i] = (uint8_t)(i * 37);
+    }
+};
+
+int randomIn(int lo, int hi) { return lo + rand() % (hi - lo + 1); }
+
+} // namespace
+
+// FrameBufferView against the U8G2 calls the weather effects used before:
+// the same pixels for every primitive, draw colour and rotation, and the
+// cost of each.
+TAMA_BENCH(framebuffer_view) {
+    bool matches = true;
+    for (const u8g2_cb_t* rotation : {U8G2_R0, U8G2_R2}) {
+        srand(7);
+        for (int round = 0; round < 2400; ++round) {
+            Target reference(rotation);
+            Target viewed(rotation);
+            FrameBufferView view(viewed.renderer);
+            uint8_t color = (uint8_t)(round % 3);
+            reference.u8g2.setDrawColor(color);
+            FrameBufferView::Op op = (FrameBufferView::Op)color;
+
+            // Coordinates run past every edge so clipping is exercised too.
+            int x0 = randomIn(-20, 147), y0 = randomIn(-20, 83);
+            int x1 = randomIn(-20, 147), y1 = randomIn(-20, 83);
+            int w = randomIn(0, 140), h = randomIn(0, 70);
+            const char* what = "";
+            uint32_t masks[8];
+            for (uint32_t& mask : masks) mask = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+            switch (round % 7) {
+            case 0:
+                what = "pixel";
+                reference.u8g2.drawPixel(x0, y0);
+                view.pixel(x0, y0, op);
+                break;
+            case 1:
+                what = "hSpan";
+                reference.u8g2.drawHLine(x0, y0, w);
+                view.hSpan(x0, y0, w, op);
+                break;
+            case 2:
+                what = "vSpan";
+                reference.u8g2.drawVLine(x0, y0, h);
+                view.vSpan(x0, y0, h, op);
+                break;
+            case 3:
+                what = "fill";
+                reference.u8g2.drawBox(x0, y0, w, h);
+                view.fill(x0, y0, w, h, op);
+                break;
+            case 4:
+                what = "blitColumns";
+                for (int i = 0; i < 8; ++i) {
+                    for (int bit = 0; bit < 32; ++bit) {
+                        if (masks[i] & (1u << bit)) reference.u8g2.drawPixel(x0 + i, y0 + bit);
+                    }
+                }
+                view.blitColumns(x0, y0, masks, 8, op);
+                break;
+            case 5: {
+                what = "vSpans";
+                int16_t xs[8], ys[8];
+                for (int i = 0; i < 8; ++i) {
+                    xs[i] = (int16_t)(x0 + (int)(masks[i] % 41) - 20);
+                    ys[i] = (int16_t)(y0 + (int)(masks[i] >> 16) % 41 - 20);
+                    reference.u8g2.drawVLine(xs[i], ys[i], h % 33);
+                }
+                view.vSpans(xs, ys, 8, h % 33, op);
+                break;
+            }
+            default:
+                what = "line";
+                reference.u8g2.drawLine(x0, y0, x1, y1);
+                view.line(x0, y0, x1, y1, op);
+                break;
+            }
+            if (memcmp(reference.u8g2.getBufferPtr(), viewed.u8g2.getBufferPtr(), U8G2::BUFFER_SIZE) != 0) {
+                if (matches) {
+                    char line[128];
+                    snprintf(line, sizeof(line), "first mismatch: %s (%d,%d)-(%d,%d) %dx%d colour %u %s", what, x0, y0,
+                             x1, y1, w, h, color, rotation == U8G2_R2 ? "R2" : "R0");
+                    bench.note(line);
+                }
+                matches = false;
+            }
+        }
+    }
+    bench.check(matches, "FrameBufferView differs from the U8G2 primitives");
+
+    // Typical effect work: 40 rain streaks and 200 fog pixels, XOR.
+    Target target(U8G2_R2);
+    U8G2& u8g2 = target.u8g2;
+    bench.measure("U8G2 drawLine/drawPixel, XOR", [&] {
+        u8g2.setDrawColor(2);
+        for (int i = 0; i < 40; ++i) u8g2.drawLine(i * 3, i, i * 3, i + 3);
+        for (int i = 0; i < 200; ++i) u8g2.drawPixel((i * 7) & 127, 32 + (i & 31));
+        benchKeep(u8g2.getBufferPtr());
+    });
+    bench.measure("FrameBufferView vSpan/xorPixel", [&] {
+        FrameBufferView view(target.renderer);
+        for (int i = 0; i < 40; ++i) view.vSpan(i * 3, i, 4, FrameBufferView::XOR);
+        for (int i = 0; i < 200; ++i) view.xorPixel((i * 7) & 127, 32 + (i & 31));
+        benchKeep(u8g2.getBufferPtr());
+    });
+    bench.measure("U8G2 drawBox 128x64, XOR", [&] {
+        u8g2.setDrawColor(2);
+        u8g2.drawBox(0, 0, U8G2::WIDTH, U8G2::HEIGHT);
+        benchKeep(u8g2.getBufferPtr());
+    });
+    bench.measure("FrameBufferView fill 128x64, XOR", [&] {
+        FrameBufferView view(target.renderer);
+        view.fill(0, 0, U8G2::WIDTH, U8G2::HEIGHT, FrameBufferView::XOR);
+        benchKeep(u8g2.getBufferPtr());
+    });
+}
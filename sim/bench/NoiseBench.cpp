@@ -0,0 +1,144 @@
+#include "Bench.h"
+#include "Helper/FixedNoise.h"
+
+#include <FastNoiseLite.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+struct NoiseCase {
+    const char* name;
+    bool perlin;
+    int octaves; // 1: no fractal
+    float frequency;
+    bool is3D;
+};
+
+// The configurations the game uses: fog (Perlin FBm), paths and hazards
+// (Perlin), journey currents (3D Perlin), spark waves (OpenSimplex2).
+const NoiseCase CASES[] = {
+    {"Perlin 2D", true, 1, 0.08f, false},
+    {"Perlin 2D FBm x2", true, 2, 0.08f, false},
+    {"Perlin 3D", true, 1, 0.08f, true},
+    {"OpenSimplex2 2D", false, 1, 0.3f, false},
+};
+
+void configure(const NoiseCase& c, FastNoiseLite& reference, FixedNoise& fixed, int seed) {
+    reference.SetNoiseType(c.perlin ? FastNoiseLite::NoiseType_Perlin : FastNoiseLite::NoiseType_OpenSimplex2);
+    fixed.SetNoiseType(c.perlin ? FixedNoise::NoiseType_Perlin : FixedNoise::NoiseType_OpenSimplex2);
+    reference.SetFrequency(c.frequency);
+    fixed.SetFrequency(c.frequency);
+    reference.SetSeed(seed);
+    fixed.SetSeed(seed);
+    if (c.octaves > 1) {
+        reference.SetFractalType(FastNoiseLite::FractalType_FBm);
+        fixed.SetFractalType(FixedNoise::FractalType_FBm);
+        reference.SetFractalOctaves(c.octaves);
+        fixed.SetFractalOctaves(c.octaves);
+    }
+}
+
+float randomCoord() { return (rand() % 200000) * 0.01f - 1000.0f; }
+
+} // namespace
+
+// FixedNoise against FastNoiseLite on the same seeds: largest and mean
+// difference per configuration, GetNoiseRow() against GetNoise(), and the
+// cost of a sample each way. The host FPU is fast, so the speed-up on the
+// ESP32 is larger than measured here.
+TAMA_BENCH(fixed_noise) {
+    char line[160];
+    for (const NoiseCase& c : CASES) {
+        double worst = 0, total = 0;
+        int samples = 0;
+        srand(11);
+        for (int seed = 0; seed < 8; ++seed) {
+            FastNoiseLite reference;
+            FixedNoise fixed;
+            configure(c, reference, fixed, seed * 7919 - 20000);
+            for (int i = 0; i < 4000; ++i) {
+                float x = randomCoord(), y = randomCoord(), z = randomCoord();
+                float expected = c.is3D ? reference.GetNoise(x, y, z) : reference.GetNoise(x, y);
+                float actual = c.is3D ? fixed.GetNoise(x, y, z) : fixed.GetNoise(x, y);
+                double error = fabs((double)expected - actual);
+                worst = std::max(worst, error);
+                total += error;
+                ++samples;
+            }
+        }
+        snprintf(line, sizeof(line), "%-18s max |error| %.5f, mean %.6f over %d samples", c.name, worst,
+                 total / samples, samples);
+        bench.note(line);
+        bench.check(worst < 2e-3, "FixedNoise strays from FastNoiseLite");
+    }
+
+    // A row is the same samples as single calls, up to the rounding of the
+    // fixed-point step.
+    {
+        FastNoiseLite unused;
+        FixedNoise fixed;
+        configure(CASES[1], unused, fixed, 1234);
+        int16_t row[64];
+        double worst = 0;
+        for (int r = 0; r < 50; ++r) {
+            float x = randomCoord(), y = randomCoord();
+            bool vertical = r & 1;
+            fixed.GetNoiseRow(x, y, vertical ? 0.0f : 0.5f, vertical ? 0.5f : 0.0f, 64, row);
+            for (int i = 0; i < 64; ++i) {
+                float single = fixed.GetNoise(x + (vertical ? 0 : 0.5f * i), y + (vertical ? 0.5f * i : 0));
+                worst = std::max(worst, fabs((double)single - row[i] / (double)FixedNoise::SAMPLE_ONE));
+            }
+        }
+        snprintf(line, sizeof(line), "GetNoiseRow vs GetNoise: max |difference| %.5f", worst);
+        bench.note(line);
+        bench.check(worst < 2e-3, "GetNoiseRow differs from GetNoise");
+    }
+
+    // Fog's texture column: 37 rows of two-octave Perlin.
+    FastNoiseLite reference;
+    FixedNoise fixed;
+    configure(CASES[1], reference, fixed, 42);
+    const int ROWS = 37;
+    float column = 0;
+    bench.measure("FastNoiseLite FBm x2, 37 samples", [&] {
+        float sum = 0;
+        column += 0.16f;
+        for (int i = 0; i < ROWS; ++i) sum += reference.GetNoise(column, i * 0.08f);
+        benchKeep(&sum);
+    });
+    bench.measure("FixedNoise FBm x2, 37 samples", [&] {
+        float sum = 0;
+        column += 0.16f;
+        for (int i = 0; i < ROWS; ++i) sum += fixed.GetNoise(column, i * 0.08f);
+        benchKeep(&sum);
+    });
+    int16_t samples[ROWS];
+    bench.measure("FixedNoise FBm x2, GetNoiseRow of 37", [&] {
+        column += 0.16f;
+        fixed.GetNoiseRow(column, 0.0f, 0.0f, 0.08f, ROWS, samples);
+        benchKeep(samples);
+    });
+
+    for (const NoiseCase& c : {CASES[2], CASES[3]}) {
+        FastNoiseLite r;
+        FixedNoise f;
+        configure(c, r, f, 42);
+        float p = 0;
+        snprintf(line, sizeof(line), "FastNoiseLite %s, 37 samples", c.name);
+        bench.measure(line, [&] {
+            float sum = 0;
+            p += 0.16f;
+            for (int i = 0; i < ROWS; ++i) sum += c.is3D ? r.GetNoise(p, i * 0.5f, 3.0f) : r.GetNoise(p, i * 0.5f);
+            benchKeep(&sum);
+        });
+        snprintf(line, sizeof(line), "FixedNoise %s, 37 samples", c.name);
+        bench.measure(line, [&] {
+            float sum = 0;
+            p += 0.16f;
+            for (int i = 0; i < ROWS; ++i) sum += c.is3D ? f.GetNoise(p, i * 0.5f, 3.0f) : f.GetNoise(p, i * 0.5f);
+            benchKeep(&sum);
+        });
+    }
+}
@@ -0,0 +1,137 @@
+#include "Bench.h"
+#include "Helper/FixedNoise.h"
+#include "Helper/NoiseTileCache.h"
+
+#include <FastNoiseLite.h>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+const int WIDTH = 128;
+const int HEIGHT = 64;
+
+// The spark stage's nebula: OpenSimplex2S FBm, one sample per 2x2 cell,
+// drifting 0.15 x 0.075 px per frame.
+struct Nebula {
+    static const int CELL = 2;
+    FastNoiseLite noise;
+    float offsetX = 12.3f;
+    float offsetY = 45.6f;
+
+    Nebula() {
+        noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2S);
+        noise.SetFrequency(0.035f);
+        noise.SetFractalType(FastNoiseLite::FractalType_FBm);
+        noise.SetFractalOctaves(2);
+    }
+    void step() {
+        offsetX += 0.15f;
+        offsetY += 0.075f;
+    }
+    static float sample(void* owner, int cellX, int cellY) {
+        return static_cast<Nebula*>(owner)->noise.GetNoise((float)(cellX * CELL), (float)(cellY * CELL));
+    }
+};
+
+// The journey stage's calm current: time-varying 3D Perlin per 3x3 cell.
+struct Current {
+    static const int CELL = 3;
+    FixedNoise noise;
+    unsigned long now = 0;
+
+    Current() {
+        noise.SetNoiseType(FixedNoise::NoiseType_Perlin);
+        noise.SetFrequency(0.08f);
+    }
+    static float sample(void* owner, int cellX, int cellY) {
+        Current* current = static_cast<Current*>(owner);
+        return current->noise.GetNoise(cellX * CELL * 0.05f, cellY * CELL * 0.05f, current->now * 0.0002f);
+    }
+};
+
+} // namespace
+
+// NoiseTileCache against sampling every cell every frame, for a scrolling
+// field and a time-varying one: frame cost and tiles sampled per frame.
+TAMA_BENCH(noise_tile_cache) {
+    NoiseTileCache* tiles = NoiseTileCache::getInstance();
+    char line[128];
+
+    Nebula direct;
+    bench.measure("nebula, every cell sampled", [&] {
+        direct.step();
+        int lit = 0;
+        for (int y = 0; y < HEIGHT; y += Nebula::CELL) {
+            for (int x = 0; x < WIDTH; x += Nebula::CELL) {
+                if (direct.noise.GetNoise(x + direct.offsetX, y + direct.offsetY) > 0.55f) ++lit;
+            }
+        }
+        benchKeep(&lit);
+    });
+
+    Nebula cached;
+    int layer = tiles->addLayer(&Nebula::sample, &cached);
+    bench.check(layer >= 0, "no layer for the nebula");
+    int8_t row[128];
+    int frames = 0;
+    const int filledBefore = tiles->getTilesFilled();
+    bench.measure("nebula, NoiseTileCache", [&] {
+        cached.step();
+        ++frames;
+        tiles->beginFrame();
+        int originX = (int)floorf(cached.offsetX), originY = (int)floorf(cached.offsetY);
+        int firstX, countX, firstY, countY;
+        NoiseTileCache::visibleCells(originX, WIDTH, Nebula::CELL, firstX, countX);
+        NoiseTileCache::visibleCells(originY, HEIGHT, Nebula::CELL, firstY, countY);
+        int lit = 0;
+        for (int cellY = firstY; cellY < firstY + countY; ++cellY) {
+            tiles->getRow(layer, firstX, cellY, countX, row);
+            for (int i = 0; i < countX; ++i) lit += row[i] > 70;
+        }
+        benchKeep(&lit);
+    });
+    snprintf(line, sizeof(line), "nebula: %.2f tiles of %d cells sampled per frame",
+             (tiles->getTilesFilled() - filledBefore) / (double)frames, NoiseTileCache::TILE_CELLS * NoiseTileCache::TILE_CELLS);
+    bench.note(line);
+
+    bool matches = true;
+    for (int cellY = -20; cellY < 20 && matches; ++cellY) {
+        for (int cellX = -20; cellX < 20; ++cellX) {
+            if (tiles->get(layer, cellX, cellY) != NoiseTileCache::quantize(Nebula::sample(&cached, cellX, cellY))) {
+                matches = false;
+                break;
+            }
+        }
+    }
+    bench.check(matches, "cached nebula differs from the noise");
+    tiles->removeLayer(layer);
+
+    Current current;
+    bench.measure("current, every cell sampled", [&] {
+        current.now += 33;
+        int lit = 0;
+        for (int cellY = 0; cellY * Current::CELL < HEIGHT; ++cellY) {
+            for (int cellX = 0; cellX * Current::CELL < WIDTH; ++cellX) lit += Current::sample(&current, cellX, cellY) > 0.55f;
+        }
+        benchKeep(&lit);
+    });
+    // Invalidated every 250 ms, four tiles resampled per frame.
+    layer = tiles->addLayer(&Current::sample, &current, 4);
+    unsigned long lastRefresh = 0;
+    bench.measure("current, NoiseTileCache", [&] {
+        current.now += 33;
+        tiles->beginFrame();
+        if (current.now - lastRefresh >= 250) {
+            lastRefresh = current.now;
+            tiles->invalidate(layer);
+        }
+        int lit = 0;
+        for (int cellY = 0; cellY * Current::CELL < HEIGHT; ++cellY) {
+            tiles->getRow(layer, 0, cellY, (WIDTH + Current::CELL - 1) / Current::CELL, row);
+            for (int i = 0; i < (WIDTH + Current::CELL - 1) / Current::CELL; ++i) lit += row[i] > 70;
+        }
+        benchKeep(&lit);
+    });
+    tiles->removeLayer(layer);
+}
@@ -0,0 +1,164 @@
+#include "Bench.h"
+#include "ParticleSystem.h"
+#include "Helper/FixedTrig.h"
+
+#include <Renderer.h>
+#include <SimHost.h>
+#include <U8g2lib.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+
+namespace {
+
+const uint64_t TICK_MICROS = 1000000 / ParticleSystem::TICKS_PER_SECOND;
+
+// How ParticleSystem kept its characters before: a scan for a free slot per
+// spawn, every slot visited per update and a font set per glyph.
+struct ScanPool {
+    struct Dot {
+        bool active = false;
+        float x, y, vx, vy;
+        unsigned long spawnTime, lifetimeMs;
+        char character;
+        const uint8_t* font;
+        uint8_t drawColor;
+    };
+    const int capacity;
+    std::unique_ptr<Dot[]> dots;
+
+    explicit ScanPool(int slots) : capacity(slots), dots(new Dot[slots]) {}
+
+    void spawn(float x, float y, float vx, float vy, unsigned long lifetimeMs, char character, const uint8_t* font, uint8_t drawColor) {
+        Dot* end = dots.get() + capacity;
+        Dot* dot = std::find_if(dots.get(), end, [](const Dot& d) { return !d.active; });
+        if (dot == end) return;
+        *dot = {true, x, y, vx, vy, millis(), lifetimeMs, character, font, drawColor};
+    }
+    void update(unsigned long now) {
+        for (int i = 0; i < capacity; ++i) {
+            Dot& d = dots[i];
+            if (!d.active) continue;
+            if (now - d.spawnTime >= d.lifetimeMs) { d.active = false; continue; }
+            d.x += d.vx;
+            d.y += d.vy;
+        }
+    }
+    void draw(U8G2& u8g2) const {
+        for (int i = 0; i < capacity; ++i) {
+            const Dot& d = dots[i];
+            if (!d.active) continue;
+            u8g2.setDrawColor(d.drawColor);
+            u8g2.setFont(d.font);
+            u8g2.drawGlyph((int)round(d.x), (int)round(d.y), d.character);
+        }
+    }
+};
+
+// The absorb effect's burst: dots thrown from the source towards a target.
+template <typename Spawn>
+void absorbBurst(int size, Spawn spawn) {
+    const FixedTrig::Angle toTarget = FixedTrig::atan2(-20.0f, 40.0f);
+    for (int i = 0; i < 4 + size * 2; ++i) {
+        const FixedTrig::Angle angle = (FixedTrig::Angle)(toTarget + FixedTrig::fromDegrees((float)random(-45, 46)));
+        const float speed = 0.7f + random(0, 51) / 100.0f;
+        spawn(40.0f, 40.0f, FixedTrig::cosF(angle) * speed, FixedTrig::sinF(angle) * speed,
+              180 + random(0, 121), '.', u8g2_font_3x5im_te, 1);
+    }
+}
+
+// The journey's sparkles: a ring of glyphs in a phase's font plus the
+// player's XOR wake.
+template <typename Spawn>
+void sparkleBurst(int tick, Spawn spawn) {
+    static const char glyphs[] = {'*', '#', '~'};
+    static const uint8_t* const fonts[] = {u8g2_font_spleen5x8_mr, u8g2_font_4x6_tf, u8g2_font_spleen5x8_mr};
+    const int phase = (tick / 8) % 3;
+    for (int i = 0; i < 25; ++i) {
+        const float angle = random(0, 360) * PI / 180.0f;
+        spawn(64.0f, 32.0f, cosf(angle) * 0.8f, sinf(angle) * 0.8f, 700, glyphs[phase], fonts[phase], 1);
+    }
+    for (int i = 0; i < 4; ++i) spawn(64.0f, 32.0f, 0.3f * (i - 2), 0.2f, 300, 'o', u8g2_font_4x6_tf, 2);
+}
+
+} // namespace
+
+// Absorb and sparkle bursts at full game rate, update + draw per tick, kept
+// as before and in the pooled ParticleSystem. Then: a double-length step
+// moves particles as far as two ticks do, and full pools of both sizes
+// refuse spawns and empty once lifetimes run out.
+TAMA_BENCH(particles) {
+    sim::seedRandom(7);
+    U8G2 u8g2{U8G2_R2};
+    DisplayConfig displayConfig{SSD1306, 0, 0, 0, U8G2_R2, U8G2::WIDTH, U8G2::HEIGHT, true};
+    Renderer renderer{&u8g2, displayConfig};
+    char label[80];
+
+    for (int effect = 0; effect < 2; ++effect) {
+        const char* name = effect == 0 ? "absorb" : "sparkle";
+        int tick = 0;
+        ScanPool before(ParticleSystem::BURST_CAPACITY);
+        auto beforeSpawn = [&](float x, float y, float vx, float vy, unsigned long life, char c, const uint8_t* font, uint8_t color) {
+            before.spawn(x, y, vx, vy, life, c, font, color);
+        };
+        snprintf(label, sizeof(label), "%s, scanned slots", name);
+        bench.measure(label, [&] {
+            sim::advanceMicros(TICK_MICROS);
+            if (effect == 0) absorbBurst(++tick % 8, beforeSpawn);
+            else sparkleBurst(++tick, beforeSpawn);
+            before.update(millis());
+            before.draw(u8g2);
+            benchKeep(u8g2.getBufferPtr());
+        });
+
+        tick = 0;
+        ParticleSystem particles(renderer, u8g2_font_4x6_tf, ParticleSystem::BURST_CAPACITY);
+        auto poolSpawn = [&](float x, float y, float vx, float vy, unsigned long life, char c, const uint8_t* font, uint8_t color) {
+            particles.spawnParticle(x, y, vx, vy, life, c, font, color);
+        };
+        int mostLive = 0;
+        snprintf(label, sizeof(label), "%s, pooled", name);
+        bench.measure(label, [&] {
+            sim::advanceMicros(TICK_MICROS);
+            if (effect == 0) absorbBurst(++tick % 8, poolSpawn);
+            else sparkleBurst(++tick, poolSpawn);
+            particles.update(millis(), 1000.0f / ParticleSystem::TICKS_PER_SECOND);
+            particles.draw();
+            mostLive = std::max(mostLive, particles.activeCount());
+            benchKeep(u8g2.getBufferPtr());
+        });
+        snprintf(label, sizeof(label), "%s: up to %d live particles", name, mostLive);
+        bench.note(label);
+    }
+
+    // One 66 ms step against two 33 ms ones.
+    ParticleSystem once(renderer, u8g2_font_4x6_tf);
+    ParticleSystem twice(renderer, u8g2_font_4x6_tf);
+    once.spawnParticle(10.0f, 10.0f, 1.5f, -0.75f, 10000, '.', nullptr);
+    twice.spawnParticle(10.0f, 10.0f, 1.5f, -0.75f, 10000, '.', nullptr);
+    once.update(millis(), 66.0f);
+    twice.update(millis(), 33.0f);
+    twice.update(millis(), 33.0f);
+    u8g2.clearBuffer();
+    once.draw();
+    uint8_t first[U8G2::BUFFER_SIZE];
+    std::copy(u8g2.getBufferPtr(), u8g2.getBufferPtr() + U8G2::BUFFER_SIZE, first);
+    u8g2.clearBuffer();
+    twice.draw();
+    bench.check(std::equal(first, first + U8G2::BUFFER_SIZE, u8g2.getBufferPtr()), "motion depends on how time is split into steps");
+
+    for (int capacity : {(int)ParticleSystem::DEFAULT_CAPACITY, (int)ParticleSystem::BURST_CAPACITY}) {
+        ParticleSystem full(renderer, u8g2_font_4x6_tf, capacity);
+        int spawned = 0;
+        while (full.spawnParticle(0.0f, 0.0f, 0.0f, 0.0f, 100 + spawned % 50, '.', nullptr)) ++spawned;
+        bench.check(full.capacity() == capacity && spawned == capacity && full.activeCount() == capacity,
+                    "the pool does not hold the capacity it was given");
+        full.update(millis() + 120, 33.0f);
+        const bool someExpired = full.activeCount() > 0 && full.activeCount() < capacity;
+        full.update(millis() + 150, 33.0f);
+        bench.check(someExpired && full.activeCount() == 0, "expired particles are not released");
+        bench.check(full.spawnParticle(0.0f, 0.0f, 0.0f, 0.0f, 100, '.', nullptr), "released slots are not reused");
+    }
+}
@@ -0,0 +1,122 @@
+#include "Bench.h"
+#include "Helper/PathGenerator.h"
+#include "Helper/Rng.h"
+#include "Helper/TweenSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// How a path position was found before: the segment from uniform t, then
+// Catmull-Rom through its neighbours in floats, every frame.
+void uniformPosition(const std::vector<PathPoint>& points, float progress, float& x, float& y) {
+    const int count = (int)points.size();
+    const int segments = count - 1;
+    const float along = progress * segments;
+    const int segment = std::min((int)along, segments - 1);
+    const float t = along - segment;
+    const PathPoint& p0 = points[std::max(0, segment - 1)];
+    const PathPoint& p1 = points[segment];
+    const PathPoint& p2 = points[segment + 1];
+    const PathPoint& p3 = points[std::min(count - 1, segment + 2)];
+    const float t2 = t * t, t3 = t2 * t;
+    x = 0.5f * ((2.0f * p1.x) + (-p0.x + p2.x) * t + (2.0f * p0.x - 5.0f * p1.x + 4.0f * p2.x - p3.x) * t2 +
+                (-p0.x + 3.0f * p1.x - 3.0f * p2.x + p3.x) * t3);
+    y = 0.5f * ((2.0f * p1.y) + (-p0.y + p2.y) * t + (2.0f * p0.y - 5.0f * p1.y + 4.0f * p2.y - p3.y) * t2 +
+                (-p0.y + 3.0f * p1.y - 3.0f * p2.y + p3.y) * t3);
+}
+
+// Slowest and fastest of the equal steps of progress, by the distance
+// travelled over each, summed from SUBSTEPS short chords.
+const int STEPS = 100;
+const int SUBSTEPS = 10;
+struct Spread {
+    float slowest = 1e9f;
+    float fastest = 0.0f;
+    float travelled = 0.0f;
+    int substep = 0;
+    void add(float x0, float y0, float x1, float y1) {
+        travelled += sqrtf((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+        if (++substep < SUBSTEPS) return;
+        slowest = std::min(slowest, travelled);
+        fastest = std::max(fastest, travelled);
+        travelled = 0.0f;
+        substep = 0;
+    }
+    float ratio() const { return slowest > 0.0f ? fastest / slowest : 1e9f; }
+};
+
+} // namespace
+
+// Flying paths from PathGenerator, positioned per frame by uniform t per
+// segment as before and from the compiled arc-length samples. Then how even
+// the speed is along each: the fastest step over the slowest.
+TAMA_BENCH(paths) {
+    Rng::seedStreams(11);
+    PathGenerator generator;
+    TweenSystem* tweens = TweenSystem::getInstance();
+    std::vector<PathPoint> points;
+    unsigned long durationMs = 0;
+    char label[80];
+
+    float worstBefore = 0.0f, worstAfter = 0.0f;
+    bool endsMatch = true;
+    for (int run = 0; run < 8; ++run) {
+        if (!generator.generateFlyingPath(points, durationMs, 128, 64)) continue;
+
+        Spread before;
+        float lastX, lastY;
+        uniformPosition(points, 0.0f, lastX, lastY);
+        for (int i = 1; i <= STEPS * SUBSTEPS; ++i) {
+            float x, y;
+            uniformPosition(points, (float)i / (STEPS * SUBSTEPS), x, y);
+            before.add(lastX, lastY, x, y);
+            lastX = x;
+            lastY = y;
+        }
+
+        Spread after;
+        TweenHandle flight = tweens->startPath(points, true, STEPS * SUBSTEPS);
+        tweens->position(flight, lastX, lastY);
+        endsMatch &= lastX == points.front().x && lastY == points.front().y;
+        for (int i = 1; i < STEPS * SUBSTEPS; ++i) {
+            float x, y;
+            tweens->updateAll(1);
+            tweens->position(flight, x, y);
+            after.add(lastX, lastY, x, y);
+            lastX = x;
+            lastY = y;
+        }
+        tweens->cancel(flight);
+        worstBefore = std::max(worstBefore, before.ratio());
+        worstAfter = std::max(worstAfter, after.ratio());
+    }
+    snprintf(label, sizeof(label), "fastest step / slowest, worst path: %.1f uniform t, %.2f arc length", worstBefore, worstAfter);
+    bench.note(label);
+    bench.check(endsMatch, "a compiled path does not start at its first point");
+    bench.check(worstAfter < 2.0f, "flight along a compiled path is not at constant speed");
+
+    const float LOOP_MS = 3000.0f;
+    int frame = 0;
+    bench.measure("uniform t, Catmull-Rom per frame", [&] {
+        float x, y;
+        uniformPosition(points, (frame++ % 3000) / LOOP_MS, x, y);
+        benchKeep(&x);
+        benchKeep(&y);
+    });
+    TweenHandle flight = tweens->startPath(points, true, (unsigned long)LOOP_MS, 0);
+    bench.measure("arc-length samples per frame", [&] {
+        float x, y;
+        tweens->updateAll(1);
+        tweens->position(flight, x, y);
+        benchKeep(&x);
+        benchKeep(&y);
+    });
+    tweens->cancel(flight);
+    bench.measure("compiling a path, once per flight", [&] {
+        tweens->cancel(tweens->startPath(points, true, (unsigned long)LOOP_MS));
+    });
+}
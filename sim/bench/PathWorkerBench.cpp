@@ -0,0 +1,134 @@
+#include "Bench.h"
+#include "Helper/PathGenerator.h"
+#include "Helper/PathWorker.h"
+#include "Helper/Rng.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+namespace {
+
+const uint32_t SEED = 21;
+const int SCREEN_W = 128;
+const int SCREEN_H = 64;
+
+struct Flight {
+    std::vector<PathPoint> points;
+    unsigned long durationMs = 0;
+    bool generated = false;
+};
+
+bool samePath(const Flight& flight, const std::vector<PathPoint>& points, unsigned long durationMs) {
+    if (flight.points.size() != points.size() || flight.durationMs != durationMs) return false;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (flight.points[i].x != points[i].x || flight.points[i].y != points[i].y) return false;
+    }
+    return true;
+}
+
+uint64_t nowNanos() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+// What loop() pays per flying path: generating it in place, as scenes did,
+// against posting a request and taking the finished path from the worker
+// thread. Then a stress run keeping every buffer in flight, with some
+// requests cancelled, checked path for path against generation in place
+// from the same seeds.
+TAMA_BENCH(path_worker) {
+    const int PATHS = 2000;
+    char label[96];
+
+    // The reference: the paths stream's seeds, in order, generated in place.
+    Rng::seedStreams(SEED);
+    PathGenerator reference;
+    std::vector<Flight> expected(PATHS);
+    uint64_t slowest = 0;
+    for (Flight& flight : expected) {
+        const uint64_t start = nowNanos();
+        flight.generated = reference.generateFlyingPath(flight.points, flight.durationMs, SCREEN_W, SCREEN_H);
+        slowest = std::max(slowest, nowNanos() - start);
+    }
+
+    PathGenerator inPlace;
+    std::vector<PathPoint> points;
+    unsigned long durationMs = 0;
+    bench.measure("generateFlyingPath in loop()", [&] {
+        inPlace.generateFlyingPath(points, durationMs, SCREEN_W, SCREEN_H);
+        benchKeep(points.data());
+    });
+
+    snprintf(label, sizeof(label), "slowest of %d paths generated in place: %llu ns", PATHS, (unsigned long long)slowest);
+    bench.note(label);
+
+    // Not started: request() generates on the spot, in seed order.
+    Rng::seedStreams(SEED);
+    PathGenerator generator;
+    PathWorker worker(&generator);
+    bool inlineMatches = true;
+    for (int i = 0; i < 16; ++i) {
+        PathWorker::Ticket ticket = worker.request(SCREEN_W, SCREEN_H);
+        const bool generated = worker.take(ticket, points, durationMs);
+        inlineMatches &= ticket == PathWorker::NO_TICKET && generated == expected[i].generated &&
+                         (!generated || samePath(expected[i], points, durationMs));
+    }
+    bench.check(inlineMatches, "paths generated in place by request() differ from generateFlyingPath()");
+
+    Rng::seedStreams(SEED);
+    bench.check(worker.begin() && worker.isRunning(), "the worker thread does not start");
+    struct InFlight {
+        PathWorker::Ticket ticket;
+        int index;
+    };
+    std::deque<InFlight> inFlight;
+    int requested = 0, completed = 0, mismatches = 0, refused = 0;
+    uint64_t loopNanos = 0;
+    while (requested < PATHS || !inFlight.empty()) {
+        while (requested < PATHS) {
+            const uint64_t start = nowNanos();
+            PathWorker::Ticket ticket = worker.request(SCREEN_W, SCREEN_H);
+            if (ticket == PathWorker::NO_TICKET) {
+                ++refused;
+                break;
+            }
+            loopNanos += nowNanos() - start;
+            if (requested % 7 == 3) worker.cancel(ticket); // Its buffer comes back once generated
+            else inFlight.push_back({ticket, requested});
+            ++requested;
+        }
+        if (inFlight.empty()) continue;
+        InFlight& oldest = inFlight.front();
+        const uint64_t start = nowNanos();
+        const bool generated = worker.take(oldest.ticket, points, durationMs);
+        if (oldest.ticket != PathWorker::NO_TICKET) continue; // Still being generated
+        loopNanos += nowNanos() - start;
+        const Flight& want = expected[oldest.index];
+        if (generated != want.generated || (generated && !samePath(want, points, durationMs))) ++mismatches;
+        ++completed;
+        inFlight.pop_front();
+    }
+    worker.end();
+    snprintf(label, sizeof(label), "%d paths through the worker, %d cancelled, %d requests refused with every buffer out",
+             completed, requested - completed, refused);
+    bench.note(label);
+    snprintf(label, sizeof(label), "loop() side: %.0f ns per path in request() and take()", (double)loopNanos / requested);
+    bench.note(label);
+    bench.check(mismatches == 0, "paths from the worker differ from generation in place");
+    bench.check(requested == PATHS && refused > 0, "the stress run did not keep every buffer in flight");
+
+    // Every buffer, cancelled ones included, is back in the pool.
+    PathWorker::Ticket tickets[PathWorker::BUFFERS];
+    bool allFree = true;
+    for (PathWorker::Ticket& ticket : tickets) {
+        ticket = worker.request(SCREEN_W, SCREEN_H);
+        allFree &= ticket != PathWorker::NO_TICKET;
+    }
+    bench.check(allFree, "buffers leak after cancel() and end()");
+    for (PathWorker::Ticket& ticket : tickets) worker.cancel(ticket);
+}
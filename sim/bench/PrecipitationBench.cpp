@@ -0,0 +1,105 @@
+#include "Bench.h"
+#include "Helper/FrameBufferView.h"
+#include "Weather/Effects/Precipitation.h"
+
+#include <Renderer.h>
+#include <SimHost.h>
+#include <U8g2lib.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+const float WIND = 1.6f;
+
+// How the rain effects kept their drops before: an array of structs, a
+// rounded wind step and random() per respawn, drawn drop by drop.
+struct DropArray {
+    struct RainDrop { int x; int y; int speed; };
+    std::unique_ptr<RainDrop[]> drops;
+    int count;
+
+    explicit DropArray(int n) : drops(new RainDrop[n]), count(n) {
+        for (int i = 0; i < n; ++i) drops[i] = {(int)random(0, 128), (int)random(-64, -5), (int)random(2, 5)};
+    }
+    void update() {
+        for (int i = 0; i < count; ++i) {
+            RainDrop& drop = drops[i];
+            drop.y += std::abs(drop.speed) * 2;
+            drop.x += static_cast<int>(round(WIND * 2 * 0.7f));
+            if (drop.y > 64 || drop.x < -10 || drop.x > 138) {
+                drop.x = (int)random(0, 128);
+                drop.y = -(int)random(5, 30);
+                drop.speed = (int)random(2, 5);
+            }
+        }
+    }
+    void draw(FrameBufferView& view) const {
+        for (int i = 0; i < count; ++i) {
+            int y1 = drops[i].y, y2 = y1 + 3;
+            if (drops[i].x < 0 || drops[i].x >= 128 || y2 < 0 || y1 >= 64) continue;
+            int top = std::max(0, y1);
+            view.vSpan(drops[i].x, top, std::min(63, y2) - top + 1, FrameBufferView::XOR);
+        }
+    }
+};
+
+Precipitation::Config stormRain(int maxParticles) {
+    Precipitation::Config config = {};
+    config.maxParticles = maxParticles;
+    config.speedMin = 2;
+    config.speedMax = 5;
+    config.speedUnit = 2.0f;
+    config.driftMin = 1;
+    config.driftMax = 2;
+    config.variants = 1;
+    config.respawnTop = -29;
+    config.respawnBottom = -5;
+    config.sideMargin = 10;
+    return config;
+}
+
+} // namespace
+
+// The storm's rain, update and draw, kept as before and in Precipitation,
+// at the old cap of 30 drops and at larger ones.
+TAMA_BENCH(precipitation) {
+    sim::seedRandom(3);
+    U8G2 u8g2{U8G2_R2};
+    DisplayConfig displayConfig{SSD1306, 0, 0, 0, U8G2_R2, U8G2::WIDTH, U8G2::HEIGHT, true};
+    Renderer renderer{&u8g2, displayConfig};
+    FrameBufferView view(renderer); // The buffer stays put, so one view does
+    const int windStep = (int)round(WIND * 2 * 0.7f) * Precipitation::ONE;
+    char label[64];
+
+    for (int drops : {30, 96, 256}) {
+        DropArray before(drops);
+        snprintf(label, sizeof(label), "%d drops, struct array", drops);
+        bench.measure(label, [&] {
+            before.update();
+            before.draw(view);
+            benchKeep(u8g2.getBufferPtr());
+        });
+
+        Precipitation rain(stormRain(drops));
+        bench.check(rain.init(U8G2::WIDTH, U8G2::HEIGHT), "no memory for the drops");
+        snprintf(label, sizeof(label), "%d drops, Precipitation", drops);
+        bench.measure(label, [&] {
+            rain.update(drops, windStep);
+            rain.drawSpans(view, drops, 4, FrameBufferView::XOR);
+            benchKeep(u8g2.getBufferPtr());
+        });
+
+        // The batched spans put down the same pixels as one vSpan a drop.
+        static uint8_t reference[U8G2::BUFFER_SIZE];
+        u8g2.clearBuffer();
+        for (int i = 0; i < drops; ++i) view.vSpan(rain.pixelX(i), rain.pixelY(i), 4, FrameBufferView::XOR);
+        memcpy(reference, u8g2.getBufferPtr(), sizeof(reference));
+        u8g2.clearBuffer();
+        rain.drawSpans(view, drops, 4, FrameBufferView::XOR);
+        bench.check(memcmp(reference, u8g2.getBufferPtr(), sizeof(reference)) == 0, "drawSpans differs from vSpan");
+    }
+}
@@ -0,0 +1,63 @@
+#include "Bench.h"
+#include "Helper/Rng.h"
+
+#include <Arduino.h>
+#include <SimHost.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+// Rng against Arduino's random() for the bounded draws the effects make,
+// and a check that the ranges stay in bounds and come out even.
+TAMA_BENCH(rng) {
+    sim::seedRandom(5);
+    bench.measure("random(100)", [&] {
+        long sum = 0;
+        for (int i = 0; i < 64; ++i) sum += random(100);
+        benchKeep(&sum);
+    });
+    Rng rng(5);
+    bench.measure("Rng::below(100)", [&] {
+        uint32_t sum = 0;
+        for (int i = 0; i < 64; ++i) sum += rng.below(100);
+        benchKeep(&sum);
+    });
+    bench.measure("random(-20, -5)", [&] {
+        long sum = 0;
+        for (int i = 0; i < 64; ++i) sum += random(-20, -5);
+        benchKeep(&sum);
+    });
+    bench.measure("Rng::range(-20, -5)", [&] {
+        int32_t sum = 0;
+        for (int i = 0; i < 64; ++i) sum += rng.range(-20, -5);
+        benchKeep(&sum);
+    });
+
+    // Seven buckets, 700000 draws: each should get close to 100000.
+    int counts[7] = {};
+    bool inRange = true;
+    for (int i = 0; i < 700000; ++i) {
+        int32_t v = rng.range(-3, 4);
+        if (v < -3 || v > 3) inRange = false;
+        else ++counts[v + 3];
+    }
+    bench.check(inRange, "Rng::range() left its range");
+    int worst = 0;
+    for (int count : counts) worst = std::max(worst, std::abs(count - 100000));
+    char line[64];
+    snprintf(line, sizeof(line), "range(-3, 4) over 700000 draws: worst bucket off by %d", worst);
+    bench.note(line);
+    bench.check(worst < 2000, "Rng::range() is uneven");
+    bench.check(rng.below(0) == 0 && rng.range(5, 5) == 5, "empty ranges");
+
+    // The same stream seed gives every instance the same sequence again.
+    Rng::seedStreams(42);
+    Rng first;
+    first.seedFrom(Rng::STREAM_FOG);
+    Rng::seedStreams(42);
+    Rng second;
+    second.seedFrom(Rng::STREAM_FOG);
+    bool same = true;
+    for (int i = 0; i < 1000; ++i) same &= first.next() == second.next();
+    bench.check(same, "reseeded streams differ");
+}
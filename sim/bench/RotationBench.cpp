@@ -0,0 +1,101 @@
+#include "Bench.h"
+#include "Helper/RotationSpriteCache.h"
+
+#include <U8g2lib.h>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+const int SPRITE_SIZE = 32; // CHARACTER_WIDTH x CHARACTER_HEIGHT
+const size_t SPRITE_BYTES = SPRITE_SIZE * SPRITE_SIZE / 8;
+
+// The forward-mapping loop Animator::drawRotatedBitmap used before the cache.
+void drawRotatedPerPixel(U8G2& u8g2, const uint8_t* bitmap, int width, int height, float pivotX, float pivotY,
+                         float angle, float x, float y) {
+    float angleRad = radians(angle);
+    float cosAngle = cos(angleRad);
+    float sinAngle = sin(angleRad);
+    for (int sy = 0; sy < height; ++sy) {
+        for (int sx = 0; sx < width; ++sx) {
+            if ((bitmap[sy * ((width + 7) / 8) + sx / 8] >> (sx % 8)) & 0x01) {
+                float tx = static_cast<float>(sx) - pivotX;
+                float ty = static_cast<float>(sy) - pivotY;
+                float rx = tx * cosAngle - ty * sinAngle;
+                float ry = tx * sinAngle + ty * cosAngle;
+                u8g2.drawPixel(static_cast<int>(round(rx + pivotX + x)), static_cast<int>(round(ry + pivotY + y)));
+            }
+        }
+    }
+}
+
+void drawRotatedCached(U8G2& u8g2, const uint8_t* bitmap, int width, int height, float pivotX, float pivotY,
+                       float angle, float x, float y) {
+    RotationSpriteCache::Sprite sprite;
+    if (!RotationSpriteCache::getInstance()->get(bitmap, width, height, pivotX, pivotY, angle, sprite)) return;
+    u8g2.setBitmapMode(1);
+    u8g2.drawXBM(static_cast<int>(round(x)) + sprite.offsetX, static_cast<int>(round(y)) + sprite.offsetY,
+                 sprite.width, sprite.height, sprite.bits);
+    u8g2.setBitmapMode(0);
+}
+
+size_t countSetPixels(U8G2& u8g2) {
+    size_t count = 0;
+    const uint8_t* buffer = u8g2.getBufferPtr();
+    for (size_t i = 0; i < U8G2::BUFFER_SIZE; ++i) count += __builtin_popcount(buffer[i]);
+    return count;
+}
+
+} // namespace
+
+TAMA_BENCH(rotated_sprite) {
+    // A filled egg, roughly the size and shape of the character.
+    static uint8_t sprite[SPRITE_BYTES];
+    memset(sprite, 0, sizeof(sprite));
+    for (int y = 0; y < SPRITE_SIZE; ++y) {
+        for (int x = 0; x < SPRITE_SIZE; ++x) {
+            float dx = (x - 15.5f) / 13.0f;
+            float dy = (y - 17.5f) / (y < 17 ? 16.0f : 14.0f);
+            if (dx * dx + dy * dy <= 1.0f) sprite[y * (SPRITE_SIZE / 8) + x / 8] |= (uint8_t)(1 << (x % 8));
+        }
+    }
+    // IdleAnimationController's lean: pivot at the bottom centre, up to 10 degrees.
+    const float pivotX = SPRITE_SIZE / 2.0f;
+    const float pivotY = SPRITE_SIZE;
+    const float x = 48.0f;
+    const float y = 20.0f;
+
+    U8G2 reference;
+    U8G2 cached;
+    reference.clearBuffer();
+    cached.clearBuffer();
+    drawRotatedPerPixel(reference, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, 0.0f, x, y);
+    drawRotatedCached(cached, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, 0.0f, x, y);
+    bench.check(memcmp(reference.getBufferPtr(), cached.getBufferPtr(), U8G2::BUFFER_SIZE) == 0,
+                "cached sprite differs from per-pixel drawing at 0 degrees");
+
+    bool noHoles = true;
+    for (int step = 1; step <= 10; ++step) {
+        reference.clearBuffer();
+        cached.clearBuffer();
+        drawRotatedPerPixel(reference, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, (float)step, x, y);
+        drawRotatedCached(cached, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, (float)step, x, y);
+        if (countSetPixels(cached) < countSetPixels(reference)) noHoles = false;
+    }
+    bench.check(noHoles, "cached sprite has fewer pixels than forward mapping");
+
+    // One lean frame: the angle moves a little every frame.
+    int frame = 0;
+    bench.measure("per-pixel sin/cos (previous), 32x32", [&] {
+        float angle = (frame++ % 24) * 10.0f / 24.0f;
+        drawRotatedPerPixel(reference, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, angle, x, y);
+        benchKeep(reference.getBufferPtr());
+    });
+    frame = 0;
+    bench.measure("cached pre-rotated blit, 32x32", [&] {
+        float angle = (frame++ % 24) * 10.0f / 24.0f;
+        drawRotatedCached(cached, sprite, SPRITE_SIZE, SPRITE_SIZE, pivotX, pivotY, angle, x, y);
+        benchKeep(cached.getBufferPtr());
+    });
+    bench.note("Rotation cache holds " + std::to_string(RotationSpriteCache::getInstance()->getBytesUsed()) + " bytes.");
+}
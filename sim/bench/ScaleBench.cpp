@@ -0,0 +1,104 @@
+#include "Bench.h"
+#include "Helper/ScaledBlitter.h"
+
+#include <U8g2lib.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const int SPRITE_SIZE = 32; // CHARACTER_WIDTH x CHARACTER_HEIGHT
+const size_t SPRITE_BYTES = SPRITE_SIZE * SPRITE_SIZE / 8;
+
+// The loop Animator::drawScaledBitmap used before ScaledBlitter: a float
+// divide, floor and bounds test for every destination pixel.
+void drawScaledPerPixel(U8G2& u8g2, const uint8_t* bitmap, int width, int height, float scale, int drawX, int drawY) {
+    int scaledW = static_cast<int>(round(width * scale));
+    int scaledH = static_cast<int>(round(height * scale));
+    for (int destY = drawY; destY < drawY + scaledH; ++destY) {
+        for (int destX = drawX; destX < drawX + scaledW; ++destX) {
+            if (destX < 0 || destX >= U8G2::WIDTH || destY < 0 || destY >= U8G2::HEIGHT) continue;
+            int srcX = static_cast<int>(floor(static_cast<float>(destX - drawX) / scale));
+            int srcY = static_cast<int>(floor(static_cast<float>(destY - drawY) / scale));
+            if (srcX >= 0 && srcX < width && srcY >= 0 && srcY < height) {
+                if ((bitmap[srcY * ((width + 7) / 8) + srcX / 8] >> (srcX % 8)) & 0x01) u8g2.drawPixel(destX, destY);
+            }
+        }
+    }
+}
+
+// Centred on the same point at every scale, as the action menu draws a click.
+void placement(float scale, int& x, int& y) {
+    int scaledW = static_cast<int>(round(SPRITE_SIZE * scale));
+    int scaledH = static_cast<int>(round(SPRITE_SIZE * scale));
+    x = 64 - scaledW / 2 + 3;
+    y = 32 - scaledH / 2 + 1;
+}
+
+} // namespace
+
+TAMA_BENCH(scaled_sprite) {
+    // A filled egg with a hole and a few odd bits, so every row and column differs.
+    static uint8_t sprite[SPRITE_BYTES];
+    memset(sprite, 0, sizeof(sprite));
+    for (int y = 0; y < SPRITE_SIZE; ++y) {
+        for (int x = 0; x < SPRITE_SIZE; ++x) {
+            float dx = (x - 15.5f) / 13.0f;
+            float dy = (y - 17.5f) / (y < 17 ? 16.0f : 14.0f);
+            float d = dx * dx + dy * dy;
+            bool on = (d <= 1.0f && d >= 0.1f) || ((x * 7 + y * 3) % 11 == 0);
+            if (on) sprite[y * (SPRITE_SIZE / 8) + x / 8] |= (uint8_t)(1 << (x % 8));
+        }
+    }
+
+    const float scales[] = {0.5f, 0.75f, 1.0f, 1.5f, 2.0f, 3.0f, 4.0f};
+    bool matches = true;
+    for (const u8g2_cb_t* rotation : {U8G2_R0, U8G2_R2}) {
+        for (float scale : scales) {
+            for (uint8_t color = 0; color <= 2; ++color) {
+                U8G2 reference(rotation);
+                U8G2 blitted(rotation);
+                // A half-lit background so clearing and inverting are visible.
+                for (size_t i = 0; i < U8G2::BUFFER_SIZE; ++i) {
+                    reference.getBufferPtr()[i] = blitted.getBufferPtr()[i] = (uint8_t)(i * 37);
+                }
+                reference.setDrawColor(color);
+                blitted.setDrawColor(color);
+                int x, y;
+                placement(scale, x, y);
+                drawScaledPerPixel(reference, sprite, SPRITE_SIZE, SPRITE_SIZE, scale, x, y);
+                ScaledBlitter::draw(&blitted, x, y, sprite, SPRITE_SIZE, SPRITE_SIZE, scale, 0, 0, U8G2::WIDTH,
+                                    U8G2::HEIGHT);
+                if (memcmp(reference.getBufferPtr(), blitted.getBufferPtr(), U8G2::BUFFER_SIZE) != 0) {
+                    matches = false;
+                    char line[96];
+                    snprintf(line, sizeof(line), "mismatch at %.2fx, colour %u, %s", scale, color,
+                             rotation == U8G2_R2 ? "R2" : "R0");
+                    bench.note(line);
+                }
+            }
+        }
+    }
+    bench.check(matches, "ScaledBlitter differs from per-pixel scaling");
+
+    // Timed in the rotation the device uses.
+    U8G2 u8g2(U8G2_R2);
+    char label[64];
+    for (float scale : scales) {
+        int x, y;
+        placement(scale, x, y);
+        snprintf(label, sizeof(label), "per-pixel float (previous), %.2fx", scale);
+        double previousNs = bench.measure(label, [&] {
+            drawScaledPerPixel(u8g2, sprite, SPRITE_SIZE, SPRITE_SIZE, scale, x, y);
+            benchKeep(u8g2.getBufferPtr());
+        });
+        snprintf(label, sizeof(label), "ScaledBlitter 16.16 page bytes, %.2fx", scale);
+        double blitNs = bench.measure(label, [&] {
+            ScaledBlitter::draw(&u8g2, x, y, sprite, SPRITE_SIZE, SPRITE_SIZE, scale, 0, 0, U8G2::WIDTH, U8G2::HEIGHT);
+            benchKeep(u8g2.getBufferPtr());
+        });
+        snprintf(label, sizeof(label), "%.2fx: ScaledBlitter %.1fx faster", scale, previousNs / blitNs);
+        bench.note(label);
+    }
+}
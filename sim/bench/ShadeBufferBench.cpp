@@ -0,0 +1,78 @@
+#include "Bench.h"
+#include "Helper/FrameBufferView.h"
+#include "Helper/ShadeBuffer.h"
+
+#include <Renderer.h>
+#include <U8g2lib.h>
+#include <cstdio>
+
+namespace {
+
+int litPixels(U8G2& u8g2) {
+    int lit = 0;
+    for (size_t i = 0; i < U8G2::BUFFER_SIZE; ++i) lit += __builtin_popcount(u8g2.getBufferPtr()[i]);
+    return lit;
+}
+
+} // namespace
+
+// The cost of a fog-sized picture, filled by cells or by columns, and the dither itself: every shade lights
+// as many pixels of an 8x8 block as it should, and a picture drawn twice
+// with XOR cancels out (the same pixels both times).
+TAMA_BENCH(shade_buffer) {
+    U8G2 u8g2{U8G2_R2};
+    DisplayConfig config{SSD1306, 0, 0, 0, U8G2_R2, U8G2::WIDTH, U8G2::HEIGHT, true};
+    Renderer renderer{&u8g2, config};
+    FrameBufferView view(renderer);
+    ShadeBuffer* shades = ShadeBuffer::getInstance();
+    bench.check(shades->acquire(), "no shade buffer");
+
+    // Fog: 2x2 cells over the lower 37 rows.
+    bench.measure("begin + fill 64x19 cells", [&] {
+        shades->begin();
+        for (int x = 0; x < 128; x += 2) {
+            for (int y = 27; y < 64; y += 2) shades->fill(x, y, 2, 2, (uint8_t)(x + y * 3));
+        }
+        benchKeep(shades);
+    });
+    // The same picture a column at a time, as the fog draws it.
+    bench.measure("begin + column 128x37", [&] {
+        shades->begin();
+        uint8_t column[37];
+        for (int x = 0; x < 128; ++x) {
+            for (int y = 0; y < 37; ++y) column[y] = (uint8_t)((x & ~1) + ((y + 27) & ~1) * 3);
+            shades->column(x, 27, column, 37);
+        }
+        benchKeep(shades);
+    });
+    bench.measure("quantize 128x37", [&] {
+        shades->quantize(view, FrameBufferView::XOR);
+        benchKeep(u8g2.getBufferPtr());
+    });
+
+    bool counts = true;
+    for (int shade = 0; shade < 256 && counts; ++shade) {
+        u8g2.clearBuffer();
+        shades->begin();
+        shades->fill(8, 16, 8, 8, (uint8_t)shade);
+        shades->quantize(view, FrameBufferView::SET);
+        int expected = 0;
+        for (int k = 0; k < 64; ++k) expected += 4 * k + 2 < shade;
+        if (litPixels(u8g2) != expected) {
+            char line[64];
+            snprintf(line, sizeof(line), "shade %d: %d pixels lit, expected %d", shade, litPixels(u8g2), expected);
+            bench.note(line);
+            counts = false;
+        }
+    }
+    bench.check(counts, "dithered shades light the wrong number of pixels");
+
+    u8g2.clearBuffer();
+    shades->begin();
+    for (int x = 0; x < 128; ++x) shades->vSpan(x, x / 3, 20, (uint8_t)(x * 2));
+    shades->quantize(view, FrameBufferView::XOR);
+    const bool drew = litPixels(u8g2) > 0;
+    shades->quantize(view, FrameBufferView::XOR);
+    bench.check(drew && litPixels(u8g2) == 0, "the same shades dithered differently");
+    shades->release();
+}
@@ -0,0 +1,50 @@
+#include "Bench.h"
+#include "System/ScreenStreamer.h"
+
+#include <cstring>
+#include <random>
+
+namespace {
+
+const int WIDTH = 128;
+const int HEIGHT = 64;
+const size_t FRAME_SIZE = WIDTH * HEIGHT / 8;
+
+// The per-pixel rotation ScreenStreamer used before the byte/LUT version.
+void flipPerPixel(const uint8_t* src, uint8_t* dest, int width, int height) {
+    memset(dest, 0, (size_t)(width * height) / 8);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (src[(y / 8) * width + x] & (1 << (y % 8))) {
+                int dest_y = height - 1 - y;
+                dest[(dest_y / 8) * width + (width - 1 - x)] |= (1 << (dest_y % 8));
+            }
+        }
+    }
+}
+
+} // namespace
+
+TAMA_BENCH(flip180) {
+    uint8_t src[FRAME_SIZE];
+    uint8_t expected[FRAME_SIZE];
+    uint8_t actual[FRAME_SIZE];
+    std::mt19937 rng(1);
+    for (size_t i = 0; i < FRAME_SIZE; i++) src[i] = (uint8_t)rng();
+
+    flipPerPixel(src, expected, WIDTH, HEIGHT);
+    ScreenStreamer::flipBuffer180(src, actual, WIDTH, HEIGHT);
+    bench.check(memcmp(expected, actual, FRAME_SIZE) == 0, "flipBuffer180 differs from the per-pixel rotation");
+
+    double before = bench.measure("per-pixel (previous)", [&] {
+        flipPerPixel(src, actual, WIDTH, HEIGHT);
+        benchKeep(actual);
+    });
+    double after = bench.measure("ScreenStreamer::flipBuffer180", [&] {
+        ScreenStreamer::flipBuffer180(src, actual, WIDTH, HEIGHT);
+        benchKeep(actual);
+    });
+    char line[128];
+    snprintf(line, sizeof(line), "saved per streamed frame: %.1f us on this host", (before - after) / 1000.0);
+    bench.note(line);
+}
@@ -0,0 +1,124 @@
+#include "Bench.h"
+#include "Helper/FixedTrig.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+double angleError(FixedTrig::Angle actual, double expectedRadians) {
+    double difference = FixedTrig::toRadians(actual) - expectedRadians;
+    while (difference > M_PI) difference -= 2 * M_PI;
+    while (difference < -M_PI) difference += 2 * M_PI;
+    return fabs(difference);
+}
+
+} // namespace
+
+// FixedTrig against libm: sin/cos over every angle, atan2 over random
+// vectors, and the trig the aurora and sunny effects do per frame, each way.
+TAMA_BENCH(fixed_trig) {
+    char line[128];
+    double worstSin = 0, worstCos = 0;
+    for (uint32_t a = 0; a < 65536; ++a) {
+        double radians = a * (2 * M_PI / 65536);
+        worstSin = std::max(worstSin, fabs(FixedTrig::sin((FixedTrig::Angle)a) / (double)FixedTrig::ONE - ::sin(radians)));
+        worstCos = std::max(worstCos, fabs(FixedTrig::cos((FixedTrig::Angle)a) / (double)FixedTrig::ONE - ::cos(radians)));
+    }
+    snprintf(line, sizeof(line), "sin max |error| %.6f, cos %.6f over every angle", worstSin, worstCos);
+    bench.note(line);
+    bench.check(worstSin < 1e-4 && worstCos < 1e-4, "FixedTrig sin/cos strays from libm");
+
+    double worstInt = 0, worstFloat = 0;
+    srand(5);
+    for (int i = 0; i < 200000; ++i) {
+        int32_t x = rand() % 4001 - 2000, y = rand() % 4001 - 2000;
+        if (x == 0 && y == 0) continue;
+        double expected = ::atan2((double)y, (double)x);
+        worstInt = std::max(worstInt, angleError(FixedTrig::atan2(y, x), expected));
+        float fx = x * 0.013f, fy = y * 0.013f;
+        worstFloat = std::max(worstFloat, angleError(FixedTrig::atan2(fy, fx), ::atan2((double)fy, (double)fx)));
+    }
+    snprintf(line, sizeof(line), "atan2 max |error| %.6f rad (int), %.6f rad (float)", worstInt, worstFloat);
+    bench.note(line);
+    // One angle unit is 9.6e-5 rad; the result is rounded to it.
+    bench.check(worstInt < 2e-4 && worstFloat < 2e-4, "FixedTrig atan2 strays from libm");
+    bench.check(FixedTrig::atan2(0, 0) == 0 && FixedTrig::atan2(0, -5) == FixedTrig::HALF_TURN &&
+                    FixedTrig::atan2(-3, 0) == (FixedTrig::Angle)(0 - FixedTrig::QUARTER_TURN),
+                "FixedTrig atan2 axes");
+
+    // AuroraWeatherEffect::drawBackground: three curtains, one sample per column.
+    float timeOffset = 0;
+    bench.measure("aurora curtains, libm sin", [&] {
+        float sum = 0;
+        timeOffset += 0.05f;
+        for (int curtain = 0; curtain < 3; ++curtain) {
+            float frequency = 0.04f + curtain * 0.02f;
+            for (float x = 0; x < 128; x += 1.0f) sum += sin(x * frequency + timeOffset) * 8.0f;
+        }
+        benchKeep(&sum);
+    });
+    bench.measure("aurora curtains, FixedTrig", [&] {
+        float sum = 0;
+        timeOffset += 0.05f;
+        for (int curtain = 0; curtain < 3; ++curtain) {
+            float frequency = 0.04f + curtain * 0.02f;
+            uint32_t phase = (uint32_t)FixedTrig::fromRadians(timeOffset) << 8;
+            const uint32_t phaseStep = (uint32_t)lroundf(frequency * FixedTrig::UNITS_PER_RADIAN * 256.0f);
+            for (int x = 0; x < 128; ++x, phase += phaseStep) sum += FixedTrig::sinF((FixedTrig::Angle)(phase >> 8)) * 8.0f;
+        }
+        benchKeep(&sum);
+    });
+
+    // SunnyWeatherEffect::drawBackground: eight rays, a wobble and two ends each.
+    float rayPhase = 0;
+    bench.measure("sun rays, libm sin/cos", [&] {
+        float sum = 0;
+        rayPhase += 0.1f;
+        for (int i = 0; i < 8; ++i) {
+            float angle = (float)(2 * M_PI / 8) * i + rayPhase;
+            float wobble = 3.0f * sin(rayPhase * 2.5f + i * 0.7f);
+            sum += round(cos(angle) * 9) + round(sin(angle) * 9) + round(cos(angle) * (14 + wobble)) +
+                   round(sin(angle) * (14 + wobble));
+        }
+        benchKeep(&sum);
+    });
+    bench.measure("sun rays, FixedTrig", [&] {
+        float sum = 0;
+        rayPhase += 0.1f;
+        const FixedTrig::Angle base = FixedTrig::fromRadians(rayPhase);
+        const FixedTrig::Angle wobblePhase = FixedTrig::fromRadians(rayPhase * 2.5f);
+        const FixedTrig::Angle wobbleStep = FixedTrig::fromRadians(0.7f);
+        for (int i = 0; i < 8; ++i) {
+            FixedTrig::Angle angle = (FixedTrig::Angle)(base + (uint32_t)i * 65536u / 8);
+            float wobble = 3.0f * FixedTrig::sinF((FixedTrig::Angle)(wobblePhase + i * wobbleStep));
+            float c = FixedTrig::cosF(angle), s = FixedTrig::sinF(angle);
+            sum += round(c * 9) + round(s * 9) + round(c * (14 + wobble)) + round(s * (14 + wobble));
+        }
+        benchKeep(&sum);
+    });
+
+    // ParticleSystem::spawnAbsorbEffect: one atan2, then sin/cos per particle.
+    float target = 0;
+    bench.measure("absorb burst of 10, libm", [&] {
+        float sum = 0;
+        target += 0.37f;
+        float toTarget = atan2(target - 20.0f, 64.0f - target);
+        for (int i = 0; i < 10; ++i) {
+            float angle = toTarget + (i * 9 - 45) * (float)M_PI / 180.0f;
+            sum += cos(angle) + sin(angle);
+        }
+        benchKeep(&sum);
+    });
+    bench.measure("absorb burst of 10, FixedTrig", [&] {
+        float sum = 0;
+        target += 0.37f;
+        FixedTrig::Angle toTarget = FixedTrig::atan2(target - 20.0f, 64.0f - target);
+        for (int i = 0; i < 10; ++i) {
+            FixedTrig::Angle angle = (FixedTrig::Angle)(toTarget + FixedTrig::fromDegrees((float)(i * 9 - 45)));
+            sum += FixedTrig::cosF(angle) + FixedTrig::sinF(angle);
+        }
+        benchKeep(&sum);
+    });
+}
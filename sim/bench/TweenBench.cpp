@@ -0,0 +1,207 @@
+#include "Bench.h"
+#include "Helper/TweenSystem.h"
+
+#include <SimHost.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+
+const uint64_t FRAME_MICROS = 1000000 / 30;
+
+// How an Animator advanced before: its own clock read, float progress from
+// its start time and a switch over its type, one heap object per animation.
+struct OldAnimator {
+    enum class Type { MOVEMENT, ROTATION_MOVEMENT, SCALE };
+    enum class State { FORWARD, PAUSED_BEFORE_REVERSE, REVERSING, FINISHED };
+    Type type;
+    State state = State::FORWARD;
+    std::vector<PathPoint> path;
+    int startX, startY, endX, endY;
+    float x = 0, y = 0, startAngle = 0, endAngle = 0, angle = 0, startScale = 1, endScale = 1, scale = 1;
+    unsigned long duration, reverseDelay, startTime, pauseStart = 0;
+    bool reverse;
+
+    OldAnimator(Type t, unsigned long d, bool r)
+        : type(t), startX(0), startY(0), endX(20), endY(10), endAngle(10), endScale(1.2f),
+          duration(d), reverseDelay(r ? 200 : 0), startTime(millis()), reverse(r) {}
+
+    bool update() {
+        if (state == State::FINISHED) return false;
+        unsigned long now = millis();
+        if (state == State::PAUSED_BEFORE_REVERSE) {
+            if (now - pauseStart < reverseDelay) return true;
+            state = State::REVERSING;
+            startTime = now;
+            std::swap(startX, endX); std::swap(startY, endY);
+            std::swap(startAngle, endAngle); std::swap(startScale, endScale);
+        }
+        unsigned long elapsed = now - startTime;
+        bool done = elapsed >= duration;
+        float progress = done ? 1.0f : (float)elapsed / (float)duration;
+        switch (type) {
+        case Type::MOVEMENT:
+        case Type::ROTATION_MOVEMENT:
+            x = startX + (endX - startX) * progress;
+            y = startY + (endY - startY) * progress;
+            if (type == Type::ROTATION_MOVEMENT) angle = startAngle + (endAngle - startAngle) * progress;
+            break;
+        case Type::SCALE:
+            scale = startScale + (endScale - startScale) * progress;
+            break;
+        }
+        if (!done) return true;
+        if (state == State::FORWARD && reverse) {
+            state = State::PAUSED_BEFORE_REVERSE;
+            pauseStart = now;
+            return true;
+        }
+        state = State::FINISHED;
+        return false;
+    }
+};
+
+struct Events {
+    int completions = 0;
+    TweenHandle last = NO_TWEEN;
+};
+
+// Keeps the pool full: every tween that completes is replaced.
+void restartTween(void* owner, TweenHandle) {
+    TweenSystem::Spec spec = TweenSystem::move(0, 0, 20, 10, 400, TweenSystem::EASE_IN_OUT);
+    spec.yoyo = true;
+    TweenSystem::getInstance()->start(spec, owner, restartTween);
+}
+
+bool near(float a, float b) {
+    return std::fabs(a - b) < 0.01f;
+}
+
+void countCompletion(void* owner, TweenHandle tween) {
+    Events* events = static_cast<Events*>(owner);
+    ++events->completions;
+    events->last = tween;
+}
+
+// Cancels another tween when it completes.
+struct Canceller {
+    TweenHandle victim = NO_TWEEN;
+};
+
+void cancelVictim(void* owner, TweenHandle) {
+    TweenSystem::getInstance()->cancel(static_cast<Canceller*>(owner)->victim);
+}
+
+} // namespace
+
+// A frame of a dozen animations the old way (each a heap object created when
+// it starts, restarted as it finishes) against a frame of MAX_TWEENS tweens
+// in one updateAll(), most running until cancelled like the quanta pulses. Then the behaviour scenes rely on: completion
+// callbacks, queued tweens, yoyo with a hold, delays, stale handles and a
+// full pool.
+TAMA_BENCH(tweens) {
+    TweenSystem* tweens = TweenSystem::getInstance();
+    Events owner;
+    char label[80];
+
+    const int OLD_COUNT = 12;
+    std::vector<std::unique_ptr<OldAnimator>> animators;
+    auto restart = [&](int i) {
+        const OldAnimator::Type type = (OldAnimator::Type)(i % 3);
+        animators[i].reset(new OldAnimator(type, 300 + 40 * i, i % 2 == 0));
+    };
+    animators.resize(OLD_COUNT);
+    for (int i = 0; i < OLD_COUNT; ++i) restart(i);
+    snprintf(label, sizeof(label), "%d animators, per object", OLD_COUNT);
+    const double perAnimator = bench.measure(label, [&] {
+        sim::advanceMicros(FRAME_MICROS);
+        for (int i = 0; i < OLD_COUNT; ++i) {
+            if (!animators[i]->update()) restart(i);
+            benchKeep(animators[i].get());
+        }
+    });
+
+    for (int i = 0; i < TweenSystem::MAX_TWEENS; ++i) {
+        TweenSystem::Spec spec = TweenSystem::move(0, 0, 20, 10, 300 + i, (TweenSystem::Easing)(i % TweenSystem::EASING_COUNT));
+        spec.yoyo = i % 2 == 0;
+        spec.holdMs = 200;
+        spec.cycles = i % 4 == 0 ? 1 : 0; // A quarter complete and are replaced
+        tweens->start(spec, &animators, restartTween);
+    }
+    const int live = tweens->activeCount();
+    snprintf(label, sizeof(label), "%d tweens, updateAll", live);
+    const double perPool = bench.measure(label, [&] {
+        tweens->updateAll(FRAME_MICROS / 1000);
+        benchKeep(tweens);
+    });
+    snprintf(label, sizeof(label), "per animation: %.1f ns as an object, %.1f ns as a tween",
+             perAnimator / OLD_COUNT, perPool / live);
+    bench.note(label);
+    bench.check(live == TweenSystem::MAX_TWEENS && tweens->activeCount() == live, "restarted tweens do not keep the pool full");
+    bench.check(tweens->start(TweenSystem::value(0, 1, 100)) == NO_TWEEN, "a full pool hands out a tween");
+    tweens->cancelOwnedBy(&animators);
+    bench.check(tweens->activeCount() == 0, "cancelOwnedBy() leaves tweens behind");
+
+    // Completion and queueing.
+    TweenHandle first = tweens->start(TweenSystem::value(0, 10, 100), &owner, countCompletion);
+    TweenHandle second = tweens->startAfter(first, TweenSystem::value(5, 6, 50), &owner, countCompletion);
+    tweens->updateAll(60);
+    bench.check(near(tweens->value(first), 6.0f) && tweens->value(second) == 5.0f, "a queued tween runs before the one it waits for");
+    tweens->updateAll(60);
+    bench.check(!tweens->isActive(first) && owner.completions == 1 && owner.last == first, "completion callback not called once");
+    bench.check(tweens->value(first) == 0.0f, "a stale handle still reads its tween");
+    tweens->updateAll(50);
+    bench.check(owner.completions == 2 && owner.last == second, "a queued tween does not start when the first completes");
+
+    first = tweens->start(TweenSystem::value(0, 1, 100), &owner, countCompletion);
+    second = tweens->startAfter(first, TweenSystem::value(0, 1, 100), &owner, countCompletion);
+    tweens->cancel(first);
+    bench.check(!tweens->isActive(second) && tweens->activeCount() == 0, "cancelling a tween leaves its queue running");
+    tweens->updateAll(500);
+    bench.check(owner.completions == 2, "a cancelled tween calls back");
+
+    // Yoyo: out over 100 ms, held 50 ms, back over 100 ms.
+    TweenSystem::Spec yoyo = TweenSystem::value(0, 8, 100);
+    yoyo.yoyo = true;
+    yoyo.holdMs = 50;
+    yoyo.delayMs = 30;
+    TweenHandle bounce = tweens->start(yoyo);
+    tweens->updateAll(30);
+    const float delayed = tweens->value(bounce);
+    tweens->updateAll(100);
+    const float out = tweens->value(bounce);
+    tweens->updateAll(40);
+    const float held = tweens->value(bounce);
+    tweens->updateAll(60);
+    const float back = tweens->value(bounce);
+    tweens->updateAll(50);
+    bench.check(delayed == 0.0f && near(out, 8.0f) && near(held, 8.0f) && near(back, 4.0f), "yoyo does not go out, hold and come back");
+    bench.check(!tweens->isActive(bounce), "yoyo does not finish after its cycle");
+
+    // A callback cancelling a tween earlier in the live list moves the last
+    // live tween into its place: that one completes in the same update too.
+    Canceller canceller;
+    Events late;
+    canceller.victim = tweens->start(TweenSystem::value(0, 1, 1000));
+    TweenHandle bystander = tweens->start(TweenSystem::value(0, 1, 1000));
+    tweens->start(TweenSystem::value(0, 1, 100), &canceller, cancelVictim);
+    TweenHandle last = tweens->start(TweenSystem::value(0, 1, 100), &late, countCompletion);
+    tweens->updateAll(100);
+    bench.check(!tweens->isActive(canceller.victim) && !tweens->isActive(last) && late.completions == 1,
+                "a tween moved by a callback's cancel() misses its completion");
+    tweens->cancel(bystander);
+
+    TweenHandle frames = tweens->start(TweenSystem::frames(4, 80));
+    int seen = 0;
+    for (int t = 0; t < 4; ++t) {
+        seen |= 1 << tweens->frame(frames);
+        tweens->updateAll(80);
+    }
+    bench.check(seen == 0xF && !tweens->isActive(frames), "frames() does not show each frame once");
+
+    TweenHandle reused = tweens->start(TweenSystem::value(0, 1, 100));
+    bench.check(reused != frames && !tweens->isActive(frames), "a reused slot answers to an old handle");
+    tweens->cancel(reused);
+}
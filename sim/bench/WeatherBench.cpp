@@ -0,0 +1,89 @@
+#include "Bench.h"
+#include "System/GameContext.h"
+#include "Weather/Effects/Aurora/AuroraWeatherEffect.h"
+#include "Weather/Effects/Cloudy/CloudyWeatherEffect.h"
+#include "Weather/Effects/Fog/FogWeatherEffect.h"
+#include "Weather/Effects/Rainbow/RainbowWeatherEffect.h"
+#include "Weather/Effects/Rainy/RainyWeatherEffect.h"
+#include "Weather/Effects/Snowy/SnowyWeatherEffect.h"
+#include "Weather/Effects/Storm/StormWeatherEffect.h"
+#include "Weather/Effects/Sunny/SunnyWeatherEffect.h"
+
+#include <Renderer.h>
+#include <SimHost.h>
+#include <U8g2lib.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace {
+
+const int SETTLE_TICKS = 90; // Three seconds at 30 Hz: fades done, particles spread
+const unsigned long TICK_MS = 33;
+
+// One effect on its own, drawn as WeatherManager draws it, in the rotation
+// the device uses. Only drawing is timed; the state is settled beforehand.
+struct EffectRig {
+    U8G2 u8g2{U8G2_R2};
+    DisplayConfig config{SSD1306, 0, 0, 0, U8G2_R2, U8G2::WIDTH, U8G2::HEIGHT, true};
+    Renderer renderer{&u8g2, config};
+    GameContext context;
+
+    EffectRig() {
+        context.display = &u8g2;
+        context.renderer = &renderer;
+        context.defaultFont = u8g2_font_5x7_tf;
+    }
+};
+
+template <typename Effect, typename... Args>
+void benchEffect(BenchRunner& bench, const char* label, Args... args) {
+    sim::seedRandom(2); // randomSeed() is a no-op on the host
+    EffectRig rig;
+    std::unique_ptr<Effect> effect(new Effect(rig.context, args...));
+    effect->setParticleDensity(100);
+    effect->setWindFactor(0.4f);
+    unsigned long now = 0;
+    effect->init(now);
+    for (int i = 0; i < SETTLE_TICKS; ++i) effect->update(now += TICK_MS);
+
+    // Identical hashes before and after a change mean the effect still
+    // draws the same pixels.
+    rig.u8g2.clearBuffer();
+    effect->drawBackground();
+    effect->drawForeground();
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < U8G2::BUFFER_SIZE; ++i) hash = (hash ^ rig.u8g2.getBufferPtr()[i]) * 16777619u;
+    char line[64];
+    snprintf(line, sizeof(line), "frame hash after %d ticks: %08x", SETTLE_TICKS, (unsigned)hash);
+    bench.note(line);
+
+    bench.measure(label, [&] {
+        rig.u8g2.clearBuffer();
+        effect->drawBackground();
+        effect->drawForeground();
+        benchKeep(rig.u8g2.getBufferPtr());
+    });
+    // With the state moving on, as on the device: scrolling and respawning
+    // are counted too.
+    std::string moving = std::string(label) + ", update + draw";
+    bench.measure(moving, [&] {
+        effect->update(now += TICK_MS);
+        rig.u8g2.clearBuffer();
+        effect->drawBackground();
+        effect->drawForeground();
+        benchKeep(rig.u8g2.getBufferPtr());
+    });
+}
+
+} // namespace
+
+TAMA_BENCH(weather_rain) { benchEffect<RainyWeatherEffect>(bench, "rainy draw", false); }
+TAMA_BENCH(weather_heavy_rain) { benchEffect<RainyWeatherEffect>(bench, "heavy rain draw", true); }
+TAMA_BENCH(weather_snow) { benchEffect<SnowyWeatherEffect>(bench, "snowy draw", false); }
+TAMA_BENCH(weather_storm) { benchEffect<StormWeatherEffect>(bench, "storm draw"); }
+TAMA_BENCH(weather_aurora) { benchEffect<AuroraWeatherEffect>(bench, "aurora draw"); }
+TAMA_BENCH(weather_fog) { benchEffect<FogWeatherEffect>(bench, "fog draw"); }
+TAMA_BENCH(weather_cloudy) { benchEffect<CloudyWeatherEffect>(bench, "cloudy draw"); }
+TAMA_BENCH(weather_rainbow) { benchEffect<RainbowWeatherEffect>(bench, "rainbow draw"); }
+TAMA_BENCH(weather_sunny) { benchEffect<SunnyWeatherEffect>(bench, "sunny draw"); }
@@ -0,0 +1,35 @@
+// Host stand-in for ArduinoOTA.
+#ifndef SIM_ARDUINO_OTA_H
+#define SIM_ARDUINO_OTA_H
+
+#include <functional>
+#include "Arduino.h"
+
+typedef enum {
+    OTA_AUTH_ERROR,
+    OTA_BEGIN_ERROR,
+    OTA_CONNECT_ERROR,
+    OTA_RECEIVE_ERROR,
+    OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+    typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+    typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+
+    ArduinoOTAClass& setPort(uint16_t port) { return *this; }
+    ArduinoOTAClass& setHostname(const char* hostname) { return *this; }
+    ArduinoOTAClass& setPassword(const char* password) { return *this; }
+    ArduinoOTAClass& onStart(THandlerFunction fn) { return *this; }
+    ArduinoOTAClass& onEnd(THandlerFunction fn) { return *this; }
+    ArduinoOTAClass& onError(THandlerFunction_Error fn) { return *this; }
+    ArduinoOTAClass& onProgress(THandlerFunction_Progress fn) { return *this; }
+    void begin() {}
+    void handle() {}
+};
+
+extern ArduinoOTAClass ArduinoOTA;
+
+#endif // SIM_ARDUINO_OTA_H
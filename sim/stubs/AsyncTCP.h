@@ -0,0 +1,7 @@
+// Host stand-in for AsyncTCP. Nothing in the firmware uses it directly.
+#ifndef SIM_ASYNCTCP_H
+#define SIM_ASYNCTCP_H
+
+#include "Arduino.h"
+
+#endif // SIM_ASYNCTCP_H
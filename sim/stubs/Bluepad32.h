@@ -0,0 +1,35 @@
+// Host stand-in for Bluepad32.
+#ifndef SIM_BLUEPAD32_H
+#define SIM_BLUEPAD32_H
+
+#include "Arduino.h"
+#include "uni.h"
+
+#ifndef BP32_MAX_GAMEPADS
+#define BP32_MAX_GAMEPADS 4
+#endif
+
+class Controller {
+public:
+    int index() const { return _index; }
+    bool isConnected() const { return false; }
+    bool isGamepad() const { return false; }
+    String getModelName() const { return "Simulated"; }
+    void disconnect() {}
+
+private:
+    int _index = -1;
+};
+
+typedef Controller* ControllerPtr;
+typedef void (*GamepadCallback)(ControllerPtr ctl);
+
+class Bluepad32 {
+public:
+    void setup(GamepadCallback onConnect, GamepadCallback onDisconnect) {}
+    bool update() { return false; }
+    void enableNewBluetoothConnections(bool enabled);
+    void forgetBluetoothKeys() {}
+};
+
+#endif // SIM_BLUEPAD32_H
@@ -0,0 +1,29 @@
+// Host stand-in for the EDGE engine's DisplayConfig.
+#ifndef SIM_EDGE_DISPLAY_CONFIG_H
+#define SIM_EDGE_DISPLAY_CONFIG_H
+
+#include <stdint.h>
+#include <U8g2lib.h>
+
+enum DisplayType {
+    SSD1306,
+    SH1106
+};
+
+struct DisplayConfig {
+    DisplayType type;
+    uint8_t clockPin;
+    uint8_t dataPin;
+    uint8_t resetPin;
+    const u8g2_cb_t* rotation;
+    int width;
+    int height;
+    bool fullBuffer;
+
+    DisplayConfig(DisplayType type, uint8_t clockPin, uint8_t dataPin, uint8_t resetPin,
+                  const u8g2_cb_t* rotation, int width, int height, bool fullBuffer)
+        : type(type), clockPin(clockPin), dataPin(dataPin), resetPin(resetPin),
+          rotation(rotation), width(width), height(height), fullBuffer(fullBuffer) {}
+};
+
+#endif // SIM_EDGE_DISPLAY_CONFIG_H
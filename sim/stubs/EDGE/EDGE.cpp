@@ -0,0 +1,141 @@
+#include "EDGE.h"
+#include <algorithm>
+
+// GEM key codes, as delivered through the key queue.
+static const uint8_t KEY_UP = 1;
+static const uint8_t KEY_RIGHT = 2;
+static const uint8_t KEY_DOWN = 3;
+static const uint8_t KEY_LEFT = 4;
+static const uint8_t KEY_CANCEL = 5;
+static const uint8_t KEY_OK = 6;
+
+SceneManager::~SceneManager() {
+    for (auto& e : _stack) delete e.scene;
+}
+
+void SceneManager::registerScene(const String& name, SceneFactory factory) {
+    _factories[name] = factory;
+}
+
+void SceneManager::requestSetCurrentScene(const String& name, void* configData) {
+    _pending = true;
+    _pendingPush = false;
+    _pendingName = name;
+    _pendingConfig = configData;
+}
+
+void SceneManager::requestPushScene(const String& name, void* configData) {
+    _pending = true;
+    _pendingPush = true;
+    _pendingName = name;
+    _pendingConfig = configData;
+}
+
+std::vector<String> SceneManager::getRegisteredSceneNames() const {
+    std::vector<String> names;
+    for (const auto& kv : _factories) names.push_back(kv.first);
+    return names;
+}
+
+SceneFactory SceneManager::getFactoryByName(const String& name) const {
+    auto it = _factories.find(name);
+    return it == _factories.end() ? SceneFactory() : it->second;
+}
+
+void SceneManager::applyPendingChange() {
+    if (!_pending) return;
+    String name = _pendingName;
+    void* config = _pendingConfig;
+    bool push = _pendingPush;
+    clearPendingSceneChange();
+
+    auto it = _factories.find(name);
+    if (it == _factories.end()) return;
+
+    if (!_stack.empty()) {
+        _previousName = _stack.back().name;
+        _stack.back().scene->onExit();
+        if (!push) {
+            for (auto& e : _stack) delete e.scene;
+            _stack.clear();
+        }
+    }
+    Scene* scene = it->second(config);
+    if (!scene) return;
+    _stack.push_back(Entry{name, scene});
+    scene->onEnter();
+}
+
+void InputManager::registerButtonListener(EDGE_Button button, EDGE_Event event, Scene* owner, std::function<void()> callback) {
+    _listeners.push_back(Listener{button, event, owner, callback});
+}
+
+void InputManager::unregisterAllListenersForScene(Scene* owner) {
+    _listeners.erase(std::remove_if(_listeners.begin(), _listeners.end(),
+                                    [owner](const Listener& l) { return l.owner == owner; }),
+                     _listeners.end());
+}
+
+void InputManager::processButtonEvent(EDGE_Button button, EDGE_Event event) {
+    Scene* current = _sceneManager.getCurrentScene();
+    if (!current) return;
+
+    if (current->usesKeyQueue() && _keyQueue && event == EDGE_Event::CLICK) {
+        uint8_t key = 0;
+        switch (button) {
+            case EDGE_Button::UP: key = KEY_UP; break;
+            case EDGE_Button::DOWN: key = KEY_DOWN; break;
+            case EDGE_Button::LEFT: key = KEY_LEFT; break;
+            case EDGE_Button::RIGHT: key = KEY_RIGHT; break;
+            case EDGE_Button::OK: key = KEY_OK; break;
+        }
+        xQueueSend(_keyQueue, &key, 0);
+    } else if (current->usesKeyQueue() && _keyQueue && event == EDGE_Event::LONG_PRESS && button == EDGE_Button::OK) {
+        uint8_t key = KEY_CANCEL;
+        xQueueSend(_keyQueue, &key, 0);
+    }
+
+    // Copy: a callback may change scenes and unregister listeners.
+    std::vector<Listener> matching;
+    for (const auto& l : _listeners) {
+        if (l.owner == current && l.button == button && l.event == event) matching.push_back(l);
+    }
+    for (auto& l : matching) l.callback();
+}
+
+void InputManager::processQueuedKeys() {
+    if (!_keyQueue) return;
+    uint8_t key;
+    while (xQueueReceive(_keyQueue, &key, 0) == pdTRUE) {
+        Scene* current = _sceneManager.getCurrentScene();
+        if (current && current->usesKeyQueue()) current->processKeyPress(key);
+    }
+}
+
+EDGE::EDGE(U8G2* u8g2, const DisplayConfig& config, EDGELogger logger)
+    : _u8g2(u8g2), _logger(logger), _renderer(u8g2, config), _inputManager(_sceneManager) {}
+
+void EDGE::init() {
+    _lastUpdateTime = millis();
+    if (_logger) _logger("EDGE: engine initialized (host stand-in).");
+}
+
+void EDGE::update() {
+    _sceneManager.applyPendingChange();
+    unsigned long now = millis();
+    unsigned long deltaTime = now - _lastUpdateTime;
+    _lastUpdateTime = now;
+    if (Scene* scene = _sceneManager.getCurrentScene()) scene->update(deltaTime);
+}
+
+void EDGE::draw() {
+    Scene* scene = _sceneManager.getCurrentScene();
+    if (!scene) return;
+    if (scene->managesOwnDrawing) {
+        scene->draw(_renderer);
+        return;
+    }
+    _u8g2->clearBuffer();
+    scene->draw(_renderer);
+    _u8g2->sendBuffer();
+}
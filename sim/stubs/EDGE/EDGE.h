@@ -0,0 +1,39 @@
+// Host stand-in for the EDGE engine facade.
+#ifndef SIM_EDGE_H
+#define SIM_EDGE_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <functional>
+#include "DisplayConfig.h"
+#include "InputManager.h"
+#include "Renderer.h"
+#include "Scene.h"
+#include "SceneManager.h"
+
+using EDGELogger = std::function<void(const char*)>;
+
+class EDGE {
+public:
+    EDGE(U8G2* u8g2, const DisplayConfig& config, EDGELogger logger = nullptr);
+
+    void init();
+    // Applies pending scene changes, then updates the current scene with the
+    // milliseconds elapsed since the previous update() call.
+    void update();
+    void draw();
+
+    Renderer& getRenderer() { return _renderer; }
+    SceneManager& getSceneManager() { return _sceneManager; }
+    InputManager& getInputManager() { return _inputManager; }
+
+private:
+    U8G2* _u8g2;
+    EDGELogger _logger;
+    Renderer _renderer;
+    SceneManager _sceneManager;
+    InputManager _inputManager;
+    unsigned long _lastUpdateTime = 0;
+};
+
+#endif // SIM_EDGE_H
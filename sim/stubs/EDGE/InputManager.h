@@ -0,0 +1,44 @@
+// Host stand-in for the EDGE engine's InputManager.
+//
+// Button events go to the listeners the current scene registered. Scenes
+// that use the key queue (GEM menus) also receive CLICKs as GEM key codes
+// through the queue, drained by processQueuedKeys() once per loop.
+#ifndef SIM_EDGE_INPUT_MANAGER_H
+#define SIM_EDGE_INPUT_MANAGER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <functional>
+#include <vector>
+
+class Scene;
+class SceneManager;
+
+enum class EDGE_Button { OK, LEFT, RIGHT, UP, DOWN };
+enum class EDGE_Event { CLICK, LONG_PRESS, PRESS, RELEASE };
+
+class InputManager {
+public:
+    explicit InputManager(SceneManager& sceneManager) : _sceneManager(sceneManager) {}
+
+    void registerButtonListener(EDGE_Button button, EDGE_Event event, Scene* owner, std::function<void()> callback);
+    void unregisterAllListenersForScene(Scene* owner);
+    void setKeyQueue(QueueHandle_t queue) { _keyQueue = queue; }
+    void processButtonEvent(EDGE_Button button, EDGE_Event event);
+    void processQueuedKeys();
+
+private:
+    struct Listener {
+        EDGE_Button button;
+        EDGE_Event event;
+        Scene* owner;
+        std::function<void()> callback;
+    };
+
+    SceneManager& _sceneManager;
+    std::vector<Listener> _listeners;
+    QueueHandle_t _keyQueue = nullptr;
+};
+
+#endif // SIM_EDGE_INPUT_MANAGER_H
@@ -0,0 +1,39 @@
+// Host stand-in for the EDGE engine's Renderer: a thin, offset-aware
+// wrapper around U8G2.
+#ifndef SIM_EDGE_RENDERER_H
+#define SIM_EDGE_RENDERER_H
+
+#include <U8g2lib.h>
+#include "DisplayConfig.h"
+
+class Renderer {
+public:
+    Renderer(U8G2* u8g2, const DisplayConfig& config)
+        : _u8g2(u8g2), _width(config.width), _height(config.height) {}
+
+    U8G2* getU8G2() { return _u8g2; }
+    int getXOffset() const { return _xOffset; }
+    int getYOffset() const { return _yOffset; }
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+
+    void setFont(const uint8_t* font) { _u8g2->setFont(font); }
+    void drawTextSafe(int x, int y, const char* text) {
+        if (!text) return;
+        _u8g2->drawStr(_xOffset + x, _yOffset + y, text);
+    }
+    void drawLine(int x0, int y0, int x1, int y1) { _u8g2->drawLine(_xOffset + x0, _yOffset + y0, _xOffset + x1, _yOffset + y1); }
+    void drawRectangle(int x, int y, int w, int h) { _u8g2->drawFrame(_xOffset + x, _yOffset + y, w, h); }
+    void drawFilledRectangle(int x, int y, int w, int h) { _u8g2->drawBox(_xOffset + x, _yOffset + y, w, h); }
+    void drawCircle(int x, int y, int r) { _u8g2->drawCircle(_xOffset + x, _yOffset + y, r); }
+    void drawFilledCircle(int x, int y, int r) { _u8g2->drawDisc(_xOffset + x, _yOffset + y, r); }
+
+private:
+    U8G2* _u8g2;
+    int _xOffset = 0;
+    int _yOffset = 0;
+    int _width;
+    int _height;
+};
+
+#endif // SIM_EDGE_RENDERER_H
@@ -0,0 +1,29 @@
+// Host stand-in for the EDGE engine's Scene base class.
+#ifndef SIM_EDGE_SCENE_H
+#define SIM_EDGE_SCENE_H
+
+#include <stdint.h>
+
+class Renderer;
+class DialogBox;
+
+class Scene {
+public:
+    virtual ~Scene() = default;
+
+    virtual void init() {}
+    virtual void onEnter() {}
+    virtual void onExit() {}
+    virtual void update(unsigned long deltaTime) {}
+    virtual void draw(Renderer& renderer) {}
+
+    virtual DialogBox* getDialogBox() { return nullptr; }
+    virtual bool usesKeyQueue() const { return false; }
+    virtual void processKeyPress(uint8_t keyCode) {}
+
+    // Scenes that push their own frames (GEM menus) set this so the engine
+    // skips its clear/send around draw().
+    bool managesOwnDrawing = false;
+};
+
+#endif // SIM_EDGE_SCENE_H
@@ -0,0 +1,50 @@
+// Host stand-in for the EDGE engine's SceneManager. Scene changes are only
+// requested by game code and applied by the engine at the start of update().
+#ifndef SIM_EDGE_SCENE_MANAGER_H
+#define SIM_EDGE_SCENE_MANAGER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <vector>
+#include "Scene.h"
+
+using SceneFactory = std::function<Scene*(void*)>;
+
+class SceneManager {
+public:
+    ~SceneManager();
+
+    void registerScene(const String& name, SceneFactory factory);
+    void requestSetCurrentScene(const String& name, void* configData = nullptr);
+    void requestPushScene(const String& name, void* configData = nullptr);
+
+    bool isSceneChangePending() const { return _pending; }
+    String getPendingSceneName() const { return _pendingName; }
+    void clearPendingSceneChange() { _pending = false; _pendingName = ""; _pendingConfig = nullptr; }
+
+    Scene* getCurrentScene() const { return _stack.empty() ? nullptr : _stack.back().scene; }
+    String getCurrentSceneName() const { return _stack.empty() ? String() : _stack.back().name; }
+    String getPreviousSceneName() const { return _previousName; }
+    std::vector<String> getRegisteredSceneNames() const;
+    SceneFactory getFactoryByName(const String& name) const;
+
+    // Engine side: applies a pending change, if any.
+    void applyPendingChange();
+
+private:
+    struct Entry {
+        String name;
+        Scene* scene;
+    };
+
+    std::map<String, SceneFactory> _factories;
+    std::vector<Entry> _stack;
+    String _previousName;
+    bool _pending = false;
+    bool _pendingPush = false;
+    String _pendingName;
+    void* _pendingConfig = nullptr;
+};
+
+#endif // SIM_EDGE_SCENE_MANAGER_H
@@ -0,0 +1,165 @@
+#include "ESPAsyncWebServer.h"
+
+void AsyncWebSocketClient::enqueue(AwsFrameType type, std::shared_ptr<std::vector<uint8_t>> data) {
+    if (_status != WS_CONNECTED) return;
+    if (queueIsFull()) {
+        // Matches the library: the message is discarded, not the connection.
+        _dropped++;
+        return;
+    }
+    _queue.push_back(Message{type, std::move(data)});
+}
+
+void AsyncWebSocketClient::text(const char* message, size_t len) {
+    enqueue(WS_TEXT, std::make_shared<std::vector<uint8_t>>((const uint8_t*)message, (const uint8_t*)message + len));
+}
+
+void AsyncWebSocketClient::binary(const uint8_t* message, size_t len) {
+    enqueue(WS_BINARY, std::make_shared<std::vector<uint8_t>>(message, message + len));
+}
+
+void AsyncWebSocketClient::binary(AsyncWebSocketMessageBuffer* buffer) {
+    if (!buffer) return;
+    enqueue(WS_BINARY, buffer->shared());
+    delete buffer;
+}
+
+void AsyncWebSocketClient::binary(AsyncWebSocketSharedBuffer buffer) {
+    if (!buffer) return;
+    enqueue(WS_BINARY, std::move(buffer));
+}
+
+size_t AsyncWebSocketClient::simDrain(size_t maxBytes) {
+    size_t delivered = 0;
+    _drainCredit = (maxBytes > SIZE_MAX - _drainCredit) ? SIZE_MAX : _drainCredit + maxBytes;
+    while (!_queue.empty()) {
+        size_t len = _queue.front().data->size();
+        if (len > _drainCredit) break;
+        _drainCredit -= len;
+        _inbox.push_back(_queue.front());
+        _queue.pop_front();
+        delivered += len;
+    }
+    if (_queue.empty()) _drainCredit = 0; // An idle link does not bank budget
+    return delivered;
+}
+
+size_t AsyncWebSocket::count() const {
+    size_t n = 0;
+    for (const auto& c : _clients) {
+        if (c.status() == WS_CONNECTED) n++;
+    }
+    return n;
+}
+
+void AsyncWebSocket::cleanupClients(uint16_t maxClients) {
+    _clients.remove_if([](const AsyncWebSocketClient& c) { return c.status() == WS_DISCONNECTED; });
+    while (count() > maxClients) {
+        simDisconnect(_clients.front().id());
+        _clients.pop_front();
+    }
+}
+
+AsyncWebSocketClient* AsyncWebSocket::client(uint32_t id) {
+    for (auto& c : _clients) {
+        if (c.id() == id && c.status() == WS_CONNECTED) return &c;
+    }
+    return nullptr;
+}
+
+bool AsyncWebSocket::availableForWriteAll() {
+    for (const auto& c : _clients) {
+        if (c.status() == WS_CONNECTED && c.queueIsFull()) return false;
+    }
+    return true;
+}
+
+void AsyncWebSocket::textAll(const char* message) {
+    auto data = std::make_shared<std::vector<uint8_t>>((const uint8_t*)message, (const uint8_t*)message + strlen(message));
+    for (auto& c : _clients) c.enqueue(WS_TEXT, data);
+}
+
+void AsyncWebSocket::binaryAll(const uint8_t* message, size_t len) {
+    auto data = std::make_shared<std::vector<uint8_t>>(message, message + len);
+    for (auto& c : _clients) c.enqueue(WS_BINARY, data);
+}
+
+void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer* buffer) {
+    if (!buffer) return;
+    for (auto& c : _clients) c.enqueue(WS_BINARY, buffer->shared());
+    delete buffer;
+}
+
+AsyncWebSocketClient* AsyncWebSocket::simConnect() {
+    _clients.emplace_back(this, _nextId++);
+    AsyncWebSocketClient* c = &_clients.back();
+    if (_handler) _handler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    return c;
+}
+
+void AsyncWebSocket::simDisconnect(uint32_t id) {
+    for (auto& c : _clients) {
+        if (c.id() == id && c.status() != WS_DISCONNECTED) {
+            c._status = WS_DISCONNECTED;
+            c._queue.clear();
+            if (_handler) _handler(this, &c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+            return;
+        }
+    }
+}
+
+void AsyncWebSocket::simReceiveText(uint32_t id, const String& message) {
+    AsyncWebSocketClient* c = client(id);
+    if (!c || !_handler) return;
+    // The firmware NUL-terminates in place, so leave one spare byte.
+    std::vector<uint8_t> data(message.c_str(), message.c_str() + message.length() + 1);
+    AwsFrameInfo info = {};
+    info.message_opcode = WS_TEXT;
+    info.opcode = WS_TEXT;
+    info.final = 1;
+    info.index = 0;
+    info.len = message.length();
+    _handler(this, c, WS_EVT_DATA, &info, data.data(), message.length());
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction onRequest) {
+    return on(uri, method, onRequest, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction onRequest,
+                                            ArUploadHandlerFunction onUpload) {
+    _routes.emplace_back();
+    AsyncCallbackWebHandler& h = _routes.back();
+    h.url = uri;
+    h.method = method;
+    h.onRequest = onRequest;
+    h.onUpload = onUpload;
+    return h;
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler) {
+    _handlers.push_back(handler);
+    return *handler;
+}
+
+bool AsyncWebServer::simGet(const char* uri, int& code, std::string& body) {
+    for (auto& h : _routes) {
+        if (h.url == uri && (h.method & HTTP_GET) && h.onRequest) {
+            AsyncWebServerRequest request(uri);
+            h.onRequest(&request);
+            const AsyncWebServerResponse* response = request.simResponse();
+            code = response ? response->code() : 500;
+            body = response ? response->body() : std::string();
+            return true;
+        }
+    }
+    return false;
+}
+
+AsyncWebSocket* AsyncWebServer::simWebSocket(const char* url) {
+    for (AsyncWebHandler* h : _handlers) {
+        AsyncWebSocket* ws = dynamic_cast<AsyncWebSocket*>(h);
+        if (ws && strcmp(ws->url(), url) == 0) return ws;
+    }
+    return nullptr;
+}
@@ -0,0 +1,226 @@
+// Host stand-in for ESPAsyncWebServer.
+//
+// There is no socket. The simulator drives the server through the sim*()
+// hooks: it can issue HTTP GETs against registered routes and attach
+// virtual WebSocket clients. Each client owns an outbound queue with the
+// library's WS_MAX_QUEUED_MESSAGES limit; the driver drains it at a
+// configurable link rate so queueLen() behaves like a real slow browser.
+#ifndef SIM_ESPASYNCWEBSERVER_H
+#define SIM_ESPASYNCWEBSERVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "IPAddress.h"
+
+#ifndef WS_MAX_QUEUED_MESSAGES
+#define WS_MAX_QUEUED_MESSAGES 32
+#endif
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+typedef struct {
+    uint8_t message_opcode;
+    uint32_t num;
+    uint8_t final;
+    uint8_t masked;
+    uint8_t opcode;
+    uint64_t len;
+    uint8_t mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+// As in the library: a message payload shared by every client it is queued for.
+using AsyncWebSocketSharedBuffer = std::shared_ptr<std::vector<uint8_t>>;
+
+class AsyncWebSocketMessageBuffer {
+public:
+    explicit AsyncWebSocketMessageBuffer(size_t size) : _data(std::make_shared<std::vector<uint8_t>>(size)) {}
+    AsyncWebSocketMessageBuffer(const uint8_t* data, size_t size)
+        : _data(std::make_shared<std::vector<uint8_t>>(data, data + size)) {}
+    uint8_t* get() { return _data->data(); }
+    size_t length() const { return _data->size(); }
+    std::shared_ptr<std::vector<uint8_t>> shared() const { return _data; }
+
+private:
+    std::shared_ptr<std::vector<uint8_t>> _data;
+};
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+public:
+    struct Message {
+        AwsFrameType type;
+        std::shared_ptr<std::vector<uint8_t>> data;
+    };
+
+    AsyncWebSocketClient(AsyncWebSocket* server, uint32_t id) : _server(server), _id(id) {}
+
+    uint32_t id() const { return _id; }
+    IPAddress remoteIP() const { return IPAddress(127, 0, 0, (uint8_t)(_id & 0xFF)); }
+    AwsClientStatus status() const { return _status; }
+    size_t queueLen() const { return _queue.size(); }
+    bool queueIsFull() const { return _queue.size() >= WS_MAX_QUEUED_MESSAGES; }
+    bool canSend() const { return !queueIsFull(); }
+
+    void text(const char* message) { text(message, strlen(message)); }
+    void text(const String& message) { text(message.c_str(), message.length()); }
+    void text(const char* message, size_t len);
+    void binary(const uint8_t* message, size_t len);
+    void binary(AsyncWebSocketMessageBuffer* buffer);
+    void binary(AsyncWebSocketSharedBuffer buffer);
+    void close() { _status = WS_DISCONNECTING; }
+
+    // --- Simulator side ---
+    // Adds maxBytes of link budget and pops every queued message the
+    // accumulated budget covers into the client's inbox, so messages larger
+    // than one call's budget take several calls, as on a slow link.
+    // Returns the number of bytes delivered.
+    size_t simDrain(size_t maxBytes);
+    const std::vector<Message>& simInbox() const { return _inbox; }
+    void simClearInbox() { _inbox.clear(); }
+    uint32_t simDroppedMessages() const { return _dropped; }
+
+private:
+    friend class AsyncWebSocket;
+    AsyncWebSocket* _server;
+    uint32_t _id;
+    AwsClientStatus _status = WS_CONNECTED;
+    std::deque<Message> _queue;
+    std::vector<Message> _inbox;
+    uint32_t _dropped = 0;
+    size_t _drainCredit = 0;
+
+    void enqueue(AwsFrameType type, std::shared_ptr<std::vector<uint8_t>> data);
+};
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() = default;
+};
+
+using AwsEventHandler = std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                                           void* arg, uint8_t* data, size_t len)>;
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+    explicit AsyncWebSocket(const String& url) : _url(url) {}
+
+    const char* url() const { return _url.c_str(); }
+    void onEvent(AwsEventHandler handler) { _handler = handler; }
+    size_t count() const;
+    void cleanupClients(uint16_t maxClients = 8);
+    std::list<AsyncWebSocketClient>& getClients() { return _clients; }
+    const std::list<AsyncWebSocketClient>& getClients() const { return _clients; }
+    AsyncWebSocketClient* client(uint32_t id);
+    bool availableForWriteAll();
+
+    void textAll(const char* message);
+    void textAll(const String& message) { textAll(message.c_str()); }
+    void binaryAll(const uint8_t* message, size_t len);
+    void binaryAll(AsyncWebSocketMessageBuffer* buffer);
+    AsyncWebSocketMessageBuffer* makeBuffer(size_t size) { return new AsyncWebSocketMessageBuffer(size); }
+
+    // --- Simulator side ---
+    AsyncWebSocketClient* simConnect();
+    void simDisconnect(uint32_t id);
+    void simReceiveText(uint32_t id, const String& message);
+
+private:
+    String _url;
+    AwsEventHandler _handler;
+    std::list<AsyncWebSocketClient> _clients;
+    uint32_t _nextId = 1;
+};
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType, std::string body)
+        : _code(code), _contentType(contentType), _body(std::move(body)) {}
+    void addHeader(const char* name, const char* value) { _headers[name] = value; }
+    int code() const { return _code; }
+    const String& contentType() const { return _contentType; }
+    const std::string& body() const { return _body; }
+
+private:
+    int _code;
+    String _contentType;
+    std::string _body;
+    std::map<std::string, std::string> _headers;
+};
+
+class AsyncWebServerRequest {
+public:
+    explicit AsyncWebServerRequest(const String& url) : _url(url) {}
+    const String& url() const { return _url; }
+    size_t contentLength() const { return 0; }
+
+    AsyncWebServerResponse* beginResponse(int code, const char* contentType, const uint8_t* content, size_t len) {
+        return new AsyncWebServerResponse(code, contentType, std::string((const char*)content, len));
+    }
+    AsyncWebServerResponse* beginResponse(int code, const char* contentType, const String& content) {
+        return new AsyncWebServerResponse(code, contentType, std::string(content.c_str(), content.length()));
+    }
+    void send(AsyncWebServerResponse* response) { _response.reset(response); }
+    void send(int code, const char* contentType, const String& content) {
+        send(beginResponse(code, contentType, content));
+    }
+    void send(int code) { send(beginResponse(code, "text/plain", String())); }
+
+    const AsyncWebServerResponse* simResponse() const { return _response.get(); }
+
+private:
+    String _url;
+    std::unique_ptr<AsyncWebServerResponse> _response;
+};
+
+using ArRequestHandlerFunction = std::function<void(AsyncWebServerRequest* request)>;
+using ArUploadHandlerFunction = std::function<void(AsyncWebServerRequest* request, String filename, size_t index,
+                                                   uint8_t* data, size_t len, bool final)>;
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+    String url;
+    WebRequestMethod method = HTTP_GET;
+    ArRequestHandlerFunction onRequest;
+    ArUploadHandlerFunction onUpload;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : _port(port) {}
+
+    void begin() {}
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload);
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+
+    // --- Simulator side ---
+    // Runs the GET handler registered for uri. Returns false if none matched.
+    bool simGet(const char* uri, int& code, std::string& body);
+    AsyncWebSocket* simWebSocket(const char* url);
+
+private:
+    uint16_t _port;
+    std::list<AsyncCallbackWebHandler> _routes;
+    std::vector<AsyncWebHandler*> _handlers;
+};
+
+#endif // SIM_ESPASYNCWEBSERVER_H
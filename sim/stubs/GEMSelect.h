@@ -0,0 +1,36 @@
+// Host stand-in for GEM's option select.
+#ifndef SIM_GEM_SELECT_H
+#define SIM_GEM_SELECT_H
+
+#include "Arduino.h"
+
+#define GEM_LOOP true
+#define GEM_NO_LOOP false
+
+struct SelectOptionByte {
+    const char* name;
+    byte val_byte;
+};
+
+class GEMSelect {
+public:
+    GEMSelect(byte length, SelectOptionByte* options, bool loop = GEM_NO_LOOP)
+        : _length(length), _options(options), _loop(loop) {}
+
+    byte getLength() const { return _length; }
+    const SelectOptionByte& getOption(byte index) const { return _options[index]; }
+    bool loops() const { return _loop; }
+    int indexOf(byte value) const {
+        for (byte i = 0; i < _length; i++) {
+            if (_options[i].val_byte == value) return i;
+        }
+        return 0;
+    }
+
+private:
+    byte _length;
+    SelectOptionByte* _options;
+    bool _loop;
+};
+
+#endif // SIM_GEM_SELECT_H
@@ -0,0 +1,98 @@
+#include "GEM_u8g2.h"
+
+GEM_u8g2::GEM_u8g2(U8G2& u8g2, byte menuPointerType, byte menuItemsPerScreen, byte menuItemHeight,
+                   byte menuPageScreenTopOffset, byte menuValuesLeftOffset)
+    : _u8g2(u8g2), _font(u8g2_font_6x12_tf) {
+    _appearance = {menuPointerType, menuItemsPerScreen, menuItemHeight, menuPageScreenTopOffset, menuValuesLeftOffset};
+}
+
+GEM_u8g2& GEM_u8g2::drawMenu() {
+    _u8g2.clearBuffer();
+    _u8g2.setDrawColor(1);
+    _u8g2.setFont(_font);
+    _u8g2.setFontPosTop();
+    if (_page) {
+        _u8g2.drawStr(0, 0, _page->_title ? _page->_title : "");
+        _u8g2.drawHLine(0, _appearance.menuPageScreenTopOffset - 2, _u8g2.getDisplayWidth());
+
+        int rowHeight = _appearance.menuItemHeight;
+        int rows = (_u8g2.getDisplayHeight() - _appearance.menuPageScreenTopOffset) / rowHeight;
+        int count = (int)_page->_items.size();
+        int first = std::max(0, std::min(_page->_currentIndex - rows + 1, count - rows));
+        for (int i = first; i < count && i < first + rows; i++) {
+            const GEMItem* item = _page->_items[i];
+            int y = _appearance.menuPageScreenTopOffset + (i - first) * rowHeight;
+            _u8g2.drawStr(6, y, item->_title ? item->_title : "");
+            if (item->_linkedText) {
+                _u8g2.drawStr(_appearance.menuValuesLeftOffset, y, item->_linkedText);
+            } else if (item->_select && item->_linkedByte) {
+                _u8g2.drawStr(_appearance.menuValuesLeftOffset, y,
+                              item->_select->getOption(item->_select->indexOf(*item->_linkedByte)).name);
+            }
+            if (i == _page->_currentIndex) {
+                _u8g2.setDrawColor(2);
+                _u8g2.drawBox(0, y - 1, _u8g2.getDisplayWidth(), rowHeight);
+                _u8g2.setDrawColor(1);
+            }
+        }
+    }
+    _u8g2.setFontPosBaseline();
+    _u8g2.sendBuffer();
+    return *this;
+}
+
+void GEM_u8g2::stepSelect(GEMItem& item, int direction) {
+    GEMSelect& select = *item._select;
+    int index = select.indexOf(*item._linkedByte) + direction;
+    int length = select.getLength();
+    if (index < 0) index = select.loops() ? length - 1 : 0;
+    if (index >= length) index = select.loops() ? 0 : length - 1;
+    *item._linkedByte = select.getOption((byte)index).val_byte;
+}
+
+void GEM_u8g2::activate(GEMItem& item) {
+    if (item._readonly) return;
+    if (item._linkedPage) {
+        _page = item._linkedPage;
+        _page->_currentIndex = 0;
+    } else if (item._select && item._linkedByte) {
+        if (_editing) {
+            _editing = false;
+            if (item._callback) item._callback();
+        } else {
+            _editing = true;
+        }
+    } else if (item._callback) {
+        item._callback();
+    }
+}
+
+GEM_u8g2& GEM_u8g2::registerKeyPress(byte keyCode) {
+    if (!_page || _page->_items.empty()) return *this;
+    GEMItem& item = *_page->_items[_page->_currentIndex];
+    int count = (int)_page->_items.size();
+
+    switch (keyCode) {
+        case GEM_KEY_UP:
+            if (_editing) stepSelect(item, -1);
+            else _page->_currentIndex = (_page->_currentIndex + count - 1) % count;
+            break;
+        case GEM_KEY_DOWN:
+            if (_editing) stepSelect(item, 1);
+            else _page->_currentIndex = (_page->_currentIndex + 1) % count;
+            break;
+        case GEM_KEY_OK:
+        case GEM_KEY_RIGHT:
+            activate(item);
+            break;
+        case GEM_KEY_CANCEL:
+        case GEM_KEY_LEFT:
+            if (_editing) _editing = false;
+            else if (_page->_parent) _page = _page->_parent;
+            break;
+        default:
+            break;
+    }
+    drawMenu();
+    return *this;
+}
@@ -0,0 +1,112 @@
+// Host stand-in for the GEM menu library (u8g2 flavour).
+//
+// Implements the subset the scenes use: pages of items, linked sub-pages,
+// read-only labels, buttons and byte selects. Rendering is a plain list
+// with a pointer, not GEM's exact look.
+#ifndef SIM_GEM_U8G2_H
+#define SIM_GEM_U8G2_H
+
+#include <vector>
+#include "Arduino.h"
+#include "U8g2lib.h"
+#include "GEMSelect.h"
+
+#define GEM_KEY_NONE 0
+#define GEM_KEY_UP 1
+#define GEM_KEY_RIGHT 2
+#define GEM_KEY_DOWN 3
+#define GEM_KEY_LEFT 4
+#define GEM_KEY_CANCEL 5
+#define GEM_KEY_OK 6
+
+#define GEM_POINTER_DASH 0
+#define GEM_POINTER_ROW 1
+#define GEM_ITEMS_COUNT_AUTO 0
+#define GEM_VER "sim"
+
+class GEMPage;
+
+struct GEMAppearance {
+    byte menuPointerType;
+    byte menuItemsPerScreen;
+    byte menuItemHeight;
+    byte menuPageScreenTopOffset;
+    byte menuValuesLeftOffset;
+};
+
+class GEMItem {
+public:
+    explicit GEMItem(const char* title) : _title(title) {}
+    GEMItem(const char* title, void (*callback)()) : _title(title), _callback(callback) {}
+    GEMItem(const char* title, GEMPage& linkedPage) : _title(title), _linkedPage(&linkedPage) {}
+    GEMItem(const char* title, char* linkedText, bool readonly = false)
+        : _title(title), _linkedText(linkedText), _readonly(readonly) {}
+    GEMItem(const char* title, byte& linkedByte, GEMSelect& select, void (*callback)() = nullptr)
+        : _title(title), _callback(callback), _linkedByte(&linkedByte), _select(&select) {}
+
+    void setTitle(const char* title) { _title = title; }
+    const char* getTitle() const { return _title; }
+    void setReadonly(bool mode = true) { _readonly = mode; }
+    bool getReadonly() const { return _readonly; }
+
+private:
+    friend class GEM_u8g2;
+    const char* _title;
+    void (*_callback)() = nullptr;
+    GEMPage* _linkedPage = nullptr;
+    char* _linkedText = nullptr;
+    byte* _linkedByte = nullptr;
+    GEMSelect* _select = nullptr;
+    bool _readonly = false;
+};
+
+class GEMPage {
+public:
+    explicit GEMPage(const char* title = "") : _title(title) {}
+
+    GEMPage& addMenuItem(GEMItem& item) { _items.push_back(&item); return *this; }
+    GEMPage& setParentMenuPage(GEMPage& parent) { _parent = &parent; return *this; }
+    GEMPage& setTitle(const char* title) { _title = title; return *this; }
+    const char* getTitle() const { return _title; }
+
+private:
+    friend class GEM_u8g2;
+    const char* _title;
+    std::vector<GEMItem*> _items;
+    GEMPage* _parent = nullptr;
+    int _currentIndex = 0;
+};
+
+class GEM_u8g2 {
+public:
+    GEM_u8g2(U8G2& u8g2, byte menuPointerType = GEM_POINTER_ROW, byte menuItemsPerScreen = GEM_ITEMS_COUNT_AUTO,
+             byte menuItemHeight = 10, byte menuPageScreenTopOffset = 10, byte menuValuesLeftOffset = 86);
+    virtual ~GEM_u8g2() = default;
+
+    GEM_u8g2& setFontSmall() { _font = u8g2_font_4x6_tf; return *this; }
+    GEM_u8g2& setSplashDelay(uint16_t value) { return *this; }
+    GEM_u8g2& hideVersion(bool flag = true) { return *this; }
+    virtual GEM_u8g2& init() { return *this; }
+    GEM_u8g2& reInit() { return *this; }
+    GEM_u8g2& setMenuPageCurrent(GEMPage& page) { _page = &page; return *this; }
+    GEMPage* getCurrentMenuPage() { return _page; }
+    GEMAppearance* getCurrentAppearance() { return &_appearance; }
+    bool isEditMode() const { return _editing; }
+
+    GEM_u8g2& drawMenu();
+    GEM_u8g2& registerKeyPress(byte keyCode);
+
+protected:
+    U8G2& _u8g2;
+
+private:
+    GEMAppearance _appearance;
+    const uint8_t* _font;
+    GEMPage* _page = nullptr;
+    bool _editing = false;
+
+    void activate(GEMItem& item);
+    void stepSelect(GEMItem& item, int direction);
+};
+
+#endif // SIM_GEM_U8G2_H
@@ -0,0 +1,31 @@
+// Host stand-in for MycilaWebSerial. Output is dropped; the simulator reads
+// the hardware Serial mirror instead.
+#ifndef SIM_MYCILA_WEBSERIAL_H
+#define SIM_MYCILA_WEBSERIAL_H
+
+#include <functional>
+#include <string>
+#include "Arduino.h"
+#include "ESPAsyncWebServer.h"
+
+class WebSerial : public Print {
+public:
+    using MsgHandler = std::function<void(const std::string& msg)>;
+
+    void begin(AsyncWebServer* server, const char* url = "/webserial") {}
+    void onMessage(MsgHandler handler) { _handler = handler; }
+    void setBuffer(size_t size) {}
+    AsyncWebSocketMessageBuffer* makeBuffer(size_t size) { return new AsyncWebSocketMessageBuffer(size); }
+    void send(AsyncWebSocketMessageBuffer* buffer) { delete buffer; }
+    using Print::write;
+    size_t write(uint8_t c) override { return 1; }
+    size_t write(const uint8_t* buffer, size_t size) override { return size; }
+
+    // Simulator hook: deliver a line as if typed in the browser console.
+    void injectMessage(const std::string& msg) { if (_handler) _handler(msg); }
+
+private:
+    MsgHandler _handler;
+};
+
+#endif // SIM_MYCILA_WEBSERIAL_H
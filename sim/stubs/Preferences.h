@@ -0,0 +1,52 @@
+// Host stand-in for the ESP32 Preferences (NVS) library. Values live in a
+// process-wide in-memory store, so they persist across begin()/end() and
+// across simulated restarts within one run, but not between runs.
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <string>
+#include "WString.h"
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition_label = nullptr) {
+        _ns = name ? name : "";
+        _open = true;
+        return true;
+    }
+    void end() { _open = false; }
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putBool(const char* key, bool value) { return putInt64(key, value ? 1 : 0, 1); }
+    size_t putUChar(const char* key, uint8_t value) { return putInt64(key, value, 1); }
+    size_t putUShort(const char* key, uint16_t value) { return putInt64(key, value, 2); }
+    size_t putInt(const char* key, int32_t value) { return putInt64(key, value, 4); }
+    size_t putUInt(const char* key, uint32_t value) { return putInt64(key, value, 4); }
+    size_t putULong(const char* key, uint32_t value) { return putInt64(key, value, 4); }
+    size_t putULong64(const char* key, uint64_t value) { return putInt64(key, (int64_t)value, 8); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+
+    bool getBool(const char* key, bool defaultValue = false) { return getInt64(key, defaultValue ? 1 : 0) != 0; }
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { return (uint8_t)getInt64(key, defaultValue); }
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0) { return (uint16_t)getInt64(key, defaultValue); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return (int32_t)getInt64(key, defaultValue); }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return (uint32_t)getInt64(key, defaultValue); }
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0) { return (uint32_t)getInt64(key, defaultValue); }
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0) { return (uint64_t)getInt64(key, (int64_t)defaultValue); }
+    String getString(const char* key, const String& defaultValue = String());
+
+private:
+    std::string _ns;
+    bool _open = false;
+
+    size_t putInt64(const char* key, int64_t value, size_t size);
+    int64_t getInt64(const char* key, int64_t defaultValue);
+};
+
+#endif // SIM_PREFERENCES_H
@@ -0,0 +1,296 @@
+// Runtime behind the host stand-ins: virtual clock, PRNG, UART, queues,
+// the default event loop, NVS and the radio globals.
+#include "SimHost.h"
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <ArduinoOTA.h>
+#include <Update.h>
+#include <Bluepad32.h>
+#include <uni.h>
+#include <esp_bt.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <esp_event.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include "espasyncbutton.hpp"
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace {
+
+uint64_t g_nowMicros = 0;
+uint64_t g_rngState = 0x9E3779B97F4A7C15ULL;
+std::deque<char> g_serialInput;
+sim::FrameSink g_frameSink;
+sim::HaltHandler g_haltHandler;
+
+struct EventHandlerEntry {
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t handler;
+    void* arg;
+};
+struct PostedEvent {
+    esp_event_base_t base;
+    int32_t id;
+    std::vector<uint8_t> data;
+};
+std::vector<EventHandlerEntry> g_eventHandlers;
+std::deque<PostedEvent> g_postedEvents;
+
+// namespace -> key -> value; strings and integers share one map.
+std::map<std::string, std::map<std::string, std::string>> g_nvs;
+
+esp_bt_controller_status_t g_btStatus = ESP_BT_CONTROLLER_STATUS_ENABLED;
+bool g_btNewConnections = false;
+
+} // namespace
+
+// --- sim:: hooks ---
+
+namespace sim {
+
+uint64_t nowMicros() { return g_nowMicros; }
+void advanceMicros(uint64_t us) { g_nowMicros += us; }
+
+void seedRandom(uint32_t seed) {
+    g_rngState = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 1 | 1);
+}
+
+uint32_t nextRandom() {
+    // splitmix64: tiny, fast and good enough for gameplay randomness.
+    uint64_t z = (g_rngState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (uint32_t)((z ^ (z >> 31)) >> 32);
+}
+
+void pushSerialInput(const std::string& text) {
+    for (char c : text) g_serialInput.push_back(c);
+}
+
+void setFrameSink(FrameSink sink) { g_frameSink = sink; }
+void emitFrame(const uint8_t* buffer, size_t len) {
+    if (g_frameSink) g_frameSink(buffer, len);
+}
+
+void setHaltHandler(HaltHandler handler) { g_haltHandler = handler; }
+void halt(const char* reason) {
+    fflush(stdout);
+    if (g_haltHandler) g_haltHandler(reason);
+    std::exit(0);
+}
+
+void dispatchEvents() {
+    while (!g_postedEvents.empty()) {
+        PostedEvent ev = std::move(g_postedEvents.front());
+        g_postedEvents.pop_front();
+        for (const auto& h : g_eventHandlers) {
+            if (h.base == ev.base && (h.id == ESP_EVENT_ANY_ID || h.id == ev.id)) {
+                h.handler(h.arg, ev.base, ev.id, ev.data.data());
+            }
+        }
+    }
+}
+
+} // namespace sim
+
+// --- Arduino core ---
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+ArduinoOTAClass ArduinoOTA;
+UpdateClass Update;
+Bluepad32 BP32;
+
+unsigned long millis() { return (unsigned long)(g_nowMicros / 1000); }
+unsigned long micros() { return (unsigned long)g_nowMicros; }
+void delay(uint32_t ms) { g_nowMicros += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { g_nowMicros += us; }
+void yield() {}
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    return (long)(sim::nextRandom() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+    // The device mixes hardware entropy regardless of the seed, so keep the
+    // run reproducible by ignoring it here too.
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    if (in_max == in_min) return out_min;
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static uint32_t g_cpuMhz = 240;
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz) { g_cpuMhz = cpu_freq_mhz; return true; }
+uint32_t getCpuFrequencyMhz() { return g_cpuMhz; }
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+int digitalRead(uint8_t pin) { return HIGH; }
+void digitalWrite(uint8_t pin, uint8_t val) {}
+
+uint32_t esp_random() { return sim::nextRandom(); }
+int64_t esp_timer_get_time() { return (int64_t)g_nowMicros; }
+
+const char* esp_err_to_name(esp_err_t code) { return code == ESP_OK ? "ESP_OK" : "ESP_FAIL"; }
+
+size_t Print::printf(const char* format, ...) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if ((size_t)len < sizeof(stackBuf)) return write((const uint8_t*)stackBuf, (size_t)len);
+    std::vector<char> heapBuf((size_t)len + 1);
+    va_start(args, format);
+    vsnprintf(heapBuf.data(), heapBuf.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)heapBuf.data(), (size_t)len);
+}
+
+int HardwareSerial::available() { return (int)g_serialInput.size(); }
+
+int HardwareSerial::read() {
+    if (g_serialInput.empty()) return -1;
+    char c = g_serialInput.front();
+    g_serialInput.pop_front();
+    return (uint8_t)c;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+void EspClass::restart() { sim::halt("ESP.restart()"); }
+
+// --- FreeRTOS ---
+
+void vTaskDelay(TickType_t ticks) { g_nowMicros += (uint64_t)ticks * 1000 * portTICK_PERIOD_MS; }
+
+struct SimQueue {
+    size_t itemSize;
+    size_t length;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new SimQueue{itemSize, length, {}};
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    if (!queue || queue->items.size() >= queue->length) return pdFALSE;
+    const uint8_t* p = static_cast<const uint8_t*>(item);
+    queue->items.emplace_back(p, p + queue->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait) {
+    if (!queue || queue->items.empty()) return pdFALSE;
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue ? (UBaseType_t)queue->items.size() : 0;
+}
+
+// --- esp_event ---
+
+ESP_EVENT_DEFINE_BASE(EBTN_EVENTS);
+
+esp_err_t esp_event_loop_create_default() { return ESP_OK; }
+
+esp_err_t esp_event_handler_instance_register(esp_event_base_t event_base, int32_t event_id,
+                                              esp_event_handler_t event_handler, void* event_handler_arg,
+                                              esp_event_handler_instance_t* instance) {
+    g_eventHandlers.push_back({event_base, event_id, event_handler, event_handler_arg});
+    return ESP_OK;
+}
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void* event_data,
+                         size_t event_data_size, TickType_t ticks_to_wait) {
+    const uint8_t* p = static_cast<const uint8_t*>(event_data);
+    g_postedEvents.push_back({event_base, event_id, std::vector<uint8_t>(p, p + event_data_size)});
+    return ESP_OK;
+}
+
+// --- Sleep ---
+
+void esp_deep_sleep_start() { sim::halt("esp_deep_sleep_start()"); }
+
+// --- Preferences ---
+
+bool Preferences::clear() {
+    if (!_open) return false;
+    g_nvs[_ns].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!_open) return false;
+    return g_nvs[_ns].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    return _open && g_nvs[_ns].count(key) > 0;
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    if (!_open || !value) return 0;
+    g_nvs[_ns][key] = value;
+    return strlen(value);
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    if (!_open) return defaultValue;
+    auto& ns = g_nvs[_ns];
+    auto it = ns.find(key);
+    return it == ns.end() ? defaultValue : String(it->second.c_str());
+}
+
+size_t Preferences::putInt64(const char* key, int64_t value, size_t size) {
+    if (!_open) return 0;
+    g_nvs[_ns][key] = std::to_string(value);
+    return size;
+}
+
+int64_t Preferences::getInt64(const char* key, int64_t defaultValue) {
+    if (!_open) return defaultValue;
+    auto& ns = g_nvs[_ns];
+    auto it = ns.find(key);
+    return it == ns.end() ? defaultValue : std::stoll(it->second);
+}
+
+// --- Bluetooth ---
+
+esp_err_t esp_bt_controller_enable(esp_bt_mode_t mode) { g_btStatus = ESP_BT_CONTROLLER_STATUS_ENABLED; return ESP_OK; }
+esp_err_t esp_bt_controller_disable() { g_btStatus = ESP_BT_CONTROLLER_STATUS_INITED; return ESP_OK; }
+esp_bt_controller_status_t esp_bt_controller_get_status() { return g_btStatus; }
+
+void Bluepad32::enableNewBluetoothConnections(bool enabled) { g_btNewConnections = enabled; }
+
+uni_hid_device_t* uni_hid_device_get_instance_for_idx(int idx) { return nullptr; }
+bool uni_bt_conn_is_connected(uni_bt_conn_t* conn) { return conn && conn->connected; }
+void uni_bt_disconnect_device_safe(int device_idx) {}
+bool uni_bt_enable_new_connections_is_enabled() { return g_btNewConnections; }
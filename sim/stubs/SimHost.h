@@ -0,0 +1,45 @@
+// Hooks shared between the host stand-ins and the simulator driver.
+// Nothing in src/ includes this; only sim/ code talks to it.
+#ifndef SIM_HOST_H
+#define SIM_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <string>
+
+namespace sim {
+
+// Virtual clock. millis()/micros()/esp_timer_get_time() read it; delay(),
+// vTaskDelay() and the driver advance it. It never follows wall time.
+uint64_t nowMicros();
+void advanceMicros(uint64_t us);
+
+// Deterministic PRNG behind esp_random()/random().
+void seedRandom(uint32_t seed);
+uint32_t nextRandom();
+
+// Text fed to Serial.read(), as if typed on the UART.
+void pushSerialInput(const std::string& text);
+
+// Called by U8G2::sendBuffer() with the raw 1024-byte page buffer.
+using FrameSink = std::function<void(const uint8_t* buffer, size_t len)>;
+void setFrameSink(FrameSink sink);
+void emitFrame(const uint8_t* buffer, size_t len);
+
+// Number of 8x8 tiles written to the panel so far, i.e. the I2C payload
+// of every sendBuffer()/updateDisplayArea() after any firmware filtering.
+uint64_t displayTilesSent();
+
+// Called when firmware code would reboot or deep sleep; the driver decides
+// whether that ends the run.
+using HaltHandler = std::function<void(const char* reason)>;
+void setHaltHandler(HaltHandler handler);
+[[noreturn]] void halt(const char* reason);
+
+// Runs queued esp_event_post() deliveries, like the default event loop task.
+void dispatchEvents();
+
+} // namespace sim
+
+#endif // SIM_HOST_H
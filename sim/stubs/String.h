@@ -0,0 +1 @@
+#include "WString.h"
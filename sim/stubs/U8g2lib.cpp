@@ -0,0 +1,340 @@
+#include "U8g2lib.h"
+#include "SimHost.h"
+
+const u8g2_cb_t u8g2_cb_r0 = {0};
+const u8g2_cb_t u8g2_cb_r2 = {2};
+
+const uint8_t u8g2_font_3x5im_te[] = {4, 6, 5, 1};
+const uint8_t u8g2_font_4x6_tf[] = {4, 6, 5, 1};
+const uint8_t u8g2_font_5x7_tf[] = {5, 7, 6, 1};
+const uint8_t u8g2_font_6x10_tf[] = {6, 10, 7, 2};
+const uint8_t u8g2_font_6x12_tf[] = {6, 12, 8, 2};
+const uint8_t u8g2_font_9x15_tf[] = {9, 15, 11, 3};
+const uint8_t u8g2_font_courR08_tr[] = {5, 9, 7, 2};
+const uint8_t u8g2_font_spleen5x8_mr[] = {5, 8, 7, 1};
+
+namespace {
+
+// 3x5 glyphs for ASCII 32..126, one row per value, bit 2 = left column.
+// Lower case shares the upper case shapes.
+const uint8_t GLYPHS_3X5[95][5] = {
+    {0, 0, 0, 0, 0}, {2, 2, 2, 0, 2}, {5, 5, 0, 0, 0}, {5, 7, 5, 7, 5}, // space ! " #
+    {3, 6, 2, 3, 6}, {5, 1, 2, 4, 5}, {2, 5, 2, 5, 3}, {2, 2, 0, 0, 0}, // $ % & '
+    {1, 2, 2, 2, 1}, {4, 2, 2, 2, 4}, {0, 5, 2, 5, 0}, {0, 2, 7, 2, 0}, // ( ) * +
+    {0, 0, 0, 2, 4}, {0, 0, 7, 0, 0}, {0, 0, 0, 0, 2}, {1, 1, 2, 4, 4}, // , - . /
+    {7, 5, 5, 5, 7}, {2, 6, 2, 2, 7}, {7, 1, 7, 4, 7}, {7, 1, 3, 1, 7}, // 0 1 2 3
+    {5, 5, 7, 1, 1}, {7, 4, 7, 1, 7}, {7, 4, 7, 5, 7}, {7, 1, 1, 2, 2}, // 4 5 6 7
+    {7, 5, 7, 5, 7}, {7, 5, 7, 1, 7}, {0, 2, 0, 2, 0}, {0, 2, 0, 2, 4}, // 8 9 : ;
+    {1, 2, 4, 2, 1}, {0, 7, 0, 7, 0}, {4, 2, 1, 2, 4}, {7, 1, 2, 0, 2}, // < = > ?
+    {7, 5, 7, 4, 7}, {2, 5, 7, 5, 5}, {6, 5, 6, 5, 6}, {3, 4, 4, 4, 3}, // @ A B C
+    {6, 5, 5, 5, 6}, {7, 4, 6, 4, 7}, {7, 4, 6, 4, 4}, {3, 4, 5, 5, 3}, // D E F G
+    {5, 5, 7, 5, 5}, {7, 2, 2, 2, 7}, {1, 1, 1, 5, 2}, {5, 5, 6, 5, 5}, // H I J K
+    {4, 4, 4, 4, 7}, {5, 7, 7, 5, 5}, {6, 5, 5, 5, 5}, {2, 5, 5, 5, 2}, // L M N O
+    {6, 5, 6, 4, 4}, {2, 5, 5, 6, 3}, {6, 5, 6, 5, 5}, {3, 4, 2, 1, 6}, // P Q R S
+    {7, 2, 2, 2, 2}, {5, 5, 5, 5, 7}, {5, 5, 5, 5, 2}, {5, 5, 7, 7, 5}, // T U V W
+    {5, 5, 2, 5, 5}, {5, 5, 2, 2, 2}, {7, 1, 2, 4, 7}, {6, 4, 4, 4, 6}, // X Y Z [
+    {4, 4, 2, 1, 1}, {3, 1, 1, 1, 3}, {2, 5, 0, 0, 0}, {0, 0, 0, 0, 7}, // \ ] ^ _
+    {4, 2, 0, 0, 0}, {2, 5, 7, 5, 5}, {6, 5, 6, 5, 6}, {3, 4, 4, 4, 3}, // ` a b c
+    {6, 5, 5, 5, 6}, {7, 4, 6, 4, 7}, {7, 4, 6, 4, 4}, {3, 4, 5, 5, 3}, // d e f g
+    {5, 5, 7, 5, 5}, {7, 2, 2, 2, 7}, {1, 1, 1, 5, 2}, {5, 5, 6, 5, 5}, // h i j k
+    {4, 4, 4, 4, 7}, {5, 7, 7, 5, 5}, {6, 5, 5, 5, 5}, {2, 5, 5, 5, 2}, // l m n o
+    {6, 5, 6, 4, 4}, {2, 5, 5, 6, 3}, {6, 5, 6, 5, 5}, {3, 4, 2, 1, 6}, // p q r s
+    {7, 2, 2, 2, 2}, {5, 5, 5, 5, 7}, {5, 5, 5, 5, 2}, {5, 5, 7, 7, 5}, // t u v w
+    {5, 5, 2, 5, 5}, {5, 5, 2, 2, 2}, {7, 1, 2, 4, 7}, {3, 2, 6, 2, 3}, // x y z {
+    {2, 2, 2, 2, 2}, {6, 2, 3, 2, 6}, {0, 3, 6, 0, 0},                  // | } ~
+};
+
+// Stand-in for any glyph outside printable ASCII (icon and symbol fonts).
+const uint8_t GLYPH_UNKNOWN[5] = {0, 2, 7, 2, 0};
+
+uint64_t g_displayTilesSent = 0;
+
+// SSD1306 stand-in: stores tiles in the panel RAM model and counts them.
+uint8_t simSsd1306DisplayCb(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    if (msg == U8X8_MSG_DISPLAY_INIT) {
+        memset(u8x8->simPanelRam, 0, U8G2::BUFFER_SIZE);
+    } else if (msg == U8X8_MSG_DISPLAY_DRAW_TILE) {
+        const u8x8_tile_t* tile = static_cast<const u8x8_tile_t*>(arg_ptr);
+        if (tile->y_pos >= U8G2::TILE_HEIGHT) return 1;
+        uint8_t x = tile->x_pos;
+        for (uint8_t r = 0; r < arg_int; r++) {
+            for (uint8_t i = 0; i < tile->cnt && x < U8G2::TILE_WIDTH; i++, x++) {
+                memcpy(u8x8->simPanelRam + tile->y_pos * U8G2::WIDTH + x * 8, tile->tile_ptr + i * 8, 8);
+                g_displayTilesSent++;
+            }
+        }
+    }
+    return 1;
+}
+
+} // namespace
+
+namespace sim {
+uint64_t displayTilesSent() { return g_displayTilesSent; }
+} // namespace sim
+
+U8G2::U8G2(const u8g2_cb_t* rotation) : _rotation(rotation ? rotation : U8G2_R0), _font(u8g2_font_5x7_tf) {
+    memset(_buffer, 0, sizeof(_buffer));
+    memset(_panelRam, 0, sizeof(_panelRam));
+    _u8x8.display_cb = simSsd1306DisplayCb;
+    _u8x8.simPanelRam = _panelRam;
+    _u8g2.cb = _rotation;
+}
+
+bool U8G2::begin() {
+    _u8x8.display_cb(&_u8x8, U8X8_MSG_DISPLAY_INIT, 0, nullptr);
+    clearBuffer();
+    sendBuffer();
+    return true;
+}
+
+void U8G2::setPowerSave(uint8_t is_enable) {
+    _powerSave = is_enable;
+    _u8x8.display_cb(&_u8x8, U8X8_MSG_DISPLAY_SET_POWER_SAVE, is_enable, nullptr);
+}
+
+void U8G2::clearBuffer() {
+    memset(_buffer, 0, sizeof(_buffer));
+}
+
+void U8G2::drawTiles(uint8_t tx, uint8_t ty, uint8_t tw) {
+    u8x8_tile_t tile;
+    tile.tile_ptr = _buffer + ty * WIDTH + tx * 8;
+    tile.cnt = tw;
+    tile.x_pos = tx;
+    tile.y_pos = ty;
+    _u8x8.display_cb(&_u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, &tile);
+}
+
+void U8G2::sendBuffer() {
+    for (uint8_t ty = 0; ty < TILE_HEIGHT; ty++) drawTiles(0, ty, TILE_WIDTH);
+    _u8x8.display_cb(&_u8x8, U8X8_MSG_DISPLAY_REFRESH, 0, nullptr);
+    sim::emitFrame(_panelRam, BUFFER_SIZE);
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    if (tx >= TILE_WIDTH || ty >= TILE_HEIGHT) return;
+    if (tx + tw > TILE_WIDTH) tw = TILE_WIDTH - tx;
+    if (ty + th > TILE_HEIGHT) th = TILE_HEIGHT - ty;
+    for (uint8_t row = ty; row < ty + th; row++) drawTiles(tx, row, tw);
+    _u8x8.display_cb(&_u8x8, U8X8_MSG_DISPLAY_REFRESH, 0, nullptr);
+    sim::emitFrame(_panelRam, BUFFER_SIZE);
+}
+
+void U8G2::setClipWindow(int x0, int y0, int x1, int y1) {
+    _clipX0 = std::max(0, x0);
+    _clipY0 = std::max(0, y0);
+    _clipX1 = std::min(WIDTH, x1);
+    _clipY1 = std::min(HEIGHT, y1);
+}
+
+void U8G2::setMaxClipWindow() {
+    _clipX0 = 0;
+    _clipY0 = 0;
+    _clipX1 = WIDTH;
+    _clipY1 = HEIGHT;
+}
+
+void U8G2::plot(int x, int y, uint8_t color) {
+    if (x < _clipX0 || x >= _clipX1 || y < _clipY0 || y >= _clipY1) return;
+    if (_rotation->quarterTurns == 2) {
+        x = WIDTH - 1 - x;
+        y = HEIGHT - 1 - y;
+    }
+    uint8_t* cell = &_buffer[(y >> 3) * WIDTH + x];
+    uint8_t mask = (uint8_t)(1 << (y & 7));
+    if (color == 0) *cell &= (uint8_t)~mask;
+    else if (color == 1) *cell |= mask;
+    else *cell ^= mask;
+}
+
+void U8G2::drawPixel(int x, int y) {
+    plot(x, y, _drawColor);
+}
+
+void U8G2::drawHLine(int x, int y, int w) {
+    for (int i = 0; i < w; i++) plot(x + i, y, _drawColor);
+}
+
+void U8G2::drawVLine(int x, int y, int h) {
+    for (int i = 0; i < h; i++) plot(x, y + i, _drawColor);
+}
+
+// u8g2_DrawLine()'s stepping (major axis, error starting at dx/2), so
+// diagonal lines have the same pixels as on the device.
+void U8G2::drawLine(int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    bool swapXY = dy > dx;
+    if (swapXY) {
+        std::swap(dx, dy);
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int err = dx >> 1;
+    int yStep = y1 > y0 ? 1 : -1;
+    for (int x = x0, y = y0; x <= x1; x++) {
+        if (swapXY) plot(y, x, _drawColor);
+        else plot(x, y, _drawColor);
+        err -= dy;
+        if (err < 0) {
+            y += yStep;
+            err += dx;
+        }
+    }
+}
+
+void U8G2::drawBox(int x, int y, int w, int h) {
+    for (int j = 0; j < h; j++) drawHLine(x, y + j, w);
+}
+
+void U8G2::drawFrame(int x, int y, int w, int h) {
+    if (w <= 0 || h <= 0) return;
+    drawHLine(x, y, w);
+    if (h >= 2) {
+        drawHLine(x, y + h - 1, w);
+        drawVLine(x, y + 1, h - 2);
+        if (w >= 2) drawVLine(x + w - 1, y + 1, h - 2);
+    }
+}
+
+void U8G2::circlePoints(int x0, int y0, int x, int y, uint8_t opt) {
+    if (opt & U8G2_DRAW_UPPER_RIGHT) { plot(x0 + x, y0 - y, _drawColor); plot(x0 + y, y0 - x, _drawColor); }
+    if (opt & U8G2_DRAW_UPPER_LEFT) { plot(x0 - x, y0 - y, _drawColor); plot(x0 - y, y0 - x, _drawColor); }
+    if (opt & U8G2_DRAW_LOWER_RIGHT) { plot(x0 + x, y0 + y, _drawColor); plot(x0 + y, y0 + x, _drawColor); }
+    if (opt & U8G2_DRAW_LOWER_LEFT) { plot(x0 - x, y0 + y, _drawColor); plot(x0 - y, y0 + x, _drawColor); }
+}
+
+void U8G2::discLines(int x0, int y0, int x, int y, uint8_t opt) {
+    if (opt & U8G2_DRAW_UPPER_RIGHT) { drawVLine(x0 + x, y0 - y, y + 1); drawVLine(x0 + y, y0 - x, x + 1); }
+    if (opt & U8G2_DRAW_UPPER_LEFT) { drawVLine(x0 - x, y0 - y, y + 1); drawVLine(x0 - y, y0 - x, x + 1); }
+    if (opt & U8G2_DRAW_LOWER_RIGHT) { drawVLine(x0 + x, y0, y + 1); drawVLine(x0 + y, y0, x + 1); }
+    if (opt & U8G2_DRAW_LOWER_LEFT) { drawVLine(x0 - x, y0, y + 1); drawVLine(x0 - y, y0, x + 1); }
+}
+
+void U8G2::drawCircle(int x0, int y0, int rad, uint8_t opt) {
+    int f = 1 - rad, ddF_x = 1, ddF_y = -2 * rad, x = 0, y = rad;
+    circlePoints(x0, y0, x, y, opt);
+    while (x < y) {
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++; ddF_x += 2; f += ddF_x;
+        circlePoints(x0, y0, x, y, opt);
+    }
+}
+
+void U8G2::drawDisc(int x0, int y0, int rad, uint8_t opt) {
+    int f = 1 - rad, ddF_x = 1, ddF_y = -2 * rad, x = 0, y = rad;
+    discLines(x0, y0, x, y, opt);
+    while (x < y) {
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++; ddF_x += 2; f += ddF_x;
+        discLines(x0, y0, x, y, opt);
+    }
+}
+
+void U8G2::drawRBox(int x, int y, int w, int h, int r) {
+    int xl = x + r, yu = y + r, xr = x + w - r - 1, yl = y + h - r - 1;
+    drawDisc(xl, yu, r, U8G2_DRAW_UPPER_LEFT);
+    drawDisc(xr, yu, r, U8G2_DRAW_UPPER_RIGHT);
+    drawDisc(xl, yl, r, U8G2_DRAW_LOWER_LEFT);
+    drawDisc(xr, yl, r, U8G2_DRAW_LOWER_RIGHT);
+    int ww = w - r - r, hh = h - r - r;
+    xl++; yu++;
+    if (ww >= 3) { ww -= 2; drawBox(xl, y, ww, r + 1); drawBox(xl, yl, ww, r + 1); }
+    if (hh >= 3) { hh -= 2; drawBox(x, yu, w, hh); }
+}
+
+void U8G2::drawRFrame(int x, int y, int w, int h, int r) {
+    int xl = x + r, yu = y + r, xr = x + w - r - 1, yl = y + h - r - 1;
+    drawCircle(xl, yu, r, U8G2_DRAW_UPPER_LEFT);
+    drawCircle(xr, yu, r, U8G2_DRAW_UPPER_RIGHT);
+    drawCircle(xl, yl, r, U8G2_DRAW_LOWER_LEFT);
+    drawCircle(xr, yl, r, U8G2_DRAW_LOWER_RIGHT);
+    int ww = w - r - r, hh = h - r - r;
+    xl++; yu++;
+    if (ww >= 3) { ww -= 2; h--; drawHLine(xl, y, ww); drawHLine(xl, y + h, ww); }
+    if (hh >= 3) { hh -= 2; w--; drawVLine(x, yu, hh); drawVLine(x + w, yu, hh); }
+}
+
+void U8G2::drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+    // Sort by y, then fill one scanline at a time between the long edge and
+    // the two short ones.
+    if (y0 > y1) { std::swap(x0, x1); std::swap(y0, y1); }
+    if (y1 > y2) { std::swap(x1, x2); std::swap(y1, y2); }
+    if (y0 > y1) { std::swap(x0, x1); std::swap(y0, y1); }
+    for (int y = y0; y <= y2; y++) {
+        auto edgeX = [y](int ax, int ay, int bx, int by) {
+            return ay == by ? ax : ax + (bx - ax) * (y - ay) / (by - ay);
+        };
+        int xa = edgeX(x0, y0, x2, y2);
+        int xb = (y < y1) ? edgeX(x0, y0, x1, y1) : edgeX(x1, y1, x2, y2);
+        if (xa > xb) std::swap(xa, xb);
+        drawHLine(xa, y, xb - xa + 1);
+    }
+}
+
+void U8G2::drawXBMP(int x, int y, int w, int h, const uint8_t* bitmap) {
+    if (!bitmap || w <= 0 || h <= 0) return;
+    int bytesPerRow = (w + 7) / 8;
+    uint8_t background = _drawColor == 0 ? 1 : 0;
+    for (int j = 0; j < h; j++) {
+        const uint8_t* row = bitmap + j * bytesPerRow;
+        for (int i = 0; i < w; i++) {
+            if (row[i >> 3] & (1 << (i & 7))) plot(x + i, y + j, _drawColor);
+            else if (!_bitmapTransparent) plot(x + i, y + j, background);
+        }
+    }
+}
+
+void U8G2::setFont(const uint8_t* font) {
+    if (font) _font = font;
+}
+
+int U8G2::glyphTop(int y) const {
+    int scale = _font[2] >= 10 ? 2 : 1;
+    int baseline = _fontPosTop ? y + _font[2] : y;
+    return baseline - 5 * scale;
+}
+
+void U8G2::renderGlyph(int x, int top, uint16_t encoding) {
+    const uint8_t* rows = (encoding >= 32 && encoding <= 126) ? GLYPHS_3X5[encoding - 32] : GLYPH_UNKNOWN;
+    int scale = _font[2] >= 10 ? 2 : 1;
+    int left = x + std::max(0, (_font[0] - 1 - 3 * scale) / 2);
+    for (int r = 0; r < 5; r++) {
+        for (int c = 0; c < 3; c++) {
+            if (!(rows[r] & (4 >> c))) continue;
+            for (int sy = 0; sy < scale; sy++) {
+                for (int sx = 0; sx < scale; sx++) plot(left + c * scale + sx, top + r * scale + sy, _drawColor);
+            }
+        }
+    }
+}
+
+u8g2_uint_t U8G2::drawGlyph(int x, int y, uint16_t encoding) {
+    renderGlyph(x, glyphTop(y), encoding);
+    return _font[0];
+}
+
+u8g2_uint_t U8G2::drawStr(int x, int y, const char* s) {
+    if (!s) return 0;
+    int top = glyphTop(y);
+    int startX = x;
+    for (; *s; s++) {
+        renderGlyph(x, top, (uint8_t)*s);
+        x += _font[0];
+    }
+    return (u8g2_uint_t)(x - startX);
+}
+
+u8g2_uint_t U8G2::getStrWidth(const char* s) const {
+    return s ? (u8g2_uint_t)(strlen(s) * _font[0]) : 0;
+}
+
+size_t U8G2::write(uint8_t c) {
+    _cursorX += drawGlyph(_cursorX, _cursorY, c);
+    return 1;
+}
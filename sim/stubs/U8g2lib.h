@@ -0,0 +1,189 @@
+// Host stand-in for U8g2 in full-buffer mode.
+//
+// The frame buffer uses the real SSD1306 page layout (8 pages of 128 bytes,
+// bit 0 = top row of the page) and drawing honours the display rotation, so
+// code that reads getBufferPtr() sees exactly what it would on the device.
+//
+// Fonts are not bundled. Every u8g2_font_* symbol carries only its metrics,
+// and glyphs are drawn with one built-in 3x5 face scaled to the font size.
+// String widths and line heights match the real fonts closely enough for
+// layout code; the exact glyph shapes do not.
+#ifndef SIM_U8G2LIB_H
+#define SIM_U8G2LIB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Arduino.h"
+
+typedef uint8_t u8g2_uint_t;
+typedef int16_t u8g2_int_t;
+
+#define U8X8_PIN_NONE 255
+#define U8X8_PROGMEM PROGMEM
+#define U8G2_DRAW_UPPER_RIGHT 0x01
+#define U8G2_DRAW_UPPER_LEFT 0x02
+#define U8G2_DRAW_LOWER_LEFT 0x04
+#define U8G2_DRAW_LOWER_RIGHT 0x08
+#define U8G2_DRAW_ALL (U8G2_DRAW_UPPER_RIGHT | U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_RIGHT | U8G2_DRAW_LOWER_LEFT)
+
+struct u8g2_cb_t {
+    uint8_t quarterTurns;
+};
+
+// Minimal u8x8 layer. As in the real library, sendBuffer() and
+// updateDisplayArea() reach the panel only through display_cb with
+// U8X8_MSG_DISPLAY_DRAW_TILE, so firmware code may wrap that callback.
+// The default callback copies tiles into a model of the SSD1306 RAM, which
+// is what the simulator publishes as the visible frame.
+#define U8X8_MSG_DISPLAY_SETUP_MEMORY 9
+#define U8X8_MSG_DISPLAY_INIT 10
+#define U8X8_MSG_DISPLAY_SET_POWER_SAVE 11
+#define U8X8_MSG_DISPLAY_SET_FLIP_MODE 13
+#define U8X8_MSG_DISPLAY_SET_CONTRAST 14
+#define U8X8_MSG_DISPLAY_DRAW_TILE 15
+#define U8X8_MSG_DISPLAY_REFRESH 16
+
+typedef struct u8x8_struct u8x8_t;
+typedef uint8_t (*u8x8_msg_cb)(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+struct u8x8_tile_t {
+    uint8_t* tile_ptr;
+    uint8_t cnt;
+    uint8_t x_pos;
+    uint8_t y_pos;
+};
+
+struct u8x8_struct {
+    u8x8_msg_cb display_cb;
+    uint8_t* simPanelRam; // Host only: the panel's 1024-byte GDDRAM
+};
+
+// The u8g2 C struct, reduced to the rotation callback pointer, so code can
+// test getU8g2()->cb against U8G2_R0 / U8G2_R2 as it would on the device.
+struct u8g2_struct {
+    const u8g2_cb_t* cb;
+};
+typedef struct u8g2_struct u8g2_t;
+
+extern const u8g2_cb_t u8g2_cb_r0;
+extern const u8g2_cb_t u8g2_cb_r2;
+#define U8G2_R0 (&u8g2_cb_r0)
+#define U8G2_R2 (&u8g2_cb_r2)
+
+// Font symbols: {advance, max char height, ascent, descent}.
+extern const uint8_t u8g2_font_3x5im_te[];
+extern const uint8_t u8g2_font_4x6_tf[];
+extern const uint8_t u8g2_font_5x7_tf[];
+extern const uint8_t u8g2_font_6x10_tf[];
+extern const uint8_t u8g2_font_6x12_tf[];
+extern const uint8_t u8g2_font_9x15_tf[];
+extern const uint8_t u8g2_font_courR08_tr[];
+extern const uint8_t u8g2_font_spleen5x8_mr[];
+
+class U8G2 : public Print {
+public:
+    static const int WIDTH = 128;
+    static const int HEIGHT = 64;
+    static const int TILE_WIDTH = WIDTH / 8;
+    static const int TILE_HEIGHT = HEIGHT / 8;
+    static const size_t BUFFER_SIZE = WIDTH * HEIGHT / 8;
+
+    explicit U8G2(const u8g2_cb_t* rotation = U8G2_R0);
+
+    bool begin();
+    void setPowerSave(uint8_t is_enable);
+    void setContrast(uint8_t value) {}
+
+    // --- Buffer ---
+    u8x8_t* getU8x8() { return &_u8x8; }
+    u8g2_t* getU8g2() { return &_u8g2; }
+    uint8_t* getBufferPtr() { return _buffer; }
+    uint8_t getBufferTileWidth() const { return TILE_WIDTH; }
+    uint8_t getBufferTileHeight() const { return TILE_HEIGHT; }
+    void clearBuffer();
+    void sendBuffer();
+    void updateDisplay() { sendBuffer(); }
+    // tx/ty/tw/th are in 8x8 tiles of the unrotated panel, like u8g2.
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    void clear() { clearBuffer(); sendBuffer(); }
+    void clearDisplay() { clear(); }
+    void firstPage() { clearBuffer(); }
+    uint8_t nextPage() { sendBuffer(); return 0; }
+
+    u8g2_uint_t getDisplayWidth() const { return WIDTH; }
+    u8g2_uint_t getDisplayHeight() const { return HEIGHT; }
+
+    // --- State ---
+    void setDrawColor(uint8_t color) { _drawColor = color; }
+    uint8_t getDrawColor() const { return _drawColor; }
+    void setBitmapMode(uint8_t is_transparent) { _bitmapTransparent = is_transparent; }
+    void setFontMode(uint8_t is_transparent) {}
+    void setClipWindow(int x0, int y0, int x1, int y1);
+    void setMaxClipWindow();
+
+    // --- Primitives (logical coordinates) ---
+    void drawPixel(int x, int y);
+    void drawHLine(int x, int y, int w);
+    void drawVLine(int x, int y, int h);
+    void drawLine(int x0, int y0, int x1, int y1);
+    void drawBox(int x, int y, int w, int h);
+    void drawFrame(int x, int y, int w, int h);
+    void drawRBox(int x, int y, int w, int h, int r);
+    void drawRFrame(int x, int y, int w, int h, int r);
+    void drawCircle(int x0, int y0, int rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawDisc(int x0, int y0, int rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+    void drawXBMP(int x, int y, int w, int h, const uint8_t* bitmap);
+    void drawXBM(int x, int y, int w, int h, const uint8_t* bitmap) { drawXBMP(x, y, w, h, bitmap); }
+
+    // --- Text ---
+    void setFont(const uint8_t* font);
+    void setFontPosTop() { _fontPosTop = true; }
+    void setFontPosBaseline() { _fontPosTop = false; }
+    u8g2_uint_t drawStr(int x, int y, const char* s);
+    u8g2_uint_t drawUTF8(int x, int y, const char* s) { return drawStr(x, y, s); }
+    u8g2_uint_t drawGlyph(int x, int y, uint16_t encoding);
+    u8g2_uint_t getStrWidth(const char* s) const;
+    u8g2_uint_t getUTF8Width(const char* s) const { return getStrWidth(s); }
+    int8_t getMaxCharHeight() const { return _font[1]; }
+    int8_t getMaxCharWidth() const { return _font[0]; }
+    int8_t getAscent() const { return _font[2]; }
+    int8_t getDescent() const { return -(int8_t)_font[3]; }
+    void setCursor(int x, int y) { _cursorX = x; _cursorY = y; }
+    int getCursorX() const { return _cursorX; }
+    int getCursorY() const { return _cursorY; }
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+
+private:
+    const u8g2_cb_t* _rotation;
+    uint8_t _buffer[BUFFER_SIZE];
+    uint8_t _panelRam[BUFFER_SIZE];
+    u8x8_t _u8x8;
+    u8g2_t _u8g2;
+    uint8_t _drawColor = 1;
+    uint8_t _bitmapTransparent = 0;
+    uint8_t _powerSave = 0;
+    int _clipX0 = 0, _clipY0 = 0, _clipX1 = WIDTH, _clipY1 = HEIGHT;
+    const uint8_t* _font;
+    bool _fontPosTop = false;
+    int _cursorX = 0, _cursorY = 0;
+
+    void drawTiles(uint8_t tx, uint8_t ty, uint8_t tw);
+    void plot(int x, int y, uint8_t color);
+    void circlePoints(int x0, int y0, int x, int y, uint8_t opt);
+    void discLines(int x0, int y0, int x, int y, uint8_t opt);
+    int glyphTop(int y) const;
+    void renderGlyph(int x, int top, uint16_t encoding);
+};
+
+// The constructor signature of the F_HW_I2C variant; the pins are ignored.
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE,
+                                         uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+        : U8G2(rotation) {}
+};
+
+#endif // SIM_U8G2LIB_H
@@ -0,0 +1,21 @@
+// Host stand-in for the ESP32 Update (flash writer) library. Every update
+// attempt fails cleanly.
+#ifndef SIM_UPDATE_H
+#define SIM_UPDATE_H
+
+#include "Arduino.h"
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass {
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN) { return false; }
+    size_t write(uint8_t* data, size_t len) { return 0; }
+    bool end(bool evenIfRemaining = false) { return false; }
+    bool hasError() { return true; }
+    const char* errorString() { return "Not supported in simulator"; }
+};
+
+extern UpdateClass Update;
+
+#endif // SIM_UPDATE_H
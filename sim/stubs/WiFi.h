@@ -0,0 +1,68 @@
+// Host stand-in for the ESP32 WiFi library. The radio never associates, so
+// status() stays WL_DISCONNECTED and OTA is never started.
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <stdint.h>
+#include <functional>
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "esp_wifi.h"
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_STA_START = 2,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+    ARDUINO_EVENT_MAX = 64
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+
+typedef struct {
+    struct {
+        struct {
+            struct { uint32_t addr; } ip;
+        } ip_info;
+    } got_ip;
+} WiFiEventInfo_t;
+
+typedef void (*WiFiEventSysCb)(WiFiEvent_t event, WiFiEventInfo_t info);
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t m) { _mode = m; return true; }
+    wl_status_t begin(const char* ssid, const char* passphrase = nullptr) { _ssid = ssid ? ssid : ""; return status(); }
+    bool disconnect(bool wifioff = false, bool eraseap = false) { return true; }
+    wl_status_t status() { return WL_DISCONNECTED; }
+    int8_t RSSI() { return 0; }
+    String SSID() const { return _ssid; }
+    IPAddress localIP() { return IPAddress(); }
+    bool getSleep() { return _sleep; }
+    bool setSleep(bool enabled) { _sleep = enabled; return true; }
+    int onEvent(WiFiEventSysCb cb, arduino_event_id_t event = ARDUINO_EVENT_MAX) { return 0; }
+
+private:
+    wifi_mode_t _mode = WIFI_OFF;
+    String _ssid;
+    bool _sleep = true;
+};
+
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
@@ -0,0 +1,10 @@
+// Host stand-in for <esp_attr.h>: placement attributes are no-ops.
+#ifndef SIM_ESP_ATTR_H
+#define SIM_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+#endif // SIM_ESP_ATTR_H
@@ -0,0 +1,26 @@
+// Host stand-in for <esp_bt.h>. The controller can be toggled but no radio
+// exists behind it.
+#ifndef SIM_ESP_BT_H
+#define SIM_ESP_BT_H
+
+#include "esp_err.h"
+
+typedef enum {
+    ESP_BT_CONTROLLER_STATUS_IDLE = 0,
+    ESP_BT_CONTROLLER_STATUS_INITED,
+    ESP_BT_CONTROLLER_STATUS_ENABLED,
+    ESP_BT_CONTROLLER_STATUS_NUM
+} esp_bt_controller_status_t;
+
+typedef enum {
+    ESP_BT_MODE_IDLE = 0,
+    ESP_BT_MODE_BLE,
+    ESP_BT_MODE_CLASSIC_BT,
+    ESP_BT_MODE_BTDM
+} esp_bt_mode_t;
+
+esp_err_t esp_bt_controller_enable(esp_bt_mode_t mode);
+esp_err_t esp_bt_controller_disable();
+esp_bt_controller_status_t esp_bt_controller_get_status();
+
+#endif // SIM_ESP_BT_H
@@ -0,0 +1,16 @@
+// Host stand-in for <esp_heap_caps.h>.
+#ifndef SIM_ESP_HEAP_CAPS_H
+#define SIM_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DEFAULT (1 << 12)
+#define MALLOC_CAP_8BIT (1 << 2)
+
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 110 * 1024; }
+inline size_t heap_caps_get_free_size(uint32_t caps) { return 200 * 1024; }
+inline uint32_t esp_get_free_heap_size() { return 200 * 1024; }
+inline uint32_t esp_get_minimum_free_heap_size() { return 150 * 1024; }
+
+#endif // SIM_ESP_HEAP_CAPS_H
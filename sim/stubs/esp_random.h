@@ -0,0 +1,10 @@
+// Host stand-in for <esp_random.h>. Draws from the seeded simulator PRNG so
+// runs are reproducible.
+#ifndef SIM_ESP_RANDOM_H
+#define SIM_ESP_RANDOM_H
+
+#include <stdint.h>
+
+uint32_t esp_random();
+
+#endif // SIM_ESP_RANDOM_H
@@ -0,0 +1,9 @@
+// Host stand-in for <esp_timer.h>. Returns the virtual simulator clock in us.
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif // SIM_ESP_TIMER_H
@@ -0,0 +1,52 @@
+// Host stand-in for ESPAsyncButton. Buttons never fire on their own; the
+// simulator posts EBTN_EVENTS directly, exactly like ScreenStreamer's
+// virtual buttons do on the device.
+#ifndef SIM_ESPASYNCBUTTON_HPP
+#define SIM_ESPASYNCBUTTON_HPP
+
+#include <stdint.h>
+#include "esp_event.h"
+#include "driver/gpio.h"
+
+ESP_EVENT_DECLARE_BASE(EBTN_EVENTS);
+
+struct EventMsg {
+    int32_t gpio;
+    int32_t cntr;
+};
+
+namespace ESPButton {
+
+enum class event_t : int32_t {
+    noop = 0,
+    press,
+    release,
+    click,
+    longPress,
+    longRelease,
+    multiClick,
+    autoRepeat
+};
+
+inline event_t int2event_t(int32_t e) { return static_cast<event_t>(e); }
+
+} // namespace ESPButton
+
+class ESPEventPolicy {};
+
+template <class EventPolicy>
+class GPIOButton {
+public:
+    GPIOButton(gpio_num_t gpio, bool logicLevel) : _gpio(gpio), _logicLevel(logicLevel) {}
+    void enableEvent(ESPButton::event_t event, bool enable = true) {}
+    void enable() { _enabled = true; }
+    void disable() { _enabled = false; }
+    gpio_num_t getGPIO() const { return _gpio; }
+
+private:
+    gpio_num_t _gpio;
+    bool _logicLevel;
+    bool _enabled = false;
+};
+
+#endif // SIM_ESPASYNCBUTTON_HPP
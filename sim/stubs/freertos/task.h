@@ -0,0 +1,15 @@
+// Host stand-in for <freertos/task.h>.
+#ifndef SIM_FREERTOS_TASK_H
+#define SIM_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+void vTaskDelay(TickType_t ticks);
+inline const char* pcTaskGetName(TaskHandle_t task) { return "sim"; }
+inline UBaseType_t uxTaskPriorityGet(TaskHandle_t task) { return 1; }
+inline UBaseType_t uxTaskGetNumberOfTasks() { return 1; }
+inline BaseType_t xPortGetCoreID() { return 1; }
+
+#endif // SIM_FREERTOS_TASK_H
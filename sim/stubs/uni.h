@@ -0,0 +1,45 @@
+// Host stand-in for the Bluepad32 "uni" C API. No controller ever connects.
+#ifndef SIM_UNI_H
+#define SIM_UNI_H
+
+#include <stdint.h>
+
+// Normally provided by sdkconfig.
+#ifndef CONFIG_BLUEPAD32_MAX_DEVICES
+#define CONFIG_BLUEPAD32_MAX_DEVICES 4
+#endif
+
+#define DPAD_UP 0x01
+#define DPAD_DOWN 0x02
+#define DPAD_RIGHT 0x04
+#define DPAD_LEFT 0x08
+#define MISC_BUTTON_SYSTEM 0x01
+#define MISC_BUTTON_SELECT 0x02
+#define MISC_BUTTON_START 0x04
+
+typedef struct {
+    uint8_t dpad;
+    uint16_t buttons;
+    uint8_t misc_buttons;
+} uni_gamepad_t;
+
+typedef struct {
+    uni_gamepad_t gamepad;
+} uni_controller_t;
+
+typedef struct {
+    bool connected;
+} uni_bt_conn_t;
+
+typedef struct uni_hid_device_s {
+    char name[64];
+    uni_controller_t controller;
+    uni_bt_conn_t conn;
+} uni_hid_device_t;
+
+uni_hid_device_t* uni_hid_device_get_instance_for_idx(int idx);
+bool uni_bt_conn_is_connected(uni_bt_conn_t* conn);
+void uni_bt_disconnect_device_safe(int device_idx);
+bool uni_bt_enable_new_connections_is_enabled();
+
+#endif // SIM_UNI_H
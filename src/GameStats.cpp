@@ -1,7 +1,7 @@
 #include "GameStats.h"
 #include "SerialForwarder.h" 
 #include <cmath>             
-#include "character/CharacterManager.h" 
+#include "Character/CharacterManager.h" 
 #include "DebugUtils.h"
 #include <map>
 
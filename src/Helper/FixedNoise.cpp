@@ -0,0 +1,321 @@
+#include "FixedNoise.h"
+#include <cmath>
+
+namespace {
+
+// FastNoiseLite's hashing primes.
+const uint32_t PRIME_X = 501125321u;
+const uint32_t PRIME_Y = 1136930381u;
+const uint32_t PRIME_Z = 1720413743u;
+
+// FastNoiseLite::Lookup::Gradients2D in Q14: 128 (x, y) pairs.
+const int16_t GRADIENTS_2D[256] = {
+    2139, 16244, 6270, 15137, 9974, 12998, 12998, 9974, 15137, 6270, 16244, 2139, 16244, -2139, 15137, -6270,
+    12998, -9974, 9974, -12998, 6270, -15137, 2139, -16244, -2139, -16244, -6270, -15137, -9974, -12998, -12998, -9974,
+    -15137, -6270, -16244, -2139, -16244, 2139, -15137, 6270, -12998, 9974, -9974, 12998, -6270, 15137, -2139, 16244,
+    2139, 16244, 6270, 15137, 9974, 12998, 12998, 9974, 15137, 6270, 16244, 2139, 16244, -2139, 15137, -6270,
+    12998, -9974, 9974, -12998, 6270, -15137, 2139, -16244, -2139, -16244, -6270, -15137, -9974, -12998, -12998, -9974,
+    -15137, -6270, -16244, -2139, -16244, 2139, -15137, 6270, -12998, 9974, -9974, 12998, -6270, 15137, -2139, 16244,
+    2139, 16244, 6270, 15137, 9974, 12998, 12998, 9974, 15137, 6270, 16244, 2139, 16244, -2139, 15137, -6270,
+    12998, -9974, 9974, -12998, 6270, -15137, 2139, -16244, -2139, -16244, -6270, -15137, -9974, -12998, -12998, -9974,
+    -15137, -6270, -16244, -2139, -16244, 2139, -15137, 6270, -12998, 9974, -9974, 12998, -6270, 15137, -2139, 16244,
+    2139, 16244, 6270, 15137, 9974, 12998, 12998, 9974, 15137, 6270, 16244, 2139, 16244, -2139, 15137, -6270,
+    12998, -9974, 9974, -12998, 6270, -15137, 2139, -16244, -2139, -16244, -6270, -15137, -9974, -12998, -12998, -9974,
+    -15137, -6270, -16244, -2139, -16244, 2139, -15137, 6270, -12998, 9974, -9974, 12998, -6270, 15137, -2139, 16244,
+    2139, 16244, 6270, 15137, 9974, 12998, 12998, 9974, 15137, 6270, 16244, 2139, 16244, -2139, 15137, -6270,
+    12998, -9974, 9974, -12998, 6270, -15137, 2139, -16244, -2139, -16244, -6270, -15137, -9974, -12998, -12998, -9974,
+    -15137, -6270, -16244, -2139, -16244, 2139, -15137, 6270, -12998, 9974, -9974, 12998, -6270, 15137, -2139, 16244,
+    6270, 15137, 15137, 6270, 15137, -6270, 6270, -15137, -6270, -15137, -15137, -6270, -15137, 6270, -6270, 15137
+};
+
+// FastNoiseLite::Lookup::Gradients3D: 64 (x, y, z, 0) edge vectors.
+const int8_t GRADIENTS_3D[256] = {
+     0,  1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,
+     1,  0,  1,  0, -1,  0,  1,  0,  1,  0, -1,  0, -1,  0, -1,  0,
+     1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,  0,
+     0,  1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,
+     1,  0,  1,  0, -1,  0,  1,  0,  1,  0, -1,  0, -1,  0, -1,  0,
+     1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,  0,
+     0,  1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,
+     1,  0,  1,  0, -1,  0,  1,  0,  1,  0, -1,  0, -1,  0, -1,  0,
+     1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,  0,
+     0,  1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,
+     1,  0,  1,  0, -1,  0,  1,  0,  1,  0, -1,  0, -1,  0, -1,  0,
+     1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,  0,
+     0,  1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,
+     1,  0,  1,  0, -1,  0,  1,  0,  1,  0, -1,  0, -1,  0, -1,  0,
+     1,  1,  0,  0, -1,  1,  0,  0,  1, -1,  0,  0, -1, -1,  0,  0,
+     1,  1,  0,  0,  0, -1,  1,  0, -1,  1,  0,  0,  0, -1, -1,  0
+};
+
+// Quintic fade t^3 (t (6t - 15) + 10) at t = i / 256, scaled to 65535.
+const uint16_t FADE[257] = {
+    0, 0, 0, 1, 2, 5, 8, 13, 19, 27, 37, 49, 63, 79, 99, 121,
+    145, 173, 204, 239, 277, 319, 364, 414, 467, 524, 586, 652, 723, 798, 878, 963,
+    1052, 1146, 1246, 1350, 1460, 1574, 1694, 1820, 1951, 2087, 2229, 2376, 2529, 2687, 2851, 3021,
+    3196, 3377, 3564, 3757, 3955, 4159, 4369, 4585, 4806, 5033, 5266, 5505, 5749, 5999, 6255, 6517,
+    6784, 7057, 7335, 7619, 7909, 8204, 8504, 8810, 9121, 9437, 9759, 10086, 10418, 10755, 11097, 11445,
+    11797, 12154, 12515, 12882, 13253, 13628, 14008, 14392, 14781, 15174, 15571, 15972, 16377, 16786, 17199, 17616,
+    18036, 18459, 18886, 19317, 19750, 20187, 20627, 21069, 21515, 21963, 22414, 22867, 23323, 23781, 24241, 24703,
+    25167, 25633, 26101, 26570, 27041, 27514, 27987, 28462, 28938, 29414, 29892, 30370, 30849, 31328, 31808, 32288,
+    32768, 33247, 33727, 34207, 34686, 35165, 35643, 36121, 36597, 37073, 37548, 38021, 38494, 38965, 39434, 39902,
+    40368, 40832, 41294, 41754, 42212, 42668, 43121, 43572, 44020, 44466, 44908, 45348, 45785, 46218, 46649, 47076,
+    47499, 47919, 48336, 48749, 49158, 49563, 49964, 50361, 50754, 51143, 51527, 51907, 52282, 52653, 53020, 53381,
+    53738, 54090, 54438, 54780, 55117, 55449, 55776, 56098, 56414, 56725, 57031, 57331, 57626, 57916, 58200, 58478,
+    58751, 59018, 59280, 59536, 59786, 60030, 60269, 60502, 60729, 60950, 61166, 61376, 61580, 61778, 61971, 62158,
+    62339, 62514, 62684, 62848, 63006, 63159, 63306, 63448, 63584, 63715, 63841, 63961, 64075, 64185, 64289, 64389,
+    64483, 64572, 64657, 64737, 64812, 64883, 64949, 65011, 65068, 65121, 65171, 65216, 65258, 65296, 65331, 65362,
+    65390, 65414, 65436, 65456, 65472, 65486, 65498, 65508, 65516, 65522, 65527, 65530, 65533, 65534, 65535, 65535,
+    65535
+};
+
+// Scale factors that bring each noise to -1..1, as in FastNoiseLite.
+const int32_t PERLIN_2D_SCALE = 46686;       // 1.4247691104677813, Q15
+const int32_t PERLIN_3D_SCALE = 31619;       // 0.964921414852142333984375, Q15
+const int64_t SIMPLEX_2D_SCALE = 6542893;    // 99.83685446303647, Q16
+const int32_t SIMPLEX_G2 = 13849;            // (3 - sqrt(3)) / 6
+
+inline uint32_t hash(int seed, uint32_t xPrimed, uint32_t yPrimed) {
+    return ((uint32_t)seed ^ xPrimed ^ yPrimed) * 0x27d4eb2du;
+}
+
+inline uint32_t hash(int seed, uint32_t xPrimed, uint32_t yPrimed, uint32_t zPrimed) {
+    return ((uint32_t)seed ^ xPrimed ^ yPrimed ^ zPrimed) * 0x27d4eb2du;
+}
+
+// Perlin works in Q14 values and Q15 weights so every product fits 32 bits:
+// offsets are Q16, gradients Q14, dot products Q14 (at most 2 in 3D).
+inline int32_t gradient(int seed, uint32_t xPrimed, uint32_t yPrimed, int32_t xd, int32_t yd) {
+    uint32_t h = hash(seed, xPrimed, yPrimed);
+    h ^= h >> 15;
+    const int16_t* g = GRADIENTS_2D + (h & (127 << 1));
+    return (xd * g[0] + yd * g[1]) >> 16;
+}
+
+inline int32_t gradient(int seed, uint32_t xPrimed, uint32_t yPrimed, uint32_t zPrimed, int32_t xd, int32_t yd, int32_t zd) {
+    uint32_t h = hash(seed, xPrimed, yPrimed, zPrimed);
+    h ^= h >> 15;
+    const int8_t* g = GRADIENTS_3D + (h & (63 << 2));
+    return (xd * g[0] + yd * g[1] + zd * g[2]) >> 2;
+}
+
+// Q16 fraction in, Q15 weight out.
+inline int32_t fade(int32_t t) {
+    int i = t >> 8;
+    int32_t a = FADE[i];
+    return (a + (((FADE[i + 1] - a) * (t & 0xFF)) >> 8)) >> 1;
+}
+
+inline int32_t lerp(int32_t a, int32_t b, int32_t t) {
+    return a + (((b - a) * t) >> 15);
+}
+
+inline int32_t square(int32_t v) {
+    return (int32_t)(((int64_t)v * v) >> 16);
+}
+
+// One OpenSimplex2 corner: a^4 * gradient, with a in Q16 (0..0.5), the
+// gradient in Q14 and the result in Q46, so small contributions keep their
+// precision.
+inline int64_t simplexCorner(int32_t a, int32_t dot) {
+    uint32_t a2 = (uint32_t)a * (uint32_t)a;                  // Q32
+    uint32_t a4 = (uint32_t)(((uint64_t)a2 * a2) >> 32);      // Q32
+    return (int64_t)a4 * dot;
+}
+
+} // namespace
+
+FixedNoise::FixedNoise() {
+    updateAmplitudes();
+}
+
+void FixedNoise::SetFractalOctaves(int octaves) {
+    _octaves = octaves < 1 ? 1 : (octaves > MAX_OCTAVES ? MAX_OCTAVES : octaves);
+    updateAmplitudes();
+}
+
+void FixedNoise::SetFractalGain(float gain) {
+    _gain = gain;
+    updateAmplitudes();
+}
+
+// FastNoiseLite's fractal bounding: the octave weights sum to 1.
+void FixedNoise::updateAmplitudes() {
+    float gain = fabsf(_gain);
+    float amp = gain;
+    float ampFractal = 1.0f;
+    for (int i = 1; i < _octaves; ++i) {
+        ampFractal += amp;
+        amp *= gain;
+    }
+    amp = 1.0f / ampFractal;
+    for (int i = 0; i < MAX_OCTAVES; ++i) {
+        _amplitudes[i] = (int32_t)lroundf(amp * 65536.0f);
+        amp *= _gain;
+    }
+}
+
+FixedNoise::Coord FixedNoise::toCoord(float v) {
+    Coord coord;
+    coord.cell = v >= 0 ? (int32_t)v : (int32_t)v - 1;
+    coord.frac = (int32_t)((v - (float)coord.cell) * 65536.0f);
+    if (coord.frac >= 65536) { // Negative whole numbers
+        coord.cell += coord.frac >> 16;
+        coord.frac &= 0xFFFF;
+    }
+    return coord;
+}
+
+int32_t FixedNoise::toStep(float v) {
+    return (int32_t)lroundf(v * 65536.0f);
+}
+
+void FixedNoise::advance(Coord& coord, int32_t step) {
+    int32_t frac = coord.frac + step;
+    coord.cell += frac >> 16;
+    coord.frac = frac & 0xFFFF;
+}
+
+// Frequency, then the skew OpenSimplex2 samples in (FastNoiseLite's
+// TransformNoiseCoordinate). Linear, so it also maps row steps.
+void FixedNoise::transform(float& x, float& y) const {
+    x *= _frequency;
+    y *= _frequency;
+    if (_noiseType == NoiseType_OpenSimplex2) {
+        const float F2 = 0.5f * (1.7320508075688772f - 1.0f);
+        float t = (x + y) * F2;
+        x += t;
+        y += t;
+    }
+}
+
+int32_t FixedNoise::single(int seed, Coord x, Coord y) const {
+    return _noiseType == NoiseType_Perlin ? perlin(seed, x, y) : simplex(seed, x, y);
+}
+
+float FixedNoise::GetNoise(float x, float y) const {
+    transform(x, y);
+    int seed = _seed;
+    int32_t sum = 0;
+    for (int octave = 0; octave < octaveCount(); ++octave) {
+        int32_t noise = single(seed++, toCoord(x), toCoord(y));
+        sum += (int32_t)(((int64_t)noise * amplitude(octave)) >> 16);
+        x *= _lacunarity;
+        y *= _lacunarity;
+    }
+    return sum * (1.0f / 65536.0f);
+}
+
+float FixedNoise::GetNoise(float x, float y, float z) const {
+    x *= _frequency;
+    y *= _frequency;
+    z *= _frequency;
+    int seed = _seed;
+    int32_t sum = 0;
+    for (int octave = 0; octave < octaveCount(); ++octave) {
+        int32_t noise = perlin(seed++, toCoord(x), toCoord(y), toCoord(z));
+        sum += (int32_t)(((int64_t)noise * amplitude(octave)) >> 16);
+        x *= _lacunarity;
+        y *= _lacunarity;
+        z *= _lacunarity;
+    }
+    return sum * (1.0f / 65536.0f);
+}
+
+void FixedNoise::GetNoiseRow(float x, float y, float stepX, float stepY, int count, int16_t* out) const {
+    if (count <= 0 || !out) return;
+    transform(x, y);
+    transform(stepX, stepY);
+
+    const int octaves = octaveCount();
+    Coord xs[MAX_OCTAVES], ys[MAX_OCTAVES];
+    int32_t xSteps[MAX_OCTAVES], ySteps[MAX_OCTAVES];
+    for (int octave = 0; octave < octaves; ++octave) {
+        xs[octave] = toCoord(x);
+        ys[octave] = toCoord(y);
+        xSteps[octave] = toStep(stepX);
+        ySteps[octave] = toStep(stepY);
+        x *= _lacunarity;
+        y *= _lacunarity;
+        stepX *= _lacunarity;
+        stepY *= _lacunarity;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int seed = _seed;
+        int32_t sum = 0;
+        for (int octave = 0; octave < octaves; ++octave) {
+            int32_t noise = single(seed++, xs[octave], ys[octave]);
+            sum += (int32_t)(((int64_t)noise * amplitude(octave)) >> 16);
+            advance(xs[octave], xSteps[octave]);
+            advance(ys[octave], ySteps[octave]);
+        }
+        int32_t sample = sum >> 1; // Q16 to Q15
+        out[i] = (int16_t)(sample > SAMPLE_ONE ? SAMPLE_ONE : (sample < -SAMPLE_ONE ? -SAMPLE_ONE : sample));
+    }
+}
+
+// FastNoiseLite::SinglePerlin (2D).
+int32_t FixedNoise::perlin(int seed, Coord x, Coord y) {
+    int32_t xd0 = x.frac, yd0 = y.frac;
+    int32_t xd1 = xd0 - 65536, yd1 = yd0 - 65536;
+    int32_t xs = fade(xd0), ys = fade(yd0);
+
+    uint32_t x0 = (uint32_t)x.cell * PRIME_X, y0 = (uint32_t)y.cell * PRIME_Y;
+    uint32_t x1 = x0 + PRIME_X, y1 = y0 + PRIME_Y;
+
+    int32_t xf0 = lerp(gradient(seed, x0, y0, xd0, yd0), gradient(seed, x1, y0, xd1, yd0), xs);
+    int32_t xf1 = lerp(gradient(seed, x0, y1, xd0, yd1), gradient(seed, x1, y1, xd1, yd1), xs);
+    return ((lerp(xf0, xf1, ys) * PERLIN_2D_SCALE) >> 15) << 2;
+}
+
+// FastNoiseLite::SinglePerlin (3D).
+int32_t FixedNoise::perlin(int seed, Coord x, Coord y, Coord z) {
+    int32_t xd0 = x.frac, yd0 = y.frac, zd0 = z.frac;
+    int32_t xd1 = xd0 - 65536, yd1 = yd0 - 65536, zd1 = zd0 - 65536;
+    int32_t xs = fade(xd0), ys = fade(yd0), zs = fade(zd0);
+
+    uint32_t x0 = (uint32_t)x.cell * PRIME_X, y0 = (uint32_t)y.cell * PRIME_Y, z0 = (uint32_t)z.cell * PRIME_Z;
+    uint32_t x1 = x0 + PRIME_X, y1 = y0 + PRIME_Y, z1 = z0 + PRIME_Z;
+
+    int32_t xf00 = lerp(gradient(seed, x0, y0, z0, xd0, yd0, zd0), gradient(seed, x1, y0, z0, xd1, yd0, zd0), xs);
+    int32_t xf10 = lerp(gradient(seed, x0, y1, z0, xd0, yd1, zd0), gradient(seed, x1, y1, z0, xd1, yd1, zd0), xs);
+    int32_t xf01 = lerp(gradient(seed, x0, y0, z1, xd0, yd0, zd1), gradient(seed, x1, y0, z1, xd1, yd0, zd1), xs);
+    int32_t xf11 = lerp(gradient(seed, x0, y1, z1, xd0, yd1, zd1), gradient(seed, x1, y1, z1, xd1, yd1, zd1), xs);
+
+    int32_t yf0 = lerp(xf00, xf10, ys);
+    int32_t yf1 = lerp(xf01, xf11, ys);
+    return ((lerp(yf0, yf1, zs) * PERLIN_3D_SCALE) >> 15) << 2;
+}
+
+// FastNoiseLite::SingleSimplex, the 2D OpenSimplex2 (coordinates already
+// skewed by transform()).
+int32_t FixedNoise::simplex(int seed, Coord x, Coord y) {
+    int32_t t = ((x.frac + y.frac) * SIMPLEX_G2) >> 16;
+    int32_t x0 = x.frac - t;
+    int32_t y0 = y.frac - t;
+    uint32_t i = (uint32_t)x.cell * PRIME_X;
+    uint32_t j = (uint32_t)y.cell * PRIME_Y;
+
+    int64_t sum = 0; // Q46
+    int32_t a = 32768 - square(x0) - square(y0);
+    if (a > 0) sum += simplexCorner(a, gradient(seed, i, j, x0, y0));
+
+    int32_t x2 = x0 + (2 * SIMPLEX_G2 - 65536);
+    int32_t y2 = y0 + (2 * SIMPLEX_G2 - 65536);
+    int32_t c = 32768 - square(x2) - square(y2);
+    if (c > 0) sum += simplexCorner(c, gradient(seed, i + PRIME_X, j + PRIME_Y, x2, y2));
+
+    if (y0 > x0) {
+        int32_t x1 = x0 + SIMPLEX_G2;
+        int32_t y1 = y0 + (SIMPLEX_G2 - 65536);
+        int32_t b = 32768 - square(x1) - square(y1);
+        if (b > 0) sum += simplexCorner(b, gradient(seed, i, j + PRIME_Y, x1, y1));
+    } else {
+        int32_t x1 = x0 + (SIMPLEX_G2 - 65536);
+        int32_t y1 = y0 + SIMPLEX_G2;
+        int32_t b = 32768 - square(x1) - square(y1);
+        if (b > 0) sum += simplexCorner(b, gradient(seed, i + PRIME_X, j, x1, y1));
+    }
+    return (int32_t)(((sum >> 14) * SIMPLEX_2D_SCALE) >> 32);
+}
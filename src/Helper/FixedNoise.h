@@ -0,0 +1,86 @@
+#ifndef FIXED_NOISE_H
+#define FIXED_NOISE_H
+
+#include <Arduino.h>
+
+// Integer version of the FastNoiseLite noise the game samples every frame:
+// Perlin (2D and 3D) and OpenSimplex2 (2D), on their own or as FBm. It uses
+// FastNoiseLite's hashing, gradient sets and scaling, so with the same seed
+// and settings it gives the same field to within about 1e-3 (measured by
+// sim/bench/NoiseBench.cpp). Coordinates become 16.16 fixed point once per
+// sample, or once per row with GetNoiseRow(); after that it is integer
+// arithmetic and table lookups, which suits the ESP32's slow FPU.
+//
+// The setters and GetNoise() mirror FastNoiseLite's, so a call site switches
+// by changing the type of its member. Noise types, fractal types and options
+// not listed here (cellular, OpenSimplex2S, domain warp, ...) stay with
+// FastNoiseLite.
+class FixedNoise {
+public:
+    enum NoiseType {
+        NoiseType_OpenSimplex2,
+        NoiseType_Perlin
+    };
+
+    enum FractalType {
+        FractalType_None,
+        FractalType_FBm
+    };
+
+    static const int MAX_OCTAVES = 8;
+    // GetNoiseRow() writes -1..1 as -SAMPLE_ONE..SAMPLE_ONE.
+    static const int16_t SAMPLE_ONE = 32767;
+
+    FixedNoise();
+
+    void SetSeed(int seed) { _seed = seed; }
+    void SetFrequency(float frequency) { _frequency = frequency; }
+    void SetNoiseType(NoiseType noiseType) { _noiseType = noiseType; }
+    void SetFractalType(FractalType fractalType) { _fractalType = fractalType; }
+    void SetFractalOctaves(int octaves);
+    void SetFractalLacunarity(float lacunarity) { _lacunarity = lacunarity; }
+    void SetFractalGain(float gain);
+
+    // -1..1, like FastNoiseLite::GetNoise(). 3D noise is always Perlin.
+    float GetNoise(float x, float y) const;
+    float GetNoise(float x, float y, float z) const;
+
+    // 'count' samples starting at (x, y), each (stepX, stepY) further on: a
+    // row, a column or any straight line of the field. The float transform is
+    // done once per octave for the whole line instead of for every sample.
+    void GetNoiseRow(float x, float y, float stepX, float stepY, int count, int16_t* out) const;
+
+private:
+    // A noise-space coordinate: integer cell and 16-bit fraction (0..65535).
+    struct Coord {
+        int32_t cell;
+        int32_t frac;
+    };
+
+    static Coord toCoord(float v);
+    static int32_t toStep(float v);
+    static void advance(Coord& coord, int32_t step);
+
+    void transform(float& x, float& y) const;
+    int octaveCount() const { return _fractalType == FractalType_FBm ? _octaves : 1; }
+    int32_t amplitude(int octave) const { return _fractalType == FractalType_FBm ? _amplitudes[octave] : 65536; }
+    int32_t single(int seed, Coord x, Coord y) const;
+    void updateAmplitudes();
+
+    // Results are Q16 (65536 = 1.0).
+    static int32_t perlin(int seed, Coord x, Coord y);
+    static int32_t perlin(int seed, Coord x, Coord y, Coord z);
+    static int32_t simplex(int seed, Coord x, Coord y);
+
+    // FastNoiseLite's defaults.
+    int _seed = 1337;
+    float _frequency = 0.01f;
+    NoiseType _noiseType = NoiseType_OpenSimplex2;
+    FractalType _fractalType = FractalType_None;
+    int _octaves = 3;
+    float _lacunarity = 2.0f;
+    float _gain = 0.5f;
+    int32_t _amplitudes[MAX_OCTAVES]; // Q16 FBm weights, fractal bounding included
+};
+
+#endif // FIXED_NOISE_H
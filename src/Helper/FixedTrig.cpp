@@ -0,0 +1,88 @@
+#include "FixedTrig.h"
+
+namespace {
+
+constexpr double PI_D = 3.14159265358979323846;
+
+// Taylor series of sin(x) for |x| <= pi/2, where 13 terms reach double
+// precision. Written recursively so it stays a C++11 constant expression.
+constexpr double sineSeries(double x2, double term, int n, double sum) {
+    return n > 25 ? sum : sineSeries(x2, -term * x2 / ((n + 1) * (n + 2)), n + 2, sum + term);
+}
+constexpr double quarterSine(double x) { return sineSeries(x * x, x, 1, 0.0); }
+
+// sin(2 pi step / SINE_STEPS), folded into the first quarter.
+constexpr double sineOfStep(int step) {
+    return step <= 128 ? quarterSine(PI_D * step / 256)
+         : step <= 256 ? quarterSine(PI_D * (256 - step) / 256)
+                       : -sineOfStep(step - 256);
+}
+constexpr int16_t sineEntry(int step) {
+    return (int16_t)(sineOfStep(step) >= 0 ? sineOfStep(step) * FixedTrig::ONE + 0.5
+                                           : sineOfStep(step) * FixedTrig::ONE - 0.5);
+}
+
+// Euler's series for atan(x), geometric in x^2 / (1 + x^2) <= 1/2 on 0..1.
+constexpr double atanSeries(double ratio, double term, int n, double sum) {
+    return n > 60 ? sum : atanSeries(ratio, term * ratio * (2 * n + 2) / (2 * n + 3), n + 1, sum + term);
+}
+constexpr double atanOf(double x) { return atanSeries(x * x / (1 + x * x), x / (1 + x * x), 0, 0.0); }
+
+// atan(i / 256) in angle units (0..8192), for tangents 0..1.
+constexpr int ATAN_STEPS = 256;
+constexpr uint16_t atanEntry(int i) { return (uint16_t)(atanOf(i / (double)ATAN_STEPS) * 32768.0 / PI_D + 0.5); }
+
+#define TABLE_4(f, i) f(i), f(i + 1), f(i + 2), f(i + 3)
+#define TABLE_16(f, i) TABLE_4(f, i), TABLE_4(f, i + 4), TABLE_4(f, i + 8), TABLE_4(f, i + 12)
+#define TABLE_64(f, i) TABLE_16(f, i), TABLE_16(f, i + 16), TABLE_16(f, i + 32), TABLE_16(f, i + 48)
+#define TABLE_256(f, i) TABLE_64(f, i), TABLE_64(f, i + 64), TABLE_64(f, i + 128), TABLE_64(f, i + 192)
+
+const uint16_t ATAN_TABLE[ATAN_STEPS + 1] = {TABLE_256(atanEntry, 0), atanEntry(256)};
+
+// tangent in Q16 (0..65536) to an angle of 0..45 degrees.
+FixedTrig::Angle atanOfRatio(uint32_t tangent) {
+    const uint32_t index = tangent >> 8;
+    if (index >= ATAN_STEPS) return ATAN_TABLE[ATAN_STEPS];
+    const int32_t frac = tangent & 255;
+    const int32_t a = ATAN_TABLE[index];
+    return (FixedTrig::Angle)(a + (((ATAN_TABLE[index + 1] - a) * frac + 128) >> 8));
+}
+
+// Unfolds an angle of the first octant to the octant of (x, y).
+FixedTrig::Angle unfold(FixedTrig::Angle angle, bool steep, bool negativeX, bool negativeY) {
+    if (steep) angle = FixedTrig::QUARTER_TURN - angle;
+    if (negativeX) angle = FixedTrig::HALF_TURN - angle;
+    if (negativeY) angle = (FixedTrig::Angle)-angle;
+    return angle;
+}
+
+} // namespace
+
+namespace FixedTrig {
+
+const int16_t SINE_TABLE[SINE_STEPS + 1] = {TABLE_256(sineEntry, 0), TABLE_256(sineEntry, 256), sineEntry(512)};
+
+Angle atan2(int32_t y, int32_t x) {
+    uint32_t ax = x < 0 ? 0u - (uint32_t)x : (uint32_t)x;
+    uint32_t ay = y < 0 ? 0u - (uint32_t)y : (uint32_t)y;
+    if (ax == 0 && ay == 0) return 0;
+    bool steep = ay > ax;
+    uint32_t tangent = steep ? (uint32_t)(((uint64_t)ax << 16) / ay) : (uint32_t)(((uint64_t)ay << 16) / ax);
+    return unfold(atanOfRatio(tangent), steep, x < 0, y < 0);
+}
+
+Angle atan2(float y, float x) {
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    if (ax == 0.0f && ay == 0.0f) return 0;
+    bool steep = ay > ax;
+    uint32_t tangent = (uint32_t)((steep ? ax / ay : ay / ax) * 65536.0f + 0.5f);
+    return unfold(atanOfRatio(tangent), steep, x < 0.0f, y < 0.0f);
+}
+
+} // namespace FixedTrig
+
+#undef TABLE_256
+#undef TABLE_64
+#undef TABLE_16
+#undef TABLE_4
@@ -0,0 +1,57 @@
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+#include <Arduino.h>
+#include <math.h>
+
+// Table-driven sin/cos/atan2 for per-pixel and per-particle work, where the
+// libm calls cost more than the drawing they feed. Angles are binary units,
+// 65536 to the turn, so wrapping is free integer overflow; results are Q15
+// (ONE = 1.0). The tables are computed at compile time (FixedTrig.cpp) and
+// interpolated linearly, which keeps the error under 1e-4 (measured by
+// sim/bench/TrigBench.cpp).
+namespace FixedTrig {
+
+typedef uint16_t Angle;
+
+const int32_t ONE = 32767;
+const Angle QUARTER_TURN = 16384;
+const Angle HALF_TURN = 32768;
+const float UNITS_PER_RADIAN = 65536.0f / (2.0f * (float)M_PI);
+const float UNITS_PER_DEGREE = 65536.0f / 360.0f;
+
+// One turn of sine: 512 steps plus a guard entry for interpolation.
+const int SINE_STEPS = 512;
+extern const int16_t SINE_TABLE[SINE_STEPS + 1];
+
+inline Angle fromUnits(float units) {
+    // Past int32 range (a phase left to grow for days) reduce to one turn first.
+    if (units >= 2.0e9f || units <= -2.0e9f) units = fmodf(units, 65536.0f);
+    return (Angle)(int32_t)floorf(units + 0.5f);
+}
+inline Angle fromRadians(float radians) { return fromUnits(radians * UNITS_PER_RADIAN); }
+inline Angle fromDegrees(float degrees) { return fromUnits(degrees * UNITS_PER_DEGREE); }
+inline float toRadians(Angle angle) { return angle / UNITS_PER_RADIAN; }
+
+inline int32_t sin(Angle angle) {
+    const int index = angle >> 7;
+    const int32_t frac = angle & 127;
+    const int32_t a = SINE_TABLE[index];
+    return a + (((SINE_TABLE[index + 1] - a) * frac + 64) >> 7);
+}
+inline int32_t cos(Angle angle) { return sin((Angle)(angle + QUARTER_TURN)); }
+
+// -1..1 as float, for callers that go on in float.
+inline float sinF(Angle angle) { return sin(angle) * (1.0f / ONE); }
+inline float cosF(Angle angle) { return cos(angle) * (1.0f / ONE); }
+
+// value * q15, rounded: a length along a sin/cos direction.
+inline int32_t scale(int32_t value, int32_t q15) { return (value * q15 + (1 << 14)) >> 15; }
+
+// Angle of the vector (x, y), as ::atan2(y, x); 0 for (0, 0).
+Angle atan2(int32_t y, int32_t x);
+Angle atan2(float y, float x);
+
+} // namespace FixedTrig
+
+#endif // FIXED_TRIG_H
@@ -0,0 +1,195 @@
+#include "FrameBufferView.h"
+#include <algorithm>
+#include <cstdlib>
+#include "Renderer.h"
+
+FrameBufferView::FrameBufferView(Renderer& renderer) {
+    U8G2* u8g2 = renderer.getU8G2();
+    if (!u8g2) return;
+    _u8g2 = u8g2;
+
+    const int displayW = u8g2->getDisplayWidth();
+    const int displayH = u8g2->getDisplayHeight();
+    _maxX = displayW - 1;
+    _maxY = displayH - 1;
+    _originX = renderer.getXOffset();
+    _originY = renderer.getYOffset();
+    _width = renderer.getWidth();
+    _height = renderer.getHeight();
+    _clipX0 = std::max(0, _originX);
+    _clipY0 = std::max(0, _originY);
+    _clipX1 = std::min(displayW, _originX + _width);
+    _clipY1 = std::min(displayH, _originY + _height);
+
+    const u8g2_cb_t* rotation = u8g2->getU8g2()->cb;
+    _rotated180 = rotation == U8G2_R2;
+    if ((_rotated180 || rotation == U8G2_R0) && (displayH & 7) == 0 &&
+        u8g2->getBufferTileHeight() * 8 == displayH) {
+        _buffer = u8g2->getBufferPtr();
+        _stride = displayW;
+    }
+}
+
+void FrameBufferView::clipTo(int x0, int y0, int x1, int y1) {
+    _clipX0 = std::max(_clipX0, _originX + x0);
+    _clipY0 = std::max(_clipY0, _originY + y0);
+    _clipX1 = std::min(_clipX1, _originX + x1);
+    _clipY1 = std::min(_clipY1, _originY + y1);
+}
+
+void FrameBufferView::fill(int x, int y, int w, int h, Op op) {
+    if (w <= 0 || h <= 0) return;
+    x += _originX;
+    y += _originY;
+    int x0 = std::max(x, _clipX0);
+    int y0 = std::max(y, _clipY0);
+    int x1 = std::min(x + w, _clipX1);
+    int y1 = std::min(y + h, _clipY1);
+    if (x0 >= x1 || y0 >= y1) return;
+    if (!_buffer) {
+        fillThroughU8g2(x0, y0, x1, y1, op);
+        return;
+    }
+    fillAbsolute(x0, y0, x1, y1, op);
+}
+
+// x0..x1, y0..y1 are clipped, absolute and end exclusive. Every page byte of
+// the rectangle is read and written once.
+void FrameBufferView::fillAbsolute(int x0, int y0, int x1, int y1, Op op) {
+    if (_rotated180) {
+        int flippedX0 = _maxX + 1 - x1;
+        int flippedY0 = _maxY + 1 - y1;
+        x1 = _maxX + 1 - x0;
+        y1 = _maxY + 1 - y0;
+        x0 = flippedX0;
+        y0 = flippedY0;
+    }
+    const int lastRow = y1 - 1;
+    for (int page = y0 >> 3; page <= lastRow >> 3; ++page) {
+        int top = std::max(y0, page * 8) & 7;
+        int bottom = std::min(lastRow, page * 8 + 7) & 7;
+        uint8_t mask = (uint8_t)((0xFF << top) & (0xFF >> (7 - bottom)));
+        uint8_t* cell = _buffer + page * _stride + x0;
+        for (int x = x0; x < x1; ++x, ++cell) apply(*cell, mask, op);
+    }
+}
+
+void FrameBufferView::fillThroughU8g2(int x0, int y0, int x1, int y1, Op op) {
+    uint8_t originalColor = _u8g2->getDrawColor();
+    _u8g2->setDrawColor(op);
+    if (x1 - x0 == 1 && y1 - y0 == 1) _u8g2->drawPixel(x0, y0);
+    else _u8g2->drawBox(x0, y0, x1 - x0, y1 - y0);
+    _u8g2->setDrawColor(originalColor);
+}
+
+void FrameBufferView::blitColumns(int x, int y, const uint32_t* masks, int w, Op op) {
+    x += _originX;
+    y += _originY;
+    const int first = std::max(0, _clipX0 - x);
+    const int last = std::min(w, _clipX1 - x);
+    if (first >= last || _clipY0 >= _clipY1 || y >= _clipY1 || y + 32 <= _clipY0) return;
+    if (!_buffer || _maxY >= 64) {
+        for (int i = first; i < last; ++i) {
+            for (uint32_t bits = masks[i]; bits; bits &= bits - 1) {
+                pixel(x + i - _originX, y + __builtin_ctz(bits) - _originY, op);
+            }
+        }
+        return;
+    }
+    // The whole display column fits a 64-bit mask, bit n for row n.
+    const uint64_t below = _clipY1 >= 64 ? ~0ull : (1ull << _clipY1) - 1;
+    const uint64_t clip = below & ~((1ull << _clipY0) - 1);
+    for (int i = first; i < last; ++i) {
+        uint64_t mask = (y >= 0 ? (uint64_t)masks[i] << y : (uint64_t)masks[i] >> -y) & clip;
+        if (!mask) continue;
+        int column = x + i;
+        if (_rotated180) {
+            mask = reverseBits(mask) >> (63 - _maxY);
+            column = _maxX - column;
+        }
+        uint8_t* cell = _buffer + column;
+        for (; mask; mask >>= 8, cell += _stride) {
+            if (mask & 0xFF) apply(*cell, (uint8_t)mask, op);
+        }
+    }
+}
+
+void FrameBufferView::vSpans(const int16_t* xs, const int16_t* ys, int count, int h, Op op) {
+    if (h <= 0 || _clipX0 >= _clipX1 || _clipY0 >= _clipY1) return;
+    h = std::min(h, 32);
+    if (!_buffer || _maxY >= 64) {
+        for (int i = 0; i < count; ++i) vSpan(xs[i], ys[i], h, op);
+        return;
+    }
+    // Rows are flipped up front when rotated: the span starting at row y
+    // then ends at stored row maxY - y.
+    int clipTop = _clipY0, clipBottom = _clipY1;
+    if (_rotated180) {
+        clipTop = _maxY + 1 - _clipY1;
+        clipBottom = _maxY + 1 - _clipY0;
+    }
+    const uint64_t below = clipBottom >= 64 ? ~0ull : (1ull << clipBottom) - 1;
+    const uint64_t clip = below & ~((1ull << clipTop) - 1);
+    const uint64_t span = (1ull << h) - 1;
+    for (int i = 0; i < count; ++i) {
+        int column = xs[i] + _originX;
+        int y = ys[i] + _originY;
+        if (column < _clipX0 || column >= _clipX1 || y >= 64 || y <= -h) continue;
+        if (_rotated180) {
+            column = _maxX - column;
+            y = _maxY - (y + h - 1);
+        }
+        uint64_t mask = (y >= 0 ? span << y : span >> -y) & clip;
+        if (!mask) continue;
+        // Only the pages the span touches.
+        int page = __builtin_ctzll(mask) >> 3;
+        uint8_t* cell = _buffer + page * _stride + column;
+        for (mask >>= page * 8; mask; mask >>= 8, cell += _stride) apply(*cell, (uint8_t)mask, op);
+    }
+}
+
+uint64_t FrameBufferView::reverseBits(uint64_t v) {
+    v = ((v >> 1) & 0x5555555555555555ull) | ((v & 0x5555555555555555ull) << 1);
+    v = ((v >> 2) & 0x3333333333333333ull) | ((v & 0x3333333333333333ull) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((v & 0x0F0F0F0F0F0F0F0Full) << 4);
+    v = ((v >> 8) & 0x00FF00FF00FF00FFull) | ((v & 0x00FF00FF00FF00FFull) << 8);
+    v = ((v >> 16) & 0x0000FFFF0000FFFFull) | ((v & 0x0000FFFF0000FFFFull) << 16);
+    return (v >> 32) | (v << 32);
+}
+
+// The stepping of U8G2::drawLine(), so lines keep their exact pixels.
+void FrameBufferView::line(int x0, int y0, int x1, int y1, Op op) {
+    if (x0 == x1) {
+        vSpan(x0, std::min(y0, y1), std::abs(y1 - y0) + 1, op);
+        return;
+    }
+    if (y0 == y1) {
+        hSpan(std::min(x0, x1), y0, std::abs(x1 - x0) + 1, op);
+        return;
+    }
+
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+    bool swapXY = dy > dx;
+    if (swapXY) {
+        std::swap(dx, dy);
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int err = dx >> 1;
+    int yStep = y1 > y0 ? 1 : -1;
+    int y = y0;
+    for (int x = x0; x <= x1; ++x) {
+        if (swapXY) pixel(y, x, op);
+        else pixel(x, y, op);
+        err -= dy;
+        if (err < 0) {
+            y += yStep;
+            err += dx;
+        }
+    }
+}
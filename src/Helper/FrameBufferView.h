@@ -0,0 +1,99 @@
+#ifndef FRAME_BUFFER_VIEW_H
+#define FRAME_BUFFER_VIEW_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+class Renderer;
+
+// Plots straight into U8g2's full frame buffer (SSD1306 page layout: one
+// byte per 8 vertical pixels, bit 0 on top) for code that draws many pixels
+// and spans per frame, such as the weather effects. The renderer's offset and
+// clip rectangle are resolved once, when the view is made, instead of in
+// every U8g2 call; spans touch each page byte once.
+//
+// Coordinates are local to the renderer and every operation is clipped to
+// its area. U8G2_R0 and U8G2_R2 are addressed directly; any other rotation
+// or buffer layout goes through the matching U8g2 calls instead.
+//
+// A view is meant to live for one draw call: it does not notice later
+// changes to the renderer.
+class FrameBufferView {
+public:
+    // Same values as U8g2's draw colours.
+    enum Op : uint8_t {
+        CLEAR = 0,
+        SET = 1,
+        XOR = 2
+    };
+
+    explicit FrameBufferView(Renderer& renderer);
+
+    bool isValid() const { return _u8g2 != nullptr; }
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+
+    // Narrows the clip rectangle (local, exclusive end) to its intersection
+    // with the current one.
+    void clipTo(int x0, int y0, int x1, int y1);
+
+    inline void pixel(int x, int y, Op op);
+    void setPixel(int x, int y) { pixel(x, y, SET); }
+    void clearPixel(int x, int y) { pixel(x, y, CLEAR); }
+    void xorPixel(int x, int y) { pixel(x, y, XOR); }
+
+    void hSpan(int x, int y, int w, Op op) { fill(x, y, w, 1, op); }
+    void vSpan(int x, int y, int h, Op op) { fill(x, y, 1, h, op); }
+    void fill(int x, int y, int w, int h, Op op);
+    // Both end points included, like U8G2::drawLine().
+    void line(int x0, int y0, int x1, int y1, Op op);
+    // A 1bpp sprite of up to 32 rows stored by column: bit n of masks[i]
+    // is pixel (x + i, y + n). Each column is one or two page bytes.
+    void blitColumns(int x, int y, const uint32_t* masks, int w, Op op);
+    // count vertical spans of the same height h (at most 32), span i from
+    // (xs[i], ys[i]) down: rain streaks and the like in one call.
+    void vSpans(const int16_t* xs, const int16_t* ys, int count, int h, Op op);
+
+private:
+    U8G2* _u8g2 = nullptr;
+    uint8_t* _buffer = nullptr; // Null: draw through _u8g2
+    int _stride = 0;            // Bytes per page (display width)
+    bool _rotated180 = false;
+    int _maxX = 0;              // Display width - 1
+    int _maxY = 0;              // Display height - 1
+    int _originX = 0;
+    int _originY = 0;
+    int _width = 0;
+    int _height = 0;
+    // Absolute clip rectangle, end exclusive.
+    int _clipX0 = 0;
+    int _clipY0 = 0;
+    int _clipX1 = 0;
+    int _clipY1 = 0;
+
+    static inline void apply(uint8_t& cell, uint8_t mask, Op op) {
+        if (op == SET) cell |= mask;
+        else if (op == CLEAR) cell &= (uint8_t)~mask;
+        else cell ^= mask;
+    }
+    void fillAbsolute(int x0, int y0, int x1, int y1, Op op);
+    void fillThroughU8g2(int x0, int y0, int x1, int y1, Op op);
+    static uint64_t reverseBits(uint64_t v);
+};
+
+inline void FrameBufferView::pixel(int x, int y, Op op) {
+    x += _originX;
+    y += _originY;
+    if (x < _clipX0 || x >= _clipX1 || y < _clipY0 || y >= _clipY1) return;
+    if (!_buffer) {
+        fillThroughU8g2(x, y, x + 1, y + 1, op);
+        return;
+    }
+    if (_rotated180) {
+        x = _maxX - x;
+        y = _maxY - y;
+    }
+    apply(_buffer[(y >> 3) * _stride + x], (uint8_t)(1 << (y & 7)), op);
+}
+
+#endif // FRAME_BUFFER_VIEW_H
@@ -0,0 +1,162 @@
+#include "NoiseTileCache.h"
+#include <algorithm>
+#include <cstring>
+#include "../DebugUtils.h"
+
+NoiseTileCache* NoiseTileCache::_instance = nullptr;
+
+NoiseTileCache* NoiseTileCache::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new NoiseTileCache();
+    }
+    return _instance;
+}
+
+int NoiseTileCache::addLayer(Sampler sampler, void* owner, int refreshBudget) {
+    if (!sampler) return -1;
+    if (!_tiles) {
+        _tiles.reset(new (std::nothrow) Tile[MAX_TILES]);
+        if (!_tiles) {
+            debugPrint("SCENES", "NoiseTileCache: failed to allocate the tiles!");
+            return -1;
+        }
+        for (int16_t& bucket : _buckets) bucket = NONE;
+    }
+    for (int i = 0; i < MAX_LAYERS; ++i) {
+        Layer& layer = _layers[i];
+        if (layer.sampler) continue;
+        layer.sampler = sampler;
+        layer.owner = owner;
+        layer.generation = 0;
+        layer.refreshBudget = refreshBudget;
+        layer.refreshesLeft = refreshBudget;
+        layer.lastTile = NONE;
+        return i;
+    }
+    debugPrint("SCENES", "NoiseTileCache: no free layer!");
+    return -1;
+}
+
+void NoiseTileCache::removeLayer(int layer) {
+    if (layer < 0 || layer >= MAX_LAYERS || !_layers[layer].sampler) return;
+    for (int16_t i = 0; i < MAX_TILES; ++i) {
+        if (_tiles[i].layer == layer) {
+            unlink(i);
+            _tiles[i].layer = NONE;
+        }
+    }
+    _layers[layer] = Layer();
+    for (const Layer& other : _layers) {
+        if (other.sampler) return;
+    }
+    _tiles.reset();
+}
+
+void NoiseTileCache::invalidate(int layer) {
+    if (layer < 0 || layer >= MAX_LAYERS) return;
+    ++_layers[layer].generation;
+}
+
+void NoiseTileCache::beginFrame() {
+    for (Layer& layer : _layers) layer.refreshesLeft = layer.refreshBudget;
+}
+
+int8_t NoiseTileCache::get(int layer, int cellX, int cellY) {
+    int tileX = floorDiv(cellX, TILE_CELLS);
+    int tileY = floorDiv(cellY, TILE_CELLS);
+    const Tile* tile = tileFor(layer, tileX, tileY);
+    if (!tile) return 0;
+    return tile->values[(cellY - tileY * TILE_CELLS) * TILE_CELLS + cellX - tileX * TILE_CELLS];
+}
+
+void NoiseTileCache::getRow(int layer, int cellX, int cellY, int count, int8_t* out) {
+    const int tileY = floorDiv(cellY, TILE_CELLS);
+    const int row = (cellY - tileY * TILE_CELLS) * TILE_CELLS;
+    while (count > 0) {
+        int tileX = floorDiv(cellX, TILE_CELLS);
+        int column = cellX - tileX * TILE_CELLS;
+        int run = std::min(count, TILE_CELLS - column);
+        const Tile* tile = tileFor(layer, tileX, tileY);
+        if (tile) memcpy(out, tile->values + row + column, run);
+        else memset(out, 0, run);
+        out += run;
+        cellX += run;
+        count -= run;
+    }
+}
+
+// The tile, sampled if it is new and resampled if it is stale and the
+// layer's budget allows. Null only for an unknown layer.
+const NoiseTileCache::Tile* NoiseTileCache::tileFor(int layer, int tileX, int tileY) {
+    if (layer < 0 || layer >= MAX_LAYERS || !_layers[layer].sampler) return nullptr;
+    Layer& state = _layers[layer];
+    Tile* tile = nullptr;
+    if (state.lastTile != NONE) {
+        Tile& last = _tiles[state.lastTile];
+        if (last.layer == layer && last.tileX == tileX && last.tileY == tileY) tile = &last;
+    }
+    if (!tile) tile = findTile(layer, tileX, tileY);
+    if (!tile) {
+        int16_t index = makeRoom();
+        tile = &_tiles[index];
+        tile->layer = (int8_t)layer;
+        tile->tileX = tileX;
+        tile->tileY = tileY;
+        int bucket = bucketOf(layer, tileX, tileY);
+        tile->next = _buckets[bucket];
+        _buckets[bucket] = index;
+        fill(*tile);
+    } else if (tile->generation != state.generation && state.refreshesLeft > 0) {
+        --state.refreshesLeft;
+        fill(*tile);
+    }
+    tile->lastUse = ++_useCounter;
+    state.lastTile = (int16_t)(tile - _tiles.get());
+    return tile;
+}
+
+NoiseTileCache::Tile* NoiseTileCache::findTile(int layer, int tileX, int tileY) {
+    for (int16_t i = _buckets[bucketOf(layer, tileX, tileY)]; i != NONE; i = _tiles[i].next) {
+        Tile& tile = _tiles[i];
+        if (tile.layer == layer && tile.tileX == tileX && tile.tileY == tileY) return &tile;
+    }
+    return nullptr;
+}
+
+// A free tile, or the least recently used one taken out of its bucket.
+int16_t NoiseTileCache::makeRoom() {
+    int16_t oldest = 0;
+    for (int16_t i = 0; i < MAX_TILES; ++i) {
+        if (_tiles[i].layer == NONE) return i;
+        if (_tiles[i].lastUse < _tiles[oldest].lastUse) oldest = i;
+    }
+    unlink(oldest);
+    _layers[_tiles[oldest].layer].lastTile = NONE;
+    _tiles[oldest].layer = NONE;
+    return oldest;
+}
+
+void NoiseTileCache::unlink(int16_t index) {
+    Tile& tile = _tiles[index];
+    int16_t* link = &_buckets[bucketOf(tile.layer, tile.tileX, tile.tileY)];
+    while (*link != NONE && *link != index) link = &_tiles[*link].next;
+    if (*link == index) *link = tile.next;
+    tile.next = NONE;
+}
+
+void NoiseTileCache::fill(Tile& tile) {
+    const Layer& layer = _layers[tile.layer];
+    const int originX = tile.tileX * TILE_CELLS;
+    const int originY = tile.tileY * TILE_CELLS;
+    int8_t* value = tile.values;
+    for (int y = 0; y < TILE_CELLS; ++y) {
+        for (int x = 0; x < TILE_CELLS; ++x) *value++ = quantize(layer.sampler(layer.owner, originX + x, originY + y));
+    }
+    tile.generation = layer.generation;
+    ++_tilesFilled;
+}
+
+int NoiseTileCache::bucketOf(int layer, int tileX, int tileY) {
+    uint32_t hash = (uint32_t)tileX * 73856093u ^ (uint32_t)tileY * 19349663u ^ (uint32_t)layer * 83492791u;
+    return (int)((hash ^ (hash >> 16)) & (HASH_BUCKETS - 1));
+}
@@ -0,0 +1,104 @@
+#ifndef NOISE_TILE_CACHE_H
+#define NOISE_TILE_CACHE_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <memory>
+
+// Noise fields sampled on a world-space lattice and kept in 8x8-cell tiles,
+// shared by every scene that draws a scrolling noise background. A scene
+// registers one layer per field with a sampler for lattice point (cellX,
+// cellY); as the view scrolls only the tiles coming into view are sampled,
+// the rest are served from the cache. The least recently used tile makes
+// room for a new one.
+//
+// Fields that drift slowly over time are invalidate()d now and then; their
+// stale tiles keep serving the old values until resampled, at most
+// refreshBudget tiles of the layer per frame, so the cost is spread out.
+//
+// Values are quantized to -127..127 (quantize()); compare against a
+// quantized threshold.
+class NoiseTileCache {
+public:
+    static const int TILE_CELLS = 8;   // Tile edge, in lattice cells
+    static const int MAX_TILES = 128;  // About 10 KB while any layer exists
+    static const int MAX_LAYERS = 4;
+
+    // The field at a lattice point, -1..1.
+    using Sampler = float (*)(void* owner, int cellX, int cellY);
+
+    NoiseTileCache(const NoiseTileCache&) = delete;
+    NoiseTileCache& operator=(const NoiseTileCache&) = delete;
+    static NoiseTileCache* getInstance();
+
+    // Returns the layer id, or -1 if all layers are taken or the tiles could
+    // not be allocated. refreshBudget: stale tiles resampled per frame.
+    int addLayer(Sampler sampler, void* owner, int refreshBudget = 0);
+    // Drops the layer and its tiles; the tile memory goes with the last layer.
+    void removeLayer(int layer);
+    // Marks every tile of the layer stale.
+    void invalidate(int layer);
+    // Starts a frame: refresh budgets are restored.
+    void beginFrame();
+
+    int8_t get(int layer, int cellX, int cellY);
+    // count values along row cellY, from cellX on.
+    void getRow(int layer, int cellX, int cellY, int count, int8_t* out);
+
+    static int8_t quantize(float value) { return (int8_t)lroundf(constrain(value, -1.0f, 1.0f) * 127.0f); }
+    // Lattice cell of a coordinate, rounding down for negatives too.
+    static int floorDiv(int value, int divisor) {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    }
+
+    static int ceilDiv(int value, int divisor) { return -floorDiv(-value, divisor); }
+    // The lattice cells, cellSize pixels apart, whose points fall on pixels
+    // origin .. origin + length - 1 of the world.
+    static void visibleCells(int origin, int length, int cellSize, int& first, int& count) {
+        first = ceilDiv(origin, cellSize);
+        count = std::max(0, floorDiv(origin + length - 1, cellSize) - first + 1);
+    }
+
+    int getTilesFilled() const { return _tilesFilled; } // Since start, for benchmarks
+
+private:
+    NoiseTileCache() = default;
+    static NoiseTileCache* _instance;
+
+    static const int HASH_BUCKETS = 64;
+    static const int16_t NONE = -1;
+
+    struct Tile {
+        int32_t tileX = 0;
+        int32_t tileY = 0;
+        int8_t layer = NONE;   // NONE: free
+        int16_t next = NONE;   // Next tile in the same hash bucket
+        uint16_t generation = 0;
+        uint32_t lastUse = 0;
+        int8_t values[TILE_CELLS * TILE_CELLS];
+    };
+
+    struct Layer {
+        Sampler sampler = nullptr; // Null: unused
+        void* owner = nullptr;
+        uint16_t generation = 0;
+        int refreshBudget = 0;
+        int refreshesLeft = 0;
+        int16_t lastTile = NONE;   // Tile of the previous lookup
+    };
+
+    std::unique_ptr<Tile[]> _tiles;
+    int16_t _buckets[HASH_BUCKETS];
+    Layer _layers[MAX_LAYERS];
+    uint32_t _useCounter = 0;
+    int _tilesFilled = 0;
+
+    const Tile* tileFor(int layer, int tileX, int tileY);
+    Tile* findTile(int layer, int tileX, int tileY);
+    int16_t makeRoom();
+    void unlink(int16_t index);
+    void fill(Tile& tile);
+    static int bucketOf(int layer, int tileX, int tileY);
+};
+
+#endif // NOISE_TILE_CACHE_H
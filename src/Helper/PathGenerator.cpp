@@ -6,7 +6,7 @@
 
 PathGenerator::PathGenerator() {
     // Initialize noise generator defaults
-    _noise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _noise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     // Frequency and seed can be set per-generation if needed, or keep defaults
     _noise.SetFrequency(0.05);
     _noise.SetSeed(esp_random());
@@ -56,19 +56,28 @@ bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
                                       unsigned long& estimatedDurationMs,
                                       int screenW, int screenH,
                                       const PathGenConfig& config) {
+    return generateFlyingPath(outPath, estimatedDurationMs, screenW, screenH, Rng::streamSeed(Rng::STREAM_PATHS), config);
+}
+
+bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
+                                      unsigned long& estimatedDurationMs,
+                                      int screenW, int screenH,
+                                      uint32_t seed,
+                                      const PathGenConfig& config) {
     outPath.clear();
-    _noise.SetSeed(esp_random()); // Use a new seed each time
+    _rng.seed(seed);
+    _noise.SetSeed(_rng.next()); // Use a new seed each time
 
-    int targetPointsThisPath = random(config.minPoints, config.maxPoints + 1);
+    int targetPointsThisPath = _rng.range(config.minPoints, config.maxPoints + 1);
     debugPrintf("PATH_GENERATOR", "PathGen Start: Target %d points. MinAngle=%.1f deg", targetPointsThisPath, config.minAngleDegrees);
 
     PathPoint currentPoint;
-    int startEdge = random(4);
+    int startEdge = _rng.below(4);
     switch (startEdge) {
-        case 0: currentPoint = { (int16_t)random(0, screenW), (int16_t)(-config.offscreenMargin) }; break;
-        case 1: currentPoint = { (int16_t)random(0, screenW), (int16_t)(screenH + config.offscreenMargin) }; break;
-        case 2: currentPoint = { (int16_t)(-config.offscreenMargin), (int16_t)random(0, screenH) }; break;
-        default: currentPoint = { (int16_t)(screenW + config.offscreenMargin), (int16_t)random(0, screenH) }; break;
+        case 0: currentPoint = { (int16_t)_rng.range(0, screenW), (int16_t)(-config.offscreenMargin) }; break;
+        case 1: currentPoint = { (int16_t)_rng.range(0, screenW), (int16_t)(screenH + config.offscreenMargin) }; break;
+        case 2: currentPoint = { (int16_t)(-config.offscreenMargin), (int16_t)_rng.range(0, screenH) }; break;
+        default: currentPoint = { (int16_t)(screenW + config.offscreenMargin), (int16_t)_rng.range(0, screenH) }; break;
     }
     outPath.push_back(currentPoint);
     debugPrintf("PATH_GENERATOR", "  Point 0: Start (%d, %d)", currentPoint.x, currentPoint.y);
@@ -87,7 +96,7 @@ bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
             float angleDelta = noiseVal * PI; // Noise determines angle change magnitude/direction
 
             // Calculate step distance
-            float stepDistance = (float)random(config.minStepDistance * 100, config.maxStepDistance * 100) / 100.0f;
+            float stepDistance = (float)_rng.range((int32_t)(config.minStepDistance * 100), (int32_t)(config.maxStepDistance * 100)) / 100.0f;
 
             // Calculate potential next angle
             float potentialNextAngle = normalizeAngle(lastAngle + angleDelta);
@@ -99,7 +108,7 @@ bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
             if (forceReturn) {
                 float angleToCenter = atan2(screenH / 2.0f - currentPoint.y, screenW / 2.0f - currentPoint.x);
                 // Blend current direction with direction towards center
-                float biasWeight = config.returnToCenterBias + (float)random((int)(config.returnToCenterNudge * 100.f))/100.0f;
+                float biasWeight = config.returnToCenterBias + (float)_rng.below((int)(config.returnToCenterNudge * 100.f))/100.0f;
                 potentialNextAngle = blendAngles(potentialNextAngle, angleToCenter, biasWeight);
                 stepDistance *= 0.9f; // Slightly reduce step when returning
                 // Fix potential std::max issue by casting
@@ -123,7 +132,7 @@ bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
                         // debugPrintf("PATH_GENERATOR", "    Angle Nudged - %.1f deg", degrees(config.angleNudgeRad));
                     } else {
                         // Nudging failed, try a more random deviation within allowed range from last angle
-                        float randomDeviation = radians(random(config.minAngleDegrees + 1, 180)) * (random(0,2)?1:-1); // Deviate more drastically but still within limits relative to *last* angle
+                        float randomDeviation = radians(_rng.range((int32_t)(config.minAngleDegrees + 1), 180)) * (_rng.coinFlip()?1:-1); // Deviate more drastically but still within limits relative to *last* angle
                         potentialNextAngle = normalizeAngle(lastAngle + randomDeviation);
                         angleOk = checkPathAngleConstraint(potentialNextAngle, lastAngle, outPath, config); // Re-check (should pass by definition now)
                         if (!angleOk) {
@@ -153,7 +162,7 @@ bool PathGenerator::generateFlyingPath(std::vector<PathPoint>& outPath,
             if (sqrt(dx_check*dx_check + dy_check*dy_check) < (float)config.minStepDistance * 0.8f) {
                  // If clamped point is too close, indicates we might be stuck near a boundary
                  // Try a more drastic angle change on next attempt
-                 lastAngle = normalizeAngle(lastAngle + radians(random(90, 180) * (random(0,2)?1:-1))); // Random large turn
+                 lastAngle = normalizeAngle(lastAngle + radians(_rng.range(90, 180) * (_rng.coinFlip()?1:-1))); // Random large turn
                 // debugPrintf("PATH_GENERATOR", "    Clamped point too close, forcing large turn.");
                  continue;
             }
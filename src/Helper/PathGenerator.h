@@ -1,7 +1,8 @@
 #ifndef PATH_GENERATOR_H
 #define PATH_GENERATOR_H
 
-#include "FastNoiseLite.h" // <-- Corrected include path
+#include "FixedNoise.h"
+#include "Rng.h"
 #include <vector>
 #include <Arduino.h> // For random(), radians(), degrees() etc.
 #include <stdint.h>  // For int16_t
@@ -44,9 +45,17 @@ public:
                             unsigned long& estimatedDurationMs,
                             int screenW, int screenH,
                             const PathGenConfig& config = PathGenConfig()); // Use default config if none provided
+    // The same from a seed the caller drew (Rng::streamSeed(STREAM_PATHS)),
+    // for generating on a thread other than the one the streams belong to.
+    bool generateFlyingPath(std::vector<PathPoint>& outPath,
+                            unsigned long& estimatedDurationMs,
+                            int screenW, int screenH,
+                            uint32_t seed,
+                            const PathGenConfig& config);
 
 private:
-    FastNoiseLite _noise;
+    FixedNoise _noise;
+    Rng _rng; // Reseeded from its stream for every path
 
     // --- Internal Math/Geometry Helpers ---
     // (Moved from _1AwakeningSparkScene)
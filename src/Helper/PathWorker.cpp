@@ -0,0 +1,182 @@
+#include "PathWorker.h"
+#include "Rng.h"
+#include "../DebugUtils.h"
+
+#ifndef TAMA_HOST_SIM
+namespace {
+
+// PATH_GENERATOR logging is on by default, and each line goes through
+// debugPrintf() and SerialForwarder::printf() (256 byte buffers each, float
+// formatting) into appendToWebSerialBuffer(), which can hold a 1 KB copy of
+// the web serial buffer while it sends. run() logs each new low of the
+// headroom under TASK.
+const uint32_t TASK_STACK_BYTES = 8192;
+const UBaseType_t TASK_PRIORITY = 1;
+
+} // namespace
+#endif
+
+PathWorker::PathWorker(PathGenerator* generator) : _generator(generator) {
+    for (int i = 0; i < BUFFERS; ++i) {
+        _buffers[i].points.reserve(PathGenConfig().maxPoints + 1);
+        _states[i] = State::FREE;
+    }
+}
+
+PathWorker::~PathWorker() {
+    end();
+}
+
+bool PathWorker::begin() {
+    if (_running) return true;
+    _stopping.store(false);
+#ifdef TAMA_HOST_SIM
+    _woken = false;
+    _thread = std::thread(&PathWorker::run, this);
+#else
+    _exited.store(false);
+    // The worker takes whichever core loop() is not running on.
+    const BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+    if (xTaskCreatePinnedToCore(taskEntry, "PathWorker", TASK_STACK_BYTES, this, TASK_PRIORITY, &_task, core) != pdPASS) {
+        debugPrint("PATH_GENERATOR", "PathWorker: failed to create the task, paths are generated in place.");
+        _task = nullptr;
+        return false;
+    }
+#endif
+    _running = true;
+    debugPrint("PATH_GENERATOR", "PathWorker started.");
+    return true;
+}
+
+void PathWorker::end() {
+    if (!_running) return;
+    _stopping.store(true);
+    wake();
+#ifdef TAMA_HOST_SIM
+    _thread.join();
+#else
+    while (!_exited.load()) vTaskDelay(pdMS_TO_TICKS(1));
+    _task = nullptr;
+#endif
+    _running = false;
+}
+
+PathWorker::Ticket PathWorker::request(int screenW, int screenH, const PathGenConfig& config) {
+    collectResults();
+    int buffer = 0;
+    while (buffer < BUFFERS && _states[buffer] != State::FREE) ++buffer;
+    if (buffer == BUFFERS) {
+        debugPrint("PATH_GENERATOR", "PathWorker: every buffer is in use!");
+        return NO_TICKET;
+    }
+    Buffer& slot = _buffers[buffer];
+    slot.config = config;
+    slot.screenW = screenW;
+    slot.screenH = screenH;
+    slot.seed = Rng::streamSeed(Rng::STREAM_PATHS);
+    if (!_running) {
+        generate((uint8_t)buffer);
+        _states[buffer] = State::DONE;
+        return (Ticket)buffer;
+    }
+    _states[buffer] = State::QUEUED;
+    _requests.push((uint8_t)buffer); // Never full: it has a place for every buffer
+    wake();
+    return (Ticket)buffer;
+}
+
+bool PathWorker::take(Ticket& ticket, std::vector<PathPoint>& outPath, unsigned long& estimatedDurationMs) {
+    if (!isValid(ticket) || _states[ticket] == State::FREE || _states[ticket] == State::CANCELLED) {
+        ticket = NO_TICKET;
+        return false;
+    }
+    collectResults();
+    if (_states[ticket] != State::DONE) return false;
+    Buffer& slot = _buffers[ticket];
+    const bool generated = slot.generated;
+    if (generated) {
+        outPath.swap(slot.points);
+        estimatedDurationMs = slot.durationMs;
+    }
+    _states[ticket] = State::FREE;
+    ticket = NO_TICKET;
+    return generated;
+}
+
+void PathWorker::cancel(Ticket& ticket) {
+    if (isValid(ticket)) {
+        if (_states[ticket] == State::QUEUED) _states[ticket] = State::CANCELLED;
+        else if (_states[ticket] == State::DONE) _states[ticket] = State::FREE;
+    }
+    ticket = NO_TICKET;
+}
+
+void PathWorker::generate(uint8_t buffer) {
+    Buffer& slot = _buffers[buffer];
+    slot.generated = _generator && _generator->generateFlyingPath(slot.points, slot.durationMs, slot.screenW, slot.screenH,
+                                                                  slot.seed, slot.config);
+}
+
+void PathWorker::collectResults() {
+    uint8_t buffer;
+    while (_results.pop(buffer)) {
+        _states[buffer] = _states[buffer] == State::CANCELLED ? State::FREE : State::DONE;
+    }
+}
+
+// Serves every queued request before looking at _stopping, so end() never
+// strands one.
+void PathWorker::run() {
+    for (;;) {
+        waitForWork();
+        uint8_t buffer;
+        while (_requests.pop(buffer)) {
+            generate(buffer);
+            _results.push(buffer);
+            noteStackHeadroom();
+        }
+        if (_stopping.load()) break;
+    }
+}
+
+#ifdef TAMA_HOST_SIM
+void PathWorker::waitForWork() {
+    std::unique_lock<std::mutex> lock(_wakeMutex);
+    _wakeCondition.wait(lock, [this] { return _woken; });
+    _woken = false;
+}
+
+void PathWorker::noteStackHeadroom() {
+    // Host threads have megabytes of stack; the board's task is what counts.
+}
+
+void PathWorker::wake() {
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _woken = true;
+    }
+    _wakeCondition.notify_one();
+}
+#else
+void PathWorker::taskEntry(void* worker) {
+    PathWorker* self = static_cast<PathWorker*>(worker);
+    self->run();
+    self->_exited.store(true);
+    vTaskDelete(nullptr);
+}
+
+void PathWorker::waitForWork() {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+void PathWorker::noteStackHeadroom() {
+    const UBaseType_t unused = uxTaskGetStackHighWaterMark(nullptr); // Bytes on the ESP32
+    if (unused >= _lowestHeadroom) return;
+    _lowestHeadroom = unused;
+    debugPrintf("TASK", "PathWorker: stack headroom down to %u of %u bytes\n", (unsigned)unused, (unsigned)TASK_STACK_BYTES);
+}
+
+void PathWorker::wake() {
+    if (_task) xTaskNotifyGive(_task);
+}
+#endif
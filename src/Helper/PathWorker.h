@@ -0,0 +1,101 @@
+#ifndef PATH_WORKER_H
+#define PATH_WORKER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+#include "PathGenerator.h"
+#include "SpscRing.h"
+#ifdef TAMA_HOST_SIM
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Runs PathGenerator away from loop(): on a FreeRTOS task pinned to the core
+// loop() does not run on, or on a std::thread in the host build.
+// generateFlyingPath() retries noise samples for every point and can take
+// long enough to drop a frame, so scenes request a path well before they
+// need it and take() it once it is ready.
+//
+// Requests and results travel as buffer indices through two
+// single-producer/single-consumer rings. The buffers are pooled and keep
+// their capacity, so a steady flow of paths does not allocate. request(),
+// take() and cancel() belong to the thread that runs loop(); the generator
+// belongs to the worker once begin() succeeds.
+class PathWorker {
+public:
+    static const int BUFFERS = 4; // Paths requested and not yet taken
+    typedef int8_t Ticket;
+    static const Ticket NO_TICKET = -1;
+
+    explicit PathWorker(PathGenerator* generator);
+    ~PathWorker();
+    PathWorker(const PathWorker&) = delete;
+    PathWorker& operator=(const PathWorker&) = delete;
+
+    // Starts the worker. Until then, or if it cannot start, request()
+    // generates the path on the spot.
+    bool begin();
+    // Finishes what was requested, then stops the worker.
+    void end();
+    bool isRunning() const { return _running; }
+
+    // NO_TICKET when every buffer is in use. The seed is drawn here, from
+    // the paths stream, so paths come out in request order whichever thread
+    // generates them.
+    Ticket request(int screenW, int screenH, const PathGenConfig& config = PathGenConfig());
+    // False while the path is being generated. Once it is done the ticket
+    // is spent (NO_TICKET) and the result is true if a path was generated;
+    // outPath's storage is swapped into the pool for the next one.
+    bool take(Ticket& ticket, std::vector<PathPoint>& outPath, unsigned long& estimatedDurationMs);
+    void cancel(Ticket& ticket);
+
+private:
+    // What loop()'s side knows of a buffer. QUEUED and CANCELLED buffers
+    // are the worker's until they come back through _results.
+    enum class State : uint8_t { FREE, QUEUED, DONE, CANCELLED };
+
+    struct Buffer {
+        PathGenConfig config;
+        int screenW = 0;
+        int screenH = 0;
+        uint32_t seed = 0;
+        std::vector<PathPoint> points;
+        unsigned long durationMs = 0;
+        bool generated = false;
+    };
+
+    PathGenerator* _generator;
+    Buffer _buffers[BUFFERS];
+    State _states[BUFFERS];
+    SpscRing<uint8_t, BUFFERS> _requests; // loop() to the worker
+    SpscRing<uint8_t, BUFFERS> _results;  // The worker to loop()
+    std::atomic<bool> _stopping{false};
+    bool _running = false;
+
+#ifdef TAMA_HOST_SIM
+    std::thread _thread;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    bool _woken = false;
+#else
+    TaskHandle_t _task = nullptr;
+    std::atomic<bool> _exited{false};
+    UBaseType_t _lowestHeadroom = ~(UBaseType_t)0; // Stack bytes never used; the worker's
+    static void taskEntry(void* worker);
+#endif
+
+    bool isValid(Ticket ticket) const { return ticket >= 0 && ticket < BUFFERS; }
+    void generate(uint8_t buffer);
+    void collectResults();
+    void run();
+    void waitForWork();
+    void noteStackHeadroom();
+    void wake();
+};
+
+#endif // PATH_WORKER_H
@@ -0,0 +1,31 @@
+#include "Rng.h"
+
+namespace {
+// One generator per stream, handing out the seeds of its instances.
+Rng streams[Rng::STREAM_COUNT];
+
+// splitmix32: spreads one seed over well-mixed words.
+uint32_t splitMix(uint32_t& state) {
+    uint32_t z = (state += 0x9E3779B9u);
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    return z ^ (z >> 16);
+}
+}
+
+void Rng::seed(uint32_t value) {
+    uint32_t state = value;
+    for (uint32_t& word : _s) word = splitMix(state);
+    // xoshiro must not start from all zeros.
+    if (!(_s[0] | _s[1] | _s[2] | _s[3])) _s[0] = 1;
+}
+
+void Rng::seedStreams(uint32_t seed) {
+    uint32_t state = seed;
+    for (Rng& stream : streams) stream.seed(splitMix(state));
+}
+
+uint32_t Rng::streamSeed(Stream stream) {
+    if (stream >= STREAM_COUNT) return 1;
+    return streams[stream].next();
+}
@@ -0,0 +1,81 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <Arduino.h>
+
+// A small xoshiro128** generator for the code that draws random numbers
+// every frame, in place of Arduino's random(): no call into the hardware
+// RNG, and ranges without a modulo (Lemire's multiply-and-reject).
+//
+// Every subsystem owns its instance and seeds it from its stream with
+// seedFrom(). BootScene seeds all streams from one esp_random() value, so
+// in the simulator (where esp_random() follows --seed) a run replays frame
+// for frame.
+class Rng {
+public:
+    enum Stream : uint8_t {
+        STREAM_WEATHER,       // Effect set-up and timing
+        STREAM_PRECIPITATION, // Drop and flake respawns
+        STREAM_FOG,
+        STREAM_AURORA,
+        STREAM_PATHS,         // PathGenerator
+        STREAM_FLAPPY_TUCK,
+        STREAM_COUNT
+    };
+
+    Rng() { seed(1); }
+    explicit Rng(uint32_t value) { seed(value); }
+
+    void seed(uint32_t value);
+    // Seeds this generator with the next seed of the stream.
+    void seedFrom(Stream stream) { seed(streamSeed(stream)); }
+
+    inline uint32_t next();
+    // 0 .. bound - 1; 0 for a bound of 0.
+    inline uint32_t below(uint32_t bound);
+    // min .. max - 1, like random(min, max); min for an empty range.
+    int32_t range(int32_t min, int32_t max) {
+        return max > min ? min + (int32_t)below((uint32_t)(max - min)) : min;
+    }
+    // True with the given chance in percent, like random(100) < percent.
+    bool percent(float chance) { return (float)below(100) < chance; }
+    bool coinFlip() { return (next() >> 31) != 0; }
+
+    // Seeds every stream, deriving each stream's seed from this one.
+    static void seedStreams(uint32_t seed);
+    // The next seed for an instance of the stream.
+    static uint32_t streamSeed(Stream stream);
+
+private:
+    uint32_t _s[4];
+
+    static inline uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+};
+
+inline uint32_t Rng::next() {
+    const uint32_t result = rotl(_s[1] * 5, 7) * 9;
+    const uint32_t t = _s[1] << 9;
+    _s[2] ^= _s[0];
+    _s[3] ^= _s[1];
+    _s[1] ^= _s[2];
+    _s[0] ^= _s[3];
+    _s[2] ^= t;
+    _s[3] = rotl(_s[3], 11);
+    return result;
+}
+
+inline uint32_t Rng::below(uint32_t bound) {
+    uint64_t m = (uint64_t)next() * bound;
+    uint32_t low = (uint32_t)m;
+    if (low < bound) {
+        // Rejects the few values that would favour the low results.
+        const uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            m = (uint64_t)next() * bound;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+#endif // RNG_H
@@ -0,0 +1,159 @@
+#include "RotationSpriteCache.h"
+#include <algorithm>
+#include <cmath>
+#include <pgmspace.h>
+#include "../DebugUtils.h"
+
+RotationSpriteCache* RotationSpriteCache::_instance = nullptr;
+
+RotationSpriteCache* RotationSpriteCache::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new RotationSpriteCache();
+    }
+    return _instance;
+}
+
+bool RotationSpriteCache::get(const unsigned char* bitmap, int width, int height, float pivotX, float pivotY, float angleDegrees, Sprite& out) {
+    if (!bitmap || width <= 0 || height <= 0) return false;
+
+    const int stepsPerTurn = (int)lroundf(360.0f / ANGLE_STEP_DEGREES);
+    int angleStep = (int)(lroundf(angleDegrees / ANGLE_STEP_DEGREES) % stepsPerTurn);
+    if (angleStep < 0) angleStep += stepsPerTurn;
+    if (angleStep == 0) {
+        // Unrotated: the source bitmap is already the sprite.
+        out.bits = bitmap;
+        out.width = width;
+        out.height = height;
+        out.offsetX = 0;
+        out.offsetY = 0;
+        return true;
+    }
+
+    int16_t pivotX2 = (int16_t)lroundf(pivotX * 2.0f);
+    int16_t pivotY2 = (int16_t)lroundf(pivotY * 2.0f);
+    for (Entry& entry : _entries) {
+        if (entry.bitmap == bitmap && entry.width == width && entry.height == height &&
+            entry.pivotX2 == pivotX2 && entry.pivotY2 == pivotY2 && entry.angleStep == angleStep) {
+            entry.lastUse = ++_useCounter;
+            out = entry.sprite;
+            return true;
+        }
+    }
+
+    // Render with the quantized pivot and angle, so every sprite sharing
+    // this entry sees the same pixels.
+    FixedTrig::Angle angle = FixedTrig::fromDegrees(angleStep * ANGLE_STEP_DEGREES);
+    pivotX = pivotX2 / 2.0f;
+    pivotY = pivotY2 / 2.0f;
+    Sprite sprite;
+    computeBounds(width, height, pivotX, pivotY, angle, sprite);
+    size_t size = (size_t)((sprite.width + 7) / 8) * sprite.height;
+    if (size > MAX_BYTES) {
+        debugPrintf("ANIMATOR", "RotationSpriteCache: %dx%d sprite needs %u bytes, over the cache size.", width, height, size);
+        return false;
+    }
+
+    Entry* entry = makeRoom(size);
+    entry->bits.reset(new (std::nothrow) uint8_t[size]);
+    if (!entry->bits) {
+        debugPrint("ANIMATOR", "RotationSpriteCache: failed to allocate a rotated sprite!");
+        return false;
+    }
+    render(bitmap, width, height, pivotX, pivotY, angle, sprite, entry->bits.get());
+    sprite.bits = entry->bits.get();
+
+    entry->bitmap = bitmap;
+    entry->width = (int16_t)width;
+    entry->height = (int16_t)height;
+    entry->pivotX2 = pivotX2;
+    entry->pivotY2 = pivotY2;
+    entry->angleStep = (int16_t)angleStep;
+    entry->sprite = sprite;
+    entry->size = size;
+    entry->lastUse = ++_useCounter;
+    _bytesUsed += size;
+
+    out = sprite;
+    return true;
+}
+
+void RotationSpriteCache::evict(Entry& entry) {
+    _bytesUsed -= entry.size;
+    entry.bits.reset();
+    entry.bitmap = nullptr;
+    entry.size = 0;
+}
+
+// Returns a free slot with `size` bytes of budget left, dropping the least
+// recently used entries as needed. size must not exceed MAX_BYTES.
+RotationSpriteCache::Entry* RotationSpriteCache::makeRoom(size_t size) {
+    while (true) {
+        Entry* freeSlot = nullptr;
+        Entry* oldest = nullptr;
+        for (Entry& entry : _entries) {
+            if (!entry.bitmap) {
+                if (!freeSlot) freeSlot = &entry;
+            } else if (!oldest || entry.lastUse < oldest->lastUse) {
+                oldest = &entry;
+            }
+        }
+        if (freeSlot && _bytesUsed + size <= MAX_BYTES) return freeSlot;
+        evict(*oldest);
+    }
+}
+
+// Bounding box of the rotated source rectangle (pixel edges, not centres).
+void RotationSpriteCache::computeBounds(int width, int height, float pivotX, float pivotY, FixedTrig::Angle angle, Sprite& sprite) {
+    float c = FixedTrig::cosF(angle);
+    float s = FixedTrig::sinF(angle);
+    const float cornersX[4] = {-0.5f, width - 0.5f, -0.5f, width - 0.5f};
+    const float cornersY[4] = {-0.5f, -0.5f, height - 0.5f, height - 0.5f};
+    float minX = 1e9f, minY = 1e9f, maxX = -1e9f, maxY = -1e9f;
+    for (int i = 0; i < 4; ++i) {
+        float tx = cornersX[i] - pivotX;
+        float ty = cornersY[i] - pivotY;
+        float rx = tx * c - ty * s + pivotX;
+        float ry = tx * s + ty * c + pivotY;
+        minX = std::min(minX, rx);
+        maxX = std::max(maxX, rx);
+        minY = std::min(minY, ry);
+        maxY = std::max(maxY, ry);
+    }
+    sprite.offsetX = (int)floorf(minX + 0.5f);
+    sprite.offsetY = (int)floorf(minY + 0.5f);
+    sprite.width = (int)ceilf(maxX - 0.5f) - sprite.offsetX + 1;
+    sprite.height = (int)ceilf(maxY - 0.5f) - sprite.offsetY + 1;
+}
+
+// Every destination pixel samples the source pixel it came from (nearest),
+// the inverse rotation stepped along each row in 16.16 fixed point.
+void RotationSpriteCache::render(const unsigned char* bitmap, int width, int height, float pivotX, float pivotY, FixedTrig::Angle angle,
+                                 const Sprite& sprite, uint8_t* bits) {
+    const int srcStride = (width + 7) / 8;
+    const int destStride = (sprite.width + 7) / 8;
+    memset(bits, 0, (size_t)destStride * sprite.height);
+
+    const float fixedOne = 65536.0f;
+    float c = FixedTrig::cosF(angle);
+    float s = FixedTrig::sinF(angle);
+    int32_t stepX = (int32_t)lroundf(c * fixedOne);
+    int32_t stepY = (int32_t)lroundf(-s * fixedOne);
+
+    for (int dy = 0; dy < sprite.height; ++dy) {
+        float qx = sprite.offsetX - pivotX;
+        float qy = sprite.offsetY + dy - pivotY;
+        // +0.5 so that truncating the fixed-point value rounds to the nearest pixel.
+        int32_t sx = (int32_t)lroundf((qx * c + qy * s + pivotX + 0.5f) * fixedOne);
+        int32_t sy = (int32_t)lroundf((-qx * s + qy * c + pivotY + 0.5f) * fixedOne);
+        uint8_t* row = bits + dy * destStride;
+        for (int dx = 0; dx < sprite.width; ++dx, sx += stepX, sy += stepY) {
+            if (sx < 0 || sy < 0) continue;
+            int px = sx >> 16;
+            int py = sy >> 16;
+            if (px >= width || py >= height) continue;
+            if (pgm_read_byte(bitmap + py * srcStride + (px >> 3)) & (1 << (px & 7))) {
+                row[dx >> 3] |= (uint8_t)(1 << (dx & 7));
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef ROTATION_SPRITE_CACHE_H
+#define ROTATION_SPRITE_CACHE_H
+
+#include <Arduino.h>
+#include <memory>
+#include "FixedTrig.h"
+
+// Pre-rotated copies of XBM bitmaps (LSB-first rows, as drawXBMP takes),
+// shared by every rotating sprite (idle lean). Angles are quantized to
+// ANGLE_STEP_DEGREES and each (bitmap, pivot, angle) is rendered once, on
+// first use, by inverse mapping, so rotated sprites have no holes. Drawing is
+// then one clipped drawXBM() instead of a sin/cos transform per pixel.
+//
+// The cache is bounded by entry count and bytes; the least recently used
+// entry is dropped to make room.
+class RotationSpriteCache {
+public:
+    static constexpr float ANGLE_STEP_DEGREES = 1.0f;
+    static const uint8_t MAX_ENTRIES = 24;
+    static const size_t MAX_BYTES = 4096;
+
+    struct Sprite {
+        const uint8_t* bits = nullptr; // XBM layout; valid until the next get()
+        int width = 0;
+        int height = 0;
+        int offsetX = 0; // Top-left corner relative to the unrotated bitmap's
+        int offsetY = 0;
+    };
+
+    RotationSpriteCache(const RotationSpriteCache&) = delete;
+    RotationSpriteCache& operator=(const RotationSpriteCache&) = delete;
+    static RotationSpriteCache* getInstance();
+
+    // Rotates bitmap by angleDegrees (clockwise on screen)
+    // around (pivotX, pivotY). Returns false if the sprite could not be
+    // allocated.
+    bool get(const unsigned char* bitmap, int width, int height, float pivotX, float pivotY, float angleDegrees, Sprite& out);
+
+    size_t getBytesUsed() const { return _bytesUsed; }
+
+private:
+    RotationSpriteCache() = default;
+    static RotationSpriteCache* _instance;
+
+    struct Entry {
+        const unsigned char* bitmap = nullptr; // Null: free slot
+        int16_t width = 0;
+        int16_t height = 0;
+        int16_t pivotX2 = 0;   // Pivot in half pixels
+        int16_t pivotY2 = 0;
+        int16_t angleStep = 0; // Angle / ANGLE_STEP_DEGREES, 0 excluded
+        Sprite sprite;
+        size_t size = 0;
+        uint32_t lastUse = 0;
+        std::unique_ptr<uint8_t[]> bits;
+    };
+
+    Entry _entries[MAX_ENTRIES];
+    size_t _bytesUsed = 0;
+    uint32_t _useCounter = 0;
+
+    void evict(Entry& entry);
+    Entry* makeRoom(size_t size);
+    static void computeBounds(int width, int height, float pivotX, float pivotY, FixedTrig::Angle angle, Sprite& sprite);
+    static void render(const unsigned char* bitmap, int width, int height, float pivotX, float pivotY, FixedTrig::Angle angle,
+                       const Sprite& sprite, uint8_t* bits);
+};
+
+#endif // ROTATION_SPRITE_CACHE_H
@@ -0,0 +1,89 @@
+#include "ScaledBlitter.h"
+#include <algorithm>
+#include <cmath>
+#include <pgmspace.h>
+
+void ScaledBlitter::draw(U8G2* u8g2, int x, int y, const unsigned char* bitmap, int width, int height, float scale,
+                         int clipX0, int clipY0, int clipX1, int clipY1) {
+    if (!u8g2 || !bitmap || width <= 0 || height <= 0 || scale <= 0.0f) return;
+
+    int destW = (int)lroundf(width * scale);
+    int destH = (int)lroundf(height * scale);
+    if (destW <= 0 || destH <= 0) return;
+
+    // Rounded up, so a destination pixel that lands exactly on a source
+    // edge (d / scale integral) never truncates to the pixel before it.
+    uint32_t step = (uint32_t)ceilf(65536.0f / scale);
+
+    const int displayW = u8g2->getDisplayWidth();
+    const int displayH = u8g2->getDisplayHeight();
+    int x0 = std::max(std::max(x, clipX0), 0);
+    int y0 = std::max(std::max(y, clipY0), 0);
+    int x1 = std::min(std::min(x + destW, clipX1), displayW);
+    int y1 = std::min(std::min(y + destH, clipY1), displayH);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    const u8g2_cb_t* rotation = u8g2->getU8g2()->cb;
+    const bool rotated180 = rotation == U8G2_R2;
+    if ((!rotated180 && rotation != U8G2_R0) || (displayH & 7) != 0 ||
+        u8g2->getBufferTileHeight() * 8 != displayH) {
+        drawPerPixel(u8g2, x, y, bitmap, width, height, step, x0, y0, x1, y1);
+        return;
+    }
+
+    uint8_t* buffer = u8g2->getBufferPtr();
+    const uint8_t color = u8g2->getDrawColor();
+    const int stride = (width + 7) / 8;
+    const int lastPage = displayH / 8 - 1;
+
+    for (int page = y0 >> 3; page <= (y1 - 1) >> 3; ++page) {
+        // The (up to) 8 source rows behind this page and the bit each lands on.
+        const unsigned char* rows[8];
+        uint8_t bits[8];
+        int rowCount = 0;
+        int rowEnd = std::min(y1, page * 8 + 8);
+        for (int row = std::max(y0, page * 8); row < rowEnd; ++row) {
+            int srcY = (int)(((uint32_t)(row - y) * step) >> 16);
+            if (srcY >= height) break;
+            rows[rowCount] = bitmap + srcY * stride;
+            bits[rowCount] = rotated180 ? (uint8_t)(0x80 >> (row & 7)) : (uint8_t)(1 << (row & 7));
+            rowCount++;
+        }
+        if (rowCount == 0) break;
+
+        uint8_t* pageRow = buffer + (rotated180 ? lastPage - page : page) * displayW;
+        uint32_t srcX16 = (uint32_t)(x0 - x) * step;
+        for (int col = x0; col < x1; ++col, srcX16 += step) {
+            int srcX = (int)(srcX16 >> 16);
+            if (srcX >= width) break;
+            const int srcByte = srcX >> 3;
+            const uint8_t srcMask = (uint8_t)(1 << (srcX & 7));
+            uint8_t out = 0;
+            for (int i = 0; i < rowCount; ++i) {
+                if (pgm_read_byte(rows[i] + srcByte) & srcMask) out |= bits[i];
+            }
+            if (!out) continue;
+            uint8_t* cell = pageRow + (rotated180 ? displayW - 1 - col : col);
+            if (color == 0) *cell &= (uint8_t)~out;
+            else if (color == 1) *cell |= out;
+            else *cell ^= out;
+        }
+    }
+}
+
+// Same mapping through drawPixel(), for buffers the page writer cannot address.
+void ScaledBlitter::drawPerPixel(U8G2* u8g2, int x, int y, const unsigned char* bitmap, int width, int height,
+                                 uint32_t step, int x0, int y0, int x1, int y1) {
+    const int stride = (width + 7) / 8;
+    for (int row = y0; row < y1; ++row) {
+        int srcY = (int)(((uint32_t)(row - y) * step) >> 16);
+        if (srcY >= height) break;
+        const unsigned char* src = bitmap + srcY * stride;
+        uint32_t srcX16 = (uint32_t)(x0 - x) * step;
+        for (int col = x0; col < x1; ++col, srcX16 += step) {
+            int srcX = (int)(srcX16 >> 16);
+            if (srcX >= width) break;
+            if (pgm_read_byte(src + (srcX >> 3)) & (1 << (srcX & 7))) u8g2->drawPixel(col, row);
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef SCALED_BLITTER_H
+#define SCALED_BLITTER_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// Nearest-neighbour scaling of XBM bitmaps (LSB-first rows, as drawXBMP
+// takes) for every zooming sprite. Source coordinates are stepped in 16.16
+// fixed point and the clip rectangle is applied once per draw, not per
+// pixel. Output goes straight into the full frame buffer one page byte
+// (8 vertical pixels) at a time, in U8G2_R0 or U8G2_R2; other rotations fall
+// back to drawPixel().
+//
+// Only set source pixels are drawn (transparent, like drawXBM in bitmap
+// mode 1), with the current draw colour: 1 sets, 0 clears, 2 inverts.
+class ScaledBlitter {
+public:
+    // Draws bitmap (width x height) scaled by `scale` with its top-left
+    // corner at (x, y). The destination is round(width * scale) by
+    // round(height * scale) and destination pixel d samples source pixel
+    // floor(d / scale). Pixels outside [clipX0, clipX1) x [clipY0, clipY1)
+    // and off the display are skipped.
+    static void draw(U8G2* u8g2, int x, int y, const unsigned char* bitmap, int width, int height, float scale,
+                     int clipX0, int clipY0, int clipX1, int clipY1);
+
+private:
+    static void drawPerPixel(U8G2* u8g2, int x, int y, const unsigned char* bitmap, int width, int height,
+                             uint32_t step, int x0, int y0, int x1, int y1);
+};
+
+#endif // SCALED_BLITTER_H
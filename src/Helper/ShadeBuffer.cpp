@@ -0,0 +1,110 @@
+#include "ShadeBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include "../DebugUtils.h"
+
+ShadeBuffer* ShadeBuffer::_instance = nullptr;
+
+// Pixel (x, y) is lit when its shade is above BAYER[y & 7][x & 7]: the
+// classic 8x8 index matrix, spread over 2..254.
+const uint8_t ShadeBuffer::BAYER[8][8] = {
+    {  2, 130,  34, 162,  10, 138,  42, 170},
+    {194,  66, 226,  98, 202,  74, 234, 106},
+    { 50, 178,  18, 146,  58, 186,  26, 154},
+    {242, 114, 210,  82, 250, 122, 218,  90},
+    { 14, 142,  46, 174,   6, 134,  38, 166},
+    {206,  78, 238, 110, 198,  70, 230, 102},
+    { 62, 190,  30, 158,  54, 182,  22, 150},
+    {254, 126, 222,  94, 246, 118, 214,  86},
+};
+
+ShadeBuffer* ShadeBuffer::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new ShadeBuffer();
+    }
+    return _instance;
+}
+
+bool ShadeBuffer::acquire() {
+    if (!_shades) {
+        _shades.reset(new (std::nothrow) uint8_t[WIDTH * HEIGHT]);
+        if (!_shades) {
+            debugPrint("WEATHER", "ShadeBuffer: failed to allocate the shades!");
+            return false;
+        }
+        memset(_shades.get(), 0, WIDTH * HEIGHT);
+        _minX = WIDTH;
+        _maxX = 0;
+        _minY = HEIGHT;
+        _maxY = 0;
+    }
+    ++_users;
+    return true;
+}
+
+void ShadeBuffer::release() {
+    if (_users > 0 && --_users == 0) _shades.reset();
+}
+
+void ShadeBuffer::begin() {
+    if (!_shades) return;
+    for (int x = _minX; x < _maxX; ++x) memset(_shades.get() + x * HEIGHT + _minY, 0, _maxY - _minY);
+    _minX = WIDTH;
+    _maxX = 0;
+    _minY = HEIGHT;
+    _maxY = 0;
+}
+
+void ShadeBuffer::column(int x, int y, const uint8_t* shades, int count) {
+    if (!_shades || x < 0 || x >= WIDTH) return;
+    const int y0 = std::max(0, y), y1 = std::min(HEIGHT, y + count);
+    if (y0 >= y1) return;
+    uint8_t* __restrict cell = _shades.get() + x * HEIGHT + y0;
+    const uint8_t* __restrict source = shades + (y0 - y);
+    for (int i = 0; i < y1 - y0; ++i) cell[i] = std::max(cell[i], source[i]);
+    _minX = std::min(_minX, x);
+    _maxX = std::max(_maxX, x + 1);
+    _minY = std::min(_minY, y0);
+    _maxY = std::max(_maxY, y1);
+}
+
+// Page-aligned strips of 32 rows, one blitColumns() each. Rows outside the
+// written area are zero, so strips may run past it. The eight shades of a
+// page byte are compared with their thresholds at once, as bytes of one
+// 64-bit word (little-endian: byte k is row k of the page).
+void ShadeBuffer::quantize(FrameBufferView& view, FrameBufferView::Op op) const {
+    if (!_shades || _minX >= _maxX) return;
+    const uint64_t HIGH_BITS = 0x8080808080808080ull;
+    // Per column phase: BAYER + 1, so "shade >= limit" means "shade > BAYER".
+    uint64_t limits[8];
+    for (int phase = 0; phase < 8; ++phase) {
+        limits[phase] = 0;
+        for (int k = 0; k < 8; ++k) limits[phase] |= (uint64_t)(BAYER[k][phase] + 1) << (8 * k);
+    }
+
+    uint32_t masks[WIDTH];
+    const int first = _minY & ~7;
+    for (int top = first; top < _maxY; top += 32) {
+        const int bottom = std::min(HEIGHT, (std::min(_maxY, top + 32) + 7) & ~7);
+        bool any = false;
+        for (int x = _minX; x < _maxX; ++x) {
+            const uint64_t limit = limits[x & 7];
+            const uint8_t* cell = _shades.get() + x * HEIGHT;
+            uint32_t mask = 0;
+            for (int y = top; y < bottom; y += 8) {
+                uint64_t shades;
+                memcpy(&shades, cell + y, 8);
+                if (!shades) continue; // An unlit page byte
+                // High bit of each byte: shade >= limit, bytewise unsigned.
+                const uint64_t difference = (shades | HIGH_BITS) - (limit & ~HIGH_BITS);
+                const uint64_t atLeast = ((shades & ~limit) | (~(shades ^ limit) & difference)) & HIGH_BITS;
+                // Gathers the eight high bits into one byte, byte k to bit k.
+                const uint32_t bits = (uint32_t)(((atLeast >> 7) * 0x0102040810204080ull) >> 56);
+                mask |= bits << (y - top);
+            }
+            masks[x] = mask;
+            any |= mask != 0;
+        }
+        if (any) view.blitColumns(_minX, top, masks + _minX, _maxX - _minX, op);
+    }
+}
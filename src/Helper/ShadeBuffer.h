@@ -0,0 +1,74 @@
+#ifndef SHADE_BUFFER_H
+#define SHADE_BUFFER_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <memory>
+#include "FrameBufferView.h"
+
+// An 8-bit picture of the screen for effects that draw soft, continuous
+// intensities (fog, aurora), shared by all of them. An effect begin()s a
+// picture, fill()s shades into it and quantize()s it onto the frame: one
+// pass through an 8x8 Bayer matrix turns each shade into a fixed dot
+// pattern, written a page byte at a time. The same shades give the same
+// pixels every frame, so still areas do not shimmer and stream cheaply.
+//
+// The buffer is full resolution, column by column, and exists while any
+// effect holds it (acquire()/release()). Only the area written since
+// begin() is cleared and quantized.
+class ShadeBuffer {
+public:
+    static const int WIDTH = 128;
+    static const int HEIGHT = 64;
+
+    ShadeBuffer(const ShadeBuffer&) = delete;
+    ShadeBuffer& operator=(const ShadeBuffer&) = delete;
+    static ShadeBuffer* getInstance();
+
+    // False if the buffer could not be allocated.
+    bool acquire();
+    void release();
+
+    // Starts an empty picture.
+    void begin();
+    // Where shapes overlap the brighter shade is kept. 0: nothing, 255: every
+    // pixel.
+    inline void fill(int x, int y, int w, int h, uint8_t shade);
+    void vSpan(int x, int y, int h, uint8_t shade) { fill(x, y, 1, h, shade); }
+    // count shades down column x from row y, for effects that work out a
+    // whole column at a time.
+    void column(int x, int y, const uint8_t* shades, int count);
+    // Draws the picture's lit pixels with op.
+    void quantize(FrameBufferView& view, FrameBufferView::Op op) const;
+
+private:
+    ShadeBuffer() = default;
+    static ShadeBuffer* _instance;
+
+    static const uint8_t BAYER[8][8];
+
+    std::unique_ptr<uint8_t[]> _shades; // WIDTH columns of HEIGHT shades
+    int _users = 0;
+    // Area written since begin(), end exclusive.
+    int _minX = WIDTH;
+    int _maxX = 0;
+    int _minY = HEIGHT;
+    int _maxY = 0;
+};
+
+inline void ShadeBuffer::fill(int x, int y, int w, int h, uint8_t shade) {
+    if (!_shades || shade == 0) return;
+    const int x0 = std::max(0, x), x1 = std::min(WIDTH, x + w);
+    const int y0 = std::max(0, y), y1 = std::min(HEIGHT, y + h);
+    if (x0 >= x1 || y0 >= y1) return;
+    for (int column = x0; column < x1; ++column) {
+        uint8_t* cell = _shades.get() + column * HEIGHT;
+        for (int row = y0; row < y1; ++row) cell[row] = std::max(cell[row], shade);
+    }
+    if (x0 < _minX) _minX = x0;
+    if (x1 > _maxX) _maxX = x1;
+    if (y0 < _minY) _minY = y0;
+    if (y1 > _maxY) _maxY = y1;
+}
+
+#endif // SHADE_BUFFER_H
@@ -0,0 +1,40 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <stdint.h>
+
+// A fixed-size queue between exactly one producer thread and one consumer
+// thread, without locks: each side only ever writes its own index, and the
+// release/acquire pair on it publishes the item (and whatever the producer
+// wrote before pushing). SIZE must be a power of two.
+template <typename T, uint32_t SIZE>
+class SpscRing {
+    static_assert(SIZE != 0 && (SIZE & (SIZE - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    // Producer side. False when full.
+    bool push(const T& item) {
+        const uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) == SIZE) return false;
+        _items[head & (SIZE - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. False when empty.
+    bool pop(T& item) {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (_head.load(std::memory_order_acquire) == tail) return false;
+        item = _items[tail & (SIZE - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T _items[SIZE];
+    std::atomic<uint32_t> _head{0}; // Next to write; the producer's
+    std::atomic<uint32_t> _tail{0}; // Next to read; the consumer's
+};
+
+#endif // SPSC_RING_H
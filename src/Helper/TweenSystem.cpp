@@ -0,0 +1,394 @@
+#include "TweenSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include "../DebugUtils.h"
+
+TweenSystem* TweenSystem::_instance = nullptr;
+
+namespace {
+
+// The curves on 0..1, as C++11 constant expressions.
+constexpr double easeIn(double t) { return t * t; }
+constexpr double easeOut(double t) { return 1.0 - (1.0 - t) * (1.0 - t); }
+constexpr double easeInOut(double t) { return t * t * (3.0 - 2.0 * t); }
+constexpr double easeOutCubic(double t) { return 1.0 - (1.0 - t) * (1.0 - t) * (1.0 - t); }
+
+constexpr double stepOf(int i) { return i / (double)TweenSystem::EASING_STEPS; }
+constexpr uint16_t q15(double v) { return (uint16_t)(v * 32768.0 + 0.5); }
+constexpr uint16_t linearEntry(int i) { return q15(stepOf(i)); }
+constexpr uint16_t easeInEntry(int i) { return q15(easeIn(stepOf(i))); }
+constexpr uint16_t easeOutEntry(int i) { return q15(easeOut(stepOf(i))); }
+constexpr uint16_t easeInOutEntry(int i) { return q15(easeInOut(stepOf(i))); }
+constexpr uint16_t easeOutCubicEntry(int i) { return q15(easeOutCubic(stepOf(i))); }
+
+float catmullRom(float t, float p0, float p1, float p2, float p3) {
+    float t2 = t * t;
+    float t3 = t2 * t;
+    return 0.5f * ( (2.0f * p1) +
+                    (-p0 + p2) * t +
+                    (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+                    (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3 );
+}
+
+} // namespace
+
+#define TABLE_4(f, i) f(i), f(i + 1), f(i + 2), f(i + 3)
+#define TABLE_16(f, i) TABLE_4(f, i), TABLE_4(f, i + 4), TABLE_4(f, i + 8), TABLE_4(f, i + 12)
+#define TABLE_64(f, i) TABLE_16(f, i), TABLE_16(f, i + 16), TABLE_16(f, i + 32), TABLE_16(f, i + 48)
+
+const uint16_t TweenSystem::EASING_TABLE[EASING_COUNT][EASING_STEPS + 1] = {
+    {TABLE_64(linearEntry, 0), linearEntry(64)},
+    {TABLE_64(easeInEntry, 0), easeInEntry(64)},
+    {TABLE_64(easeOutEntry, 0), easeOutEntry(64)},
+    {TABLE_64(easeInOutEntry, 0), easeInOutEntry(64)},
+    {TABLE_64(easeOutCubicEntry, 0), easeOutCubicEntry(64)},
+};
+
+#undef TABLE_64
+#undef TABLE_16
+#undef TABLE_4
+
+TweenSystem* TweenSystem::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new TweenSystem();
+    }
+    return _instance;
+}
+
+TweenSystem::Spec TweenSystem::value(float from, float to, unsigned long durationMs, Easing easing) {
+    Spec spec = {};
+    spec.from[0] = from;
+    spec.to[0] = to;
+    spec.channels = 1;
+    spec.durationMs = durationMs;
+    spec.easing = easing;
+    spec.cycles = 1;
+    return spec;
+}
+
+TweenSystem::Spec TweenSystem::move(float fromX, float fromY, float toX, float toY, unsigned long durationMs, Easing easing) {
+    Spec spec = value(fromX, toX, durationMs, easing);
+    spec.from[1] = fromY;
+    spec.to[1] = toY;
+    spec.channels = 2;
+    return spec;
+}
+
+TweenSystem::Spec TweenSystem::frames(int frameCount, unsigned long frameDurationMs, uint16_t cycles) {
+    Spec spec = value(0.0f, (float)std::max(1, frameCount), std::max(1, frameCount) * frameDurationMs);
+    spec.cycles = cycles;
+    return spec;
+}
+
+bool TweenSystem::ensurePool() {
+    if (_pool) return true;
+    _pool.reset(new (std::nothrow) Pool());
+    if (!_pool) {
+        debugPrint("ANIMATOR", "TweenSystem: failed to allocate the tween pool!");
+        return false;
+    }
+    // Slot 0 is handed out first.
+    _freeCount = MAX_TWEENS;
+    for (int i = 0; i < MAX_TWEENS; ++i) {
+        _pool->freeSlots[i] = (uint16_t)(MAX_TWEENS - 1 - i);
+        _pool->generation[i] = 1;
+    }
+    _liveCount = 0;
+    return true;
+}
+
+uint16_t TweenSystem::slotOf(TweenHandle tween) const {
+    if (!_pool || tween == NO_TWEEN) return NO_SLOT;
+    const uint16_t slot = (uint16_t)(tween & 0xFFFF);
+    if (slot >= MAX_TWEENS || _pool->generation[slot] != (uint16_t)(tween >> 16)) return NO_SLOT;
+    return slot;
+}
+
+uint16_t TweenSystem::allocate(const Spec& spec, void* owner, Callback onComplete) {
+    if (!ensurePool() || _freeCount == 0) {
+        debugPrint("ANIMATOR", "TweenSystem: no free tween!");
+        return NO_SLOT;
+    }
+    Pool& pool = *_pool;
+    const uint16_t slot = pool.freeSlots[--_freeCount];
+    pool.livePosition[slot] = (uint16_t)_liveCount;
+    pool.live[_liveCount++] = slot;
+
+    pool.elapsed[slot] = -(int32_t)std::min(spec.delayMs, 0x3FFFFFFFul);
+    const uint32_t duration = std::min(spec.durationMs, 0x3FFFFFFFul);
+    const uint64_t cycle = spec.yoyo ? 2ull * duration + std::min(spec.holdMs, 0x3FFFFFFFul) : duration;
+    pool.duration[slot] = duration;
+    pool.rate[slot] = duration ? (uint32_t)((1ull << 31) / duration) : 0;
+    pool.cycle[slot] = (uint32_t)std::min<uint64_t>(cycle, 0x7FFFFFFF);
+    pool.end[slot] = (uint32_t)std::min<uint64_t>(cycle * spec.cycles, 0x7FFFFFFF);
+    pool.easing[slot] = spec.easing < EASING_COUNT ? spec.easing : LINEAR;
+    pool.eased[slot] = EASING_TABLE[pool.easing[slot]][0];
+    pool.flags[slot] = spec.yoyo ? YOYO : 0;
+    pool.channels[slot] = std::min<uint8_t>(spec.channels, MAX_CHANNELS);
+    pool.path[slot] = NO_PATH;
+    for (int c = 0; c < MAX_CHANNELS; ++c) {
+        const bool used = c < pool.channels[slot];
+        pool.from[c][slot] = used ? spec.from[c] : 0.0f;
+        pool.delta[c][slot] = used ? spec.to[c] - spec.from[c] : 0.0f;
+    }
+    pool.then[slot] = NO_TWEEN;
+    pool.owner[slot] = owner;
+    pool.onComplete[slot] = onComplete;
+    return slot;
+}
+
+TweenHandle TweenSystem::start(const Spec& spec, void* owner, Callback onComplete) {
+    const uint16_t slot = allocate(spec, owner, onComplete);
+    return slot == NO_SLOT ? NO_TWEEN : handleOf(slot);
+}
+
+TweenHandle TweenSystem::startAfter(TweenHandle previous, const Spec& spec, void* owner, Callback onComplete) {
+    uint16_t last = slotOf(previous);
+    if (last == NO_SLOT) return start(spec, owner, onComplete);
+    const uint16_t slot = allocate(spec, owner, onComplete);
+    if (slot == NO_SLOT) return NO_TWEEN;
+    Pool& pool = *_pool;
+    for (uint16_t next = slotOf(pool.then[last]); next != NO_SLOT; next = slotOf(pool.then[last])) last = next;
+    pool.then[last] = handleOf(slot);
+    pool.flags[slot] |= WAITING;
+    return handleOf(slot);
+}
+
+// Walks the curve in short chords twice: once for its length, then to drop a
+// sample every PATH_SAMPLES-th of it. Queries then only interpolate between
+// neighbouring samples, and equal progress covers equal distance.
+void TweenSystem::compilePath(Path& path, const std::vector<PathPoint>& points, bool smooth) {
+    const int STEPS_PER_SEGMENT = 16;
+    const int count = (int)points.size();
+    const int steps = (count - 1) * STEPS_PER_SEGMENT;
+    auto curve = [&](int step, float& x, float& y) {
+        const int segment = std::min(step / STEPS_PER_SEGMENT, count - 2);
+        const float t = (float)(step - segment * STEPS_PER_SEGMENT) / STEPS_PER_SEGMENT;
+        const PathPoint& p1 = points[segment];
+        const PathPoint& p2 = points[segment + 1];
+        if (smooth) {
+            // The end points stand in for the missing neighbours.
+            const PathPoint& p0 = points[std::max(0, segment - 1)];
+            const PathPoint& p3 = points[std::min(count - 1, segment + 2)];
+            x = catmullRom(t, p0.x, p1.x, p2.x, p3.x);
+            y = catmullRom(t, p0.y, p1.y, p2.y, p3.y);
+        } else {
+            x = p1.x + (p2.x - p1.x) * t;
+            y = p1.y + (p2.y - p1.y) * t;
+        }
+    };
+    auto store = [&](int sample, float x, float y) {
+        const float scale = (float)(1 << PATH_SHIFT);
+        path.x[sample] = (int16_t)std::max(-32768.0f, std::min(32767.0f, roundf(x * scale)));
+        path.y[sample] = (int16_t)std::max(-32768.0f, std::min(32767.0f, roundf(y * scale)));
+    };
+
+    float length = 0.0f;
+    float lastX, lastY;
+    curve(0, lastX, lastY);
+    for (int step = 1; step <= steps; ++step) {
+        float x, y;
+        curve(step, x, y);
+        length += sqrtf((x - lastX) * (x - lastX) + (y - lastY) * (y - lastY));
+        lastX = x;
+        lastY = y;
+    }
+
+    float walked = 0.0f;
+    int sample = 0;
+    curve(0, lastX, lastY);
+    store(sample++, lastX, lastY);
+    for (int step = 1; step <= steps && sample < PATH_SAMPLES; ++step) {
+        float x, y;
+        curve(step, x, y);
+        const float chord = sqrtf((x - lastX) * (x - lastX) + (y - lastY) * (y - lastY));
+        for (float next = length * sample / PATH_SAMPLES; sample < PATH_SAMPLES && walked + chord >= next;
+             next = length * sample / PATH_SAMPLES) {
+            const float f = chord > 0.0f ? (next - walked) / chord : 0.0f;
+            store(sample++, lastX + (x - lastX) * f, lastY + (y - lastY) * f);
+        }
+        walked += chord;
+        lastX = x;
+        lastY = y;
+    }
+    // The last sample is the end point, as are any rounding left short.
+    while (sample <= PATH_SAMPLES) store(sample++, points.back().x, points.back().y);
+}
+
+TweenHandle TweenSystem::startPath(const std::vector<PathPoint>& points, bool smooth, unsigned long durationMs,
+                                   uint16_t cycles, void* owner, Callback onComplete) {
+    if (points.size() < 2) {
+        debugPrint("ANIMATOR", "TweenSystem: a path needs at least 2 points.");
+        return NO_TWEEN;
+    }
+    int path = 0;
+    while (path < MAX_PATHS && _paths[path].used) ++path;
+    if (path == MAX_PATHS) {
+        debugPrint("ANIMATOR", "TweenSystem: no free path!");
+        return NO_TWEEN;
+    }
+    Spec spec = value(0.0f, 1.0f, durationMs);
+    spec.channels = 2;
+    spec.cycles = cycles;
+    const uint16_t slot = allocate(spec, owner, onComplete);
+    if (slot == NO_SLOT) return NO_TWEEN;
+    compilePath(_paths[path], points, smooth);
+    _paths[path].used = true;
+    _pool->path[slot] = (uint8_t)path;
+    return handleOf(slot);
+}
+
+void TweenSystem::release(uint16_t slot) {
+    Pool& pool = *_pool;
+    if (pool.path[slot] != NO_PATH) {
+        _paths[pool.path[slot]].used = false;
+    }
+    if (++pool.generation[slot] == 0) pool.generation[slot] = 1;
+    pool.flags[slot] = 0;
+    pool.owner[slot] = nullptr;
+    pool.onComplete[slot] = nullptr;
+
+    const uint16_t position = pool.livePosition[slot];
+    const uint16_t moved = pool.live[--_liveCount];
+    pool.live[position] = moved;
+    pool.livePosition[moved] = position;
+    pool.freeSlots[_freeCount++] = slot;
+}
+
+void TweenSystem::cancelSlot(uint16_t slot) {
+    const TweenHandle then = _pool->then[slot];
+    release(slot);
+    const uint16_t next = slotOf(then);
+    if (next != NO_SLOT && (_pool->flags[next] & WAITING)) cancelSlot(next);
+}
+
+void TweenSystem::cancel(TweenHandle tween) {
+    const uint16_t slot = slotOf(tween);
+    if (slot != NO_SLOT) cancelSlot(slot);
+}
+
+void TweenSystem::cancelOwnedBy(const void* owner) {
+    if (!_pool) return;
+    // Backwards: a removal moves the last, already visited, slot into place.
+    for (int position = _liveCount - 1; position >= 0; --position) {
+        if (position >= _liveCount) continue; // A queue went with it
+        const uint16_t slot = _pool->live[position];
+        if (_pool->owner[slot] == owner) cancelSlot(slot);
+    }
+}
+
+uint16_t TweenSystem::ease(uint8_t easing, int32_t progress) {
+    if (progress >= ONE) return EASING_TABLE[easing][EASING_STEPS];
+    const int shift = 15 - 6; // EASING_STEPS == 1 << 6
+    const int index = progress >> shift;
+    const int32_t frac = progress & ((1 << shift) - 1);
+    const int32_t a = EASING_TABLE[easing][index];
+    return (uint16_t)(a + (((EASING_TABLE[easing][index + 1] - a) * frac) >> shift));
+}
+
+void TweenSystem::updateAll(unsigned long dtMs) {
+    if (!_pool || _liveCount == 0) return;
+    Pool& pool = *_pool;
+    const int32_t dt = (int32_t)std::min(dtMs, 0x3FFFFFFFul);
+
+    int finished = 0;
+    for (int i = 0; i < _liveCount; ++i) {
+        const uint16_t slot = pool.live[i];
+        if (pool.flags[slot] & (WAITING | FINISHED)) continue;
+        const int32_t elapsed = pool.elapsed[slot] + dt;
+        pool.elapsed[slot] = elapsed;
+        if (elapsed < 0) continue; // Still delayed
+
+        const uint32_t cycle = pool.cycle[slot];
+        const uint32_t end = pool.end[slot];
+        uint32_t t = (uint32_t)elapsed;
+        if (t >= end && (end || !cycle)) { // Done, or nothing to run
+            pool.eased[slot] = EASING_TABLE[pool.easing[slot]][(pool.flags[slot] & YOYO) ? 0 : EASING_STEPS];
+            pool.flags[slot] |= FINISHED;
+            ++finished;
+            continue;
+        }
+        if (t >= cycle) {
+            t %= cycle;
+            if (!end) pool.elapsed[slot] = (int32_t)t; // Forever: keep the count small
+        }
+
+        // Q15 progress of this cycle: out, held at the end, back.
+        const uint32_t duration = pool.duration[slot];
+        uint32_t progress;
+        if (t < duration) progress = (t * pool.rate[slot] + 0x8000) >> 16;
+        else if (t < cycle - duration) progress = ONE;
+        else progress = ((cycle - t) * pool.rate[slot] + 0x8000) >> 16;
+        pool.eased[slot] = ease(pool.easing[slot], (int32_t)progress);
+    }
+    if (finished == 0) return;
+
+    // Completions, after the pass. Callbacks may start and cancel tweens,
+    // which moves live slots around, so the finished ones are gathered
+    // first; a handle gone stale meanwhile was cancelled by a callback.
+    TweenHandle done[MAX_TWEENS];
+    int doneCount = 0;
+    for (int position = 0; position < _liveCount; ++position) {
+        const uint16_t slot = pool.live[position];
+        if (pool.flags[slot] & FINISHED) done[doneCount++] = handleOf(slot);
+    }
+    for (int i = 0; i < doneCount; ++i) {
+        const uint16_t slot = slotOf(done[i]);
+        if (slot == NO_SLOT) continue;
+        const TweenHandle then = pool.then[slot];
+        void* owner = pool.owner[slot];
+        Callback onComplete = pool.onComplete[slot];
+        release(slot);
+        const uint16_t next = slotOf(then);
+        if (next != NO_SLOT) pool.flags[next] &= ~WAITING;
+        if (onComplete) onComplete(owner, done[i]);
+    }
+}
+
+float TweenSystem::value(TweenHandle tween, int channel) const {
+    const uint16_t slot = slotOf(tween);
+    if (slot == NO_SLOT || channel < 0 || channel >= MAX_CHANNELS) return 0.0f;
+    const Pool& pool = *_pool;
+    if (pool.path[slot] != NO_PATH) {
+        float x, y;
+        pathPosition(pool.path[slot], pool.eased[slot], x, y);
+        return channel == 0 ? x : channel == 1 ? y : 0.0f;
+    }
+    return pool.from[channel][slot] + pool.delta[channel][slot] * pool.eased[slot] * (1.0f / ONE);
+}
+
+float TweenSystem::progress(TweenHandle tween) const {
+    const uint16_t slot = slotOf(tween);
+    return slot == NO_SLOT ? 0.0f : _pool->eased[slot] * (1.0f / ONE);
+}
+
+int TweenSystem::frame(TweenHandle tween) const {
+    const uint16_t slot = slotOf(tween);
+    if (slot == NO_SLOT) return 0;
+    const int frameCount = (int)(_pool->from[0][slot] + _pool->delta[0][slot] + 0.5f);
+    return std::max(0, std::min(frameCount - 1, (int)value(tween, 0)));
+}
+
+bool TweenSystem::position(TweenHandle tween, float& x, float& y) const {
+    const uint16_t slot = slotOf(tween);
+    if (slot == NO_SLOT) return false;
+    const Pool& pool = *_pool;
+    if (pool.path[slot] != NO_PATH) {
+        pathPosition(pool.path[slot], pool.eased[slot], x, y);
+        return true;
+    }
+    x = value(tween, 0);
+    y = value(tween, 1);
+    return true;
+}
+
+void TweenSystem::pathPosition(uint8_t path, int32_t progress, float& x, float& y) const {
+    const Path& p = _paths[path];
+    const int32_t along = progress * PATH_SAMPLES; // Q15 samples
+    const int sample = std::min((int)(along >> 15), PATH_SAMPLES - 1);
+    const float t = (float)(along - (sample << 15)) * (1.0f / ONE);
+    const float scale = 1.0f / (1 << PATH_SHIFT);
+    x = (p.x[sample] + (p.x[sample + 1] - p.x[sample]) * t) * scale;
+    y = (p.y[sample] + (p.y[sample + 1] - p.y[sample]) * t) * scale;
+}
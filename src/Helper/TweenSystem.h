@@ -0,0 +1,166 @@
+#ifndef TWEEN_SYSTEM_H
+#define TWEEN_SYSTEM_H
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+#include "PathGenerator.h"
+
+// A running tween, or NO_TWEEN. Handles of finished or cancelled tweens go
+// stale: isActive() turns false and the slot may be reused without the old
+// handle ever reaching the new tween.
+typedef uint32_t TweenHandle;
+const TweenHandle NO_TWEEN = 0;
+
+// Everything that moves from A to B over time, in one place: positions,
+// angles, scales, spritesheet frames and paths. Tweens are kept in a pool
+// as parallel arrays (clock, easing and channels apart), and one
+// updateAll() per frame advances them all in a tight loop; scenes only read
+// values back by handle and draw. Up to MAX_CHANNELS values share a clock
+// (x, y and an angle, say).
+//
+// A tween can wait for another to complete (startAfter()) and can call a
+// plain function when it completes; neither allocates. Owners cancel their
+// tweens when they go away (cancelOwnedBy()), since a callback must not
+// reach a destroyed owner.
+// Pool size. Peak use is the awakening spark's quanta pulses (16 at once);
+// every slot costs about 70 bytes of heap whether used or not.
+#ifndef TWEEN_POOL_SIZE
+#define TWEEN_POOL_SIZE 32
+#endif
+
+class TweenSystem {
+public:
+    static const int MAX_TWEENS = TWEEN_POOL_SIZE;
+    static const int MAX_CHANNELS = 3;
+    static const int MAX_PATHS = 2; // Flyers, about 1 KB of samples each
+    // Samples a path is compiled into, at equal distances along it.
+    static const int PATH_SAMPLES = 256;
+
+    // Curves are tables of EASING_STEPS + 1 samples (TweenSystem.cpp),
+    // interpolated linearly.
+    enum Easing : uint8_t {
+        LINEAR,
+        EASE_IN,        // Quadratic
+        EASE_OUT,       // Quadratic
+        EASE_IN_OUT,    // Smoothstep
+        EASE_OUT_CUBIC,
+        EASING_COUNT
+    };
+    static const int EASING_STEPS = 64;
+
+    // What to run. Channels go from 'from' to 'to' together.
+    struct Spec {
+        float from[MAX_CHANNELS];
+        float to[MAX_CHANNELS];
+        uint8_t channels;
+        unsigned long durationMs;
+        unsigned long delayMs;  // Before the first cycle
+        Easing easing;
+        bool yoyo;              // Each cycle returns to 'from' ...
+        unsigned long holdMs;   // ... after holding at 'to' this long
+        uint16_t cycles;        // 0: until cancelled
+    };
+    static Spec value(float from, float to, unsigned long durationMs, Easing easing = LINEAR);
+    static Spec move(float fromX, float fromY, float toX, float toY, unsigned long durationMs, Easing easing = LINEAR);
+    // Channel 0 counts 0 .. frameCount; read it with frame().
+    static Spec frames(int frameCount, unsigned long frameDurationMs, uint16_t cycles = 1);
+
+    typedef void (*Callback)(void* owner, TweenHandle tween);
+
+    TweenSystem(const TweenSystem&) = delete;
+    TweenSystem& operator=(const TweenSystem&) = delete;
+    static TweenSystem* getInstance();
+
+    // NO_TWEEN when the pool is full (or could not be allocated).
+    TweenHandle start(const Spec& spec, void* owner = nullptr, Callback onComplete = nullptr);
+    // Queues behind previous and whatever already waits for it; cancelling
+    // previous cancels the queue. Starts at once if previous is not running.
+    TweenHandle startAfter(TweenHandle previous, const Spec& spec, void* owner = nullptr, Callback onComplete = nullptr);
+    // Moves along points at constant speed, however long each segment is;
+    // read it with position(). smooth: Catmull-Rom through the points. The
+    // curve is compiled here, once, so points need not outlive the call.
+    TweenHandle startPath(const std::vector<PathPoint>& points, bool smooth, unsigned long durationMs,
+                          uint16_t cycles = 1, void* owner = nullptr, Callback onComplete = nullptr);
+
+    void cancel(TweenHandle tween);
+    void cancelOwnedBy(const void* owner);
+
+    // Advances every tween by dtMs, then completes the finished ones.
+    void updateAll(unsigned long dtMs);
+
+    bool isActive(TweenHandle tween) const { return slotOf(tween) != NO_SLOT; }
+    // 0 for a stale handle.
+    float value(TweenHandle tween, int channel = 0) const;
+    // Eased progress of the current cycle, 0..1.
+    float progress(TweenHandle tween) const;
+    // Channel 0 of a frames() tween, as a frame index.
+    int frame(TweenHandle tween) const;
+    // Channels 0 and 1, or the point reached along a path. False if stale.
+    bool position(TweenHandle tween, float& x, float& y) const;
+
+    int activeCount() const { return _liveCount; }
+
+private:
+    TweenSystem() = default;
+    static TweenSystem* _instance;
+
+    static const uint16_t NO_SLOT = 0xFFFF;
+    static const uint8_t NO_PATH = 0xFF;
+    static const int32_t ONE = 1 << 15; // Progress, Q15
+
+    // Flags
+    static const uint8_t YOYO = 1;
+    static const uint8_t WAITING = 2;   // For the tween before it
+    static const uint8_t FINISHED = 4;
+
+    // Points PATH_SAMPLES-th of the length apart, in 1/16 pixels (Q4).
+    static const int PATH_SHIFT = 4;
+    struct Path {
+        int16_t x[PATH_SAMPLES + 1];
+        int16_t y[PATH_SAMPLES + 1];
+        bool used = false;
+    };
+
+    // The pool, one array per field, indexed by slot.
+    struct Pool {
+        int32_t elapsed[MAX_TWEENS];        // ms into the tween, negative while delayed
+        uint32_t duration[MAX_TWEENS];      // One way
+        uint32_t rate[MAX_TWEENS];          // 2^31 / duration: progress without a division
+        uint32_t cycle[MAX_TWEENS];         // Out, hold and back for a yoyo
+        uint32_t end[MAX_TWEENS];           // cycle * cycles; 0: forever
+        uint16_t eased[MAX_TWEENS];         // Q15, what values are read from
+        uint8_t easing[MAX_TWEENS];
+        uint8_t flags[MAX_TWEENS];
+        uint8_t channels[MAX_TWEENS];
+        uint8_t path[MAX_TWEENS];
+        float from[MAX_CHANNELS][MAX_TWEENS];
+        float delta[MAX_CHANNELS][MAX_TWEENS];
+        uint16_t generation[MAX_TWEENS];
+        TweenHandle then[MAX_TWEENS];       // Waiting for this one
+        void* owner[MAX_TWEENS];
+        Callback onComplete[MAX_TWEENS];
+        uint16_t livePosition[MAX_TWEENS];
+        // live[0 .. _liveCount) are the slots in use, freeSlots[0 .. _freeCount) the rest.
+        uint16_t live[MAX_TWEENS];
+        uint16_t freeSlots[MAX_TWEENS];
+    };
+    std::unique_ptr<Pool> _pool;
+    int _liveCount = 0;
+    int _freeCount = 0;
+    Path _paths[MAX_PATHS];
+
+    static const uint16_t EASING_TABLE[EASING_COUNT][EASING_STEPS + 1];
+
+    bool ensurePool();
+    uint16_t slotOf(TweenHandle tween) const;
+    TweenHandle handleOf(uint16_t slot) const { return ((TweenHandle)_pool->generation[slot] << 16) | slot; }
+    uint16_t allocate(const Spec& spec, void* owner, Callback onComplete);
+    void release(uint16_t slot);
+    void cancelSlot(uint16_t slot);
+    static uint16_t ease(uint8_t easing, int32_t progress);
+    static void compilePath(Path& path, const std::vector<PathPoint>& points, bool smooth);
+    void pathPosition(uint8_t path, int32_t progress, float& x, float& y) const;
+};
+
+#endif // TWEEN_SYSTEM_H
@@ -53,6 +53,7 @@ bool DEBUG_U8G2_WEBSTREAM = true;
 #include "DialogBox/DialogBox.h"
 #include "System/DeepSleepController.h"
 #include "Scenes/Prequel/PrequelManager.h"
+#include "Helper/TweenSystem.h"
 #include "System/PeriodicTaskManager.h"
 #include "HardwareInputController.h"
 
@@ -70,13 +71,16 @@ bool DEBUG_U8G2_WEBSTREAM = true;
 #include "MycilaWebSerial.h"
 #include <SerialForwarder.h>
 #include "System/ScreenStreamer.h"
+#include "System/FrameProfiler.h"
+#include "System/DirtyTileTracker.h"
 
 
 #include "GameStats.h"
 #include "Weather/WeatherManager.h"
-#include "character/CharacterManager.h"
+#include "Character/CharacterManager.h"
 #include "GlobalMappings.h"
 #include "Helper/PathGenerator.h"
+#include "Helper/PathWorker.h"
 
 Language currentLanguage = Language::ENGLISH;
 GameContext gameContext;
@@ -100,7 +104,10 @@ PrequelManager *prequelManager_ptr = nullptr;
 PeriodicTaskManager *periodicTaskManager_ptr = nullptr;
 HardwareInputController *hardwareInputController_ptr = nullptr;
 PathGenerator *pathGenerator_ptr = nullptr;
+PathWorker *pathWorker_ptr = nullptr;
 ScreenStreamer* screenStreamer_ptr = nullptr;
+FrameProfiler* frameProfiler_ptr = nullptr;
+DirtyTileTracker* dirtyTileTracker_ptr = nullptr;
 
 extern Bluepad32 BP32;
 
@@ -133,6 +140,7 @@ const unsigned long TICK_INTERVAL_MICROS = 1000000 / TICK_SPEED;
 unsigned long previousTickTime = 0;
 unsigned long tickCounter = 0;
 unsigned long lastActivityTime = 0;
+unsigned long lastTweenUpdate = 0;
 
 const unsigned long ONE_MINUTE_MILLIS = 60000UL;
 const unsigned long INACTIVITY_TIMEOUT_MILLIS = 2 * ONE_MINUTE_MILLIS;
@@ -293,6 +301,11 @@ void setup()
     );
     u8g2->begin();
 
+    // Only tiles that changed since the previous flush go over I2C.
+    dirtyTileTracker_ptr = new DirtyTileTracker(u8g2, displayConf.rotation == U8G2_R2);
+    dirtyTileTracker_ptr->init();
+    gameContext.dirtyTiles = dirtyTileTracker_ptr;
+
     gameContext.display = u8g2;
     gameContext.defaultFont = u8g2_font_5x7_tf;
 
@@ -312,6 +325,12 @@ void setup()
     screenStreamer_ptr = new ScreenStreamer(u8g2, server_ptr, true, true, false, 8);
     screenStreamer_ptr->init();
 
+    debugPrint("SYSTEM", "Initializing frame profiler...");
+    frameProfiler_ptr = new FrameProfiler();
+    frameProfiler_ptr->init(server_ptr);
+    gameContext.frameProfiler = frameProfiler_ptr;
+    screenStreamer_ptr->setFrameProfiler(frameProfiler_ptr);
+
 
     debugPrint("SYSTEM", "Initializing character manager...");
     characterManager_ptr = CharacterManager::getInstance();
@@ -320,6 +339,9 @@ void setup()
     debugPrint("SYSTEM", "Initializing PathGenerator...");
     pathGenerator_ptr = new PathGenerator();
     gameContext.pathGenerator = pathGenerator_ptr;
+    pathWorker_ptr = new PathWorker(pathGenerator_ptr);
+    pathWorker_ptr->begin();
+    gameContext.pathWorker = pathWorker_ptr;
 
     debugPrint("SYSTEM", "Initializing deep sleep controller...");
     deepSleepController_ptr = new DeepSleepController(u8g2);
@@ -341,7 +363,7 @@ void setup()
     weatherManager_ptr = new WeatherManager(gameContext);
     gameContext.weatherManager = weatherManager_ptr;
 
-    if (!preferences_ptr || !gameStats_ptr || !server_ptr || !webSerial_ptr || !forwardedSerial_ptr || !wifiManager_ptr || !bluetoothManager_ptr || !globalButtonOk_ptr || !physicalButtonUp_ptr || !physicalButtonDown_ptr || !u8g2 || !engine || !characterManager_ptr || !deepSleepController_ptr || !prequelManager_ptr || !periodicTaskManager_ptr || !hardwareInputController_ptr || !weatherManager_ptr || !pathGenerator_ptr || !screenStreamer_ptr)
+    if (!preferences_ptr || !gameStats_ptr || !server_ptr || !webSerial_ptr || !forwardedSerial_ptr || !wifiManager_ptr || !bluetoothManager_ptr || !globalButtonOk_ptr || !physicalButtonUp_ptr || !physicalButtonDown_ptr || !u8g2 || !engine || !characterManager_ptr || !deepSleepController_ptr || !prequelManager_ptr || !periodicTaskManager_ptr || !hardwareInputController_ptr || !weatherManager_ptr || !pathGenerator_ptr || !pathWorker_ptr || !screenStreamer_ptr || !frameProfiler_ptr || !dirtyTileTracker_ptr)
     {
         Serial.println("!!! FATAL: Core object allocation failed! Halting.");
         while (1)
@@ -482,6 +504,7 @@ void setup()
 
     debugPrint("SYSTEM", "Setup completed.");
     startTime = millis();
+    lastTweenUpdate = startTime;
     previousTickTime = micros();
 }
 
@@ -496,7 +519,7 @@ void loop()
         !gameContext.bluetoothManager || !gameContext.gameStats || !gameContext.serialForwarder ||
         !gameContext.characterManager || !gameContext.deepSleepController ||
         !prequelManager_ptr || !gameContext.periodicTaskManager || !gameContext.hardwareInputController ||
-        !gameContext.weatherManager || !gameContext.pathGenerator || !gameContext.sceneManager || !gameContext.inputManager || !gameContext.renderer || !gameContext.display || !screenStreamer_ptr)
+        !gameContext.weatherManager || !gameContext.pathGenerator || !gameContext.pathWorker || !gameContext.sceneManager || !gameContext.inputManager || !gameContext.renderer || !gameContext.display || !screenStreamer_ptr || !gameContext.frameProfiler)
     {
         Serial.println("Loop Error: Core object pointer(s) or context members are NULL!");
         delay(1000);
@@ -543,29 +566,51 @@ void loop()
     if (currentTimeMicros - previousTickTime >= TICK_INTERVAL_MICROS)
     {
         unsigned long elapsedMicros = currentTimeMicros - previousTickTime;
-        unsigned long ticksToProcess = elapsedMicros / TICK_INTERVAL_MICROS;
-        if (ticksToProcess > 5) ticksToProcess = 5;
+        unsigned long ticksDue = elapsedMicros / TICK_INTERVAL_MICROS;
+        unsigned long ticksToProcess = ticksDue > 5 ? 5 : ticksDue;
         previousTickTime += ticksToProcess * TICK_INTERVAL_MICROS;
 
+        FrameProfiler* profiler = gameContext.frameProfiler;
+        profiler->beginFrame(*gameContext.sceneManager, ticksDue, ticksToProcess);
+        uint32_t frameStart = FrameProfiler::nowMicros();
+        uint32_t phaseStart = frameStart;
+
+        // Once per frame, whatever the tick count: tweens run on elapsed time.
+        unsigned long tweenNow = millis();
+        TweenSystem::getInstance()->updateAll(tweenNow - lastTweenUpdate);
+        lastTweenUpdate = tweenNow;
+
         for (unsigned long i = 0; i < ticksToProcess; ++i)
         {
             engine->update();
+            uint32_t now = FrameProfiler::nowMicros();
+            profiler->record(FrameProfiler::PHASE_UPDATE, now - phaseStart);
+            phaseStart = now;
         }
         tickCounter += ticksToProcess;
 
         engine->draw();
+        uint32_t drawEnd = FrameProfiler::nowMicros();
+        profiler->record(FrameProfiler::PHASE_DRAW, drawEnd - phaseStart);
 
         if (screenStreamer_ptr) {
             screenStreamer_ptr->streamFrame();
         }
+        uint32_t frameEnd = FrameProfiler::nowMicros();
+        profiler->record(FrameProfiler::PHASE_STREAM, frameEnd - drawEnd);
+        profiler->endFrame(*gameContext.sceneManager, gameContext.gameStats->currentWeather, frameEnd - frameStart);
     } else {
         vTaskDelay(pdMS_TO_TICKS(1));
     }
 
 
     if (gameContext.periodicTaskManager) {
+        uint32_t periodicStart = FrameProfiler::nowMicros();
         gameContext.periodicTaskManager->update(currentMillis, lastActivityTime);
+        gameContext.frameProfiler->record(FrameProfiler::PHASE_PERIODIC, FrameProfiler::nowMicros() - periodicStart);
     }
 
+    uint32_t serialStart = FrameProfiler::nowMicros();
     gameContext.serialForwarder->flushWebSerial();
+    gameContext.frameProfiler->record(FrameProfiler::PHASE_SERIAL, FrameProfiler::nowMicros() - serialStart);
 }
\ No newline at end of file
@@ -1,60 +1,111 @@
 #include "ParticleSystem.h"
 #include <cmath> // For round
 #include "DebugUtils.h"
-#include <algorithm> // For std::for_each, std::find_if
-#include <iterator> // For std::begin, std::end
+#include "Helper/FixedTrig.h"
+#include <algorithm> // For std::min, std::max
+#include <new>
 
 
-ParticleSystem::ParticleSystem(Renderer& renderer, const uint8_t* defaultFont)
+namespace {
+const int32_t ONE = 1 << ParticleSystem::FRACTION_BITS;
+
+int32_t toFixed(float pixels) { return (int32_t)lroundf(pixels * ONE); }
+// Pixels per tick to fixed point per millisecond.
+int32_t toFixedPerMs(float pixelsPerTick) {
+    return (int32_t)lroundf(pixelsPerTick * ONE * ParticleSystem::TICKS_PER_SECOND / 1000.0f);
+}
+int toPixel(int32_t fixed) { return (fixed + ONE / 2) >> ParticleSystem::FRACTION_BITS; }
+}
+
+ParticleSystem::ParticleSystem(Renderer& renderer, const uint8_t* defaultFont, int capacity)
     : _renderer(renderer), _defaultFont(defaultFont)
 {
-    // Pool is initialized by Particle default constructor (active=false)
+    capacity = std::max(1, std::min(capacity, (int)NO_SLOT)); // Slots are uint16_t, NO_SLOT excluded
+    _particlePool.reset(new (std::nothrow) Particle[capacity]);
+    _slots.reset(new (std::nothrow) uint16_t[2 * capacity]);
+    if (!_particlePool || !_slots) {
+        debugPrint("PARTICLE_SYSTEM", "ParticleSystem: failed to allocate the particle pool!");
+        _particlePool.reset();
+        _slots.reset();
+        return;
+    }
+    _capacity = capacity;
+    _live = _slots.get();
+    _drawOrder = _live + _capacity;
+    reset();
 }
 
-int ParticleSystem::findInactiveParticle() {
-    auto it = std::find_if(std::begin(_particlePool), std::end(_particlePool), [](const Particle& p) {
-        return !p.active;
-    });
+void ParticleSystem::reset() {
+    _liveCount = 0;
+    _groupCount = 0;
+    if (!_particlePool) return;
+    for (int i = 0; i < _capacity; ++i) {
+        _particlePool[i].nextFree = (i + 1 < _capacity) ? (uint16_t)(i + 1) : NO_SLOT;
+    }
+    _freeHead = 0;
+}
 
-    if (it != std::end(_particlePool)) {
-        return std::distance(std::begin(_particlePool), it);
+Particle* ParticleSystem::allocateParticle(float x, float y, float vx, float vy, unsigned long lifetimeMs, uint8_t drawColor) {
+    if (_freeHead == NO_SLOT) return nullptr;
+    if (_liveCount == 0) _groupCount = 0; // Start over with the fonts in use
+    const uint16_t slot = _freeHead;
+    Particle& p = _particlePool[slot];
+    _freeHead = p.nextFree;
+    _live[_liveCount++] = slot;
+
+    p.x = toFixed(x); p.y = toFixed(y); p.vx = toFixedPerMs(vx); p.vy = toFixedPerMs(vy);
+    p.spawnTime = millis(); p.lifetimeMs = lifetimeMs; p.drawColor = drawColor;
+    p.currentFrame = 0; p.lastFrameUpdateTime = 0;
+    return &p;
+}
+
+uint8_t ParticleSystem::fontGroupFor(const uint8_t* font) {
+    for (int i = 0; i < _groupCount; ++i) {
+        if (_groupFonts[i] == font) return (uint8_t)i;
     }
-    return -1;
+    if (_groupCount == MAX_FONT_GROUPS - 1) return MAX_FONT_GROUPS - 1;
+    _groupFonts[_groupCount] = font;
+    return (uint8_t)_groupCount++;
 }
 
-void ParticleSystem::reset() {
-    std::for_each(std::begin(_particlePool), std::end(_particlePool), [](Particle& p) {
-        p.active = false;
-    });
+void ParticleSystem::releaseAt(int position) {
+    const uint16_t slot = _live[position];
+    _particlePool[slot].nextFree = _freeHead;
+    _freeHead = slot;
+    _live[position] = _live[--_liveCount];
 }
 
 bool ParticleSystem::spawnParticle(float x, float y, float vx, float vy, unsigned long lifetimeMs,
                                    char character, const uint8_t* font, uint8_t drawColor) {
-    int index = findInactiveParticle(); if (index == -1) return false;
-    Particle& p = _particlePool[index]; p.active = true; p.x = x; p.y = y; p.vx = vx; p.vy = vy; p.spawnTime = millis(); p.lifetimeMs = lifetimeMs; p.visualType = ParticleVisualType::CHARACTER; p.character = character; p.font = font; p.drawColor = drawColor; p.assetData = nullptr; p.currentFrame = 0; p.lastFrameUpdateTime = 0;
+    Particle* p = allocateParticle(x, y, vx, vy, lifetimeMs, drawColor);
+    if (!p) return false;
+    p->visualType = ParticleVisualType::CHARACTER; p->character = character; p->font = font; p->assetData = nullptr;
+    p->fontGroup = fontGroupFor(font ? font : _defaultFont);
     return true;
 }
 
 bool ParticleSystem::spawnParticle(float x, float y, float vx, float vy, unsigned long lifetimeMs,
                                    const GraphicAssetData& asset, uint8_t drawColor) {
-    if (!asset.isValid()) return false; int index = findInactiveParticle(); if (index == -1) return false;
-    Particle& p = _particlePool[index]; p.active = true; p.x = x; p.y = y; p.vx = vx; p.vy = vy; p.spawnTime = millis(); p.lifetimeMs = lifetimeMs; p.drawColor = drawColor; p.assetData = &asset; p.character = ' '; p.font = nullptr;
-    if (asset.isSpritesheet()) { p.visualType = ParticleVisualType::ANIMATED_SPRITESHEET; p.currentFrame = 0; p.lastFrameUpdateTime = p.spawnTime; }
-    else { p.visualType = ParticleVisualType::STATIC_BITMAP; p.currentFrame = 0; p.lastFrameUpdateTime = 0; }
+    if (!asset.isValid()) return false;
+    Particle* p = allocateParticle(x, y, vx, vy, lifetimeMs, drawColor);
+    if (!p) return false;
+    p->assetData = &asset; p->character = ' '; p->font = nullptr; p->fontGroup = MAX_FONT_GROUPS - 1;
+    if (asset.isSpritesheet()) { p->visualType = ParticleVisualType::ANIMATED_SPRITESHEET; p->lastFrameUpdateTime = p->spawnTime; }
+    else { p->visualType = ParticleVisualType::STATIC_BITMAP; }
     return true;
 }
 
 // --- NEW: Absorb Effect Implementation ---
 void ParticleSystem::spawnAbsorbEffect(float targetX, float targetY, float sourceX, float sourceY, int count, int size) {
     int numParticles = count + size * 2; // Base count + bonus for size
-    float angleToTarget = atan2(targetY - sourceY, targetX - sourceX);
+    FixedTrig::Angle angleToTarget = FixedTrig::atan2(targetY - sourceY, targetX - sourceX);
 
     for (int i = 0; i < numParticles; ++i) {
         // Angle spread around the direction towards the target
-        float angle = angleToTarget + random(-45, 46) * PI / 180.0f;
+        FixedTrig::Angle angle = (FixedTrig::Angle)(angleToTarget + FixedTrig::fromDegrees((float)random(-45, 46)));
         float speed = 0.7f + (random(0, 51) / 100.0f); // Speed range
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed;
+        float vx = FixedTrig::cosF(angle) * speed;
+        float vy = FixedTrig::sinF(angle) * speed;
         unsigned long lifetime = 180 + random(0, 121); // Lifetime range
 
         // Use a tiny font for absorb effect particles
@@ -65,16 +116,19 @@ void ParticleSystem::spawnAbsorbEffect(float targetX, float targetY, float sourc
 
 
 void ParticleSystem::update(unsigned long currentTime, float deltaTime) {
-    std::for_each(std::begin(_particlePool), std::end(_particlePool), [&](Particle& p) {
-        if (!p.active) return;
-        
+    const int32_t step = (int32_t)std::min((float)MAX_STEP_MS, std::max(0.0f, deltaTime));
+    int position = 0;
+    while (position < _liveCount) {
+        Particle& p = _particlePool[_live[position]];
         if (currentTime - p.spawnTime >= p.lifetimeMs) {
-            p.active = false;
-            return;
+            // The last live particle moves into this position; visit it next.
+            releaseAt(position);
+            continue;
         }
+        ++position;
 
-        p.x += p.vx;
-        p.y += p.vy;
+        p.x += p.vx * step;
+        p.y += p.vy * step;
 
         if (p.visualType == ParticleVisualType::ANIMATED_SPRITESHEET && p.assetData && p.assetData->isSpritesheet()) {
             if (currentTime - p.lastFrameUpdateTime >= p.assetData->frameDurationMs) {
@@ -85,7 +139,7 @@ void ParticleSystem::update(unsigned long currentTime, float deltaTime) {
                 }
             }
         }
-    });
+    }
 }
 
 void ParticleSystem::draw() {
@@ -93,24 +147,39 @@ void ParticleSystem::draw() {
     if (!u8g2) return;
 
     uint8_t originalDrawColor = u8g2->getDrawColor();
-    const uint8_t* fontBeforeParticleDraw = _defaultFont; 
-
-    std::for_each(std::begin(_particlePool), std::end(_particlePool), [&](const Particle& p) {
-        if (!p.active) return;
 
-        int drawX = _renderer.getXOffset() + static_cast<int>(round(p.x));
-        int drawY = _renderer.getYOffset() + static_cast<int>(round(p.y));
-
-        u8g2->setDrawColor(p.drawColor);
+    // Counting sort of the live slots by font group, keeping their order
+    // within a group.
+    int groupStart[MAX_FONT_GROUPS + 1] = {0};
+    const Particle* pool = _particlePool.get();
+    for (int i = 0; i < _liveCount; ++i) ++groupStart[pool[_live[i]].fontGroup + 1];
+    for (int g = 1; g <= MAX_FONT_GROUPS; ++g) groupStart[g] += groupStart[g - 1];
+    for (int i = 0; i < _liveCount; ++i) _drawOrder[groupStart[pool[_live[i]].fontGroup]++] = _live[i];
+
+    const int xOffset = _renderer.getXOffset();
+    const int yOffset = _renderer.getYOffset();
+    const uint8_t* currentFont = nullptr;
+    int currentColor = -1;
+    bool bitmapModeSet = false;
+
+    for (int i = 0; i < _liveCount; ++i) {
+        const Particle& p = pool[_drawOrder[i]];
+        int drawX = xOffset + toPixel(p.x);
+        int drawY = yOffset + toPixel(p.y);
+
+        if (p.drawColor != currentColor) {
+            currentColor = p.drawColor;
+            u8g2->setDrawColor(p.drawColor);
+        }
 
         switch(p.visualType) {
             case ParticleVisualType::CHARACTER:
                 {
-                    const uint8_t* targetFont = (p.font != nullptr) ? p.font : _defaultFont;
-                    if (targetFont) {
+                    const uint8_t* targetFont = p.font ? p.font : _defaultFont; // Fallback to particle system's default
+                    if (!targetFont) break;
+                    if (targetFont != currentFont) {
+                        currentFont = targetFont;
                         u8g2->setFont(targetFont);
-                    } else {
-                        u8g2->setFont(_defaultFont); // Fallback to particle system's default
                     }
                     u8g2->drawGlyph(drawX, drawY, p.character);
                 }
@@ -118,7 +187,7 @@ void ParticleSystem::draw() {
 
             case ParticleVisualType::STATIC_BITMAP:
                 if (p.assetData && p.assetData->bitmap) {
-                    u8g2->setBitmapMode(0); 
+                    if (!bitmapModeSet) { u8g2->setBitmapMode(0); bitmapModeSet = true; }
                     u8g2->drawXBMP(drawX, drawY, p.assetData->width, p.assetData->height, p.assetData->bitmap);
                 }
                 break;
@@ -126,15 +195,15 @@ void ParticleSystem::draw() {
             case ParticleVisualType::ANIMATED_SPRITESHEET:
                 if (p.assetData && p.assetData->bitmap && p.currentFrame < p.assetData->frameCount) {
                     const uint8_t* framePtr = p.assetData->bitmap + (p.currentFrame * p.assetData->bytesPerFrame);
-                    u8g2->setBitmapMode(0); 
+                    if (!bitmapModeSet) { u8g2->setBitmapMode(0); bitmapModeSet = true; }
                     u8g2->drawXBMP(drawX, drawY, p.assetData->width, p.assetData->height, framePtr);
                 }
                 break;
         }
-    });
+    }
 
     if (_defaultFont) {
          u8g2->setFont(_defaultFont);
     }
     u8g2->setDrawColor(originalDrawColor);
-}
\ No newline at end of file
+}
@@ -2,65 +2,83 @@
 #ifndef PARTICLE_SYSTEM_H
 #define PARTICLE_SYSTEM_H
 
-#include <vector>
+#include <memory>
 #include <Arduino.h>
 #include "Renderer.h"          // Needs Renderer
 #include <U8g2lib.h>           // Needs U8g2
 #include "Helper/GraphicAssetTypes.h" // <<< MODIFIED: Include new path for GraphicAssetData
 
-// Maximum number of concurrent particles
-#define MAX_PARTICLES 50
-
 // Enum defining what the particle looks like
-enum class ParticleVisualType {
+enum class ParticleVisualType : uint8_t {
     CHARACTER,
     STATIC_BITMAP,
     ANIMATED_SPRITESHEET
 };
 
-// Represents a single particle
+// Represents a single particle. Position and velocity are fixed point
+// (ParticleSystem::FRACTION_BITS); velocity is per millisecond.
 struct Particle {
-    bool active = false;
-
     // Physics
-    float x = 0.0f;
-    float y = 0.0f;
-    float vx = 0.0f;
-    float vy = 0.0f;
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t vx = 0;
+    int32_t vy = 0;
 
     // Lifetime
     unsigned long spawnTime = 0;
     unsigned long lifetimeMs = 0;
 
-    // Visuals
-    ParticleVisualType visualType = ParticleVisualType::CHARACTER;
-    uint8_t drawColor = 1; // 1=Normal, 2=XOR
-
     // --- Visual Data Storage ---
     // Character specific
-    char character = ' ';
     const uint8_t* font = nullptr;
 
     // Bitmap/Spritesheet specific (Use pointer to shared data)
     const GraphicAssetData* assetData = nullptr;
 
     // Spritesheet state
-    int currentFrame = 0;
     unsigned long lastFrameUpdateTime = 0;
+    uint16_t currentFrame = 0;
     // --- End Visual Data ---
+
+    uint16_t nextFree = 0; // Next slot of the free list while unused
+    uint8_t fontGroup = 0; // Draw batch, see ParticleSystem::draw()
+
+    ParticleVisualType visualType = ParticleVisualType::CHARACTER;
+    uint8_t drawColor = 1; // 1=Normal, 2=XOR
+    char character = ' ';
 };
 
 
+// A fixed pool of particles. Unused slots are chained into a free list, so
+// spawning and expiring are O(1); the slots in use are also listed densely
+// (expired ones are swap-removed), so update() and draw() only visit live
+// particles. Motion is scaled by the update's deltaTime, so catch-up ticks
+// do not change how fast particles travel.
 class ParticleSystem {
 public:
+    static const int FRACTION_BITS = 16;
+    // Spawn velocities are in pixels per game tick of 1000 / TICKS_PER_SECOND ms.
+    static const int TICKS_PER_SECOND = 30;
+    // Longer steps (a stall, a scene resuming) are cut to this.
+    static const unsigned long MAX_STEP_MS = 250;
+    // Pool sizes: enough for an ambient effect, and for overlapping bursts
+    // (the absorb effect, the journey's sparkles).
+    static const int DEFAULT_CAPACITY = 50;
+    static const int BURST_CAPACITY = 384;
+
     // Constructor now takes the default font to restore to
-    ParticleSystem(Renderer& renderer, const uint8_t* defaultFont);
+    ParticleSystem(Renderer& renderer, const uint8_t* defaultFont, int capacity = DEFAULT_CAPACITY);
     ~ParticleSystem() = default;
 
+    // deltaTime: milliseconds since the previous update.
     void update(unsigned long currentTime, float deltaTime);
+    // Draws particles grouped by font, so each font is set once per frame.
     void draw();
     void reset();
 
+    int activeCount() const { return _liveCount; }
+    int capacity() const { return _capacity; }
+
     // --- Spawning Functions ---
     bool spawnParticle(float x, float y, float vx, float vy, unsigned long lifetimeMs,
                        char character, const uint8_t* font, uint8_t drawColor = 1);
@@ -74,11 +92,29 @@ public:
 
 
 private:
+    static const uint16_t NO_SLOT = 0xFFFF;
+    // Fonts get a draw group each; bitmaps, and fonts beyond these, share
+    // the last one.
+    static const int MAX_FONT_GROUPS = 8;
+
     Renderer& _renderer;
-    Particle _particlePool[MAX_PARTICLES];
+    std::unique_ptr<Particle[]> _particlePool;
+    // _live[0 .. _liveCount) are the slots in use, then room for draw()'s order.
+    std::unique_ptr<uint16_t[]> _slots;
+    uint16_t* _live = nullptr;
+    uint16_t* _drawOrder = nullptr;
+    int _liveCount = 0;
+    int _capacity = 0;
+    uint16_t _freeHead = NO_SLOT;
+    const uint8_t* _groupFonts[MAX_FONT_GROUPS];
+    int _groupCount = 0;
     const uint8_t* _defaultFont; // <-- Store the default font
 
-    int findInactiveParticle();
+    // A free slot taken out of the free list and made live, or nullptr.
+    Particle* allocateParticle(float x, float y, float vx, float vy, unsigned long lifetimeMs, uint8_t drawColor);
+    uint8_t fontGroupFor(const uint8_t* font);
+    // Returns the slot of _live[position] to the free list.
+    void releaseAt(int position);
 };
 
 #endif // PARTICLE_SYSTEM_H
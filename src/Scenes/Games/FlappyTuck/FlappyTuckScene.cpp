@@ -49,7 +49,7 @@ int FlappyTuckScene::getMaxPipeSpacing() {
 float FlappyTuckScene::getGravityForLevel() {
     float base = INITIAL_GRAVITY + (currentLevel / 9.0f) * 0.020f; 
     float range = 0.015f + (currentLevel / 5.0f) * 0.005f; 
-    float calculatedGravity = random(0, (int)(range * 1000)) / 1000.0f + base;
+    float calculatedGravity = _rng.range(0, (int)(range * 1000)) / 1000.0f + base;
     calculatedGravity = std::max(0.15f, std::min(0.30f, calculatedGravity)); 
     return calculatedGravity;
 }
@@ -59,7 +59,7 @@ void FlappyTuckScene::configurePipe(Pipe& pipe) {
     movingPipeChance = std::min(movingPipeChance, MOVING_PIPE_MAX_CHANCE_PERCENT);
     movingPipeChance = std::max(0, movingPipeChance); 
 
-    if (currentLevel >= LEVEL_START_MOVING_PIPES && random(100) < movingPipeChance) { 
+    if (currentLevel >= LEVEL_START_MOVING_PIPES && _rng.percent(movingPipeChance)) { 
         float verticalSpeed = MOVING_PIPE_BASE_SPEED + ((currentLevel - LEVEL_START_MOVING_PIPES) / MOVING_PIPE_SPEED_SCALAR_PER_LEVEL_DIVISOR) * MOVING_PIPE_SPEED_INCREMENT_AMOUNT;
         verticalSpeed = std::min(verticalSpeed, MOVING_PIPE_MAX_SPEED);                
         verticalSpeed = std::max(0.005f, verticalSpeed); 
@@ -74,13 +74,13 @@ void FlappyTuckScene::configurePipe(Pipe& pipe) {
         if (minY >= maxY) { minY = TOP_BOTTOM_PADDING + 3; maxY = SCREEN_HEIGHT - pipeGapCurrent - TOP_BOTTOM_PADDING - 4; }
         if (maxY <= minY) maxY = minY + 1; 
 
-        pipe.setMoving(true, verticalSpeed, minY, maxY);
+        pipe.setMoving(true, verticalSpeed, minY, maxY, _rng.coinFlip() ? 1 : -1);
     }
 
-    if (currentLevel >= LEVEL_START_GAP_CHANGING_PIPES && random(100) < 8 + currentLevel * 2.0f) { 
+    if (currentLevel >= LEVEL_START_GAP_CHANGING_PIPES && _rng.percent(8 + currentLevel * 2.0f)) { 
         float gapChangeSpeedAbs = 0.005f + (currentLevel / 28.0f) * 0.01f; 
         gapChangeSpeedAbs = std::min(gapChangeSpeedAbs, 0.03f); 
-        float gapChangeSpeed = (random(0,2) == 0 ? -1 : 1) * gapChangeSpeedAbs;
+        float gapChangeSpeed = (_rng.coinFlip() ? -1 : 1) * gapChangeSpeedAbs;
         
         int currentPipeGap = pipe.getGapHeight(); 
         int changeAmount = 2 + currentLevel / 4; 
@@ -89,14 +89,14 @@ void FlappyTuckScene::configurePipe(Pipe& pipe) {
         pipe.setGapChanging(true, gapChangeSpeed, targetGap);
     }
 
-    if (currentLevel >= LEVEL_START_FRAGILE_PIPES && random(100) < 6 + currentLevel * 1.2f) { 
+    if (currentLevel >= LEVEL_START_FRAGILE_PIPES && _rng.percent(6 + currentLevel * 1.2f)) { 
         pipe.setFragile(true);
     }
 
-    if (currentLevel >= LEVEL_START_PIPE_HAZARDS && random(100) < 8 + currentLevel * 1.5f) { 
-        bool topHazard = random(0,2) == 0;
-        bool bottomHazard = random(0,2) == 0;
-        if (!topHazard && !bottomHazard && random(0,3)==0) topHazard = true; 
+    if (currentLevel >= LEVEL_START_PIPE_HAZARDS && _rng.percent(8 + currentLevel * 1.5f)) { 
+        bool topHazard = _rng.coinFlip();
+        bool bottomHazard = _rng.coinFlip();
+        if (!topHazard && !bottomHazard && _rng.below(3) == 0) topHazard = true; 
         if (topHazard || bottomHazard) pipe.setHazards(topHazard, bottomHazard, 3);
     }
 }
@@ -104,7 +104,7 @@ void FlappyTuckScene::configurePipe(Pipe& pipe) {
 void FlappyTuckScene::addPipeObject(int xPos) {
     int pipeWidth = getPipeWidth();
     int pipeGap = getPipeGap();
-    int pipeGapY = random(TOP_BOTTOM_PADDING, SCREEN_HEIGHT - pipeGap - TOP_BOTTOM_PADDING);
+    int pipeGapY = _rng.range(TOP_BOTTOM_PADDING, SCREEN_HEIGHT - pipeGap - TOP_BOTTOM_PADDING);
     
     // Pipe constructor does not take Renderer, its draw method does.
     std::unique_ptr<Pipe> newPipe(new Pipe(xPos, SCREEN_HEIGHT, pipeGapY, pipeWidth, pipeGap));
@@ -130,8 +130,8 @@ void FlappyTuckScene::ensureObjectDensity() {
     if (maxSpacing <= minSpacing) maxSpacing = minSpacing + 5; 
 
     if (!anyPipes || rightmostX < SCREEN_WIDTH - minSpacing) {
-        int randomSpacing = random(minSpacing, maxSpacing + 1);
-        int nextPipeX = !anyPipes ? SCREEN_WIDTH + random(0,10) : rightmostX + randomSpacing; 
+        int randomSpacing = _rng.range(minSpacing, maxSpacing + 1);
+        int nextPipeX = !anyPipes ? SCREEN_WIDTH + _rng.range(0,10) : rightmostX + randomSpacing; 
         addPipeObject(nextPipeX);
     }
 }
@@ -165,16 +165,17 @@ void FlappyTuckScene::onEnter() {
     if (_gameContext && _gameContext->gameStats) { 
         _highScore = _gameContext->gameStats->FlappyTuckHighScore; 
     }
+    _rng.seedFrom(Rng::STREAM_FLAPPY_TUCK);
     resetGame(); 
     _wasPausedByFatigue = false;
 
     unsigned long currentTime = millis();
     _lastCoinSpawnTime = currentTime;
-    _nextCoinSpawnInterval = random(MIN_COIN_SPAWN_INTERVAL_MS, MAX_COIN_SPAWN_INTERVAL_MS + 1);
+    _nextCoinSpawnInterval = _rng.range(MIN_COIN_SPAWN_INTERVAL_MS, MAX_COIN_SPAWN_INTERVAL_MS + 1);
     _lastPowerUpSpawnTime = currentTime + 5000; 
-    _nextPowerUpSpawnInterval = random(MIN_POWERUP_SPAWN_INTERVAL_MS, MAX_POWERUP_SPAWN_INTERVAL_MS + 1);
+    _nextPowerUpSpawnInterval = _rng.range(MIN_POWERUP_SPAWN_INTERVAL_MS, MAX_POWERUP_SPAWN_INTERVAL_MS + 1);
     _lastEnemySpawnTime = currentTime + 2000; 
-    _nextEnemySpawnInterval = random(MIN_ENEMY_SPAWN_INTERVAL_MS, MAX_ENEMY_SPAWN_INTERVAL_MS + 1);
+    _nextEnemySpawnInterval = _rng.range(MIN_ENEMY_SPAWN_INTERVAL_MS, MAX_ENEMY_SPAWN_INTERVAL_MS + 1);
 }
 
 void FlappyTuckScene::flap() { if (!gameIsOver && !isGamePausedByFatigue() && !isFatigueDialogActive()) birdVelocity = JUMP_FORCE; } 
@@ -315,11 +316,11 @@ void FlappyTuckScene::resetGame() {
 
     unsigned long currentTime = millis();
     _lastCoinSpawnTime = currentTime;
-    _nextCoinSpawnInterval = random(MIN_COIN_SPAWN_INTERVAL_MS, MAX_COIN_SPAWN_INTERVAL_MS + 1);
+    _nextCoinSpawnInterval = _rng.range(MIN_COIN_SPAWN_INTERVAL_MS, MAX_COIN_SPAWN_INTERVAL_MS + 1);
     _lastPowerUpSpawnTime = currentTime + 5000; 
-    _nextPowerUpSpawnInterval = random(MIN_POWERUP_SPAWN_INTERVAL_MS, MAX_POWERUP_SPAWN_INTERVAL_MS + 1);
+    _nextPowerUpSpawnInterval = _rng.range(MIN_POWERUP_SPAWN_INTERVAL_MS, MAX_POWERUP_SPAWN_INTERVAL_MS + 1);
     _lastEnemySpawnTime = currentTime + 2000; 
-    _nextEnemySpawnInterval = random(MIN_ENEMY_SPAWN_INTERVAL_MS, MAX_ENEMY_SPAWN_INTERVAL_MS + 1);
+    _nextEnemySpawnInterval = _rng.range(MIN_ENEMY_SPAWN_INTERVAL_MS, MAX_ENEMY_SPAWN_INTERVAL_MS + 1);
 
     debugPrint("SCENES", "FlappyTuckScene: Game Reset Complete.");
 }
@@ -362,7 +363,7 @@ void FlappyTuckScene::onGameResumedFromFatiguePause() {
 void FlappyTuckScene::spawnCoin() {
     if (!_gameContext || !_gameContext->renderer) return;  
 
-    float coinX = _gameContext->renderer->getWidth() + random(2, 6); 
+    float coinX = _gameContext->renderer->getWidth() + _rng.range(2, 6); 
     float coinY; 
 
     int typicalGapHeight = getPipeGap(); 
@@ -370,7 +371,7 @@ void FlappyTuckScene::spawnCoin() {
     int maxCoinY = SCREEN_HEIGHT - TOP_BOTTOM_PADDING - COIN_SPRITE_HEIGHT - typicalGapHeight;
     if (maxCoinY <= minCoinY) maxCoinY = minCoinY + 5; 
 
-    coinY = random(minCoinY, maxCoinY + 1) + typicalGapHeight / 2.0f - COIN_SPRITE_HEIGHT / 2.0f;
+    coinY = _rng.range(minCoinY, maxCoinY + 1) + typicalGapHeight / 2.0f - COIN_SPRITE_HEIGHT / 2.0f;
     coinY = std::max((float)TOP_BOTTOM_PADDING, std::min((float)SCREEN_HEIGHT - TOP_BOTTOM_PADDING - COIN_SPRITE_HEIGHT, coinY));
     
     _collectibles.push_back(std::unique_ptr<CollectibleObject>(new Coin(coinX, coinY)));
@@ -380,10 +381,10 @@ void FlappyTuckScene::spawnCoin() {
 
 void FlappyTuckScene::spawnPowerUp() {
     if (!_gameContext || !_gameContext->renderer || currentLevel < LEVEL_START_POWERUPS) return; 
-    float x = _gameContext->renderer->getWidth() + random(10, 30); 
-    float y = random(TOP_BOTTOM_PADDING + POWERUP_SPRITE_HEIGHT, SCREEN_HEIGHT - TOP_BOTTOM_PADDING - POWERUP_SPRITE_HEIGHT * 2);
+    float x = _gameContext->renderer->getWidth() + _rng.range(10, 30); 
+    float y = _rng.range(TOP_BOTTOM_PADDING + POWERUP_SPRITE_HEIGHT, SCREEN_HEIGHT - TOP_BOTTOM_PADDING - POWERUP_SPRITE_HEIGHT * 2);
     
-    CollectibleType type = (random(0,2) == 0) ? CollectibleType::POWERUP_GHOST : CollectibleType::POWERUP_SLOWMO;
+    CollectibleType type = _rng.coinFlip() ? CollectibleType::POWERUP_GHOST : CollectibleType::POWERUP_SLOWMO;
     _collectibles.push_back(std::unique_ptr<CollectibleObject>(new PowerUpItem(x, y, type)));
     debugPrintf("SCENES", "Spawned PowerUp Type %d at X: %.1f, Y: %.1f", (int)type, x, y);
 }
@@ -433,9 +434,9 @@ void FlappyTuckScene::deactivatePowerUp() {
 
 void FlappyTuckScene::spawnFlyingEnemy() {
     if (!_gameContext || !_gameContext->renderer || currentLevel < LEVEL_START_FLYING_ENEMIES) return; 
-    float x = _gameContext->renderer->getWidth() + random(5, 15); 
-    float y = random(TOP_BOTTOM_PADDING + ENEMY_BIRD_SPRITE_HEIGHT, SCREEN_HEIGHT - TOP_BOTTOM_PADDING - ENEMY_BIRD_SPRITE_HEIGHT * 2);
-    float speedX = - ( (float)random(6,12) / 10.0f ) - (currentLevel / 10.0f * 0.2f); 
+    float x = _gameContext->renderer->getWidth() + _rng.range(5, 15); 
+    float y = _rng.range(TOP_BOTTOM_PADDING + ENEMY_BIRD_SPRITE_HEIGHT, SCREEN_HEIGHT - TOP_BOTTOM_PADDING - ENEMY_BIRD_SPRITE_HEIGHT * 2);
+    float speedX = - ( (float)_rng.range(6,12) / 10.0f ) - (currentLevel / 10.0f * 0.2f); 
     speedX = std::max(-1.8f, speedX); 
 
     _enemies.push_back(std::unique_ptr<EnemyObject>(new FlyingEnemy(x, y, speedX)));
@@ -475,23 +476,23 @@ void FlappyTuckScene::checkEnemyCollisions() {
 void FlappyTuckScene::manageObjectSpawning(unsigned long currentTime) {
     if (currentLevel >= LEVEL_START_COINS && currentTime >= _lastCoinSpawnTime + _nextCoinSpawnInterval) {
         int spawnChance = std::max(25, 75 - (currentLevel * 2)); // Increased base chance, minimum 25%
-        if (random(100) < spawnChance) { 
+        if (_rng.percent(spawnChance)) { 
             spawnCoin();
         }
         _lastCoinSpawnTime = currentTime;
-        _nextCoinSpawnInterval = random(MIN_COIN_SPAWN_INTERVAL_MS - (currentLevel*50), MAX_COIN_SPAWN_INTERVAL_MS - (currentLevel*100) + 1);
+        _nextCoinSpawnInterval = _rng.range(MIN_COIN_SPAWN_INTERVAL_MS - (currentLevel*50), MAX_COIN_SPAWN_INTERVAL_MS - (currentLevel*100) + 1);
         if (_nextCoinSpawnInterval < 500) _nextCoinSpawnInterval = 500;
     }
     if (currentLevel >= LEVEL_START_POWERUPS && currentTime >= _lastPowerUpSpawnTime + _nextPowerUpSpawnInterval) {
-        if (random(100) < 10 + currentLevel) { spawnPowerUp(); }
+        if (_rng.percent(10 + currentLevel)) { spawnPowerUp(); }
         _lastPowerUpSpawnTime = currentTime;
-        _nextPowerUpSpawnInterval = random(MIN_POWERUP_SPAWN_INTERVAL_MS - (currentLevel*200), MAX_POWERUP_SPAWN_INTERVAL_MS - (currentLevel*300) + 1);
+        _nextPowerUpSpawnInterval = _rng.range(MIN_POWERUP_SPAWN_INTERVAL_MS - (currentLevel*200), MAX_POWERUP_SPAWN_INTERVAL_MS - (currentLevel*300) + 1);
         if (_nextPowerUpSpawnInterval < 4000) _nextPowerUpSpawnInterval = 4000;
     }
     if (currentLevel >= LEVEL_START_FLYING_ENEMIES && currentTime >= _lastEnemySpawnTime + _nextEnemySpawnInterval) { 
-        if (random(100) < 15 + (currentLevel * 2.5f)) { spawnFlyingEnemy(); }
+        if (_rng.percent(15 + (currentLevel * 2.5f))) { spawnFlyingEnemy(); }
         _lastEnemySpawnTime = currentTime;
-        _nextEnemySpawnInterval = random(MIN_ENEMY_SPAWN_INTERVAL_MS - (currentLevel*150), MAX_ENEMY_SPAWN_INTERVAL_MS - (currentLevel*250) + 1);
+        _nextEnemySpawnInterval = _rng.range(MIN_ENEMY_SPAWN_INTERVAL_MS - (currentLevel*150), MAX_ENEMY_SPAWN_INTERVAL_MS - (currentLevel*250) + 1);
          if (_nextEnemySpawnInterval < 2000) _nextEnemySpawnInterval = 2000;
     }
 }
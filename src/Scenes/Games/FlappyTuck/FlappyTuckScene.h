@@ -8,6 +8,7 @@
 #include "CollectibleObject.h"  
 #include "EnemyObject.h"        
 #include "../../../System/GameContext.h" 
+#include "../../../Helper/Rng.h"
 
 // Constants (can remain here or be moved if shared)
 #define SCREEN_WIDTH 128 
@@ -41,6 +42,7 @@ private:
     int pipePassed, currentLevel, pipeSpeed;
     uint32_t _sessionCoins; 
     uint32_t _highScore;    
+    Rng _rng; // Level layout and spawns; reseeded on every entry
 
     std::vector<std::unique_ptr<GameObject>> gameObjects; 
     std::vector<std::unique_ptr<CollectibleObject>> _collectibles; 
@@ -190,12 +190,12 @@ bool Pipe::hasBeenScored() const {
 }
 
 // --- Public setters for new mechanics ---
-void Pipe::setMoving(bool moving, float speed, int minY, int maxY) {
+void Pipe::setMoving(bool moving, float speed, int minY, int maxY, int direction) {
     _isMovingVertically = moving;
     _verticalSpeed = speed; 
     _minY = minY;
     _maxY = maxY;
-    _verticalMoveDirection = (random(0,2) == 0) ? 1 : -1; 
+    _verticalMoveDirection = direction < 0 ? -1 : 1;
     _accumulatedVerticalMove = 0.0f;
 }
 
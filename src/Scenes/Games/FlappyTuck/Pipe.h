@@ -31,7 +31,7 @@ public:
     void reset(int startX, int screenHeight, int newGapY, int newWidth, int newGapHeight);
 
     // --- NEW: Public setters for new mechanics ---
-    void setMoving(bool moving, float speed, int minY, int maxY);
+    void setMoving(bool moving, float speed, int minY, int maxY, int direction); // direction: 1 down, -1 up
     void setGapChanging(bool changing, float speed, int targetGap);
     void setFragile(bool fragile);
     void setHazards(bool top, bool bottom, int hazardH = 3);
@@ -23,16 +23,18 @@ _1AwakeningSparkScene::_1AwakeningSparkScene() {
     _noise.SetFractalOctaves(2);
     _noise.SetFractalLacunarity(2.0f);
     _noise.SetFractalGain(0.5f);
-    _pulseNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _pulseNoise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _pulseNoise.SetFrequency(0.2f);
     _pulseNoise.SetSeed(random(0,10000));
-    _badQuantaWaveNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+    _badQuantaWaveNoise.SetNoiseType(FixedNoise::NoiseType_OpenSimplex2);
     _badQuantaWaveNoise.SetFrequency(0.3f);
     _badQuantaWaveNoise.SetSeed(random(0,5000));
     debugPrint("SCENES", "_1AwakeningSparkScene constructor");
 }
 
 _1AwakeningSparkScene::~_1AwakeningSparkScene() {
+    NoiseTileCache::getInstance()->removeLayer(_nebulaLayer);
+    TweenSystem::getInstance()->cancelOwnedBy(this);
     debugPrint("SCENES", "_1AwakeningSparkScene destroyed");
 }
 
@@ -46,7 +48,7 @@ void _1AwakeningSparkScene::init(GameContext& context) {
         return;
     }
     _dialogBox.reset(new DialogBox(*_gameContext->renderer));
-    _particleSystem.reset(new ParticleSystem(*_gameContext->renderer, _gameContext->defaultFont)); 
+    _particleSystem.reset(new ParticleSystem(*_gameContext->renderer, _gameContext->defaultFont, ParticleSystem::BURST_CAPACITY)); 
     _effectsManager.reset(new EffectsManager(*_gameContext->renderer)); 
 
     _gameContext->inputManager->registerButtonListener(EDGE_Button::LEFT, EDGE_Event::PRESS, this, [this](){ this->onButton1Press(); });
@@ -74,11 +76,14 @@ void _1AwakeningSparkScene::onEnter() {
         _sparkX = 128 / 2.0f; _sparkY = 64 / 2.0f;
         debugPrint("SCENES", "Warning: _1AwakeningSparkScene::onEnter - GameContext or Renderer is null.");
     }
-    _sparkEnergy = 0.0f; _isAttracting = false; _isPulsing = false;
+    _sparkEnergy = 0.0f; _isAttracting = false;
+    TweenSystem::getInstance()->cancelOwnedBy(this); _pulseTween = NO_TWEEN;
     _sparkCoreAnimCounter = 0; _anyQuantaUnderSpark = false;
     _noiseOffsetX = random(0, 1000) / 10.0f; _noiseOffsetY = random(0, 1000) / 10.0f;
+    NoiseTileCache::getInstance()->removeLayer(_nebulaLayer);
+    _nebulaLayer = NoiseTileCache::getInstance()->addLayer(&_1AwakeningSparkScene::sampleNebula, this);
 
-    for(int i=0; i < MAX_QUANTA; ++i) { _quantaPool[i].active = false; _quantaPool[i].clusterId = -1; _quantaPool[i].isClusterLead = false; }
+    for(int i=0; i < MAX_QUANTA; ++i) { _quantaPool[i].active = false; _quantaPool[i].pulse = NO_TWEEN; _quantaPool[i].clusterId = -1; _quantaPool[i].isClusterLead = false; }
     _potentialClusters.clear(); _nextClusterId = 0;
     _lastQuantaSpawnTime = millis(); for(int i=0; i<5; ++i) spawnQuanta();
     for(int i=0; i < MAX_BAD_QUANTA; ++i) { _badQuantaPool[i].active = false; }
@@ -100,6 +105,16 @@ void _1AwakeningSparkScene::onExit() {
     if (_gameContext && _gameContext->inputManager) {
         _gameContext->inputManager->unregisterAllListenersForScene(this);
     }
+    NoiseTileCache::getInstance()->removeLayer(_nebulaLayer);
+    _nebulaLayer = -1;
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    _pulseTween = NO_TWEEN;
+    for (int i = 0; i < MAX_QUANTA; ++i) _quantaPool[i].pulse = NO_TWEEN;
+}
+
+float _1AwakeningSparkScene::sampleNebula(void* owner, int cellX, int cellY) {
+    _1AwakeningSparkScene* scene = static_cast<_1AwakeningSparkScene*>(owner);
+    return scene->_noise.GetNoise((float)(cellX * NEBULA_CELL), (float)(cellY * NEBULA_CELL));
 }
 
 void _1AwakeningSparkScene::spawnQuanta() {
@@ -119,8 +134,12 @@ void _1AwakeningSparkScene::spawnQuanta() {
                 _quantaPool[i].active = false; continue;
             }
             _quantaPool[i].spawnTime = millis();
-            _quantaPool[i].lastPulseTime = millis() + random(0, (int)(QUANTA_PULSE_INTERVAL_MS / 2.0f));
-            _quantaPool[i].pulseIncreasing = true; _quantaPool[i].currentPulseSize = 0.0f;
+            // Grows and shrinks every QUANTA_PULSE_INTERVAL_MS, out of step with the others.
+            TweenSystem::Spec pulse = TweenSystem::value(0.0f, QUANTA_PULSE_MAX_ADDITIONAL_SIZE, QUANTA_PULSE_INTERVAL_MS / 2);
+            pulse.yoyo = true; pulse.cycles = 0;
+            pulse.delayMs = random(0, (int)(QUANTA_PULSE_INTERVAL_MS / 2.0f));
+            TweenSystem::getInstance()->cancel(_quantaPool[i].pulse);
+            _quantaPool[i].pulse = TweenSystem::getInstance()->start(pulse, this); _quantaPool[i].currentPulseSize = 0.0f;
             _quantaPool[i].isInvertedDraw = false; _quantaPool[i].clusterId = -1; _quantaPool[i].isClusterLead = false;
             _quantaPool[i].vx = 0; _quantaPool[i].vy = 0;
             _quantaPool[i].nextMoveTime = millis() + random(QUANTA_MIN_MOVE_INTERVAL_MS, QUANTA_MAX_MOVE_INTERVAL_MS + 1);
@@ -131,6 +150,12 @@ void _1AwakeningSparkScene::spawnQuanta() {
 
 void _1AwakeningSparkScene::updateQuanta(unsigned long currentTime) {
     _anyQuantaUnderSpark = false;
+    TweenSystem* tweens = TweenSystem::getInstance();
+    // Quanta go out in many places (lifetime, absorption, clusters); their
+    // pulses are stopped here, a frame later at most.
+    for (int i = 0; i < MAX_QUANTA; ++i) {
+        if (!_quantaPool[i].active && _quantaPool[i].pulse != NO_TWEEN) { tweens->cancel(_quantaPool[i].pulse); _quantaPool[i].pulse = NO_TWEEN; }
+    }
     for (int i = 0; i < MAX_QUANTA; ++i) {
         if (_quantaPool[i].active) {
             if (currentTime - _quantaPool[i].spawnTime > QUANTA_LIFETIME_MS) { _quantaPool[i].active = false; continue; }
@@ -148,13 +173,7 @@ void _1AwakeningSparkScene::updateQuanta(unsigned long currentTime) {
                 if(_quantaPool[i].y < 0) {_quantaPool[i].y = 0; _quantaPool[i].vy *= -0.5;}
                 if(_quantaPool[i].y >= r.getHeight()) {_quantaPool[i].y = r.getHeight()-1; _quantaPool[i].vy *= -0.5;}
             }
-            if (currentTime - _quantaPool[i].lastPulseTime > QUANTA_PULSE_INTERVAL_MS / 2) {
-                _quantaPool[i].lastPulseTime = currentTime; _quantaPool[i].pulseIncreasing = !_quantaPool[i].pulseIncreasing;
-            }
-            float pulseCycleProgress = (float)(currentTime - _quantaPool[i].lastPulseTime) / (QUANTA_PULSE_INTERVAL_MS/2.0f);
-            pulseCycleProgress = std::max(0.0f, std::min(1.0f, pulseCycleProgress));
-            if (_quantaPool[i].pulseIncreasing) { _quantaPool[i].currentPulseSize = QUANTA_PULSE_MAX_ADDITIONAL_SIZE * pulseCycleProgress; } 
-            else { _quantaPool[i].currentPulseSize = QUANTA_PULSE_MAX_ADDITIONAL_SIZE * (1.0f - pulseCycleProgress); }
+            _quantaPool[i].currentPulseSize = tweens->value(_quantaPool[i].pulse);
             float dx_to_spark = _sparkX - _quantaPool[i].x; float dy_to_spark = _sparkY - _quantaPool[i].y;
             float dist_to_spark_sq = dx_to_spark * dx_to_spark + dy_to_spark * dy_to_spark;
             float overlap_radius_sq = (_sparkSize + _quantaPool[i].actualRadius + 0.5f) * (_sparkSize + _quantaPool[i].actualRadius + 0.5f);
@@ -284,9 +303,8 @@ void _1AwakeningSparkScene::update(unsigned long deltaTime) {
         spawnBadQuanta(); _lastBadQuantaSpawnTime = currentTime;
     }
     if (_isAttracting && (currentTime - _attractStartTime > ATTRACT_MAX_DURATION_MS)) { _isAttracting = false; debugPrint("SCENES", "Attract timed out (max hold duration)."); }
-    if (_isPulsing && currentTime - _pulseAnimStartTime >= PULSE_ANIM_DURATION_MS) { _isPulsing = false; }
     if (_isAttracting || _anyQuantaUnderSpark) { _sparkCoreAnimCounter++; }
-    if (_particleSystem) { _particleSystem->update(currentTime, 33); }
+    if (_particleSystem) { _particleSystem->update(currentTime, deltaTime); }
 }
 
 void _1AwakeningSparkScene::draw(Renderer& renderer) {
@@ -294,10 +312,22 @@ void _1AwakeningSparkScene::draw(Renderer& renderer) {
     U8G2* u8g2 = _gameContext->display; // Use context
     int renderOffsetX = renderer.getXOffset(); int renderOffsetY = renderer.getYOffset();
     if (_effectsManager) { _effectsManager->applyEffectOffset(renderOffsetX, renderOffsetY); }
-    for (int y = 0; y < renderer.getHeight(); y += 2) {
-        for (int x = 0; x < renderer.getWidth(); x += 2) {
-            float noiseVal = _noise.GetNoise((float)x + _noiseOffsetX * 50, (float)y + _noiseOffsetY * 50);
-            if (noiseVal > 0.55f) { u8g2->drawPixel(renderOffsetX + x, renderOffsetY + y); }
+    // The nebula is fixed in the world and the view drifts over it, so only
+    // the tiles scrolling in are sampled.
+    NoiseTileCache* tiles = NoiseTileCache::getInstance();
+    tiles->beginFrame();
+    const int originX = (int)floorf(_noiseOffsetX * 50); const int originY = (int)floorf(_noiseOffsetY * 50);
+    int firstCellX, cellsX, firstCellY, cellsY;
+    NoiseTileCache::visibleCells(originX, renderer.getWidth(), NEBULA_CELL, firstCellX, cellsX);
+    NoiseTileCache::visibleCells(originY, renderer.getHeight(), NEBULA_CELL, firstCellY, cellsY);
+    const int8_t nebulaThreshold = NoiseTileCache::quantize(0.55f);
+    int8_t nebulaRow[128];
+    cellsX = std::min(cellsX, (int)sizeof(nebulaRow));
+    for (int cellY = firstCellY; cellY < firstCellY + cellsY; ++cellY) {
+        tiles->getRow(_nebulaLayer, firstCellX, cellY, cellsX, nebulaRow);
+        int y = cellY * NEBULA_CELL - originY;
+        for (int i = 0; i < cellsX; ++i) {
+            if (nebulaRow[i] > nebulaThreshold) { u8g2->drawPixel(renderOffsetX + (firstCellX + i) * NEBULA_CELL - originX, renderOffsetY + y); }
         }
     }
     for (int i = 0; i < MAX_QUANTA; ++i) {
@@ -341,15 +371,15 @@ void _1AwakeningSparkScene::draw(Renderer& renderer) {
             u8g2->drawCircle(renderOffsetX + (int)_sparkX, renderOffsetY + (int)_sparkY, finalSparkDrawRadius + pulseSize + 2);
         }
     }
-    if (_isPulsing) {
-        unsigned long pulseElapsedTime = millis() - _pulseAnimStartTime; float pulseProgress = (float)pulseElapsedTime / PULSE_ANIM_DURATION_MS;
+    if (TweenSystem::getInstance()->isActive(_pulseTween)) {
+        float pulseProgress = TweenSystem::getInstance()->value(_pulseTween); float pulseElapsedTime = pulseProgress * PULSE_ANIM_DURATION_MS;
         if (pulseProgress <= 1.0f) {
             int basePulseRadius = finalSparkDrawRadius + (int)(PULSE_MAX_RADIUS * pulseProgress); u8g2->setDrawColor(1);
             const int waveSegments = 16; float lastX = -999, lastY = -999;
             for (int k = 0; k <= waveSegments; ++k) {
                 float angle = (2.0f * PI / waveSegments) * k;
-                float noiseInputX = cos(angle) * 2.5f + (float)pulseElapsedTime * 0.025f;
-                float noiseInputY = sin(angle) * 2.5f + (float)pulseElapsedTime * 0.025f;
+                float noiseInputX = cos(angle) * 2.5f + pulseElapsedTime * 0.025f;
+                float noiseInputY = sin(angle) * 2.5f + pulseElapsedTime * 0.025f;
                 float waveOffset = _pulseNoise.GetNoise(noiseInputX, noiseInputY) * 3.0f * (1.0f - pulseProgress);
                 float currentPulseRadius = basePulseRadius + waveOffset;
                 currentPulseRadius = std::max((float)finalSparkDrawRadius + 1.0f, currentPulseRadius);
@@ -404,7 +434,7 @@ void _1AwakeningSparkScene::onButton3Click() {
     if (_sparkEnergy < PULSE_ENERGY_COST) { debugPrint("SCENES", "PrequelS1: Not enough energy to pulse!"); triggerScreenShake(); return; }
     _sparkEnergy -= PULSE_ENERGY_COST;
     debugPrintf("SCENES", "PrequelS1: Button 3 (Pulse) CLICKED. Energy: %.1f (-%.1f)", _sparkEnergy, PULSE_ENERGY_COST);
-    if (!_isPulsing) { _isPulsing = true; _pulseAnimStartTime = millis(); _pulseNoise.SetSeed(random(0,10000)); applyPulseToBackground(); }
+    if (!TweenSystem::getInstance()->isActive(_pulseTween)) { _pulseTween = TweenSystem::getInstance()->start(TweenSystem::value(0.0f, 1.0f, PULSE_ANIM_DURATION_MS), this); _pulseNoise.SetSeed(random(0,10000)); applyPulseToBackground(); }
     const float PULSE_PUSH_RADIUS = PULSE_MAX_RADIUS * 0.85f; const float PULSE_STRENGTH = 6.5f;
     float sparkNebulaVal = _noise.GetNoise(_sparkX + _noiseOffsetX * 50, _sparkY + _noiseOffsetY * 50);
     if (sparkNebulaVal > 0.55f && random(100) < 40) {
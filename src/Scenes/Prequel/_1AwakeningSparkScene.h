@@ -3,12 +3,15 @@
 
 #include "Scene.h"
 #include "FastNoiseLite.h" 
+#include "../../Helper/FixedNoise.h"
+#include "../../Helper/NoiseTileCache.h"
 #include "../../DialogBox/DialogBox.h" 
 #include <memory> 
 #include <vector> 
 #include "../../ParticleSystem.h" 
 #include "../../Helper/EffectsManager.h" 
 #include "../../System/GameContext.h" 
+#include "../../Helper/TweenSystem.h"
 
 // Forward Declarations
 class Renderer;
@@ -30,10 +33,14 @@ public:
 
 private:
     FastNoiseLite _noise;
-    FastNoiseLite _pulseNoise;
-    FastNoiseLite _badQuantaWaveNoise;
+    FixedNoise _pulseNoise;
+    FixedNoise _badQuantaWaveNoise;
     float _noiseOffsetX = 0.0f;
     float _noiseOffsetY = 0.0f;
+    // The nebula background, cached on a lattice of NEBULA_CELL pixels.
+    static const int NEBULA_CELL = 2;
+    int _nebulaLayer = -1;
+    static float sampleNebula(void* owner, int cellX, int cellY);
     float _baseBackgroundScrollSpeedX = 0.003f;
     float _baseBackgroundScrollSpeedY = 0.0015f;
     unsigned long _startTime = 0;
@@ -44,8 +51,7 @@ private:
     int _sparkSize = 2;
     float _sparkEnergy = 0.0f;
     static constexpr float ENERGY_TO_COLLECT = 400.0f; 
-    bool _isPulsing = false;
-    unsigned long _pulseAnimStartTime = 0;
+    TweenHandle _pulseTween = NO_TWEEN;     // Ring progress, 0..1
     static const unsigned long PULSE_ANIM_DURATION_MS = 250;
     static const int PULSE_MAX_RADIUS = 20;
     static constexpr float PULSE_ENERGY_COST = 5.0f;
@@ -55,8 +61,8 @@ private:
     struct Quanta {
         float x, y; float vx = 0.0f, vy = 0.0f; unsigned long nextMoveTime = 0;
         bool active = false; int size = 1; float actualRadius = 0.4f;
-        unsigned long spawnTime; unsigned long lastPulseTime = 0;
-        bool pulseIncreasing = true; float currentPulseSize = 0.0f;
+        unsigned long spawnTime;
+        TweenHandle pulse = NO_TWEEN; float currentPulseSize = 0.0f;
         bool isInvertedDraw = false; int clusterId = -1; bool isClusterLead = false;
         float targetClusterOffsetX = 0; float targetClusterOffsetY = 0;
     };
@@ -5,6 +5,7 @@
 #include "GameStats.h"
 #include "SerialForwarder.h"
 #include "Localization.h"
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <limits>
@@ -24,7 +25,7 @@ _2CellularConglomerationScene::_2CellularConglomerationScene()
     _noise.SetFrequency(0.05f);
     _noise.SetCellularReturnType(FastNoiseLite::CellularReturnType_Distance2Div);
     _noise.SetSeed(random(0, 10000));
-    _hazardNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _hazardNoise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _hazardNoise.SetFrequency(0.08f);
     _hazardNoise.SetSeed(random(10000, 20000));
     debugPrint("SCENES", "_2CellularConglomerationScene constructor");
@@ -33,6 +34,8 @@ _2CellularConglomerationScene::_2CellularConglomerationScene()
 _2CellularConglomerationScene::~_2CellularConglomerationScene()
 {
     debugPrint("SCENES", "_2CellularConglomerationScene destroyed");
+    NoiseTileCache::getInstance()->removeLayer(_backgroundLayer);
+    NoiseTileCache::getInstance()->removeLayer(_hazardLayer);
 }
 
 void _2CellularConglomerationScene::init(GameContext &context)
@@ -57,6 +60,11 @@ void _2CellularConglomerationScene::onEnter()
     _instructionsShown = false;
     _noiseOffsetX = random(0, 1000) / 10.0f;
     _noiseOffsetY = random(0, 1000) / 10.0f;
+    NoiseTileCache* tiles = NoiseTileCache::getInstance();
+    tiles->removeLayer(_backgroundLayer);
+    tiles->removeLayer(_hazardLayer);
+    _backgroundLayer = tiles->addLayer(&_2CellularConglomerationScene::sampleBackground, this);
+    _hazardLayer = tiles->addLayer(&_2CellularConglomerationScene::sampleHazard, this);
     setupBondingPhase();
     if (_dialogBox)
     {
@@ -81,6 +89,22 @@ void _2CellularConglomerationScene::onExit()
     {
         _gameContext->inputManager->unregisterAllListenersForScene(this);
     }
+    NoiseTileCache::getInstance()->removeLayer(_backgroundLayer);
+    NoiseTileCache::getInstance()->removeLayer(_hazardLayer);
+    _backgroundLayer = -1;
+    _hazardLayer = -1;
+}
+
+float _2CellularConglomerationScene::sampleBackground(void *owner, int cellX, int cellY)
+{
+    _2CellularConglomerationScene *scene = static_cast<_2CellularConglomerationScene *>(owner);
+    return scene->_noise.GetNoise((float)(cellX * BACKGROUND_CELL), (float)(cellY * BACKGROUND_CELL));
+}
+
+float _2CellularConglomerationScene::sampleHazard(void *owner, int cellX, int cellY)
+{
+    _2CellularConglomerationScene *scene = static_cast<_2CellularConglomerationScene *>(owner);
+    return scene->_hazardNoise.GetNoise((float)(cellX * HAZARD_CELL), (float)(cellY * HAZARD_CELL));
 }
 
 void _2CellularConglomerationScene::setupBondingPhase()
@@ -632,14 +656,29 @@ void _2CellularConglomerationScene::draw(Renderer &renderer)
     int rOffsetY = renderer.getYOffset();
     if (_effectsManager)
         _effectsManager->applyEffectOffset(rOffsetX, rOffsetY);
-    for (int y = 0; y < renderer.getHeight(); y += 4)
+    // The background is fixed in the world and drifts past; only the tiles
+    // scrolling in are sampled.
+    NoiseTileCache *tiles = NoiseTileCache::getInstance();
+    tiles->beginFrame();
+    const int originX = (int)floorf(_noiseOffsetX * 10);
+    const int originY = (int)floorf(_noiseOffsetY * 10);
+    int firstCellX, cellsX, firstCellY, cellsY;
+    NoiseTileCache::visibleCells(originX, renderer.getWidth(), BACKGROUND_CELL, firstCellX, cellsX);
+    NoiseTileCache::visibleCells(originY, renderer.getHeight(), BACKGROUND_CELL, firstCellY, cellsY);
+    const int8_t highThreshold = NoiseTileCache::quantize(0.5f);
+    const int8_t lowThreshold = NoiseTileCache::quantize(-0.5f);
+    int8_t backgroundRow[128];
+    cellsX = std::min(cellsX, (int)sizeof(backgroundRow));
+    for (int cellY = firstCellY; cellY < firstCellY + cellsY; ++cellY)
     {
-        for (int x = 0; x < renderer.getWidth(); x += 4)
+        tiles->getRow(_backgroundLayer, firstCellX, cellY, cellsX, backgroundRow);
+        int y = cellY * BACKGROUND_CELL - originY;
+        for (int i = 0; i < cellsX; ++i)
         {
-            float noiseVal = _noise.GetNoise((float)x + _noiseOffsetX * 10, (float)y + _noiseOffsetY * 10);
-            if (noiseVal > 0.5f)
+            int x = (firstCellX + i) * BACKGROUND_CELL - originX;
+            if (backgroundRow[i] > highThreshold)
                 u8g2->drawPixel(rOffsetX + x, rOffsetY + y);
-            else if (noiseVal < -0.5f)
+            else if (backgroundRow[i] < lowThreshold)
                 u8g2->drawPixel(rOffsetX + x + 1, rOffsetY + 1);
         }
     }
@@ -671,19 +710,27 @@ void _2CellularConglomerationScene::drawHazards(Renderer &renderer)
     if (_effectsManager)
         _effectsManager->applyEffectOffset(rOffsetX, rOffsetY);
     u8g2->setDrawColor(1);
-    for (int y = 0; y < renderer.getHeight(); y += 3)
+    // The hazard field does not move: once its tiles are in the cache only
+    // the threshold changes. Values above 1 (hazards off) stay above 127.
+    const int threshold = (int)lroundf(_currentHazardThreshold * 127.0f);
+    const int denseThreshold = (int)lroundf((_currentHazardThreshold + 0.1f) * 127.0f);
+    NoiseTileCache *tiles = NoiseTileCache::getInstance();
+    const int cellsX = std::min((renderer.getWidth() + HAZARD_CELL - 1) / HAZARD_CELL, 64);
+    int8_t hazardRow[64];
+    for (int cellY = 0; cellY * HAZARD_CELL < renderer.getHeight(); ++cellY)
     {
-        for (int x = 0; x < renderer.getWidth(); x += 3)
+        int y = cellY * HAZARD_CELL;
+        tiles->getRow(_hazardLayer, 0, cellY, cellsX, hazardRow);
+        for (int i = 0; i < cellsX; ++i)
         {
-            float hazardVal = _hazardNoise.GetNoise((float)x, (float)y);
-            if (hazardVal > _currentHazardThreshold)
+            if (hazardRow[i] <= threshold)
+                continue;
+            int x = i * HAZARD_CELL;
+            u8g2->drawBox(rOffsetX + x, rOffsetY + y, 2, 2);
+            if (hazardRow[i] > denseThreshold)
             {
-                u8g2->drawBox(rOffsetX + x, rOffsetY + y, 2, 2);
-                if (hazardVal > _currentHazardThreshold + 0.1f)
-                {
-                    u8g2->drawPixel(rOffsetX + x + 1, rOffsetY + y);
-                    u8g2->drawPixel(rOffsetX + x, rOffsetY + y + 1);
-                }
+                u8g2->drawPixel(rOffsetX + x + 1, rOffsetY + y);
+                u8g2->drawPixel(rOffsetX + x, rOffsetY + y + 1);
             }
         }
     }
@@ -3,6 +3,8 @@
 
 #include "Scene.h"
 #include "FastNoiseLite.h"       
+#include "../../Helper/FixedNoise.h"
+#include "../../Helper/NoiseTileCache.h"
 #include "../../DialogBox/DialogBox.h" 
 #include <memory> 
 #include <vector>
@@ -58,8 +60,14 @@ private:
     int _specGoalA = 2; int _specGoalB = 2; int _specGoalC = 1;
 
     Stage2Phase _currentPhase = Stage2Phase::BONDING_IDLE;
-    FastNoiseLite _noise; FastNoiseLite _hazardNoise;
+    FastNoiseLite _noise; FixedNoise _hazardNoise;
     float _noiseOffsetX = 0.0f; float _noiseOffsetY = 0.0f;
+    // Background cells and hazards, cached on lattices of these many pixels.
+    static const int BACKGROUND_CELL = 4;
+    static const int HAZARD_CELL = 3;
+    int _backgroundLayer = -1; int _hazardLayer = -1;
+    static float sampleBackground(void* owner, int cellX, int cellY);
+    static float sampleHazard(void* owner, int cellX, int cellY);
     static constexpr float HAZARD_BASE_THRESHOLD = 0.65f;
     float _currentHazardThreshold = 1.1f;
     static constexpr float HAZARD_REPEL_STRENGTH = 0.15f;
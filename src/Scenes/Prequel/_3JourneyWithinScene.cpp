@@ -35,7 +35,7 @@ _3JourneyWithinScene::_3JourneyWithinScene()
     _zoneNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2S);
     _zoneNoise.SetFrequency(0.025f);
     _zoneNoise.SetSeed(esp_random());
-    _currentNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _currentNoise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _currentNoise.SetFrequency(0.08f);
     _currentNoise.SetSeed(esp_random());
     _thicketElementNoise.SetNoiseType(FastNoiseLite::NoiseType_Cellular);
@@ -49,6 +49,8 @@ _3JourneyWithinScene::_3JourneyWithinScene()
 _3JourneyWithinScene::~_3JourneyWithinScene()
 {
     debugPrint("SCENES", "_3JourneyWithinScene destroyed");
+    removeNoiseLayers();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
 }
 
 void _3JourneyWithinScene::init(GameContext &context)
@@ -68,7 +70,7 @@ void _3JourneyWithinScene::init(GameContext &context)
     }
     _dialogBox.reset(new DialogBox(*_gameContext->renderer));
     _effectsManager.reset(new EffectsManager(*_gameContext->renderer));
-    _particleSystem.reset(new ParticleSystem(*_gameContext->renderer, _gameContext->defaultFont)); 
+    _particleSystem.reset(new ParticleSystem(*_gameContext->renderer, _gameContext->defaultFont, ParticleSystem::BURST_CAPACITY)); 
 
     _gameContext->inputManager->registerButtonListener(EDGE_Button::LEFT, EDGE_Event::PRESS, this, [this](){ 
         if (handleDialogKeyPress(GEM_KEY_UP)) { return; }
@@ -103,6 +105,8 @@ void _3JourneyWithinScene::onEnter()
     _currentNoise.SetSeed(esp_random());
     _thicketElementNoise.SetSeed(esp_random());
     debugPrint("SCENES", "  Noise re-seeded.");
+    removeNoiseLayers();
+    addNoiseLayers();
 
     if (_gameContext && _gameContext->renderer)
     { 
@@ -172,6 +176,56 @@ void _3JourneyWithinScene::onExit()
         _dialogBox->close();
     if (_gameContext && _gameContext->inputManager)
         _gameContext->inputManager->unregisterAllListenersForScene(this);
+    removeNoiseLayers();
+    TweenSystem::getInstance()->cancel(_gateTween);
+    _gateTween = NO_TWEEN;
+}
+
+void _3JourneyWithinScene::addNoiseLayers()
+{
+    NoiseTileCache *tiles = NoiseTileCache::getInstance();
+    _currentNoiseTime = millis();
+    _lastCurrentRefresh = _currentNoiseTime;
+    _zoneLayer = tiles->addLayer(&_3JourneyWithinScene::sampleZone, this);
+    _thicketLayer = tiles->addLayer(&_3JourneyWithinScene::sampleThicket, this);
+    _currentAngleLayer = tiles->addLayer(&_3JourneyWithinScene::sampleCurrentAngle, this, CURRENT_TILES_PER_FRAME);
+    _currentValueLayer = tiles->addLayer(&_3JourneyWithinScene::sampleCurrentValue, this, CURRENT_TILES_PER_FRAME);
+}
+
+void _3JourneyWithinScene::removeNoiseLayers()
+{
+    NoiseTileCache *tiles = NoiseTileCache::getInstance();
+    tiles->removeLayer(_zoneLayer);
+    tiles->removeLayer(_thicketLayer);
+    tiles->removeLayer(_currentAngleLayer);
+    tiles->removeLayer(_currentValueLayer);
+    _zoneLayer = _thicketLayer = _currentAngleLayer = _currentValueLayer = -1;
+}
+
+float _3JourneyWithinScene::sampleZone(void *owner, int cellX, int cellY)
+{
+    _3JourneyWithinScene *scene = static_cast<_3JourneyWithinScene *>(owner);
+    return scene->_zoneNoise.GetNoise(cellX * BACKGROUND_CELL * 0.015f, cellY * BACKGROUND_CELL * 0.015f);
+}
+
+float _3JourneyWithinScene::sampleThicket(void *owner, int cellX, int cellY)
+{
+    _3JourneyWithinScene *scene = static_cast<_3JourneyWithinScene *>(owner);
+    return scene->_thicketElementNoise.GetNoise(cellX * BACKGROUND_CELL * 0.3f, cellY * BACKGROUND_CELL * 0.3f);
+}
+
+float _3JourneyWithinScene::sampleCurrentAngle(void *owner, int cellX, int cellY)
+{
+    _3JourneyWithinScene *scene = static_cast<_3JourneyWithinScene *>(owner);
+    return scene->_currentNoise.GetNoise(cellX * BACKGROUND_CELL * 0.1f, cellY * BACKGROUND_CELL * 0.1f,
+                                         scene->_currentNoiseTime * 0.0005f);
+}
+
+float _3JourneyWithinScene::sampleCurrentValue(void *owner, int cellX, int cellY)
+{
+    _3JourneyWithinScene *scene = static_cast<_3JourneyWithinScene *>(owner);
+    return scene->_currentNoise.GetNoise(cellX * BACKGROUND_CELL * 0.05f, cellY * BACKGROUND_CELL * 0.05f,
+                                         scene->_currentNoiseTime * 0.0002f);
 }
 
 void _3JourneyWithinScene::update(unsigned long deltaTime)
@@ -206,7 +260,7 @@ void _3JourneyWithinScene::update(unsigned long deltaTime)
     }
     if (_currentPhase == JourneyPhase::GATE_OPENING)
     {
-        if (currentTime >= _gateAnimEndTime)
+        if (!TweenSystem::getInstance()->isActive(_gateTween))
         {
             _currentPhase = _phaseBeforeGate;
         }
@@ -222,7 +276,7 @@ void _3JourneyWithinScene::update(unsigned long deltaTime)
     }
     else if (_currentPhase == JourneyPhase::STAGE_COMPLETE_ANIM)
     {
-        if (currentTime >= _gateAnimEndTime)
+        if (!TweenSystem::getInstance()->isActive(_gateTween))
         {
             completeStage();
         }
@@ -270,7 +324,7 @@ void _3JourneyWithinScene::update(unsigned long deltaTime)
     if (_journeyProgress >= TARGET_PROGRESS && _currentPhase != JourneyPhase::STAGE_COMPLETE_ANIM)
     {
         _currentPhase = JourneyPhase::STAGE_COMPLETE_ANIM;
-        _gateAnimEndTime = currentTime + 1500;
+        _gateTween = TweenSystem::getInstance()->start(TweenSystem::value(0.0f, 1.0f, STAGE_COMPLETE_ANIM_DURATION_MS), this);
         debugPrint("SCENES", "Stage 3: Reached target progress, starting completion anim.");
     }
 }
@@ -548,7 +602,7 @@ void _3JourneyWithinScene::handleQTEInput(QTEButton pressedButton)
                 _gateActive[i] = false;
             }
             _currentPhase = JourneyPhase::GATE_OPENING;
-            _gateAnimEndTime = currentTime + GATE_OPEN_ANIM_DURATION_MS;
+            _gateTween = TweenSystem::getInstance()->start(TweenSystem::value(0.0f, 1.0f, GATE_OPEN_ANIM_DURATION_MS), this);
             if (_effectsManager)
                 _effectsManager->triggerScreenShake(1, GATE_OPEN_ANIM_DURATION_MS - 50);
             if (_particleSystem && _gameContext && _gameContext->renderer)
@@ -635,30 +689,54 @@ void _3JourneyWithinScene::drawBackgroundAndZones(Renderer &renderer, int rOffse
     float scrollFactor = 0.05f;
     uint8_t physicalWidth = u8g2->getDisplayWidth();
     uint8_t physicalHeight = u8g2->getDisplayHeight();
-    for (int y_base = 0; y_base < renderer.getHeight(); y_base += 3)
+
+    // The zones are fixed in the world and scroll past; the currents also
+    // drift with time, a few tiles at a time.
+    NoiseTileCache *tiles = NoiseTileCache::getInstance();
+    tiles->beginFrame();
+    _currentNoiseTime = millis();
+    if (_currentNoiseTime - _lastCurrentRefresh >= CURRENT_REFRESH_MS)
+    {
+        _lastCurrentRefresh = _currentNoiseTime;
+        tiles->invalidate(_currentAngleLayer);
+        tiles->invalidate(_currentValueLayer);
+    }
+    const int originX = (int)floorf(_noiseOffsetX - _backgroundScrollX * scrollFactor);
+    const int originY = (int)floorf(_noiseOffsetY - _backgroundScrollY * scrollFactor);
+    int firstCellX, cellsX, firstCellY, cellsY;
+    NoiseTileCache::visibleCells(originX, renderer.getWidth(), BACKGROUND_CELL, firstCellX, cellsX);
+    NoiseTileCache::visibleCells(originY, renderer.getHeight(), BACKGROUND_CELL, firstCellY, cellsY);
+    const int8_t thicketZone = NoiseTileCache::quantize(THICKET_NOISE_THRESHOLD);
+    const int8_t rapidZone = NoiseTileCache::quantize(RAPID_NOISE_THRESHOLD);
+    const int8_t thicketHigh = NoiseTileCache::quantize(0.65f);
+    const int8_t thicketLow = NoiseTileCache::quantize(-0.65f);
+    const int8_t currentHigh = NoiseTileCache::quantize(0.55f);
+    const int8_t currentLow = NoiseTileCache::quantize(-0.55f);
+
+    for (int cellY = firstCellY; cellY < firstCellY + cellsY; ++cellY)
     {
-        for (int x_base = 0; x_base < renderer.getWidth(); x_base += 3)
+        int finalDrawY = rOffsetY + cellY * BACKGROUND_CELL - originY;
+        if (finalDrawY + 2 < 0 || finalDrawY >= physicalHeight)
+            continue;
+        for (int cellX = firstCellX; cellX < firstCellX + cellsX; ++cellX)
         {
-            int finalDrawX = rOffsetX + x_base;
-            int finalDrawY = rOffsetY + y_base;
-            if (finalDrawX + 2 < 0 || finalDrawX >= physicalWidth || finalDrawY + 2 < 0 || finalDrawY >= physicalHeight)
+            int finalDrawX = rOffsetX + cellX * BACKGROUND_CELL - originX;
+            if (finalDrawX + 2 < 0 || finalDrawX >= physicalWidth)
             {
                 continue;
             }
-            float noiseX = (float)x_base + _noiseOffsetX - _backgroundScrollX * scrollFactor;
-            float noiseY = (float)y_base + _noiseOffsetY - _backgroundScrollY * scrollFactor;
-            float zoneVal = _zoneNoise.GetNoise(noiseX * 0.015f, noiseY * 0.015f);
-            if (zoneVal < THICKET_NOISE_THRESHOLD)
+            int8_t zoneVal = tiles->get(_zoneLayer, cellX, cellY);
+            if (zoneVal < thicketZone)
             {
-                float thicketVal = _thicketElementNoise.GetNoise(noiseX * 0.3f, noiseY * 0.3f);
-                if (thicketVal > 0.65f)
+                int8_t thicketVal = tiles->get(_thicketLayer, cellX, cellY);
+                if (thicketVal > thicketHigh)
                     u8g2->drawPixel(finalDrawX, finalDrawY);
-                else if (thicketVal < -0.65f)
+                else if (thicketVal < thicketLow)
                     u8g2->drawPixel(finalDrawX + 1, finalDrawY + 1);
             }
-            else if (zoneVal > RAPID_NOISE_THRESHOLD)
+            else if (zoneVal > rapidZone)
             {
-                float currentAngle = _currentNoise.GetNoise(noiseX * 0.1f, noiseY * 0.1f, millis() * 0.0005f) * PI;
+                float currentAngle = tiles->get(_currentAngleLayer, cellX, cellY) * (PI / 127.0f);
                 if (random(100) < 15)
                 {
                     int len = random(3, 7);
@@ -667,10 +745,10 @@ void _3JourneyWithinScene::drawBackgroundAndZones(Renderer &renderer, int rOffse
             }
             else
             {
-                float currentVal = _currentNoise.GetNoise(noiseX * 0.05f, noiseY * 0.05f, millis() * 0.0002f);
-                if (currentVal > 0.55f)
+                int8_t currentVal = tiles->get(_currentValueLayer, cellX, cellY);
+                if (currentVal > currentHigh)
                     u8g2->drawPixel(finalDrawX, finalDrawY);
-                else if (currentVal < -0.55f && random(100) < 5)
+                else if (currentVal < currentLow && random(100) < 5)
                     u8g2->drawPixel(finalDrawX, finalDrawY);
             }
         }
@@ -740,9 +818,7 @@ void _3JourneyWithinScene::drawGate(Renderer &renderer, int rOffsetX, int rOffse
     int drawGateX = rOffsetX + logicalGateX;
     if (_currentPhase == JourneyPhase::GATE_OPENING && _gateActive[gateIndex])
     {
-        unsigned long timeSinceOpenStart = millis() - (_gateAnimEndTime - GATE_OPEN_ANIM_DURATION_MS);
-        float openProgress = (float)timeSinceOpenStart / GATE_OPEN_ANIM_DURATION_MS;
-        openProgress = std::min(1.0f, openProgress);
+        float openProgress = TweenSystem::getInstance()->isActive(_gateTween) ? TweenSystem::getInstance()->value(_gateTween) : 1.0f;
         int openingGap = (int)(r_ref.getHeight() * openProgress * 1.2f);
         int halfGap = openingGap / 2;
         int gatePartHeight = r_ref.getHeight() / 2 - halfGap;
@@ -3,12 +3,15 @@
 
 #include "Scene.h"
 #include "FastNoiseLite.h"
+#include "../../Helper/FixedNoise.h"
+#include "../../Helper/NoiseTileCache.h"
 #include "../../DialogBox/DialogBox.h"
 #include "../../Helper/EffectsManager.h"
 #include "../../ParticleSystem.h"
 #include <memory>
 #include <vector>
 #include "../../System/GameContext.h"
+#include "../../Helper/TweenSystem.h"
 
 // Forward Declarations
 class Renderer;
@@ -70,6 +73,7 @@ private:
     static constexpr unsigned long QTE_STEP_TIME_LIMIT_MS = 2000;
     static constexpr float GATE_PROGRESS_PENALTY = 20.0f;
     static constexpr unsigned long GATE_OPEN_ANIM_DURATION_MS = 500;
+    static constexpr unsigned long STAGE_COMPLETE_ANIM_DURATION_MS = 1500;
     static constexpr unsigned long PHASE_TRANSITION_GRACE_MS = 750;
 
     // --- Zone Thresholds ---
@@ -78,10 +82,28 @@ private:
 
     // --- State Variables ---
     FastNoiseLite _zoneNoise;
-    FastNoiseLite _currentNoise;
+    FixedNoise _currentNoise;
     FastNoiseLite _thicketElementNoise;
     float _noiseOffsetX = 0.0f;
     float _noiseOffsetY = 0.0f;
+    // The background's noise layers, cached on a lattice of BACKGROUND_CELL
+    // pixels. The two current layers drift with time: they are invalidated
+    // every CURRENT_REFRESH_MS and resampled a few tiles per frame.
+    static const int BACKGROUND_CELL = 3;
+    static const unsigned long CURRENT_REFRESH_MS = 250;
+    static const int CURRENT_TILES_PER_FRAME = 4;
+    int _zoneLayer = -1;
+    int _thicketLayer = -1;
+    int _currentAngleLayer = -1;
+    int _currentValueLayer = -1;
+    unsigned long _currentNoiseTime = 0;     // millis() the current layers sample at
+    unsigned long _lastCurrentRefresh = 0;
+    static float sampleZone(void *owner, int cellX, int cellY);
+    static float sampleThicket(void *owner, int cellX, int cellY);
+    static float sampleCurrentAngle(void *owner, int cellX, int cellY);
+    static float sampleCurrentValue(void *owner, int cellX, int cellY);
+    void addNoiseLayers();
+    void removeNoiseLayers();
     float _backgroundScrollX = 0.0f;
     float _backgroundScrollY = 0.0f;
 
@@ -106,7 +128,7 @@ private:
     QTEButton _qteSequence[QTE_SEQUENCE_LENGTH];
     int _qteCurrentStep = 0;
     unsigned long _qteStepStartTime = 0;
-    unsigned long _gateAnimEndTime = 0;
+    TweenHandle _gateTween = NO_TWEEN; // Gate opening or stage completion, 0..1
 
     std::unique_ptr<DialogBox> _dialogBox;
     std::unique_ptr<EffectsManager> _effectsManager;
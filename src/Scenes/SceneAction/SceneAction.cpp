@@ -9,7 +9,7 @@
 #include "Localization.h"
 #include <algorithm>
 #include <cstring>
-#include "Animator.h"
+#include "../../Helper/ScaledBlitter.h"
 #include "../../DialogBox/DialogBox.h"
 #include "../../DebugUtils.h"
 #include "GEM_u8g2.h"
@@ -20,7 +20,7 @@ SceneAction::SceneAction() : _currentContext(ActionMenuContext::MAIN),
                              _selectedCol(0),
                              _selectedRow(0),
                              _hoveredItemNameKey(StringKey::ACTION_CLEANING),
-                             _clickAnimation(nullptr),
+                             _clickAnimation(NO_TWEEN),
                              _pendingAction(GridAction::NONE),
                              _animatingIconIndex(-1)
 {
@@ -71,7 +71,8 @@ void SceneAction::onEnter()
     _selectedCol = 0;
     _selectedRow = 0;
     updateHoveredItemName();
-    _clickAnimation.reset();
+    TweenSystem::getInstance()->cancel(_clickAnimation);
+    _clickAnimation = NO_TWEEN;
     _pendingAction = GridAction::NONE;
     _animatingIconIndex = -1;
     if (_dialogBox)
@@ -82,7 +83,8 @@ void SceneAction::onExit()
 {
     debugPrint("SCENES", "SceneAction::onExit");
     _currentContext = ActionMenuContext::MAIN;
-    _clickAnimation.reset();
+    TweenSystem::getInstance()->cancel(_clickAnimation);
+    _clickAnimation = NO_TWEEN;
     _pendingAction = GridAction::NONE;
     _animatingIconIndex = -1;
     if (_dialogBox)
@@ -101,15 +103,14 @@ void SceneAction::update(unsigned long deltaTime)
         _dialogBox->update(currentTime);
     }
 
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
     {
-        bool stillAnimating = _clickAnimation->update();
-        if (!stillAnimating)
+        if (!TweenSystem::getInstance()->isActive(_clickAnimation))
         {
             debugPrintf("SCENES", "Click animation finished for action %d", (int)_pendingAction);
             GridAction completedAction = _pendingAction;
             _pendingAction = GridAction::NONE;
-            _clickAnimation.reset();
+            _clickAnimation = NO_TWEEN;
             _animatingIconIndex = -1;
 
             if (completedAction == GridAction::GOTO_CLEANING_MENU)
@@ -149,9 +150,9 @@ void SceneAction::update(unsigned long deltaTime)
 void SceneAction::draw(Renderer &renderer)
 { 
     drawGrid(renderer);
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
     {
-        _clickAnimation->draw();
+        drawClickAnimation(renderer);
     }
     else
     {
@@ -206,7 +207,7 @@ void SceneAction::setupGridForContext(ActionMenuContext context)
 
 void SceneAction::onNavLeft()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     if (_dialogBox && _dialogBox->isActive())
         return;
@@ -225,7 +226,7 @@ void SceneAction::onNavLeft()
 
 void SceneAction::onNavRight()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     if (_dialogBox && _dialogBox->isActive())
         return;
@@ -244,7 +245,7 @@ void SceneAction::onNavRight()
 
 void SceneAction::onNavUp()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     if (_dialogBox && _dialogBox->isActive())
         return;
@@ -258,7 +259,7 @@ void SceneAction::onNavUp()
 
 void SceneAction::onNavDown()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     if (_dialogBox && _dialogBox->isActive())
         return;
@@ -272,7 +273,7 @@ void SceneAction::onNavDown()
 
 void SceneAction::onSelect()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     if (_dialogBox && _dialogBox->isActive())
         return;
@@ -286,20 +287,23 @@ void SceneAction::onSelect()
     debugPrintf("SCENES", "Action Selected: Row=%d, Col=%d -> Action=%d", _selectedRow, _selectedCol, (int)selectedItem.action);
     _pendingAction = selectedItem.action;
     _animatingIconIndex = selectedIndex;
-    int iconX = _selectedCol * GRID_ICON_WIDTH;
-    int iconY = _selectedRow * GRID_ICON_HEIGHT;
     const unsigned long ANIM_DURATION_MS = 80;
     const float START_SCALE = 1.0f;
     const float END_SCALE = 1.2f;
 
     if (_gameContext && _gameContext->renderer)
+    {
+        TweenSystem::Spec click = TweenSystem::value(START_SCALE, END_SCALE, ANIM_DURATION_MS);
+        click.yoyo = true;
+        _clickAnimation = TweenSystem::getInstance()->start(click, this);
+    }
+    if (_clickAnimation != NO_TWEEN)
     { 
-        _clickAnimation.reset(new Animator(*_gameContext->renderer, selectedItem.bitmap, GRID_ICON_WIDTH, GRID_ICON_HEIGHT, iconX, iconY, START_SCALE, END_SCALE, ANIM_DURATION_MS, 1, true, 0));
         debugPrintf("SCENES", "Starting SCALE click animation for action %d at index %d", (int)_pendingAction, _animatingIconIndex);
     }
     else
     {
-        debugPrint("SCENES", "Error: GameContext or Renderer null, cannot create click animation. Performing action directly.");
+        debugPrint("SCENES", "Error: cannot create click animation. Performing action directly.");
         if (_pendingAction == GridAction::GOTO_CLEANING_MENU)
         {
             _currentContext = ActionMenuContext::CLEANING;
@@ -335,7 +339,7 @@ void SceneAction::onSelect()
 
 void SceneAction::onLongPressExit()
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
     {
         debugPrint("SCENES", "SceneAction: Long press ignored during click animation.");
         return;
@@ -701,7 +705,7 @@ void SceneAction::drawGrid(Renderer &renderer)
         for (int c = 0; c < GRID_COLS; ++c)
         {
             int index = r * GRID_COLS + c;
-            if (_clickAnimation && index == _animatingIconIndex)
+            if (_clickAnimation != NO_TWEEN && index == _animatingIconIndex)
             {
                 continue;
             }
@@ -719,9 +723,29 @@ void SceneAction::drawGrid(Renderer &renderer)
         }
     }
 }
+void SceneAction::drawClickAnimation(Renderer &renderer)
+{
+    U8G2 *u8g2 = renderer.getU8G2();
+    float scale = TweenSystem::getInstance()->value(_clickAnimation);
+    if (!u8g2 || _animatingIconIndex < 0 || _animatingIconIndex >= GRID_TOTAL_ICONS || scale <= 0)
+        return;
+    const unsigned char *bitmap = _gridItems[_animatingIconIndex].bitmap;
+    if (bitmap == nullptr)
+        return;
+
+    int scaledW = static_cast<int>(round(GRID_ICON_WIDTH * scale));
+    int scaledH = static_cast<int>(round(GRID_ICON_HEIGHT * scale));
+    int centerX = (_animatingIconIndex % GRID_COLS) * GRID_ICON_WIDTH + GRID_ICON_WIDTH / 2;
+    int centerY = (_animatingIconIndex / GRID_COLS) * GRID_ICON_HEIGHT + GRID_ICON_HEIGHT / 2;
+    int drawX = renderer.getXOffset() + centerX - scaledW / 2;
+    int drawY = renderer.getYOffset() + centerY - scaledH / 2;
+    ScaledBlitter::draw(u8g2, drawX, drawY, bitmap, GRID_ICON_WIDTH, GRID_ICON_HEIGHT, scale,
+                        renderer.getXOffset(), renderer.getYOffset(),
+                        renderer.getXOffset() + renderer.getWidth(), renderer.getYOffset() + renderer.getHeight());
+}
 void SceneAction::drawSelector(Renderer &renderer)
 {
-    if (_clickAnimation)
+    if (_clickAnimation != NO_TWEEN)
         return;
     int selectorX = _selectedCol * GRID_ICON_WIDTH;
     int selectorY = _selectedRow * GRID_ICON_HEIGHT;
@@ -9,10 +9,10 @@
 #include "Localization.h" 
 #include "../../DialogBox/DialogBox.h" 
 #include "../../System/GameContext.h" 
+#include "../../Helper/TweenSystem.h"
 
 // Forward declarations
 class Renderer;
-class Animator;
 
 enum class ActionMenuContext {
     MAIN,
@@ -84,7 +84,7 @@ private:
     int _selectedRow = 0;
     StringKey _hoveredItemNameKey = StringKey::ACTION_TITLE; 
 
-    std::unique_ptr<Animator> _clickAnimation; 
+    TweenHandle _clickAnimation;               // Icon scale; NO_TWEEN once handled
     GridAction _pendingAction;                 
     int _animatingIconIndex;                   
 
@@ -96,7 +96,8 @@ private:
     void setupGridForContext(ActionMenuContext context); 
     void performGridAction(GridAction action);           
     void updateHoveredItemName();                        
-    StringKey getActionNameKey(GridAction action);       
+    StringKey getActionNameKey(GridAction action);
+    void drawClickAnimation(Renderer &renderer);       
 
     void doCleaningDouche();
     bool doCleaningToilet(); 
@@ -6,6 +6,7 @@
 #include "GameStats.h" 
 #include "Localization.h" 
 #include "../../Helper/EffectsManager.h" 
+#include "../../Helper/Rng.h"
 #include "../../DebugUtils.h"
 #include "../../System/GameContext.h" 
 #include "SceneManager.h" 
@@ -76,7 +77,8 @@ void BootScene::init(GameContext& context) {
     memset(pawPositions, 0, sizeof(pawPositions));
 
     randomSeed(esp_random());
-    debugPrint("SCENES", "BootScene: Random seed set using esp_random().");
+    Rng::seedStreams(esp_random());
+    debugPrint("SCENES", "BootScene: Random seeds set using esp_random().");
 }
 
 void BootScene::onEnter() {
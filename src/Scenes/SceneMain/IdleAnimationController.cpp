@@ -1,8 +1,9 @@
 #include "IdleAnimationController.h"
 #include <Arduino.h> // For millis(), random()
-#include <cmath>     // For PI, cos, sin etc. if needed directly (Animator uses it)
-IdleAnimationController::IdleAnimationController(Renderer &renderer, CharacterManager *charMgr, PathGenerator *pathGen)
-    : _renderer(renderer), _characterManager(charMgr), _pathGenerator(pathGen),
+#include <cmath>
+#include "../../Helper/RotationSpriteCache.h"
+IdleAnimationController::IdleAnimationController(Renderer &renderer, CharacterManager *charMgr, PathWorker *pathWorker)
+    : _renderer(renderer), _characterManager(charMgr), _pathWorker(pathWorker),
       _snoozeState(SnoozeStateInternal::NONE), _snoozeFrameEndTime(0),
       _snoozeBitmap1(nullptr), _snoozeBitmap2(nullptr),
       _activeAnimType(CurrentIdleAnimType::NONE)
@@ -11,11 +12,16 @@ IdleAnimationController::IdleAnimationController(Renderer &renderer, CharacterMa
 }
 IdleAnimationController::~IdleAnimationController()
 {
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    if (_pathWorker)
+        _pathWorker->cancel(_nextPath);
     debugPrint("SCENES", "IdleAnimationController destroyed.");
 }
 void IdleAnimationController::reset()
 {
-    _currentAnimator.reset();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    _tween = NO_TWEEN;
+    _frameTween = NO_TWEEN;
     _snoozeState = SnoozeStateInternal::NONE;
     _snoozeBitmap1 = nullptr;
     _snoozeBitmap2 = nullptr;
@@ -24,7 +30,8 @@ void IdleAnimationController::reset()
 }
 bool IdleAnimationController::isAnimating() const
 {
-    return (_currentAnimator && _currentAnimator->isFinished() == false) || _snoozeState != SnoozeStateInternal::NONE;
+    // Until update() sees the tween complete.
+    return _activeAnimType == CurrentIdleAnimType::LEAN || _activeAnimType == CurrentIdleAnimType::PATH || _snoozeState != SnoozeStateInternal::NONE;
 }
 void IdleAnimationController::startRandomIdleAnimation(unsigned long currentTime, int targetX, int targetY)
 {
@@ -138,26 +145,24 @@ bool IdleAnimationController::triggerLeanAnimation(unsigned long currentTime, in
         return false;
     }
     debugPrintf("SCENES", "IdleAnimCtrl: Starting LEAN animation (Offset: %d, Angle: %.1f)", leanOffsetX, leanAngle);
-    _currentAnimator.reset(new Animator(_renderer, asset.bitmap, asset.width, asset.height,
-                                        targetX, targetY, targetX + leanOffsetX, targetY, LEAN_DURATION_MS,
-                                        0.0f, leanAngle, PIVOT_CENTER, static_cast<float>(asset.height),
-                                        true, LEAN_REVERSE_DELAY_MS));
+    TweenSystem::Spec lean = TweenSystem::move(targetX, targetY, targetX + leanOffsetX, targetY, LEAN_DURATION_MS);
+    lean.from[2] = 0.0f;
+    lean.to[2] = leanAngle;
+    lean.channels = 3;
+    lean.yoyo = true;
+    lean.holdMs = LEAN_REVERSE_DELAY_MS;
+    _tween = TweenSystem::getInstance()->start(lean, this);
+    if (_tween == NO_TWEEN)
+        return false;
+    _sprite = asset;
+    _pivotX = asset.width / 2.0f;
+    _pivotY = static_cast<float>(asset.height);
     _activeAnimType = CurrentIdleAnimType::LEAN;
     return true;
 }
-bool IdleAnimationController::triggerPathAnimation(unsigned long currentTime)
+PathGenConfig IdleAnimationController::flyingPathConfig()
 {
-    if (isAnimating())
-        return false;
-    if (!_characterManager || !_pathGenerator)
-    {
-        debugPrint("SCENES", "IdleAnimCtrl Error: CharacterManager or PathGenerator is null (Path).");
-        return false;
-    }
-
-    std::vector<PathPoint> generatedPath;
-    unsigned long estimatedDuration;
-    PathGenConfig config; // Use default config or customize if needed
+    PathGenConfig config;
     config.minPoints = 3;
     config.maxPoints = 5;
     config.minStepDistance = 10;
@@ -165,13 +170,32 @@ bool IdleAnimationController::triggerPathAnimation(unsigned long currentTime)
     config.baseDurationMs = 3000;
     config.minDurationMs = 2000;
     config.maxDurationMs = 5000;
+    return config;
+}
+void IdleAnimationController::preparePath()
+{
+    if (_pathWorker && _nextPath == PathWorker::NO_TICKET)
+        _nextPath = _pathWorker->request(_renderer.getWidth(), _renderer.getHeight(), flyingPathConfig());
+}
+bool IdleAnimationController::triggerPathAnimation(unsigned long currentTime)
+{
+    if (isAnimating())
+        return false;
+    if (!_characterManager || !_pathWorker)
+    {
+        debugPrint("SCENES", "IdleAnimCtrl Error: CharacterManager or PathWorker is null (Path).");
+        return false;
+    }
 
-    if (!_pathGenerator->generateFlyingPath(generatedPath, estimatedDuration, _renderer.getWidth(), _renderer.getHeight(), config))
+    // Normally requested when this animation was scheduled, long done by now.
+    preparePath();
+    unsigned long estimatedDuration = 0;
+    if (!_pathWorker->take(_nextPath, _pathPoints, estimatedDuration))
     {
-        debugPrint("SCENES", "IdleAnimCtrl: Failed to generate a valid dynamic path.");
+        debugPrint("SCENES", _nextPath != PathWorker::NO_TICKET ? "IdleAnimCtrl: Dynamic path not ready yet." : "IdleAnimCtrl: Failed to generate a valid dynamic path.");
         return false;
     }
-    debugPrintf("SCENES", "IdleAnimCtrl: Triggering dynamic PATH animation (%d points, est duration %lu ms).", generatedPath.size(), estimatedDuration);
+    debugPrintf("SCENES", "IdleAnimCtrl: Triggering dynamic PATH animation (%d points, est duration %lu ms).", _pathPoints.size(), estimatedDuration);
 
     int spriteChoice = random(0, 3);
     GraphicAssetData spriteAsset;
@@ -201,24 +225,28 @@ bool IdleAnimationController::triggerPathAnimation(unsigned long currentTime)
         debugPrint("SCENES", "IdleAnimCtrl Error: Failed to get valid sprite asset data for path.");
         return false;
     }
-    _currentAnimator.reset(new Animator(_renderer, spriteAsset.bitmap, spriteAsset.width, spriteAsset.height,
-                                        spriteAsset.frameCount, spriteAsset.bytesPerFrame, spriteAsset.frameDurationMs,
-                                        estimatedDuration, true, 1));
-    _currentAnimator->setGeneratedPath(generatedPath);
+    TweenSystem* tweens = TweenSystem::getInstance();
+    _tween = tweens->startPath(_pathPoints, true, estimatedDuration, 1, this);
+    if (_tween == NO_TWEEN)
+        return false;
+    _frameTween = tweens->start(TweenSystem::frames(spriteAsset.frameCount, spriteAsset.frameDurationMs, 0), this);
+    _sprite = spriteAsset;
     _activeAnimType = CurrentIdleAnimType::PATH;
     return true;
 }
 bool IdleAnimationController::update(unsigned long currentTime)
 {
-    if (_currentAnimator)
+    if (_activeAnimType == CurrentIdleAnimType::LEAN || _activeAnimType == CurrentIdleAnimType::PATH)
     {
-        if (!_currentAnimator->update())
-        { // Animator finished
-            _currentAnimator.reset();
+        if (!TweenSystem::getInstance()->isActive(_tween))
+        {
+            TweenSystem::getInstance()->cancel(_frameTween);
+            _tween = NO_TWEEN;
+            _frameTween = NO_TWEEN;
             _activeAnimType = CurrentIdleAnimType::NONE;
             return false; // Animation done
         }
-        return true; // Animator still running
+        return true; // Tween still running
     }
     else if (_snoozeState != SnoozeStateInternal::NONE)
     {
@@ -245,9 +273,29 @@ bool IdleAnimationController::update(unsigned long currentTime)
 }
 void IdleAnimationController::draw()
 {
-    if (_currentAnimator)
+    TweenSystem* tweens = TweenSystem::getInstance();
+    float x, y;
+    if (_activeAnimType == CurrentIdleAnimType::LEAN && tweens->position(_tween, x, y))
+    {
+        U8G2 *u8g2 = _renderer.getU8G2();
+        RotationSpriteCache::Sprite sprite;
+        if (!u8g2 || !RotationSpriteCache::getInstance()->get(_sprite.bitmap, _sprite.width, _sprite.height, _pivotX, _pivotY,
+                                                              tweens->value(_tween, 2), sprite))
+            return;
+        int drawX = _renderer.getXOffset() + static_cast<int>(round(x)) + sprite.offsetX;
+        int drawY = _renderer.getYOffset() + static_cast<int>(round(y)) + sprite.offsetY;
+        // Transparent: the rotated sprite's bounding box must not erase what
+        // is behind it.
+        u8g2->setBitmapMode(1);
+        u8g2->drawXBM(drawX, drawY, sprite.width, sprite.height, sprite.bits);
+        u8g2->setBitmapMode(0);
+    }
+    else if (_activeAnimType == CurrentIdleAnimType::PATH && tweens->position(_tween, x, y))
     {
-        _currentAnimator->draw();
+        U8G2 *u8g2 = _renderer.getU8G2();
+        if (u8g2)
+            u8g2->drawXBMP(_renderer.getXOffset() + static_cast<int>(round(x)), _renderer.getYOffset() + static_cast<int>(round(y)),
+                           _sprite.width, _sprite.height, _sprite.bitmap + tweens->frame(_frameTween) * _sprite.bytesPerFrame);
     }
     else if (_snoozeState != SnoozeStateInternal::NONE)
     {
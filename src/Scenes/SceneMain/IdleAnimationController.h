@@ -1,9 +1,9 @@
 #ifndef IDLE_ANIMATION_CONTROLLER_H
 #define IDLE_ANIMATION_CONTROLLER_H
 #include <memory>
-#include "../../Animator.h"                   // Needs Animator definition
-#include "../../character/CharacterManager.h" // Needs CharacterManager definition
-#include "../../Helper/PathGenerator.h"       // Needs PathGenerator definition
+#include "../../Helper/TweenSystem.h"
+#include "../../Character/CharacterManager.h" // Needs CharacterManager definition
+#include "../../Helper/PathWorker.h"          // Needs PathWorker definition
 #include "Renderer.h"                         // Needs Renderer definition
 #include "../../DebugUtils.h"
 class IdleAnimationController
@@ -24,13 +24,15 @@ public:
         SNOOZE_2
     };
 
-    IdleAnimationController(Renderer &renderer, CharacterManager *charMgr, PathGenerator *pathGen);
+    IdleAnimationController(Renderer &renderer, CharacterManager *charMgr, PathWorker *pathWorker);
     ~IdleAnimationController();
 
     void startRandomIdleAnimation(unsigned long currentTime, int targetX, int targetY);
     bool triggerSnoozeAnimation(unsigned long currentTime, int targetX, int targetY);
     bool triggerLeanAnimation(unsigned long currentTime, int targetX, int targetY);
     bool triggerPathAnimation(unsigned long currentTime); // Path anim typically doesn't need targetX/Y for its own start
+    // Asks the path worker for the next flight, unless one is already on its way.
+    void preparePath();
 
     bool update(unsigned long currentTime); // Returns true if still animating
     void draw();
@@ -41,8 +43,16 @@ public:
 private:
     Renderer &_renderer;
     CharacterManager *_characterManager;
-    PathGenerator *_pathGenerator; // Pointer, as MainScene owns the instance
-    std::unique_ptr<Animator> _currentAnimator;
+    PathWorker *_pathWorker; // Not owned
+    PathWorker::Ticket _nextPath = PathWorker::NO_TICKET;
+    std::vector<PathPoint> _pathPoints; // Swapped with the worker's buffers
+    // Lean: x, y and angle. Path: along the path, with _frameTween
+    // cycling the sprite's frames.
+    TweenHandle _tween = NO_TWEEN;
+    TweenHandle _frameTween = NO_TWEEN;
+    GraphicAssetData _sprite;
+    float _pivotX = 0.0f;
+    float _pivotY = 0.0f;
 
     SnoozeStateInternal _snoozeState; // Use internal SnoozeState
     unsigned long _snoozeFrameEndTime;
@@ -58,5 +68,6 @@ private:
     static constexpr float MAX_LEAN_ANGLE = 10.0f;
     static const int MAX_LEAN_OFFSET_X = 4;
     // Path animation durations are determined by PathGenerator
+    static PathGenConfig flyingPathConfig();
 };
 #endif // IDLE_ANIMATION_CONTROLLER_H
@@ -5,17 +5,16 @@
 #include "Renderer.h"
 #include <U8g2lib.h>
 #include "../../Graphics.h"
-#include "character/level0/CharacterGraphics_L0.h"
+#include "Character/level0/CharacterGraphics_L0.h"
 #include "../../GameStats.h"
-#include "../../Animator.h"
+#include "../../Helper/TweenSystem.h"
 #include "IconMenuManager.h"
 #include "../../Weather/WeatherManager.h"
 #include <Arduino.h>
 #include <memory>
 #include "../../SerialForwarder.h"
-#include "character/CharacterManager.h"
+#include "Character/CharacterManager.h"
 #include <vector>
-#include "FastNoiseLite.h"
 #include <cmath>
 #include "../../DialogBox/DialogBox.h"
 #include "../../Helper/PathGenerator.h"
@@ -33,7 +32,7 @@ MainScene::MainScene() : currentPhase(AnimationPhase::PHASE_IDLE),
                          _topMenuYTarget(0.0f),
                          _bottomMenuYTarget(0.0f)
 {
-    _noise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _noise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _noise.SetFrequency(0.05);
     _noise.SetSeed(esp_random());
 }
@@ -59,13 +58,14 @@ void MainScene::init(GameContext& context)
 
     _isFirstEntry = true;
     showMenus = false;
-    currentAnimation.reset();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    currentAnimation = NO_TWEEN;
     _nextIdleAnimTime = 0;
 
     if (_gameContext->renderer && _gameContext->gameStats) {
         _iconMenuManager.reset(new IconMenuManager(*_gameContext->renderer, *_gameContext->gameStats));
         _dialogBox.reset(new DialogBox(*_gameContext->renderer));
-        _idleAnimController.reset(new IdleAnimationController(*_gameContext->renderer, _gameContext->characterManager, _gameContext->pathGenerator));
+        _idleAnimController.reset(new IdleAnimationController(*_gameContext->renderer, _gameContext->characterManager, _gameContext->pathWorker));
     } else {
         debugPrint("SCENES", "ERROR: Renderer or GameStats (via context) null in MainScene init, cannot create UI managers.");
     }
@@ -123,7 +123,8 @@ void MainScene::onEnter()
         debugPrint("SCENES", "ERROR: _idleAnimController is null in onEnter!");
     }
 
-    currentAnimation.reset();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    currentAnimation = NO_TWEEN;
     if (_dialogBox)
         _dialogBox->close();
 
@@ -162,8 +163,11 @@ void MainScene::onEnter()
             targetEggY = (renderer.getHeight() - staticAsset.height) / 2;
             int startX = targetEggX;
             int startY = -staticAsset.height;
-            currentAnimation.reset(new Animator(renderer, staticAsset.bitmap, staticAsset.width, staticAsset.height, startX, startY, targetEggX, targetEggY, FALLING_ANIMATION_DURATION_MS));
+            currentAnimation = TweenSystem::getInstance()->start(
+                TweenSystem::move(startX, startY, targetEggX, targetEggY, FALLING_ANIMATION_DURATION_MS), this, onEntryAnimationDone);
             debugPrint("SCENES", "MainScene::onEnter - FALLING animation created.");
+            if (currentAnimation == NO_TWEEN)
+                advanceEntryAnimation();
             unsigned long downingTotalDur = downingOk && downingAsset.isSpritesheet() ? (downingAsset.frameDurationMs * downingAsset.frameCount) : 0;
             scheduleNextIdleAnimation(millis() + FALLING_ANIMATION_DURATION_MS + downingTotalDur + 1000);
         }
@@ -211,7 +215,8 @@ void MainScene::onEnter()
 void MainScene::onExit()
 {
     debugPrint("SCENES", "MainScene::onExit");
-    currentAnimation.reset();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+    currentAnimation = NO_TWEEN;
     if (_iconMenuManager)
         _iconMenuManager->resetSelection();
     if (_idleAnimController)
@@ -222,10 +227,41 @@ void MainScene::onExit()
         _gameContext->inputManager->unregisterAllListenersForScene(this);
     }
 }
+void MainScene::onEntryAnimationDone(void* owner, TweenHandle tween)
+{
+    static_cast<MainScene*>(owner)->advanceEntryAnimation();
+}
+void MainScene::advanceEntryAnimation()
+{
+    currentAnimation = NO_TWEEN;
+    unsigned long currentTime = millis();
+    GraphicAssetData downingAsset;
+    bool downingOk = _gameContext->characterManager->getGraphicAssetData(GraphicType::DOWNING_SHEET, downingAsset);
+
+    if (currentPhase == AnimationPhase::PHASE_FALLING && downingOk && downingAsset.isSpritesheet())
+    {
+        currentPhase = AnimationPhase::DOWNING;
+        currentAnimation = TweenSystem::getInstance()->start(
+            TweenSystem::frames(downingAsset.frameCount, downingAsset.frameDurationMs), this, onEntryAnimationDone);
+        if (currentAnimation != NO_TWEEN)
+            return;
+    }
+    if (currentPhase == AnimationPhase::PHASE_FALLING)
+        debugPrint("SCENES", "Error: Missing assets for DOWNING animation, skipping to IDLE.");
+
+    currentPhase = AnimationPhase::PHASE_IDLE;
+    showMenus = !(_gameContext->gameStats && _gameContext->gameStats->isSleeping);
+    if (showMenus && _iconMenuManager)
+        _iconMenuManager->resetSelection();
+    scheduleNextIdleAnimation(currentTime);
+}
 void MainScene::scheduleNextIdleAnimation(unsigned long currentTime)
 {
     unsigned long randomInterval = random(MIN_IDLE_ANIM_INTERVAL_MS, MAX_IDLE_ANIM_INTERVAL_MS + 1);
     _nextIdleAnimTime = currentTime + randomInterval;
+    // A flight may be picked: have its path generated in the meantime.
+    if (_idleAnimController)
+        _idleAnimController->preparePath();
     debugPrintf("SCENES", "MainScene: Next random idle animation scheduled for %lu ms from now (at %lu)", randomInterval, _nextIdleAnimTime);
 }
 
@@ -235,7 +271,7 @@ bool MainScene::triggerSnoozeAnimation()
         debugPrint("SCENES", "MainScene Error: Context/GameStats/IdleController null in triggerSnoozeAnimation.");
         return false;
     }
-    if (currentAnimation || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
+    if (TweenSystem::getInstance()->isActive(currentAnimation) || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
     {
         debugPrint("SCENES", "MainScene: Cannot trigger Snooze: Main animation, sleep, menu active, or not idle.");
         return false;
@@ -251,7 +287,7 @@ bool MainScene::triggerLeanAnimation()
         debugPrint("SCENES", "MainScene Error: Context/GameStats/IdleController null in triggerLeanAnimation.");
         return false;
     }
-    if (currentAnimation || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
+    if (TweenSystem::getInstance()->isActive(currentAnimation) || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
     {
         debugPrint("SCENES", "MainScene: Cannot trigger Lean: Main animation, sleep, menu active, or not idle.");
         return false;
@@ -267,7 +303,7 @@ bool MainScene::triggerPathAnimation()
         debugPrint("SCENES", "MainScene Error: Context/GameStats/IdleController null in triggerPathAnimation.");
         return false;
     }
-    if (currentAnimation || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
+    if (TweenSystem::getInstance()->isActive(currentAnimation) || currentPhase != AnimationPhase::PHASE_IDLE || _gameContext->gameStats->isSleeping || showMenus)
     {
         debugPrint("SCENES", "MainScene: Cannot trigger Path: Main animation, sleep, menu active, or not idle.");
         return false;
@@ -336,50 +372,7 @@ void MainScene::update(unsigned long deltaTime)
         _dialogBox->update(currentTime);
     }
 
-    if (currentAnimation)
-    { 
-        bool stillAnimating = currentAnimation->update();
-        if (!stillAnimating)
-        {
-            GraphicAssetData downingAsset;
-            bool downingOk = _gameContext->characterManager->getGraphicAssetData(GraphicType::DOWNING_SHEET, downingAsset);
-
-            if (currentPhase == AnimationPhase::PHASE_FALLING)
-            {
-                currentPhase = AnimationPhase::DOWNING;
-                currentAnimation.reset();
-                if (_gameContext->renderer && downingOk && downingAsset.isSpritesheet())
-                {
-                    currentAnimation.reset(new Animator(*_gameContext->renderer, downingAsset.bitmap, downingAsset.width, downingAsset.height, downingAsset.frameCount, downingAsset.bytesPerFrame, targetEggX, targetEggY, downingAsset.frameDurationMs, 1));
-                }
-                else
-                {
-                    debugPrint("SCENES", "Error: Missing assets/renderer for DOWNING animation, skipping to IDLE.");
-                    currentPhase = AnimationPhase::PHASE_IDLE;
-                    showMenus = !(_gameContext->gameStats && _gameContext->gameStats->isSleeping);
-                    if (_iconMenuManager && showMenus)
-                        _iconMenuManager->resetSelection();
-                    scheduleNextIdleAnimation(currentTime);
-                }
-            }
-            else if (currentPhase == AnimationPhase::DOWNING)
-            {
-                currentPhase = AnimationPhase::PHASE_IDLE;
-                currentAnimation.reset();
-                showMenus = !(_gameContext->gameStats && _gameContext->gameStats->isSleeping);
-                if (showMenus && _iconMenuManager)
-                    _iconMenuManager->resetSelection();
-                scheduleNextIdleAnimation(currentTime);
-            }
-            else
-            { 
-                currentAnimation.reset();
-                currentPhase = AnimationPhase::PHASE_IDLE; 
-                scheduleNextIdleAnimation(currentTime);
-            }
-        }
-    }
-    else if (currentPhase == AnimationPhase::PHASE_IDLE && !(_dialogBox && _dialogBox->isActive()))
+    if (currentPhase == AnimationPhase::PHASE_IDLE && !(_dialogBox && _dialogBox->isActive()))
     {
         if (_idleAnimController)
         {
@@ -438,7 +431,8 @@ void MainScene::attemptToSleep()
 
         _gameContext->sceneManager->requestSetCurrentScene("SLEEPING");
 
-        currentAnimation.reset();
+        TweenSystem::getInstance()->cancel(currentAnimation);
+        currentAnimation = NO_TWEEN;
         if (_idleAnimController)
             _idleAnimController->reset(); 
         _nextIdleAnimTime = 0;
@@ -497,9 +491,21 @@ void MainScene::draw(Renderer& renderer)
 
     _gameContext->weatherManager->drawBackground(canDrawWeather);
 
-    if (currentAnimation && (currentPhase == AnimationPhase::PHASE_FALLING || currentPhase == AnimationPhase::DOWNING))
+    if (currentPhase == AnimationPhase::PHASE_FALLING || currentPhase == AnimationPhase::DOWNING)
     {
-        currentAnimation->draw();
+        TweenSystem* tweens = TweenSystem::getInstance();
+        GraphicAssetData asset;
+        float x, y;
+        if (currentPhase == AnimationPhase::PHASE_FALLING)
+        {
+            if (tweens->position(currentAnimation, x, y) && _gameContext->characterManager->getGraphicAssetData(GraphicType::STATIC_IDLE, asset) && asset.isValid())
+                u8g2->drawXBMP(renderer.getXOffset() + static_cast<int>(round(x)), renderer.getYOffset() + static_cast<int>(round(y)), asset.width, asset.height, asset.bitmap);
+        }
+        else if (tweens->isActive(currentAnimation) && _gameContext->characterManager->getGraphicAssetData(GraphicType::DOWNING_SHEET, asset) && asset.isSpritesheet())
+        {
+            const uint8_t* frame = asset.bitmap + tweens->frame(currentAnimation) * asset.bytesPerFrame;
+            u8g2->drawXBMP(renderer.getXOffset() + targetEggX, renderer.getYOffset() + targetEggY, asset.width, asset.height, frame);
+        }
     }
     else if (currentPhase == AnimationPhase::PHASE_IDLE)
     {
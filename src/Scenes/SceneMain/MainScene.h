@@ -3,10 +3,10 @@
 #include <vector>
 #include <memory>
 #include "espasyncbutton.hpp"
-#include "../../Animator.h"
-#include "character/CharacterManager.h"
+#include "../../Helper/TweenSystem.h"
+#include "Character/CharacterManager.h"
 #include "../../Weather/WeatherManager.h"
-#include "FastNoiseLite.h"
+#include "../../Helper/FixedNoise.h"
 #include "IconMenuManager.h"
 #include "../../DialogBox/DialogBox.h"
 #include "../../Helper/PathGenerator.h"
@@ -47,7 +47,7 @@ private:
     static const int MENU_BAR_HEIGHT = IconMenuManager::ICON_HEIGHT + 2 * IconMenuManager::ICON_SPACING;
     static constexpr float MENU_ANIMATION_SPEED = 8.0f; 
 
-    std::unique_ptr<Animator> currentAnimation; 
+    TweenHandle currentAnimation = NO_TWEEN; // Falling, then downing
     AnimationPhase currentPhase = AnimationPhase::PHASE_IDLE;
     int targetEggX = 0;
     int targetEggY = 0;
@@ -65,11 +65,13 @@ private:
     std::unique_ptr<DialogBox> _dialogBox;
     bool _isFirstEntry = true;
 
-    FastNoiseLite _noise;
+    FixedNoise _noise;
     
     // Scene-specific context pointer
     GameContext* _gameContext = nullptr;
 
+    static void onEntryAnimationDone(void* owner, TweenHandle tween);
+    void advanceEntryAnimation();
     void scheduleNextIdleAnimation(unsigned long currentTime);
     void handleMenuAction(IconAction action);
     void drawSicknessOverlay(Renderer &renderer);
@@ -4,7 +4,7 @@
 #include "Scene.h"
 #include <memory> 
 #include "espasyncbutton.hpp" 
-#include "character/CharacterManager.h" 
+#include "Character/CharacterManager.h" 
 #include "../../ParticleSystem.h"      
 #include "../../DialogBox/DialogBox.h" 
 #include "../../System/GameContext.h" 
@@ -10,7 +10,7 @@
 #include <cstring>
 #include <algorithm>
 #include "../../SerialForwarder.h" 
-#include "../../character/CharacterManager.h" 
+#include "../../Character/CharacterManager.h" 
 #include "../../DebugUtils.h"
 #include "../../System/GameContext.h" 
 
@@ -9,7 +9,7 @@
 #include "Scene.h"          
 #include "Scenes/SceneMain/MainScene.h" 
 #include "Weather/WeatherTypes.h" 
-#include "character/CharacterManager.h" 
+#include "Character/CharacterManager.h" 
 #include "DialogBox/DialogBox.h" 
 #include "Scenes/SceneSleeping/SleepingScene.h" 
 #include "System/DeepSleepController.h" 
@@ -20,6 +20,8 @@
 #include <freertos/task.h>     
 #include "GlobalMappings.h" 
 #include "System/GameContext.h" 
+#include "System/FrameProfiler.h"
+#include "System/DirtyTileTracker.h"
 #include "esp_wifi.h" 
 #include "esp_bt.h"
 #include <map>
@@ -288,6 +290,23 @@ void SerialCommandHandler::processSerialCommand(String command) {
             _context.serialForwarder->println("Error: Invalid prequel stage value. Use 'NONE', 'LANG_SEL', 'S1', 'S2', 'S3', 'S4', 'FINISHED' or 0-6.");
         }
     }
+    else if (command.equalsIgnoreCase("perf_stats")) {
+        if (!_context.frameProfiler) { _context.serialForwarder->println("Error: FrameProfiler not ready."); return; }
+        _context.frameProfiler->printReport(*_context.serialForwarder);
+        if (_context.dirtyTiles) {
+            const DirtyTileTracker::Stats& tiles = _context.dirtyTiles->getStats();
+            uint32_t totalTiles = tiles.tilesSent + tiles.tilesSkipped;
+            _context.serialForwarder->printf("Display flushes: %lu (%lu idle), tiles sent: %lu of %lu (%lu%%)\n",
+                (unsigned long)tiles.flushes, (unsigned long)tiles.idleFlushes, (unsigned long)tiles.tilesSent,
+                (unsigned long)totalTiles, totalTiles ? (unsigned long)(tiles.tilesSent * 100ULL / totalTiles) : 0UL);
+        }
+    }
+    else if (command.equalsIgnoreCase("perf_reset")) {
+        if (!_context.frameProfiler) { _context.serialForwarder->println("Error: FrameProfiler not ready."); return; }
+        _context.frameProfiler->reset();
+        if (_context.dirtyTiles) _context.dirtyTiles->resetStats();
+        _context.serialForwarder->println("Frame profiler statistics reset.");
+    }
     else if (command.equalsIgnoreCase("reboot")) {
         _context.serialForwarder->println("Rebooting..."); delay(100); ESP.restart();
     }
@@ -352,6 +371,8 @@ void SerialCommandHandler::printHelp() {
     _context.serialForwarder->println("  anim_fly                  - Triggers a dynamic flying animation (if MainScene active).");
     _context.serialForwarder->println("  list_scenes               - Lists available scene names.");
     _context.serialForwarder->println("  set_scene <name>          - Sets the current scene by its registered name.");
+    _context.serialForwarder->println("  perf_stats                - Shows per-phase, per-scene and per-weather frame timings.");
+    _context.serialForwarder->println("  perf_reset                - Clears the frame profiler statistics.");
     _context.serialForwarder->println("  reboot                    - Reboots the device.");
     _context.serialForwarder->println("\nDebugging Commands:");
     _context.serialForwarder->println("  debug_status              - Shows current debug configuration.");
@@ -0,0 +1,54 @@
+#include "Crc32.h"
+
+#ifdef TAMA_HOST_SIM
+
+namespace {
+
+uint32_t sliceTable[8][256];
+bool sliceTableReady = false;
+
+void buildSliceTable() {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; j++) c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1u)));
+        sliceTable[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int s = 1; s < 8; s++) {
+            uint32_t prev = sliceTable[s - 1][i];
+            sliceTable[s][i] = (prev >> 8) ^ sliceTable[0][prev & 0xFF];
+        }
+    }
+    sliceTableReady = true;
+}
+
+} // namespace
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!sliceTableReady) buildSliceTable();
+    crc = ~crc;
+    while (length >= 8) {
+        uint32_t lo, hi;
+        memcpy(&lo, data, 4);
+        memcpy(&hi, data + 4, 4);
+        lo ^= crc;
+        crc = sliceTable[7][lo & 0xFF] ^ sliceTable[6][(lo >> 8) & 0xFF] ^
+              sliceTable[5][(lo >> 16) & 0xFF] ^ sliceTable[4][lo >> 24] ^
+              sliceTable[3][hi & 0xFF] ^ sliceTable[2][(hi >> 8) & 0xFF] ^
+              sliceTable[1][(hi >> 16) & 0xFF] ^ sliceTable[0][hi >> 24];
+        data += 8;
+        length -= 8;
+    }
+    while (length--) crc = (crc >> 8) ^ sliceTable[0][(crc ^ *data++) & 0xFF];
+    return ~crc;
+}
+
+#else
+
+#include "esp_rom_crc.h"
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    return esp_rom_crc32_le(crc, data, length);
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <Arduino.h>
+
+// CRC-32 (IEEE 802.3, reflected, the zlib/JS variant the Screen Viewer checks).
+// Same calling convention as esp_rom_crc32_le(): start with crc = 0 and feed
+// the returned value back in to checksum data that arrives in pieces.
+//
+// The ESP32 build uses the ROM routine. The host build has no ROM and uses a
+// slice-by-8 table instead.
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length);
+
+#endif // CRC32_H
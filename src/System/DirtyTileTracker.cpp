@@ -0,0 +1,123 @@
+#include "DirtyTileTracker.h"
+#include "../DebugUtils.h"
+
+DirtyTileTracker* DirtyTileTracker::_instance = nullptr;
+
+DirtyTileTracker::DirtyTileTracker(U8G2* u8g2, bool rotated180)
+    : _u8g2(u8g2), _rotated180(rotated180)
+{
+    memset(_shadow, 0, sizeof(_shadow));
+    markAllDirty();
+}
+
+DirtyTileTracker::~DirtyTileTracker() {
+    if (_instance == this && _u8g2 && _driverCallback) {
+        _u8g2->getU8x8()->display_cb = _driverCallback;
+    }
+    if (_instance == this) _instance = nullptr;
+}
+
+void DirtyTileTracker::init() {
+    if (!_u8g2) return;
+    if (_instance && _instance != this) {
+        debugPrint("SYSTEM", "DirtyTileTracker: another tracker already owns the display. Ignoring.");
+        return;
+    }
+    u8x8_t* u8x8 = _u8g2->getU8x8();
+    if (u8x8->display_cb == displayCallbackFilter) return;
+    _driverCallback = u8x8->display_cb;
+    _instance = this;
+    u8x8->display_cb = displayCallbackFilter;
+    debugPrint("SYSTEM", "DirtyTileTracker installed on display callback.");
+}
+
+void DirtyTileTracker::markDirty(int x, int y, int w, int h) {
+    if (w <= 0 || h <= 0) return;
+    int x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+    if (_rotated180) {
+        x0 = TILE_COLS * 8 - 1 - (x + w - 1);
+        x1 = TILE_COLS * 8 - 1 - x;
+        y0 = TILE_ROWS * 8 - 1 - (y + h - 1);
+        y1 = TILE_ROWS * 8 - 1 - y;
+    }
+    x0 = constrain(x0, 0, TILE_COLS * 8 - 1);
+    x1 = constrain(x1, 0, TILE_COLS * 8 - 1);
+    y0 = constrain(y0, 0, TILE_ROWS * 8 - 1);
+    y1 = constrain(y1, 0, TILE_ROWS * 8 - 1);
+    if (x0 > x1 || y0 > y1) return;
+
+    uint16_t columnMask = 0;
+    for (int tx = x0 >> 3; tx <= (x1 >> 3); ++tx) columnMask |= (uint16_t)(1u << tx);
+    for (int ty = y0 >> 3; ty <= (y1 >> 3); ++ty) _forced[ty] |= columnMask;
+}
+
+void DirtyTileTracker::markAllDirty() {
+    for (uint8_t ty = 0; ty < TILE_ROWS; ++ty) _forced[ty] = 0xFFFF;
+}
+
+uint8_t DirtyTileTracker::displayCallbackFilter(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    DirtyTileTracker* self = _instance;
+    if (!self || !self->_driverCallback) return 0;
+
+    if (msg == U8X8_MSG_DISPLAY_DRAW_TILE && self->_enabled && arg_int == 1) {
+        return self->drawTileRow(u8x8, static_cast<const u8x8_tile_t*>(arg_ptr));
+    }
+    if (msg == U8X8_MSG_DISPLAY_INIT || msg == U8X8_MSG_DISPLAY_DRAW_TILE) {
+        // Panel RAM was reset or written without going through the shadow.
+        self->markAllDirty();
+    }
+    return self->_driverCallback(u8x8, msg, arg_int, arg_ptr);
+}
+
+uint8_t DirtyTileTracker::drawTileRow(u8x8_t* u8x8, const u8x8_tile_t* tile) {
+    uint8_t ty = tile->y_pos;
+    if (ty >= TILE_ROWS || tile->x_pos >= TILE_COLS) {
+        return _driverCallback(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, (void*)tile);
+    }
+    uint8_t count = tile->cnt;
+    if (tile->x_pos + count > TILE_COLS) count = TILE_COLS - tile->x_pos;
+
+    bool fullRow = tile->x_pos == 0 && count == TILE_COLS;
+    if (fullRow && ty == 0) {
+        _stats.flushes++;
+        _tilesSentThisFlush = 0;
+    }
+
+    // Forward each run of changed tiles as one DRAW_TILE message.
+    uint8_t i = 0;
+    while (i < count) {
+        uint8_t tx = tile->x_pos + i;
+        const uint8_t* src = tile->tile_ptr + i * 8;
+        uint8_t* shadow = &_shadow[(ty * TILE_COLS + tx) * 8];
+        bool forced = (_forced[ty] >> tx) & 1;
+        if (!forced && memcmp(src, shadow, 8) == 0) {
+            _stats.tilesSkipped++;
+            i++;
+            continue;
+        }
+
+        uint8_t runStart = i;
+        while (i < count) {
+            tx = tile->x_pos + i;
+            src = tile->tile_ptr + i * 8;
+            shadow = &_shadow[(ty * TILE_COLS + tx) * 8];
+            forced = (_forced[ty] >> tx) & 1;
+            if (!forced && memcmp(src, shadow, 8) == 0) break;
+            memcpy(shadow, src, 8);
+            _forced[ty] &= (uint16_t)~(1u << tx);
+            i++;
+        }
+
+        u8x8_tile_t run;
+        run.tile_ptr = tile->tile_ptr + runStart * 8;
+        run.cnt = i - runStart;
+        run.x_pos = tile->x_pos + runStart;
+        run.y_pos = ty;
+        _driverCallback(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, &run);
+        _stats.tilesSent += run.cnt;
+        _tilesSentThisFlush += run.cnt;
+    }
+
+    if (fullRow && ty == TILE_ROWS - 1 && _tilesSentThisFlush == 0) _stats.idleFlushes++;
+    return 1;
+}
@@ -0,0 +1,63 @@
+#ifndef DIRTY_TILE_TRACKER_H
+#define DIRTY_TILE_TRACKER_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// Sends only the 8x8 tiles that changed since the last flush.
+//
+// EDGE redraws the full frame every tick and flushes it with sendBuffer(),
+// which, like updateDisplayArea(), reaches the panel through the u8x8
+// display callback as DRAW_TILE messages. The tracker wraps that callback:
+// each tile row is compared against a shadow copy of the panel RAM and only
+// runs of changed tiles are forwarded to the real driver. Nothing else in
+// the draw path has to change, and GEM scenes that flush on their own
+// benefit as well.
+//
+// Callers that know the panel content no longer matches the shadow (panel
+// re-init, glitch recovery) can force tiles out with markDirty().
+class DirtyTileTracker {
+public:
+    static const uint8_t TILE_COLS = 16;
+    static const uint8_t TILE_ROWS = 8;
+
+    struct Stats {
+        uint32_t flushes = 0;
+        uint32_t tilesSent = 0;
+        uint32_t tilesSkipped = 0;
+        uint32_t idleFlushes = 0; // Flushes where no tile changed at all
+    };
+
+    DirtyTileTracker(U8G2* u8g2, bool rotated180);
+    ~DirtyTileTracker();
+
+    void init(); // Installs the display callback filter
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool isEnabled() const { return _enabled; }
+
+    // Logical (rotated) screen coordinates, as passed to U8G2 drawing calls.
+    void markDirty(int x, int y, int w, int h);
+    void markAllDirty();
+    bool isTileDirty(uint8_t tx, uint8_t ty) const { return (_forced[ty] >> tx) & 1; }
+
+    const Stats& getStats() const { return _stats; }
+    void resetStats() { _stats = Stats(); }
+
+private:
+    static DirtyTileTracker* _instance; // u8x8 callbacks carry no user pointer
+    static uint8_t displayCallbackFilter(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+    U8G2* _u8g2;
+    bool _rotated180;
+    bool _enabled = true;
+    u8x8_msg_cb _driverCallback = nullptr;
+
+    uint8_t _shadow[TILE_ROWS * TILE_COLS * 8]; // Last tiles sent to the panel
+    uint16_t _forced[TILE_ROWS];                // Bit per tile column: send even if unchanged
+    Stats _stats;
+    uint16_t _tilesSentThisFlush = 0;
+
+    uint8_t drawTileRow(u8x8_t* u8x8, const u8x8_tile_t* tile);
+};
+
+#endif // DIRTY_TILE_TRACKER_H
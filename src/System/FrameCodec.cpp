@@ -0,0 +1,205 @@
+#include "FrameCodec.h"
+
+namespace {
+
+const RleCodec rleCodec;
+const DeltaRunCodec deltaRunCodec;
+const XorZeroRunCodec xorZeroRunCodec;
+const LzssCodec lzssCodec;
+
+const FrameCodec* const CODECS[] = { &deltaRunCodec, &xorZeroRunCodec, &rleCodec, &lzssCodec };
+
+// LZSS match finder: last position + 1 of each 3-byte hash (0 = none).
+// Shared by all encodes, which only ever run on the loop task.
+const size_t LZSS_HASH_BITS = 10;
+uint16_t lzssHashHead[1 << LZSS_HASH_BITS];
+
+inline uint16_t lzssHash(const uint8_t* p) {
+    return (uint16_t)(((p[0] << 8) ^ (p[1] << 4) ^ p[2]) * 2654435761u >> (32 - LZSS_HASH_BITS));
+}
+
+} // namespace
+
+const FrameCodec* const* FrameCodec::all(size_t& count) {
+    count = sizeof(CODECS) / sizeof(CODECS[0]);
+    return CODECS;
+}
+
+const FrameCodec* FrameCodec::byName(const char* name) {
+    for (const FrameCodec* codec : CODECS) {
+        if (strcmp(codec->name(), name) == 0) return codec;
+    }
+    return nullptr;
+}
+
+size_t RleCodec::encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                        uint8_t* dest, size_t destLen) const {
+    const uint8_t* src = frames;
+    size_t srcLen = frameCount * frameSize;
+    size_t destIndex = 0;
+    for (size_t i = 0; i < srcLen; ) {
+        uint8_t currentByte = src[i];
+        uint8_t runCount = 1;
+        while (i + runCount < srcLen && src[i + runCount] == currentByte && runCount < 255) {
+            runCount++;
+        }
+        if (destIndex + 2 > destLen) {
+            return 0; // Not enough space in destination buffer for this run
+        }
+        dest[destIndex++] = runCount;
+        dest[destIndex++] = currentByte;
+        i += runCount;
+    }
+    return destIndex;
+}
+
+// Unchanged gaps shorter than a run header are folded into the current run.
+// Returns 0 if nothing changed.
+size_t DeltaRunCodec::encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                             uint8_t* dest, size_t destLen) const {
+    static const size_t RUN_HEADER_SIZE = 3;
+    static const size_t MAX_RUN_LENGTH = 255;
+    if (frameCount != 1 || !previous || frameSize > 0x10000) return 0;
+
+    const uint8_t* current = frames;
+    size_t destIndex = 0;
+    size_t i = 0;
+    while (i < frameSize) {
+        // Skip unchanged bytes a word at a time where alignment allows.
+        while (i + 4 <= frameSize && ((i & 3) == 0)) {
+            uint32_t a, b;
+            memcpy(&a, current + i, 4);
+            memcpy(&b, previous + i, 4);
+            if (a != b) break;
+            i += 4;
+        }
+        while (i < frameSize && current[i] == previous[i]) i++;
+        if (i >= frameSize) break;
+
+        size_t runStart = i;
+        size_t runEnd = i + 1; // Exclusive, always ends on a changed byte
+        size_t scan = runEnd;
+        while (scan < frameSize && scan - runStart < MAX_RUN_LENGTH) {
+            if (current[scan] != previous[scan]) {
+                runEnd = scan + 1;
+            } else if (scan - runEnd >= RUN_HEADER_SIZE) {
+                break;
+            }
+            scan++;
+        }
+
+        size_t runLength = runEnd - runStart;
+        if (destIndex + RUN_HEADER_SIZE + runLength > destLen) return 0;
+        dest[destIndex++] = (uint8_t)(runStart >> 8);
+        dest[destIndex++] = (uint8_t)(runStart & 0xFF);
+        dest[destIndex++] = (uint8_t)runLength;
+        memcpy(dest + destIndex, current + runStart, runLength);
+        destIndex += runLength;
+        i = runEnd;
+    }
+    return destIndex;
+}
+
+size_t XorZeroRunCodec::encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                               uint8_t* dest, size_t destLen) const {
+    size_t destIndex = 0;
+    uint8_t zeroRun = 0;
+    for (size_t f = 0; f < frameCount; ++f) {
+        const uint8_t* current = frames + f * frameSize;
+        const uint8_t* base = f > 0 ? current - frameSize : previous; // Null: XOR with zeros
+        for (size_t i = 0; i < frameSize; ++i) {
+            uint8_t x = base ? (uint8_t)(current[i] ^ base[i]) : current[i];
+            if (x == 0) {
+                if (++zeroRun == 255) {
+                    if (destIndex + 2 > destLen) return 0;
+                    dest[destIndex++] = 0;
+                    dest[destIndex++] = zeroRun;
+                    zeroRun = 0;
+                }
+                continue;
+            }
+            if (zeroRun > 0) {
+                if (destIndex + 2 > destLen) return 0;
+                dest[destIndex++] = 0;
+                dest[destIndex++] = zeroRun;
+                zeroRun = 0;
+            }
+            if (destIndex + 1 > destLen) return 0;
+            dest[destIndex++] = x;
+        }
+    }
+    if (zeroRun > 0) {
+        if (destIndex + 2 > destLen) return 0;
+        dest[destIndex++] = 0;
+        dest[destIndex++] = zeroRun;
+    }
+    return destIndex;
+}
+
+// Greedy LZSS. Candidates for a match are the last position with the same
+// 3-byte hash, the previous byte (runs) and the same byte one frame back
+// (animation), so no hash chains are needed.
+size_t LzssCodec::encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                         uint8_t* dest, size_t destLen) const {
+    const uint8_t* src = frames;
+    size_t srcLen = frameCount * frameSize;
+    if (srcLen >= 0xFFFF) return 0; // Positions are stored as uint16_t
+    memset(lzssHashHead, 0, sizeof(lzssHashHead));
+
+    size_t destIndex = 0;
+    size_t flagIndex = 0;
+    uint8_t flagBit = 8; // Forces a new flag byte for the first item
+
+    size_t i = 0;
+    while (i < srcLen) {
+        if (flagBit == 8) {
+            if (destIndex + 1 > destLen) return 0;
+            flagIndex = destIndex++;
+            dest[flagIndex] = 0;
+            flagBit = 0;
+        }
+
+        size_t bestLength = 0;
+        size_t bestOffset = 0;
+        size_t maxLength = srcLen - i < MAX_MATCH ? srcLen - i : MAX_MATCH;
+        if (maxLength >= MIN_MATCH) {
+            size_t candidates[3] = {0, 0, 0};
+            uint16_t hash = lzssHash(src + i);
+            if (lzssHashHead[hash]) candidates[0] = lzssHashHead[hash];         // Position + 1
+            if (i >= 1) candidates[1] = i;                                      // i - 1, + 1
+            if (frameSize < WINDOW_SIZE && i >= frameSize) candidates[2] = i - frameSize + 1;
+            lzssHashHead[hash] = (uint16_t)(i + 1);
+
+            for (size_t c = 0; c < 3; ++c) {
+                if (!candidates[c]) continue;
+                size_t pos = candidates[c] - 1;
+                size_t offset = i - pos;
+                if (offset == 0 || offset > WINDOW_SIZE) continue;
+                size_t length = 0;
+                while (length < maxLength && src[pos + length] == src[i + length]) length++;
+                if (length > bestLength) {
+                    bestLength = length;
+                    bestOffset = offset;
+                }
+            }
+        }
+
+        if (bestLength >= MIN_MATCH) {
+            // [offset-1 high 8 bits][offset-1 low 4 bits << 4 | length-3]
+            if (destIndex + 2 > destLen) return 0;
+            dest[flagIndex] |= (uint8_t)(1 << flagBit);
+            dest[destIndex++] = (uint8_t)((bestOffset - 1) >> 4);
+            dest[destIndex++] = (uint8_t)((((bestOffset - 1) & 0x0F) << 4) | (bestLength - MIN_MATCH));
+            // Keep the hash table warm inside the match.
+            for (size_t k = 1; k < bestLength && i + k + MIN_MATCH <= srcLen; ++k) {
+                lzssHashHead[lzssHash(src + i + k)] = (uint16_t)(i + k + 1);
+            }
+            i += bestLength;
+        } else {
+            if (destIndex + 1 > destLen) return 0;
+            dest[destIndex++] = src[i++];
+        }
+        flagBit++;
+    }
+    return destIndex;
+}
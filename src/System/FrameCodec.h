@@ -0,0 +1,88 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <Arduino.h>
+
+// Encoders for the Screen Viewer stream. ScreenStreamer runs every codec
+// that applies to a frame (or batch) and sends the smallest output; the
+// matching decoders live in ScreenWebPageGenerator/ScreenWebPage.html.
+//
+// A codec encodes frameCount consecutive frames of frameSize bytes. Frame 0
+// may be coded against `previous`, the frame the receiver already shows, if
+// the codec usesPrevious() and previous is not null; later frames may refer
+// to the frames before them. encode() returns 0 if there is nothing to send
+// or if the output would not fit in destLen, so passing the best size found
+// so far as destLen lets a codec give up early.
+class FrameCodec {
+public:
+    virtual ~FrameCodec() = default;
+
+    virtual const char* name() const = 0;
+    virtual char frameHeader() const = 0;   // Header byte of a single-frame packet
+    virtual uint8_t batchMode() const = 0;  // Value of the batch 'compression' field, 0 if batches are unsupported
+    virtual bool usesPrevious() const = 0;  // Needs the receiver's current frame (not a keyframe)
+
+    virtual size_t encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                          uint8_t* dest, size_t destLen) const = 0;
+
+    // All codecs, in the order they are tried. Raw ('U', batch mode 0) is the
+    // implicit fallback and not part of the list.
+    static const FrameCodec* const* all(size_t& count);
+    static const FrameCodec* byName(const char* name);
+};
+
+// 'C' / batch 1: (count, byte) pairs.
+class RleCodec : public FrameCodec {
+public:
+    const char* name() const override { return "rle"; }
+    char frameHeader() const override { return 'C'; }
+    uint8_t batchMode() const override { return 1; }
+    bool usesPrevious() const override { return false; }
+    size_t encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                  uint8_t* dest, size_t destLen) const override;
+};
+
+// 'D': runs of changed bytes, [offset hi][offset lo][length][bytes...].
+class DeltaRunCodec : public FrameCodec {
+public:
+    const char* name() const override { return "delta"; }
+    char frameHeader() const override { return 'D'; }
+    uint8_t batchMode() const override { return 0; }
+    bool usesPrevious() const override { return true; }
+    size_t encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                  uint8_t* dest, size_t destLen) const override;
+};
+
+// 'X' / batch 2: each frame XORed with the one before it (frame 0 of a batch
+// with an all-zero frame), then zero runs coded as [0x00][run length] and
+// every other byte copied as is.
+class XorZeroRunCodec : public FrameCodec {
+public:
+    const char* name() const override { return "xor"; }
+    char frameHeader() const override { return 'X'; }
+    uint8_t batchMode() const override { return 2; }
+    bool usesPrevious() const override { return true; }
+    size_t encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                  uint8_t* dest, size_t destLen) const override;
+};
+
+// 'L' / batch 3: LZSS with a 4 KB window, so a batch frame can copy from
+// the same position in the frame before it. A flag byte announces the next
+// 8 items, LSB first: 0 is a literal byte, 1 a two-byte match
+// [(offset-1) >> 4][((offset-1) & 0x0F) << 4 | (length-3)], offset 1..4096,
+// length 3..18.
+class LzssCodec : public FrameCodec {
+public:
+    static const size_t WINDOW_SIZE = 4096;
+    static const size_t MIN_MATCH = 3;
+    static const size_t MAX_MATCH = MIN_MATCH + 15;
+
+    const char* name() const override { return "lzss"; }
+    char frameHeader() const override { return 'L'; }
+    uint8_t batchMode() const override { return 3; }
+    bool usesPrevious() const override { return false; }
+    size_t encode(const uint8_t* frames, size_t frameCount, size_t frameSize, const uint8_t* previous,
+                  uint8_t* dest, size_t destLen) const override;
+};
+
+#endif // FRAME_CODEC_H
@@ -0,0 +1,212 @@
+#include "FrameProfiler.h"
+#include <ESPAsyncWebServer.h>
+#include <algorithm>
+#include "EDGE.h"
+#include "../SerialForwarder.h"
+#include "../DebugUtils.h"
+#include "../Weather/WeatherManager.h"
+
+#ifdef TAMA_HOST_SIM
+#include <chrono>
+#endif
+
+FrameProfiler::FrameProfiler() {
+    reset();
+}
+
+void FrameProfiler::init(AsyncWebServer* server) {
+    if (!server) return;
+    server->on("/perf", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", toJson());
+    });
+    debugPrint("SYSTEM", "FrameProfiler initialized, stats served on /perf.");
+}
+
+void FrameProfiler::reset() {
+    for (auto& ring : _phases) ring.clear();
+    for (auto& ring : _weathers) ring.clear();
+    for (auto& slot : _scenes) {
+        slot.name[0] = '\0';
+        slot.frames.clear();
+    }
+    _sceneCount = 0;
+    _lastScene = nullptr;
+    _sceneChangePending = true;
+    _currentSceneSlot = -1;
+    _framesRecorded = 0;
+    _ticksProcessed = 0;
+    _ticksDropped = 0;
+    _clampEvents = 0;
+    _catchUpFrames = 0;
+    _startMillis = millis();
+}
+
+#ifdef TAMA_HOST_SIM
+uint32_t FrameProfiler::hostMicros() {
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+void FrameProfiler::beginFrame(SceneManager& sceneManager, unsigned long ticksDue, unsigned long ticksProcessed) {
+    if (!_enabled) return;
+    // Scene changes are applied inside engine->update(), so a pending change
+    // means the scene that draws this frame may not be the one we know.
+    if (sceneManager.isSceneChangePending()) _sceneChangePending = true;
+
+    _ticksProcessed += ticksProcessed;
+    if (ticksDue > ticksProcessed) {
+        _ticksDropped += ticksDue - ticksProcessed;
+        _clampEvents++;
+    }
+    if (ticksProcessed > 1) _catchUpFrames++;
+}
+
+void FrameProfiler::record(Phase phase, uint32_t elapsedUs) {
+    if (!_enabled || phase >= PHASE_COUNT) return;
+    _phases[phase].push(elapsedUs);
+}
+
+void FrameProfiler::endFrame(SceneManager& sceneManager, WeatherType weather, uint32_t frameUs) {
+    if (!_enabled) return;
+    _phases[PHASE_FRAME].push(frameUs);
+    _framesRecorded++;
+
+    Scene* scene = sceneManager.getCurrentScene();
+    if (scene != _lastScene || _sceneChangePending) {
+        _lastScene = scene;
+        _sceneChangePending = false;
+        _currentSceneSlot = scene ? findOrAddScene(sceneManager.getCurrentSceneName()) : -1;
+    }
+    if (_currentSceneSlot >= 0) _scenes[_currentSceneSlot].frames.push(frameUs);
+
+    size_t weatherSlot = (size_t)weather;
+    if (weatherSlot >= WEATHER_SLOT_COUNT) weatherSlot = (size_t)WeatherType::UNKNOWN;
+    _weathers[weatherSlot].push(frameUs);
+}
+
+int FrameProfiler::findOrAddScene(const String& sceneName) {
+    for (size_t i = 0; i < _sceneCount; ++i) {
+        if (strncmp(_scenes[i].name, sceneName.c_str(), SCENE_NAME_LEN - 1) == 0) return (int)i;
+    }
+    if (_sceneCount >= MAX_TRACKED_SCENES) return -1;
+    SceneSlot& slot = _scenes[_sceneCount];
+    strncpy(slot.name, sceneName.c_str(), SCENE_NAME_LEN - 1);
+    slot.name[SCENE_NAME_LEN - 1] = '\0';
+    slot.frames.clear();
+    return (int)_sceneCount++;
+}
+
+FrameProfiler::Stats FrameProfiler::computeStats(const uint16_t* samples, size_t count) {
+    Stats stats;
+    if (count == 0) return stats;
+
+    uint16_t sorted[PHASE_SAMPLE_COUNT];
+    if (count > PHASE_SAMPLE_COUNT) count = PHASE_SAMPLE_COUNT;
+    memcpy(sorted, samples, count * sizeof(uint16_t));
+    std::sort(sorted, sorted + count);
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < count; ++i) total += sorted[i];
+
+    size_t p99Index = (count * 99 + 99) / 100;
+    if (p99Index > 0) p99Index--;
+    if (p99Index >= count) p99Index = count - 1;
+
+    stats.count = (uint32_t)count;
+    stats.minUs = sorted[0];
+    stats.maxUs = sorted[count - 1];
+    stats.avgUs = total / count;
+    stats.p99Us = sorted[p99Index];
+    return stats;
+}
+
+FrameProfiler::Stats FrameProfiler::getPhaseStats(Phase phase) const {
+    if (phase >= PHASE_COUNT) return Stats();
+    return _phases[phase].compute();
+}
+
+const char* FrameProfiler::phaseToString(Phase phase) {
+    switch (phase) {
+        case PHASE_UPDATE:   return "update";
+        case PHASE_DRAW:     return "draw";
+        case PHASE_EFFECTS:  return "effects";
+        case PHASE_STREAM:   return "stream";
+        case PHASE_PERIODIC: return "periodic";
+        case PHASE_SERIAL:   return "serial";
+        case PHASE_FRAME:    return "frame";
+        default:             return "unknown";
+    }
+}
+
+void FrameProfiler::printStatsLine(SerialForwarder& out, const char* label, const Stats& stats, uint32_t overBudget) {
+    out.printf("  %-24s n=%3lu min=%6lu avg=%6lu p99=%6lu max=%6lu over=%lu\n", label,
+               (unsigned long)stats.count, (unsigned long)stats.minUs, (unsigned long)stats.avgUs,
+               (unsigned long)stats.p99Us, (unsigned long)stats.maxUs, (unsigned long)overBudget);
+}
+
+void FrameProfiler::printReport(SerialForwarder& out) const {
+    out.println("\n--- Frame Profiler (us) ---");
+    out.printf("Budget: %lu us/frame, CPU: %lu MHz, window: last %u samples\n",
+               (unsigned long)FRAME_BUDGET_US, (unsigned long)getCpuFrequencyMhz(), (unsigned)PHASE_SAMPLE_COUNT);
+    out.printf("Frames: %lu, Ticks: %lu, Dropped ticks: %lu (%lu clamps), Catch-up frames: %lu, Since: %lu ms\n",
+               _framesRecorded, _ticksProcessed, _ticksDropped, _clampEvents, _catchUpFrames, millis() - _startMillis);
+    out.println("Phases:");
+    for (uint8_t p = 0; p < PHASE_COUNT; ++p) {
+        printStatsLine(out, phaseToString((Phase)p), _phases[p].compute(), _phases[p].overBudget);
+    }
+    out.println("Frame time by scene:");
+    for (size_t i = 0; i < _sceneCount; ++i) {
+        printStatsLine(out, _scenes[i].name, _scenes[i].frames.compute(), _scenes[i].frames.overBudget);
+    }
+    out.println("Frame time by primary weather:");
+    for (size_t w = 0; w < WEATHER_SLOT_COUNT; ++w) {
+        if (_weathers[w].count == 0) continue;
+        printStatsLine(out, WeatherManager::weatherTypeToString((WeatherType)w), _weathers[w].compute(), _weathers[w].overBudget);
+    }
+    out.println("--- End Frame Profiler ---");
+}
+
+void FrameProfiler::appendJsonStats(String& json, const Stats& stats, uint32_t overBudget) {
+    json += "{\"n\":" + String(stats.count);
+    json += ",\"min\":" + String(stats.minUs);
+    json += ",\"avg\":" + String(stats.avgUs);
+    json += ",\"p99\":" + String(stats.p99Us);
+    json += ",\"max\":" + String(stats.maxUs);
+    json += ",\"over\":" + String(overBudget) + "}";
+}
+
+String FrameProfiler::toJson() const {
+    String json = "{";
+    json += "\"budget_us\":" + String(FRAME_BUDGET_US) + ",";
+    json += "\"cpu_mhz\":" + String(getCpuFrequencyMhz()) + ",";
+    json += "\"frames\":" + String(_framesRecorded) + ",";
+    json += "\"ticks\":" + String(_ticksProcessed) + ",";
+    json += "\"dropped_ticks\":" + String(_ticksDropped) + ",";
+    json += "\"clamp_events\":" + String(_clampEvents) + ",";
+    json += "\"catch_up_frames\":" + String(_catchUpFrames) + ",";
+
+    json += "\"phases\":{";
+    for (uint8_t p = 0; p < PHASE_COUNT; ++p) {
+        if (p > 0) json += ",";
+        json += "\"" + String(phaseToString((Phase)p)) + "\":";
+        appendJsonStats(json, _phases[p].compute(), _phases[p].overBudget);
+    }
+    json += "},\"scenes\":{";
+    for (size_t i = 0; i < _sceneCount; ++i) {
+        if (i > 0) json += ",";
+        json += "\"" + String(_scenes[i].name) + "\":";
+        appendJsonStats(json, _scenes[i].frames.compute(), _scenes[i].frames.overBudget);
+    }
+    json += "},\"weather\":{";
+    bool first = true;
+    for (size_t w = 0; w < WEATHER_SLOT_COUNT; ++w) {
+        if (_weathers[w].count == 0) continue;
+        if (!first) json += ",";
+        first = false;
+        json += "\"" + String(WeatherManager::weatherTypeToString((WeatherType)w)) + "\":";
+        appendJsonStats(json, _weathers[w].compute(), _weathers[w].overBudget);
+    }
+    json += "}}";
+    return json;
+}
@@ -0,0 +1,128 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "../Weather/WeatherTypes.h"
+
+// Forward declarations
+class SerialForwarder;
+class AsyncWebServer;
+class Scene;
+class SceneManager;
+
+// Low-overhead timing of the main loop phases.
+// Every sample is a microsecond delta stored in a fixed-size ring buffer, so
+// recording never allocates. Samples saturate at 65535 us, which is already
+// two full frame budgets. Statistics (min/avg/p99/max) are only computed
+// when a report is requested, via the 'perf_stats' command or GET /perf.
+class FrameProfiler {
+public:
+    enum Phase : uint8_t {
+        PHASE_UPDATE = 0,   // One engine->update() tick
+        PHASE_DRAW,         // engine->draw(), including the display flush
+        PHASE_EFFECTS,      // Weather effects' drawBackground() + drawForeground(), part of draw
+        PHASE_STREAM,       // screenStreamer->streamFrame()
+        PHASE_PERIODIC,     // periodicTaskManager->update()
+        PHASE_SERIAL,       // flushWebSerial()
+        PHASE_FRAME,        // All ticks + draw + stream of one rendered frame
+        PHASE_COUNT
+    };
+
+    static const size_t PHASE_SAMPLE_COUNT = 128;
+    static const size_t SLOT_SAMPLE_COUNT = 64;
+    static const size_t MAX_TRACKED_SCENES = 16;
+    static const size_t SCENE_NAME_LEN = 28;
+    static const size_t WEATHER_SLOT_COUNT = (size_t)WeatherType::UNKNOWN + 1;
+    static const uint32_t FRAME_BUDGET_US = 33333; // One 30 Hz tick
+
+    struct Stats {
+        uint32_t count = 0;
+        uint32_t minUs = 0;
+        uint32_t avgUs = 0;
+        uint32_t p99Us = 0;
+        uint32_t maxUs = 0;
+    };
+
+    FrameProfiler();
+
+    void init(AsyncWebServer* server); // Registers GET /perf
+    void reset();
+
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool isEnabled() const { return _enabled; }
+
+    // Host builds read a monotonic clock instead: the simulator's
+    // esp_timer_get_time() is virtual and does not advance while code runs.
+    static inline uint32_t nowMicros() {
+#ifdef TAMA_HOST_SIM
+        return hostMicros();
+#else
+        return (uint32_t)esp_timer_get_time();
+#endif
+    }
+
+    // Main loop hooks. Frames are attributed to the scene that drew them;
+    // its name is only looked up again after a scene change.
+    void beginFrame(SceneManager& sceneManager, unsigned long ticksDue, unsigned long ticksProcessed);
+    void record(Phase phase, uint32_t elapsedUs);
+    void endFrame(SceneManager& sceneManager, WeatherType weather, uint32_t frameUs);
+
+    Stats getPhaseStats(Phase phase) const;
+    static const char* phaseToString(Phase phase);
+
+    void printReport(SerialForwarder& out) const;
+    String toJson() const;
+
+private:
+    template <size_t N>
+    struct SampleRing {
+        uint16_t samples[N];
+        uint16_t head = 0;
+        uint16_t count = 0;
+        uint32_t overBudget = 0;
+
+        void push(uint32_t value) {
+            samples[head] = value > 0xFFFF ? 0xFFFF : (uint16_t)value;
+            head = (uint16_t)((head + 1) % N);
+            if (count < N) count++;
+            if (value > FRAME_BUDGET_US) overBudget++;
+        }
+        void clear() { head = 0; count = 0; overBudget = 0; }
+        Stats compute() const { return computeStats(samples, count); }
+    };
+    using PhaseRing = SampleRing<PHASE_SAMPLE_COUNT>;
+    using SlotRing = SampleRing<SLOT_SAMPLE_COUNT>;
+
+    struct SceneSlot {
+        char name[SCENE_NAME_LEN];
+        SlotRing frames;
+    };
+
+    bool _enabled = true;
+    PhaseRing _phases[PHASE_COUNT];
+    SceneSlot _scenes[MAX_TRACKED_SCENES];
+    size_t _sceneCount = 0;
+    SlotRing _weathers[WEATHER_SLOT_COUNT];
+
+    Scene* _lastScene = nullptr;
+    bool _sceneChangePending = true;
+    int _currentSceneSlot = -1;
+
+    unsigned long _framesRecorded = 0;
+    unsigned long _ticksProcessed = 0;
+    unsigned long _ticksDropped = 0;    // Ticks deferred by the catch-up clamp
+    unsigned long _clampEvents = 0;     // Frames where the clamp kicked in
+    unsigned long _catchUpFrames = 0;   // Frames that ran more than one tick
+    unsigned long _startMillis = 0;
+
+    int findOrAddScene(const String& sceneName);
+    static Stats computeStats(const uint16_t* samples, size_t count);
+    static void printStatsLine(SerialForwarder& out, const char* label, const Stats& stats, uint32_t overBudget);
+    static void appendJsonStats(String& json, const Stats& stats, uint32_t overBudget);
+#ifdef TAMA_HOST_SIM
+    static uint32_t hostMicros();
+#endif
+};
+
+#endif // FRAME_PROFILER_H
@@ -18,9 +18,12 @@ class DeepSleepController;
 class PeriodicTaskManager;
 class HardwareInputController;
 class PathGenerator;
+class PathWorker;
 class Preferences; 
 class U8G2;
 class PrequelManager;      
+class FrameProfiler;
+class DirtyTileTracker;
 
 struct GameContext {
     GameStats* gameStats = nullptr;
@@ -36,11 +39,14 @@ struct GameContext {
     DeepSleepController* deepSleepController = nullptr;
     PeriodicTaskManager* periodicTaskManager = nullptr;
     HardwareInputController* hardwareInputController = nullptr; 
-    PathGenerator* pathGenerator = nullptr;
+    PathGenerator* pathGenerator = nullptr; // The path worker's
+    PathWorker* pathWorker = nullptr;
     Preferences* preferences = nullptr; 
     U8G2* display = nullptr;          
     const uint8_t* defaultFont = nullptr; 
     PrequelManager* prequelManager = nullptr;
+    FrameProfiler* frameProfiler = nullptr;
+    DirtyTileTracker* dirtyTiles = nullptr;
     WakeUpInfo lastWakeUpInfo;
 
     GameContext() = default;
@@ -1,6 +1,6 @@
 #include "PeriodicTaskManager.h"
 #include "GameStats.h"
-#include "character/CharacterManager.h"
+#include "Character/CharacterManager.h"
 #include "SerialForwarder.h"
 #include <algorithm> 
 #include "../System/GameContext.h" // <<< NEW INCLUDE
@@ -1,14 +1,23 @@
 #include "ScreenStreamer.h"
 #include <memory>
-#include <vector>
 #include "esp_event.h"
 #include "espasyncbutton.hpp"
 #include "GlobalMappings.h"
+#include "Crc32.h"
+#include "FrameCodec.h"
+#include "FrameProfiler.h"
+
+const uint8_t ScreenStreamer::RATE_LEVEL_FPS[ScreenStreamer::RATE_LEVEL_COUNT] = {30, 15, 10, 5};
+
+// Ticks arrive every 33.3 ms, so an interval of n ticks may measure a
+// millisecond or two short.
+static const unsigned long FRAME_INTERVAL_SLACK_MS = 3;
 
 ScreenStreamer::ScreenStreamer(U8G2* u8g2, AsyncWebServer* server, bool flip180, bool useCompression, bool useDeltaFrames, int batchSize)
     : _u8g2_ptr(u8g2), _server(server), _ws(nullptr), _flip180(flip180), _useCompression(useCompression), _useDeltaFrames(useDeltaFrames), _batchSize(batchSize),
       _lastFrameTime(0), _frameInterval(33), // Default to ~30 FPS
-      _lastFullFrameTime(0), _fullFrameInterval(10000) // 10 seconds
+      _lastFullFrameTime(0), _fullFrameInterval(10000), // 10 seconds
+      _activeBatchSize(batchSize)
 {
     if (!_u8g2_ptr || !_server) {
         debugPrint("U8G2_WEBSTREAM", "ERROR: ScreenStreamer requires valid U8G2 and WebServer pointers!");
@@ -27,7 +36,7 @@ ScreenStreamer::~ScreenStreamer() {
 }
 
 void ScreenStreamer::allocateBuffers() {
-    if (_processBuffer) {
+    if (_previousBuffer) {
         debugPrint("U8G2_WEBSTREAM", "allocateBuffers called, but buffers already exist. Ignoring.");
         return;
     }
@@ -39,13 +48,12 @@ void ScreenStreamer::allocateBuffers() {
         _useDeltaFrames = false;
         size_t batchBufferSizeBytes = bufferSize * _batchSize;
         
-        // Use a more conservative size for the compression buffer (e.g., 120% of raw size)
-        _processBufferCapacity = (size_t)(batchBufferSizeBytes * 1.2);
-        if (_processBufferCapacity < 2048) _processBufferCapacity = 2048; // Ensure a minimum reasonable size
-
-        _processBuffer.reset(new (std::nothrow) uint8_t[_processBufferCapacity]);
-        if (!_processBuffer) {
-            debugPrint("U8G2_WEBSTREAM", "FATAL: Failed to allocate _processBuffer!");
+        // Packets are assembled in place: header, then the raw frames or a
+        // codec's output, which is only used if it is smaller.
+        _packetCapacity = BATCH_HEADER_SIZE + batchBufferSizeBytes;
+        _batchScratch = allocatePacketBuffer();
+        if (!_batchScratch || acquirePacketSlot() < 0) {
+            debugPrint("U8G2_WEBSTREAM", "FATAL: Failed to allocate a batch packet buffer!");
             deallocateBuffers();
             return;
         }
@@ -56,15 +64,27 @@ void ScreenStreamer::allocateBuffers() {
             deallocateBuffers();
             return;
         }
-        debugPrintf("U8G2_WEBSTREAM", "Batching enabled. Batch buffer: %u bytes, Process buffer: %u bytes", batchBufferSizeBytes, _processBufferCapacity);
+        debugPrintf("U8G2_WEBSTREAM", "Batching enabled. Batch buffer: %u bytes, Packet buffer: %u bytes", batchBufferSizeBytes, _packetCapacity);
     } else {
-        _processBufferCapacity = bufferSize * 2 + 1; // For single frames, worst-case is still needed
+        // Best and trial encodes side by side (header byte + up to one raw frame
+        // each), so codecs can be compared without allocating. The winner is
+        // copied into a pooled packet of the same size.
+        _processBufferCapacity = (bufferSize + 1) * 2;
+        _packetCapacity = 1 + bufferSize;
         _processBuffer.reset(new (std::nothrow) uint8_t[_processBufferCapacity]);
         if (!_processBuffer) {
             debugPrint("U8G2_WEBSTREAM", "FATAL: Failed to allocate _processBuffer (non-batch)!");
             deallocateBuffers();
             return;
         }
+        for (uint8_t i = 0; i < PACKET_POOL_SIZE; ++i) {
+            _packetPool[i] = allocatePacketBuffer();
+            if (!_packetPool[i]) {
+                debugPrint("U8G2_WEBSTREAM", "FATAL: Failed to allocate a frame packet buffer!");
+                deallocateBuffers();
+                return;
+            }
+        }
         debugPrint("U8G2_WEBSTREAM", "Processing buffer allocated for single frames.");
     }
     
@@ -86,10 +106,22 @@ void ScreenStreamer::allocateBuffers() {
     }
     memset(_previousBuffer.get(), 0, bufferSize);
     debugPrint("U8G2_WEBSTREAM", "Previous frame buffer allocated.");
+
+    // Every session starts at full rate and re-learns the link.
+    setRateLevel(0);
+    _healthyPeriods = 0;
+    _periodFrames = 0;
+    _periodBlockedFrames = 0;
+    _lastRateControlTime = millis();
+    _lastFullFrameTime = millis();
+    portENTER_CRITICAL(&_rttMux);
+    _bestRttMs = UINT32_MAX;
+    _pongSeen = false;
+    portEXIT_CRITICAL(&_rttMux);
 }
 
 void ScreenStreamer::deallocateBuffers() {
-    if (!_processBuffer && !_previousBuffer) {
+    if (!_previousBuffer) {
         debugPrint("U8G2_WEBSTREAM", "deallocateBuffers called, but no buffers to free. Ignoring.");
         return;
     }
@@ -100,6 +132,11 @@ void ScreenStreamer::deallocateBuffers() {
     _previousBuffer.reset();
     _batchBuffer.reset();
     _processBufferCapacity = 0; // Reset capacity
+    // Packets still queued in AsyncWebSocket keep their buffer alive until sent.
+    for (uint8_t i = 0; i < PACKET_POOL_SIZE; ++i) _packetPool[i].reset();
+    _batchScratch.reset();
+    _currentBatchFrameCount = 0; // Frames of a partial batch went with _batchBuffer
+    _batchCrc = 0;
 }
 
 void ScreenStreamer::init() {
@@ -134,7 +171,6 @@ void ScreenStreamer::onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * c
         if (_ws->count() == 1) { // First client
             allocateBuffers();
         }
-        _force_next_frame_stream = true;
     } else if (type == WS_EVT_DISCONNECT) {
         debugPrintf("U8G2_WEBSTREAM", "WebSocket client #%u disconnected\n", client->id());
         if (_ws->count() == 0) { // Last client
@@ -148,6 +184,13 @@ void ScreenStreamer::onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * c
 
             if (message.equals("ping")) {
                 client->text("pong");
+            } else if (message.startsWith("pong:")) {
+                // Echo of our "ping:<millis>", queued behind the frames sent meanwhile.
+                uint32_t rttMs = (uint32_t)(millis() - strtoul(message.c_str() + 5, nullptr, 10));
+                portENTER_CRITICAL(&_rttMux);
+                if (rttMs < _bestRttMs) _bestRttMs = rttMs;
+                _pongSeen = true;
+                portEXIT_CRITICAL(&_rttMux);
             } else if (message.startsWith("BTN_EVENT:")) {
                 String pinStr = "";
                 String typeStr = "";
@@ -193,244 +236,447 @@ void ScreenStreamer::onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * c
     }
 }
 
+// Bit-reversed byte values: a 180 degree turn mirrors every 8-pixel column of a page.
+static const uint8_t BIT_REVERSE_TABLE[256] = {
+    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+    0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+    0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+    0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+    0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+    0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+    0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+    0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+    0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+    0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+    0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+    0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+    0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+    0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+    0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+    0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
+};
+
+// In the SSD1306 page layout a 180 degree rotation moves byte i to
+// (size - 1 - i) with its bits reversed, so the whole frame is one pass over
+// the buffer, four bytes per iteration.
 void ScreenStreamer::flipBuffer180(const uint8_t* src, uint8_t* dest, int width, int height) {
     if (!dest) {
         debugPrint("U8G2_WEBSTREAM", "flipBuffer180 error: destination buffer is null.");
         return;
     }
-    int buffer_size = (width * height) / 8;
-    memset(dest, 0, buffer_size);
-
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int src_byte_index = (y / 8) * width + x;
-            int src_bit_mask = 1 << (y % 8);
-            if ((src[src_byte_index] & src_bit_mask) != 0) {
-                int dest_x = width - 1 - x;
-                int dest_y = height - 1 - y;
-                int dest_byte_index = (dest_y / 8) * width + dest_x;
-                int dest_bit_mask = 1 << (dest_y % 8);
-                dest[dest_byte_index] |= dest_bit_mask;
+    size_t buffer_size = (size_t)(width * height) / 8;
+
+    if (height % 8 != 0) {
+        // Partial last page: the byte mapping above does not hold.
+        memset(dest, 0, buffer_size);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                if (src[(y / 8) * width + x] & (1 << (y % 8))) {
+                    int dest_y = height - 1 - y;
+                    dest[(dest_y / 8) * width + (width - 1 - x)] |= (1 << (dest_y % 8));
+                }
             }
         }
+        return;
+    }
+
+    size_t i = 0;
+    for (; i + 4 <= buffer_size; i += 4) {
+        uint32_t word;
+        memcpy(&word, src + i, 4);
+        // Reversing 4 bytes in place: the last source byte becomes the first destination byte.
+        uint32_t flipped = ((uint32_t)BIT_REVERSE_TABLE[word & 0xFF] << 24) |
+                           ((uint32_t)BIT_REVERSE_TABLE[(word >> 8) & 0xFF] << 16) |
+                           ((uint32_t)BIT_REVERSE_TABLE[(word >> 16) & 0xFF] << 8) |
+                           (uint32_t)BIT_REVERSE_TABLE[word >> 24];
+        memcpy(dest + buffer_size - 4 - i, &flipped, 4);
+    }
+    for (; i < buffer_size; i++) {
+        dest[buffer_size - 1 - i] = BIT_REVERSE_TABLE[src[i]];
     }
 }
 
-size_t ScreenStreamer::compressRLE(const uint8_t* src, size_t srcLen, uint8_t* dest, size_t destLen) {
-    size_t destIndex = 0;
-    for (size_t i = 0; i < srcLen; ) {
-        uint8_t currentByte = src[i];
-        uint8_t runCount = 1;
-        while (i + runCount < srcLen && src[i + runCount] == currentByte && runCount < 255) {
-            runCount++;
-        }
-        
-        if (destIndex + 2 > destLen) {
-            // Not enough space in destination buffer for this run
-            return 0; // Indicate failure
-        }
+bool ScreenStreamer::isCodecEnabled(const FrameCodec* codec) const {
+    // Codecs that refer to the previous frame are delta coding, the others compression.
+    return codec->usesPrevious() ? _useDeltaFrames : _useCompression;
+}
 
-        dest[destIndex++] = runCount;
-        dest[destIndex++] = currentByte;
-        i += runCount;
+// Tries every enabled single-frame codec that matches `previous` (a delta
+// codec if it is set, a keyframe codec if not) and keeps the smallest packet
+// below sizeToBeat in `best`, with its header byte. Trial encodes go to
+// `scratch`; the two pointers are swapped whenever a codec wins. Returns 0
+// if no codec beat sizeToBeat.
+size_t ScreenStreamer::encodeFrame(const uint8_t* source, const uint8_t* previous, size_t sizeToBeat, uint8_t*& best, uint8_t*& scratch) {
+    size_t frameSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
+    size_t bestSize = 0;
+    size_t codecCount = 0;
+    const FrameCodec* const* codecs = FrameCodec::all(codecCount);
+
+    for (size_t i = 0; i < codecCount && sizeToBeat > 2; ++i) {
+        const FrameCodec* codec = codecs[i];
+        if (codec->usesPrevious() != (previous != nullptr) || !isCodecEnabled(codec)) continue;
+        size_t size = codec->encode(source, 1, frameSize, previous, scratch + 1, sizeToBeat - 2);
+        if (size == 0) continue;
+        scratch[0] = codec->frameHeader();
+        std::swap(best, scratch);
+        bestSize = sizeToBeat = size + 1;
+    }
+    return bestSize;
+}
+
+const uint8_t* ScreenStreamer::currentFrameBuffer() {
+    if (_flip180) {
+        flipBuffer180(_u8g2_ptr->getBufferPtr(), _flipBuffer.get(), _u8g2_ptr->getDisplayWidth(), _u8g2_ptr->getDisplayHeight());
+        return _flipBuffer.get();
     }
-    return destIndex;
+    return _u8g2_ptr->getBufferPtr();
 }
 
-// Simple CRC32 implementation
-uint32_t ScreenStreamer::crc32(const uint8_t *data, size_t length) {
-    uint32_t crc = 0xffffffff;
-    while (length--) {
-        uint8_t byte = *data++;
-        crc = crc ^ byte;
-        for (int j = 0; j < 8; j++) {
-            uint32_t mask = -(crc & 1);
-            crc = (crc >> 1) ^ (0xedb88320 & mask);
+bool ScreenStreamer::isClientReady(const AsyncWebSocketClient& client) {
+    // One message in flight per client: a client still draining its queue
+    // skips frames instead of holding back the others.
+    return client.status() == WS_CONNECTED && client.queueLen() == 0;
+}
+
+ScreenStreamer::ViewerClient* ScreenStreamer::findViewerClient(uint32_t id) {
+    for (uint8_t i = 0; i < MAX_VIEWER_CLIENTS; ++i) {
+        if (_viewers[i].inUse && _viewers[i].id == id) return &_viewers[i];
+    }
+    return nullptr;
+}
+
+// Brings the viewer table in line with the socket's client list. Runs on the
+// loop task only, so onWsEvent() never touches per-client state.
+void ScreenStreamer::updateViewerClients(uint8_t& readyCount, uint8_t& readyUnsyncedCount) {
+    readyCount = 0;
+    readyUnsyncedCount = 0;
+    for (uint8_t i = 0; i < MAX_VIEWER_CLIENTS; ++i) _viewers[i].seen = false;
+
+    for (const AsyncWebSocketClient& client : _ws->getClients()) {
+        if (client.status() != WS_CONNECTED) continue;
+        ViewerClient* viewer = findViewerClient(client.id());
+        if (!viewer) {
+            for (uint8_t i = 0; i < MAX_VIEWER_CLIENTS; ++i) {
+                if (!_viewers[i].inUse) {
+                    viewer = &_viewers[i];
+                    *viewer = ViewerClient();
+                    viewer->id = client.id();
+                    viewer->inUse = true; // Starts unsynced: first frame is a keyframe
+                    break;
+                }
+            }
+            if (!viewer) continue; // Table full, client gets nothing
+        }
+        viewer->seen = true;
+        if (isClientReady(client)) {
+            readyCount++;
+            if (!viewer->synced) readyUnsyncedCount++;
         }
     }
-    return ~crc;
+
+    for (uint8_t i = 0; i < MAX_VIEWER_CLIENTS; ++i) {
+        ViewerClient& viewer = _viewers[i];
+        if (!viewer.inUse || viewer.seen) continue;
+        debugPrintf("U8G2_WEBSTREAM", "Viewer #%u gone: %u frames sent (%u keyframes), %u skipped while busy\n",
+                    viewer.id, viewer.framesSent, viewer.keyframesSent, viewer.framesSkipped);
+        viewer.inUse = false;
+    }
 }
 
-void ScreenStreamer::sendFullFrame() {
-    const uint8_t* sourceBuffer = _u8g2_ptr->getBufferPtr();
-    size_t sourceBufferSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
+void ScreenStreamer::sendToClient(AsyncWebSocketClient& client, ViewerClient& viewer, const AsyncWebSocketSharedBuffer& packet, bool isKeyframe) {
+    client.binary(packet);
+    viewer.synced = true;
+    viewer.framesSent++;
+    if (isKeyframe) viewer.keyframesSent++;
+}
 
-    if (_flip180) {
-        flipBuffer180(_u8g2_ptr->getBufferPtr(), _flipBuffer.get(), _u8g2_ptr->getDisplayWidth(), _u8g2_ptr->getDisplayHeight());
-        sourceBuffer = _flipBuffer.get();
+// Returns a pooled packet holding `size` bytes of `data`, or null if every
+// packet buffer is still queued.
+AsyncWebSocketSharedBuffer ScreenStreamer::pooledPacket(const uint8_t* data, size_t size) {
+    int slot = acquirePacketSlot();
+    if (slot < 0) return nullptr;
+    AsyncWebSocketSharedBuffer packet = _packetPool[slot];
+    memcpy(packet->data(), data, size);
+    packet->resize(size); // Shrinking keeps the allocation
+    return packet;
+}
+
+// Fans the current frame out per client. Clients holding the previous frame
+// get a delta; clients that skipped frames, or that a delta cannot serve,
+// get a keyframe to resynchronise; busy clients are skipped. Each encoding
+// is only made if a ready client needs it.
+void ScreenStreamer::sendFrame(const uint8_t* sourceBuffer, bool isDirty, bool anySyncedReady, bool anyUnsyncedReady) {
+    size_t sourceBufferSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
+    uint8_t* best = _processBuffer.get();
+    uint8_t* scratch = _processBuffer.get() + sourceBufferSize + 1;
+
+    // Each payload is copied once into a pooled buffer AsyncWebSocket shares
+    // with us, and that buffer goes to every client receiving it. Without a
+    // free buffer the payload stays null and its clients are resynced later.
+    AsyncWebSocketSharedBuffer deltaPacket;
+    AsyncWebSocketSharedBuffer fullPacket;
+
+    // Delta: only kept if it beats a raw keyframe.
+    if (isDirty && anySyncedReady) {
+        size_t deltaSize = encodeFrame(sourceBuffer, _previousBuffer.get(), 1 + sourceBufferSize, best, scratch);
+        if (deltaSize > 0) deltaPacket = pooledPacket(best, deltaSize);
     }
 
-    uint8_t* payload = _processBuffer.get();
-    size_t payloadSize = 0;
+    // Keyframe: best codec that does not need the previous frame, or raw.
+    if (anyUnsyncedReady || (isDirty && anySyncedReady && !deltaPacket)) {
+        size_t fullSize = encodeFrame(sourceBuffer, nullptr, 1 + sourceBufferSize, best, scratch);
+        if (fullSize == 0) {
+            best[0] = 'U';
+            memcpy(best + 1, sourceBuffer, sourceBufferSize);
+            fullSize = 1 + sourceBufferSize;
+        }
+        fullPacket = pooledPacket(best, fullSize);
+        // Made anyway for the unsynced clients: synced ones take whichever is smaller.
+        if (deltaPacket && fullPacket && fullPacket->size() <= deltaPacket->size()) deltaPacket.reset();
+    }
 
-    if (_useCompression) {
-        size_t compressedSize = compressRLE(sourceBuffer, sourceBufferSize, payload + 1, _processBufferCapacity - 1);
-        if (compressedSize > 0) { // Failure returns 0
-            payload[0] = 'C';
-            payloadSize = 1 + compressedSize;
-        } else {
-            payload[0] = 'U';
-            memcpy(payload + 1, sourceBuffer, sourceBufferSize);
-            payloadSize = 1 + sourceBufferSize;
-            debugPrint("U8G2_WEBSTREAM", "RLE compression failed for full frame, sending uncompressed.");
+    for (AsyncWebSocketClient& client : _ws->getClients()) {
+        ViewerClient* viewer = findViewerClient(client.id());
+        if (!viewer || client.status() != WS_CONNECTED) continue;
+        if (!isClientReady(client)) {
+            if (isDirty) {
+                viewer->synced = false;
+                viewer->framesSkipped++;
+            }
+            continue;
+        }
+        if (viewer->synced) {
+            if (!isDirty) continue; // Already showing this frame
+            if (deltaPacket) {
+                sendToClient(client, *viewer, deltaPacket, false);
+                continue;
+            }
+        }
+        if (fullPacket) {
+            sendToClient(client, *viewer, fullPacket, !viewer->synced);
+        } else if (viewer->synced) {
+            viewer->synced = false; // Misses this frame; resynced by a keyframe
+            viewer->framesSkipped++;
         }
-    } else {
-        payload[0] = 'U';
-        memcpy(payload + 1, sourceBuffer, sourceBufferSize);
-        payloadSize = 1 + sourceBufferSize;
     }
-    
-    _ws->binaryAll(payload, payloadSize);
     memcpy(_previousBuffer.get(), sourceBuffer, sourceBufferSize);
 }
 
-void ScreenStreamer::sendDeltaFrame() {
-    const uint8_t* sourceBuffer = _u8g2_ptr->getBufferPtr();
-    size_t sourceBufferSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
+void ScreenStreamer::setRateLevel(uint8_t level) {
+    _rateLevel = level;
+    _frameInterval = 1000 / RATE_LEVEL_FPS[level];
+    if (_batchSize > 1) {
+        int batchSize = _batchSize * RATE_LEVEL_FPS[level] / RATE_LEVEL_FPS[0];
+        _activeBatchSize = batchSize < 2 ? 2 : batchSize;
+    }
+}
 
-    if (_flip180) {
-        flipBuffer180(_u8g2_ptr->getBufferPtr(), _flipBuffer.get(), _u8g2_ptr->getDisplayWidth(), _u8g2_ptr->getDisplayHeight());
-        sourceBuffer = _flipBuffer.get();
+// Runs once per control period: rates the period that just ended, moves the
+// stream rate by at most one level and sends the next round-trip probe.
+void ScreenStreamer::updateStreamRate(unsigned long now) {
+    if (now - _lastRateControlTime < RATE_CONTROL_PERIOD_MS) return;
+    _lastRateControlTime = now;
+
+    portENTER_CRITICAL(&_rttMux);
+    uint32_t rttMs = _bestRttMs;
+    bool pongSeen = _pongSeen;
+    _bestRttMs = UINT32_MAX;
+    portEXIT_CRITICAL(&_rttMux);
+    if (rttMs == UINT32_MAX) {
+        // No answer within a whole period counts as a slow link, unless the
+        // viewer never answers pings (then the round trip is not used).
+        rttMs = pongSeen ? RATE_CONTROL_PERIOD_MS : 0;
     }
 
-    std::vector<uint8_t> deltaPayload;
-    for (size_t i = 0; i < sourceBufferSize; ++i) {
-        if (sourceBuffer[i] != _previousBuffer.get()[i]) {
-            deltaPayload.push_back(i >> 8);
-            deltaPayload.push_back(i & 0xFF);
-            deltaPayload.push_back(sourceBuffer[i]);
+    uint32_t blockedPercent = _periodFrames ? (uint32_t)_periodBlockedFrames * 100 / _periodFrames : 0;
+    uint32_t loadPercent = 0;
+    if (_frameProfiler) {
+        loadPercent = _frameProfiler->getPhaseStats(FrameProfiler::PHASE_FRAME).avgUs * 100 / FrameProfiler::FRAME_BUDGET_US;
+    }
+    _periodFrames = 0;
+    _periodBlockedFrames = 0;
+
+    bool congested = rttMs > RTT_CONGESTED_MS || blockedPercent > BLOCKED_CONGESTED_PERCENT || loadPercent > LOAD_CONGESTED_PERCENT;
+    bool healthy = rttMs < RTT_HEALTHY_MS && blockedPercent < BLOCKED_HEALTHY_PERCENT && loadPercent < LOAD_HEALTHY_PERCENT;
+    uint8_t level = _rateLevel;
+    if (congested) {
+        _healthyPeriods = 0;
+        if (level + 1 < RATE_LEVEL_COUNT) level++;
+    } else if (healthy) {
+        if (++_healthyPeriods >= RATE_RECOVERY_PERIODS && level > 0) {
+            level--;
+            _healthyPeriods = 0;
         }
+    } else {
+        _healthyPeriods = 0;
+    }
+    if (level != _rateLevel) {
+        setRateLevel(level);
+        debugPrintf("U8G2_WEBSTREAM", "Stream rate %u FPS (batch %d): rtt %u ms, %u%% blocked, loop load %u%%\n",
+                    RATE_LEVEL_FPS[_rateLevel], _activeBatchSize, rttMs, blockedPercent, loadPercent);
     }
 
-    if (!deltaPayload.empty()) {
-        uint8_t* payload = _processBuffer.get();
-        payload[0] = 'D';
-        memcpy(payload + 1, deltaPayload.data(), deltaPayload.size());
-        size_t payloadSize = 1 + deltaPayload.size();
+    String ping = "ping:" + String(now);
+    for (AsyncWebSocketClient& client : _ws->getClients()) {
+        if (client.status() == WS_CONNECTED) client.text(ping);
+    }
+}
 
-        _ws->binaryAll(payload, payloadSize);
-        memcpy(_previousBuffer.get(), sourceBuffer, sourceBufferSize);
+// Returns the index of a pooled packet buffer nobody else references any
+// more, sized to _packetCapacity, or -1 if every buffer is still queued.
+int ScreenStreamer::acquirePacketSlot() {
+    for (uint8_t i = 0; i < PACKET_POOL_SIZE; ++i) {
+        AsyncWebSocketSharedBuffer& slot = _packetPool[i];
+        if (!slot) {
+            slot = allocatePacketBuffer();
+            if (!slot) return -1;
+        }
+        if (slot.use_count() == 1) {
+            slot->resize(_packetCapacity); // Within capacity: no reallocation
+            return i;
+        }
     }
+    return -1;
+}
+
+AsyncWebSocketSharedBuffer ScreenStreamer::allocatePacketBuffer() {
+    // Same headroom check as a failed makeBuffer(): vectors cannot report OOM.
+    if (ESP.getMaxAllocHeap() < _packetCapacity) return nullptr;
+    AsyncWebSocketSharedBuffer buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(_packetCapacity);
+    return buffer;
 }
 
-void ScreenStreamer::sendBatchFrame() {
+bool ScreenStreamer::sendBatchFrame() {
     size_t frameSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
     size_t batchDataSize = frameSize * _currentBatchFrameCount;
-    bool isCompressed = false;
 
-    size_t dataToSendSize = 0;
-    uint8_t* dataToSendPtr = nullptr;
-    
+    int slot = acquirePacketSlot();
+    if (slot < 0) {
+        return false; // Every packet buffer is still queued; retry next frame
+    }
+
+    // Data is written straight after the reserved header. Each batch codec
+    // encodes into the scratch buffer and the two are swapped when it beats
+    // the best so far; raw frames are the baseline.
+    size_t dataSize = batchDataSize;
+    uint8_t batchMode = 0;
     if (_useCompression) {
-        size_t compressedSize = compressRLE(_batchBuffer.get(), batchDataSize, _processBuffer.get(), _processBufferCapacity);
-        if (compressedSize > 0) { // compressRLE returns 0 on failure/overflow
-            dataToSendSize = compressedSize;
-            dataToSendPtr = _processBuffer.get();
-            isCompressed = true;
-        } else {
-            // Compression failed or result would overflow. Send uncompressed.
-            dataToSendSize = batchDataSize;
-            dataToSendPtr = _batchBuffer.get();
-            isCompressed = false;
-            debugPrint("U8G2_WEBSTREAM", "RLE compression overflowed or failed, sending uncompressed batch.");
+        size_t codecCount = 0;
+        const FrameCodec* const* codecs = FrameCodec::all(codecCount);
+        for (size_t i = 0; i < codecCount; ++i) {
+            const FrameCodec* codec = codecs[i];
+            if (codec->batchMode() == 0) continue;
+            _batchScratch->resize(_packetCapacity);
+            size_t size = codec->encode(_batchBuffer.get(), _currentBatchFrameCount, frameSize, nullptr,
+                                        _batchScratch->data() + BATCH_HEADER_SIZE, dataSize - 1);
+            if (size == 0) continue;
+            std::swap(_packetPool[slot], _batchScratch);
+            dataSize = size;
+            batchMode = codec->batchMode();
         }
-    } else {
-        dataToSendSize = batchDataSize;
-        dataToSendPtr = _batchBuffer.get();
-        isCompressed = false;
+    }
+    AsyncWebSocketSharedBuffer packet = _packetPool[slot];
+    uint8_t* packetData = packet->data();
+    if (batchMode == 0) {
+        memcpy(packetData + BATCH_HEADER_SIZE, _batchBuffer.get(), batchDataSize);
     }
 
-    // Calculate CRC on the data that will actually be sent (compressed or not)
-    uint32_t crc = crc32(dataToSendPtr, dataToSendSize);
-
-    // Packet structure: [Header 'B'] [Frame Count] [Target FPS] [IsCompressed] [CRC32] [Data]
-    size_t headerSize = 1 + 1 + 1 + 1 + 4;
-    size_t totalPacketSize = headerSize + dataToSendSize;
-
-    std::unique_ptr<uint8_t[]> finalPacket(new uint8_t[totalPacketSize]);
-    finalPacket[0] = 'B';
-    finalPacket[1] = (uint8_t)_currentBatchFrameCount;
-    finalPacket[2] = (uint8_t)(1000 / _frameInterval); // Target FPS
-    finalPacket[3] = isCompressed ? 1 : 0; // The new compression flag
-    memcpy(&finalPacket[4], &crc, sizeof(crc));
-    memcpy(&finalPacket[headerSize], dataToSendPtr, dataToSendSize);
-
-    _ws->binaryAll(finalPacket.get(), totalPacketSize);
+    // Packet structure: [Header 'B'] [Frame Count] [Target FPS] [Codec] [CRC32] [Data]
+    // The CRC covers the uncompressed frames and was accumulated as they were batched.
+    packetData[0] = 'B';
+    packetData[1] = (uint8_t)_currentBatchFrameCount;
+    packetData[2] = RATE_LEVEL_FPS[_rateLevel]; // Target FPS
+    packetData[3] = batchMode; // 0 raw, else FrameCodec::batchMode()
+    memcpy(&packetData[4], &_batchCrc, sizeof(_batchCrc));
+    packet->resize(BATCH_HEADER_SIZE + dataSize); // Shrinking keeps the allocation
+
+    // Every frame in a batch is complete, so any ready client can take it.
+    for (AsyncWebSocketClient& client : _ws->getClients()) {
+        ViewerClient* viewer = findViewerClient(client.id());
+        if (!viewer || client.status() != WS_CONNECTED) continue;
+        if (isClientReady(client)) {
+            sendToClient(client, *viewer, packet, !viewer->synced);
+        } else {
+            viewer->synced = false;
+            viewer->framesSkipped += _currentBatchFrameCount;
+        }
+    }
 
     // After sending, update the previous buffer with the *last* frame from the batch
     memcpy(_previousBuffer.get(), _batchBuffer.get() + (batchDataSize - frameSize), frameSize);
     _currentBatchFrameCount = 0; // Reset batch
+    _batchCrc = 0;
+    return true;
 }
 
 
 void ScreenStreamer::streamFrame() {
     unsigned long now = millis();
-    if (now - _lastFrameTime < _frameInterval) {
+    if (now - _lastFrameTime + FRAME_INTERVAL_SLACK_MS < _frameInterval) {
         return; 
     }
     _lastFrameTime = now;
 
-    if (!_u8g2_ptr || !_ws || _ws->count() == 0 || !_processBuffer || !_previousBuffer) {
+    if (!_u8g2_ptr || !_ws || _ws->count() == 0 || !_previousBuffer) {
         return;
     }
-    _ws->cleanupClients();
-    
-    // If we are currently sending a frame, check if the send is complete
-    if (_isSending) {
-        bool allQueuesEmpty = true;
-        const std::list<AsyncWebSocketClient>& clients = _ws->getClients();
-        for (const AsyncWebSocketClient& client : clients) {
-            if (client.status() == WS_CONNECTED && client.queueLen() > 0) {
-                allQueuesEmpty = false;
-                break;
-            }
-        }
-        if (allQueuesEmpty) {
-            _isSending = false;
-        } else {
-            return;
-        }
+    _ws->cleanupClients(MAX_VIEWER_CLIENTS);
+    updateStreamRate(now);
+
+    // Batches carry whole frames; single-frame mode resends a keyframe
+    // periodically so a viewer cannot drift on a lost or misapplied delta.
+    if (_batchSize <= 1 && now - _lastFullFrameTime >= _fullFrameInterval) {
+        _lastFullFrameTime = now;
+        for (uint8_t i = 0; i < MAX_VIEWER_CLIENTS; ++i) _viewers[i].synced = false;
+    }
+
+    uint8_t readyCount = 0;
+    uint8_t readyUnsyncedCount = 0;
+    updateViewerClients(readyCount, readyUnsyncedCount);
+    _periodFrames++;
+    if (readyCount == 0) {
+        _periodBlockedFrames++;
+        return; // Every client is still busy with an earlier frame
     }
     
-    // Perform dirty check using memcmp
-    const uint8_t* currentU8G2Buffer = _u8g2_ptr->getBufferPtr();
+    // Dirty check against the last streamed frame, which is stored flipped,
+    // so the current frame has to be flipped before comparing.
+    const uint8_t* sourceBuffer = currentFrameBuffer();
     size_t bufferSize = (_u8g2_ptr->getDisplayWidth() * _u8g2_ptr->getDisplayHeight()) / 8;
-    bool isDirty = (memcmp(currentU8G2Buffer, _previousBuffer.get(), bufferSize) != 0);
+    bool isDirty = (memcmp(sourceBuffer, _previousBuffer.get(), bufferSize) != 0);
 
-    if (!isDirty && !_force_next_frame_stream) {
-        return; // No change, no send
+    if (!isDirty && readyUnsyncedCount == 0) {
+        // No change. Flush a partial batch so the viewer is not left behind
+        // while the screen is static.
+        if (_batchSize > 1 && _currentBatchFrameCount > 0) {
+            sendBatchFrame();
+        }
+        return;
     }
     
     // Handle non-batching mode first
     if (_batchSize <= 1) {
-        if (_force_next_frame_stream || !_useDeltaFrames) {
-            sendFullFrame();
-            _force_next_frame_stream = false;
-            _lastFullFrameTime = now;
-        } else {
-            sendDeltaFrame();
-        }
-        _isSending = true; // Mark as sending
+        sendFrame(sourceBuffer, isDirty, readyCount > readyUnsyncedCount, readyUnsyncedCount > 0);
         return;
     }
 
     // --- Batching Logic ---
-    const uint8_t* sourceBuffer = currentU8G2Buffer;
-    if (_flip180) {
-        flipBuffer180(currentU8G2Buffer, _flipBuffer.get(), _u8g2_ptr->getDisplayWidth(), _u8g2_ptr->getDisplayHeight());
-        sourceBuffer = _flipBuffer.get();
+    if (_currentBatchFrameCount >= _activeBatchSize && !sendBatchFrame()) {
+        return; // Full batch still waiting for a free packet buffer
     }
-    
-    // Add the current dirty frame to the batch
+
+    // Add the current frame to the batch (also when it is only needed as a
+    // keyframe for a client that connected or fell behind).
     memcpy(_batchBuffer.get() + (_currentBatchFrameCount * bufferSize), sourceBuffer, bufferSize);
+    _batchCrc = crc32Update(_batchCrc, sourceBuffer, bufferSize);
     _currentBatchFrameCount++;
 
     // Update the "last drawn" buffer for the next dirty check
     memcpy(_previousBuffer.get(), sourceBuffer, bufferSize);
     
     // If the batch is full, send it
-    if (_currentBatchFrameCount >= _batchSize) {
+    if (_currentBatchFrameCount >= _activeBatchSize) {
         sendBatchFrame();
-        _isSending = true; // Mark as sending
     }
-}
\ No newline at end of file
+}
@@ -4,7 +4,7 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <ESPAsyncWebServer.h>
-#include <atomic>
+#include <freertos/FreeRTOS.h> // portMUX_TYPE
 #include <memory>
 #include "System/ScreenWebPage.h"
 #include "DebugUtils.h"
@@ -12,6 +12,8 @@
 
 // Forward Declaration
 class Renderer;
+class FrameCodec;
+class FrameProfiler;
 
 class ScreenStreamer {
 public:
@@ -21,6 +23,13 @@ public:
     void init();
     void streamFrame();
 
+    // Optional: lets the adaptive stream rate back off when the game loop has
+    // little headroom left.
+    void setFrameProfiler(FrameProfiler* profiler) { _frameProfiler = profiler; }
+
+    // 180 degree rotation of an SSD1306 page-layout buffer (src and dest must not overlap).
+    static void flipBuffer180(const uint8_t* src, uint8_t* dest, int width, int height);
+
 private:
     U8G2* _u8g2_ptr;
     AsyncWebServer* _server;
@@ -33,30 +42,90 @@ private:
     int _batchSize;
 
     // Buffers
-    std::unique_ptr<uint8_t[]> _processBuffer; // Used for compression output/final payload
+    std::unique_ptr<uint8_t[]> _processBuffer; // Single-frame mode: best and trial encodes
     size_t _processBufferCapacity = 0;
     std::unique_ptr<uint8_t[]> _flipBuffer;    // Used for flipping if enabled
     std::unique_ptr<uint8_t[]> _previousBuffer; // Used for dirty checking
     std::unique_ptr<uint8_t[]> _batchBuffer;   // For batching frames
     int _currentBatchFrameCount = 0;          // Counter for frames in batch
+    uint32_t _batchCrc = 0;                   // CRC-32 of the frames batched so far
+
+    // Packets go out in buffers AsyncWebSocket shares with us: batches are
+    // built in place, single frames copied in once. A buffer is reused once
+    // the streamer holds the only reference again, i.e. every client it was
+    // queued for sent it. A single frame can take two (delta and keyframe).
+    static const size_t BATCH_HEADER_SIZE = 1 + 1 + 1 + 1 + 4; // ['B'][count][fps][compressed][crc32]
+    static const uint8_t PACKET_POOL_SIZE = 4;
+    AsyncWebSocketSharedBuffer _packetPool[PACKET_POOL_SIZE];
+    AsyncWebSocketSharedBuffer _batchScratch; // Trial encodes, swapped into the pool when smaller
+    size_t _packetCapacity = 0;
+
+    // Per-client state. Each viewer skips frames on its own while its queue
+    // drains and gets a keyframe once it is ready again.
+    static const uint8_t MAX_VIEWER_CLIENTS = 8;
+    struct ViewerClient {
+        uint32_t id = 0;
+        bool inUse = false;
+        bool seen = false;
+        bool synced = false;         // Holds the frame in _previousBuffer, so deltas apply
+        uint32_t framesSent = 0;
+        uint32_t keyframesSent = 0;
+        uint32_t framesSkipped = 0;
+    };
+    ViewerClient _viewers[MAX_VIEWER_CLIENTS];
 
     // Timers & State
     unsigned long _lastFrameTime;
     unsigned long _frameInterval;
     unsigned long _lastFullFrameTime;
     const unsigned long _fullFrameInterval;
-    std::atomic<bool> _force_next_frame_stream{true};
-    bool _isSending = false;
+
+    // Adaptive stream rate. Once per control period the stream drops one
+    // level when the best viewer's round trip is slow, when no viewer was
+    // ready for most frames or when the game loop is short of time, and
+    // climbs back one level after several healthy periods in a row.
+    static const uint8_t RATE_LEVEL_COUNT = 4;
+    static const uint8_t RATE_LEVEL_FPS[RATE_LEVEL_COUNT]; // Every 1, 2, 3 and 6 game ticks
+    static const unsigned long RATE_CONTROL_PERIOD_MS = 1000;
+    static const uint8_t RATE_RECOVERY_PERIODS = 3;
+    static const uint32_t RTT_CONGESTED_MS = 300;
+    static const uint32_t RTT_HEALTHY_MS = 100;
+    static const uint8_t BLOCKED_CONGESTED_PERCENT = 50; // Frames where no viewer was ready
+    static const uint8_t BLOCKED_HEALTHY_PERCENT = 10;
+    static const uint8_t LOAD_CONGESTED_PERCENT = 85;    // Average frame time vs the 30 Hz budget
+    static const uint8_t LOAD_HEALTHY_PERCENT = 60;
+    uint8_t _rateLevel = 0;
+    uint8_t _healthyPeriods = 0;
+    int _activeBatchSize;                      // Shrinks with the rate so a batch spans about the same time
+    unsigned long _lastRateControlTime = 0;
+    uint16_t _periodFrames = 0;                // streamFrame() runs with viewers this period
+    uint16_t _periodBlockedFrames = 0;         // ... of which no viewer was ready
+    FrameProfiler* _frameProfiler = nullptr;
+
+    // Round trips of "ping:<millis>" / "pong:<millis>", measured on the
+    // socket task, so guarded by a mux. Only the fastest viewer counts: slow
+    // viewers already skip frames on their own.
+    portMUX_TYPE _rttMux = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t _bestRttMs = UINT32_MAX;          // This period
+    bool _pongSeen = false;                    // Viewer answers pings at all
 
     // Methods
     void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len);
     void postVirtualButtonEvent(gpio_num_t pin, ESPButton::event_t eventType);
-    void flipBuffer180(const uint8_t* src, uint8_t* dest, int width, int height);
-    size_t compressRLE(const uint8_t* src, size_t srcLen, uint8_t* dest, size_t destLen);
-    uint32_t crc32(const uint8_t *data, size_t length);
-    void sendFullFrame();
-    void sendDeltaFrame();
-    void sendBatchFrame();
+    bool isCodecEnabled(const FrameCodec* codec) const;
+    size_t encodeFrame(const uint8_t* source, const uint8_t* previous, size_t sizeToBeat, uint8_t*& best, uint8_t*& scratch);
+    const uint8_t* currentFrameBuffer();
+    static bool isClientReady(const AsyncWebSocketClient& client);
+    ViewerClient* findViewerClient(uint32_t id);
+    void updateViewerClients(uint8_t& readyCount, uint8_t& readyUnsyncedCount);
+    void sendToClient(AsyncWebSocketClient& client, ViewerClient& viewer, const AsyncWebSocketSharedBuffer& packet, bool isKeyframe);
+    AsyncWebSocketSharedBuffer pooledPacket(const uint8_t* data, size_t size);
+    void sendFrame(const uint8_t* sourceBuffer, bool isDirty, bool anySyncedReady, bool anyUnsyncedReady);
+    void updateStreamRate(unsigned long now);
+    void setRateLevel(uint8_t level);
+    int acquirePacketSlot();
+    AsyncWebSocketSharedBuffer allocatePacketBuffer();
+    bool sendBatchFrame();
 
     // Dynamic Buffer Management
     void allocateBuffers();
@@ -1,410 +1,516 @@
 
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
-const uint32_t SCREENVIEWER_HTML_SIZE = 12112;
+const uint32_t SCREENVIEWER_HTML_SIZE = 15278;
 const uint8_t SCREENVIEWER_HTML[] PROGMEM = { 
-31,139,8,0,0,0,0,0,2,3,140,84,135,174,227,42,16,253,21,94,175,164,39,186,194,14,42,175,215,237,
-77,29,195,196,65,107,131,5,147,174,252,251,66,72,47,210,42,197,3,103,250,204,113,254,133,178,18,87,13,144,
-41,214,21,207,227,63,169,132,41,199,96,194,9,132,226,121,13,40,136,156,10,231,1,199,111,94,255,78,159,120,
-142,26,43,224,191,189,122,222,239,145,103,255,254,246,43,121,171,97,1,46,111,39,32,247,184,10,143,194,170,213,
-102,98,13,210,137,168,117,181,98,94,24,79,61,56,61,201,10,33,63,150,206,206,140,162,210,86,214,177,175,122,
-50,126,178,253,9,0,50,132,37,82,81,233,210,48,9,6,193,101,181,112,165,54,172,215,105,150,89,35,148,210,
-166,100,157,237,180,187,73,0,45,44,162,173,119,248,246,43,91,65,112,46,204,92,248,205,109,184,78,167,147,21,
-214,41,112,172,215,44,137,183,149,86,228,171,225,112,152,233,90,148,64,29,152,128,197,0,141,94,66,37,16,212,
-13,66,107,187,166,210,105,223,80,80,37,248,27,133,51,108,251,149,71,129,51,79,11,225,14,233,162,109,88,119,
-24,106,217,53,105,215,52,166,49,84,124,108,131,16,98,251,213,164,241,84,218,89,236,192,166,177,94,163,182,134,
-137,34,164,60,67,200,130,147,212,16,167,203,41,38,241,166,92,87,22,226,251,206,207,241,211,26,254,112,236,93,
-136,77,186,209,32,117,130,58,161,244,204,179,83,74,122,13,172,59,8,199,67,215,38,157,109,75,6,200,217,202,
-95,148,17,188,156,16,82,204,16,173,217,28,157,164,180,22,90,225,148,13,162,56,133,152,109,146,147,27,214,33,
-195,232,163,20,53,208,187,33,110,225,219,56,221,209,217,106,60,197,242,70,87,17,14,83,239,94,78,253,118,67,
-6,34,126,206,23,82,206,156,15,114,99,117,156,197,85,211,6,143,178,99,83,59,7,119,103,5,135,50,126,30,
-24,9,137,122,14,119,172,70,34,126,50,116,129,76,19,235,106,182,147,226,130,126,248,62,212,244,195,54,111,39,
-250,229,237,68,224,72,195,64,230,238,61,190,134,219,92,233,57,209,106,124,182,101,252,247,231,175,24,161,52,111,
-7,140,231,137,67,36,141,108,60,26,68,237,51,114,145,221,88,199,221,222,83,8,153,174,146,83,89,9,239,199,
-251,194,194,93,170,44,90,175,173,173,169,157,33,15,33,210,45,39,215,176,54,252,167,35,154,50,57,243,122,234,
-217,185,235,51,172,64,67,148,64,65,27,109,198,93,254,47,76,240,38,214,67,253,14,127,246,207,231,107,247,248,
-203,216,153,187,165,56,144,214,169,168,207,95,238,68,242,199,95,191,223,43,43,232,158,94,16,252,213,78,100,36,
-247,141,48,39,140,255,170,125,40,218,128,68,80,121,59,128,71,31,94,58,221,32,255,226,19,169,94,194,221,54,
-142,36,252,87,24,126,243,169,129,17,204,200,113,246,162,12,235,229,112,102,253,54,182,51,177,179,151,162,231,161,
-197,146,133,14,13,106,64,200,142,71,226,127,223,194,65,138,164,168,57,187,147,136,4,170,80,7,234,66,17,139,
-181,156,155,0,65,128,110,196,130,132,249,253,175,8,29,114,110,194,124,190,8,224,231,42,87,186,24,12,66,180,
-41,88,8,9,105,248,170,154,124,204,211,117,6,212,253,68,30,148,3,161,99,200,10,8,204,122,213,250,187,21,
-221,42,131,129,251,141,146,199,148,186,71,50,157,49,112,168,27,210,71,238,89,200,52,127,158,184,159,184,15,226,
-33,203,239,147,108,226,126,122,33,10,200,22,19,243,79,172,151,162,160,17,170,215,48,92,150,132,212,170,160,27,
-5,122,173,100,80,141,4,64,52,147,76,208,77,61,162,72,206,18,171,178,87,114,154,207,220,147,182,79,79,137,
-10,150,188,71,114,5,127,92,11,133,162,251,135,177,193,73,6,131,37,245,244,150,184,232,171,17,53,227,69,53,
-86,248,49,179,106,198,37,60,7,231,74,229,138,132,31,18,41,115,29,160,124,169,223,136,224,151,112,152,15,195,
-95,66,58,214,75,149,63,7,25,70,216,20,120,120,121,253,241,219,231,243,187,171,235,219,187,79,215,223,174,62,
-134,44,43,205,122,11,110,120,231,27,191,115,241,166,44,199,70,134,233,104,22,205,147,44,35,139,106,83,25,105,
-26,138,193,149,220,66,30,207,166,48,27,123,94,21,145,219,45,208,146,178,5,219,161,2,115,202,43,61,148,161,
-89,77,150,11,20,197,44,87,252,53,10,99,57,31,141,243,83,17,101,32,31,244,114,156,15,135,84,17,97,180,
-94,179,80,146,205,113,60,173,185,181,196,27,251,38,112,119,205,206,71,119,240,4,82,23,188,249,178,221,110,74,
-230,6,30,147,159,159,69,161,65,130,42,248,222,16,66,62,229,34,13,70,101,195,32,160,178,155,30,73,96,7,
-88,52,0,187,222,134,162,202,117,150,189,226,188,129,144,239,16,2,71,149,155,121,93,59,156,96,34,58,55,2,
-156,63,10,173,65,217,129,149,202,117,110,150,173,37,117,184,173,169,182,152,53,0,122,77,178,206,244,101,115,242,
-184,141,89,64,123,186,27,71,228,250,241,30,212,206,239,0,13,227,116,180,221,138,226,42,185,66,32,234,44,244,
-22,103,189,61,203,224,113,93,232,224,30,130,36,112,101,203,19,4,126,153,122,123,123,54,7,236,142,149,45,238,
-0,21,193,187,22,107,173,144,37,108,201,50,227,97,237,141,111,189,242,13,154,112,8,134,175,208,232,122,48,32,
-175,154,243,145,157,218,110,11,178,63,74,7,131,30,88,111,177,212,42,135,104,142,5,198,250,209,76,163,3,81,
-33,11,157,200,185,81,147,213,133,215,141,30,123,31,173,125,254,151,111,114,158,172,49,119,176,96,45,139,21,204,
-197,66,64,26,120,78,3,75,48,10,200,47,67,61,12,105,29,5,22,166,206,50,197,49,215,108,81,34,253,156,
-200,150,217,163,7,83,31,110,94,29,27,213,40,34,41,45,158,133,158,47,73,205,105,37,194,102,158,20,16,28,
-199,210,133,8,27,70,199,247,10,146,31,99,59,243,166,57,195,90,130,54,193,78,14,130,53,94,222,212,56,222,
-36,227,132,191,83,42,121,105,90,98,38,230,224,150,170,17,217,49,101,50,74,86,171,236,197,175,79,203,42,37,
-21,70,56,19,118,254,250,165,4,39,25,151,110,154,80,234,53,193,150,24,141,150,167,98,188,196,48,148,77,151,
-179,54,193,177,215,232,168,109,154,73,154,86,182,203,155,81,202,71,85,155,19,20,209,61,14,146,121,180,134,159,
-84,11,116,29,228,176,85,183,76,19,45,171,226,101,48,176,51,198,113,72,216,24,15,25,48,100,39,170,136,211,
-201,238,57,214,148,117,236,104,82,144,174,101,77,58,3,209,106,93,44,81,192,184,51,206,167,157,1,166,103,123,
-48,154,237,19,64,135,235,146,120,78,148,132,20,221,86,242,156,236,199,12,58,233,141,113,113,15,36,6,228,179,
-209,96,208,37,224,44,224,76,34,137,126,218,252,213,136,161,219,21,185,41,140,220,254,17,153,167,64,3,51,111,
-78,27,38,200,21,226,62,131,160,25,187,131,71,120,204,213,75,144,161,209,7,41,104,91,186,69,193,255,79,131,
-172,226,41,64,19,50,99,223,208,158,193,97,117,195,49,161,129,206,3,33,231,10,140,175,101,2,193,162,144,245,
-75,65,89,79,194,170,120,215,42,153,99,252,107,189,18,74,123,98,110,46,249,1,59,239,128,205,161,99,248,127,
-175,201,187,50,4,67,214,126,118,87,168,197,39,168,24,64,50,130,50,137,254,32,205,190,104,231,168,157,200,67,
-235,2,69,212,22,206,181,211,153,229,84,244,72,221,34,212,239,209,76,176,156,37,127,183,95,27,188,182,83,119,
-173,157,54,92,223,128,231,188,39,190,87,49,75,240,163,99,38,57,231,122,187,85,68,214,146,26,67,175,95,204,
-52,77,33,3,13,65,215,41,155,239,94,250,222,24,210,158,10,153,81,200,184,21,131,55,46,8,231,227,228,232,
-40,56,27,141,41,78,200,105,50,115,204,153,167,40,171,87,54,175,109,254,54,130,39,46,57,152,156,38,78,71,
-45,61,28,35,140,244,66,79,72,245,196,71,172,95,44,26,203,168,88,217,248,46,48,226,255,67,82,86,102,116,
-200,88,222,101,89,237,168,125,69,202,222,150,183,4,171,39,251,185,171,96,77,141,216,77,221,147,78,54,232,70,
-215,193,224,224,158,59,194,125,139,186,109,212,129,104,231,30,218,85,13,214,180,218,169,174,71,13,68,183,19,88,
-15,68,119,61,202,58,210,216,119,99,10,170,175,188,233,143,10,114,103,146,210,214,4,227,202,82,198,135,48,166,
-21,196,209,241,238,212,113,80,111,93,11,200,122,55,190,39,119,239,165,156,137,218,207,172,221,140,185,151,47,171,
-146,37,158,206,250,249,248,96,58,56,157,226,189,69,199,91,101,87,161,174,74,212,180,50,55,91,54,234,218,80,
-189,138,42,79,48,37,208,65,146,76,215,10,232,240,133,11,150,37,219,148,51,246,166,123,162,115,108,9,166,88,
-97,163,107,194,101,242,36,30,18,157,171,104,93,128,122,247,96,74,97,157,127,206,159,113,177,164,0,66,89,222,
-128,89,101,137,54,221,176,14,72,193,67,1,166,228,39,130,39,209,99,98,10,224,215,36,95,129,74,182,2,182,
-11,161,96,145,255,220,206,49,132,63,194,246,9,84,129,28,209,233,247,226,251,235,120,70,166,223,159,191,167,223,
-163,217,144,78,162,223,78,72,145,44,18,37,42,168,125,160,237,111,232,107,186,221,78,205,137,143,133,107,249,67,
-230,207,50,100,163,25,157,30,27,95,204,231,214,209,162,234,225,50,79,129,17,197,55,50,121,132,56,244,235,26,
-110,5,34,76,196,244,100,22,155,39,230,103,98,204,21,43,211,135,255,148,229,137,38,161,21,195,129,155,245,197,
-244,173,65,122,139,72,166,206,102,149,74,98,183,126,45,190,88,145,73,156,164,219,60,221,46,115,9,200,243,36,
-20,121,17,198,164,6,65,128,103,184,207,139,109,34,83,149,139,212,202,149,87,179,143,201,124,251,44,228,54,19,
-114,253,211,74,28,230,122,9,42,68,65,71,179,178,164,83,21,25,146,51,147,155,149,127,25,90,206,47,164,38,
-42,242,242,176,227,17,117,48,245,246,77,119,143,187,37,118,7,99,229,172,231,228,207,90,15,134,142,104,153,20,
-215,207,242,139,50,42,210,47,44,225,211,89,36,100,10,63,175,23,219,237,14,215,197,58,231,16,35,230,163,140,
-143,23,250,84,142,245,112,72,197,162,14,134,222,137,167,218,164,52,168,157,195,7,141,163,227,146,45,249,212,251,
-232,88,112,32,161,243,175,144,182,142,243,172,48,83,209,235,123,172,27,10,80,209,60,95,44,0,66,202,84,95,
-246,104,22,67,176,43,65,212,216,176,46,234,48,173,214,210,84,161,88,61,249,10,103,101,112,234,56,26,45,20,
-170,179,64,246,170,87,128,255,202,213,15,80,187,49,215,114,238,142,22,160,175,221,90,72,158,105,170,184,158,138,
-25,51,70,206,125,97,82,83,163,56,99,138,116,252,225,170,206,155,237,208,80,105,92,90,214,105,238,15,141,76,
-82,196,132,169,156,113,141,255,208,158,26,208,212,172,90,173,231,58,87,28,202,70,244,227,122,247,204,160,49,110,
-78,218,2,71,238,238,138,53,90,194,221,93,19,178,36,130,25,137,248,230,217,138,124,99,59,168,113,248,32,22,
-145,27,137,126,45,66,230,30,139,248,13,83,176,130,68,199,35,182,107,202,199,225,255,91,44,22,33,251,227,58,
-201,132,126,137,143,71,204,125,228,176,49,192,117,204,221,179,237,210,163,15,128,244,3,41,220,175,31,98,220,174,
-84,24,231,193,167,146,73,190,73,33,75,94,226,127,26,153,211,198,234,197,142,54,36,221,237,198,126,201,221,220,
-8,119,180,114,173,39,23,233,93,99,30,85,28,90,6,109,27,100,187,13,29,139,246,173,142,253,13,4,183,208,
-1,22,138,254,142,204,184,174,31,164,49,34,168,182,216,240,137,244,5,7,116,32,38,221,177,177,109,98,68,51,
-65,105,157,133,229,222,73,251,147,177,226,158,162,188,242,7,101,200,58,211,212,72,75,219,35,50,17,230,39,106,
-236,64,203,104,155,19,76,82,49,85,198,4,213,204,148,172,202,38,70,183,96,11,199,42,113,48,232,176,239,117,
-203,192,205,83,214,131,233,52,190,143,234,198,17,215,67,80,214,215,238,190,48,95,24,63,38,58,169,27,139,141,
-17,8,124,231,169,5,73,69,148,226,15,7,251,83,215,71,125,171,127,176,123,254,181,250,126,249,193,181,153,222,
-124,172,137,29,6,104,209,62,4,182,221,246,81,253,47,184,255,221,231,46,112,77,178,127,182,77,175,23,134,234,
-200,184,208,196,137,239,54,225,1,180,159,53,154,33,64,99,81,55,211,192,125,169,168,247,27,162,249,82,100,233,
-85,158,66,225,15,121,141,110,253,5,74,104,62,30,10,163,230,144,142,251,137,185,77,168,73,89,96,14,85,96,
-108,4,102,231,13,130,118,207,23,70,164,157,189,59,99,7,230,15,21,205,192,191,207,225,187,76,65,146,190,4,
-30,32,164,127,206,148,183,219,131,166,186,191,242,127,25,140,32,145,105,224,32,234,131,110,1,58,88,41,145,43,
-211,173,112,204,215,148,219,89,106,196,236,187,68,197,59,159,246,3,104,26,162,88,130,115,244,194,143,58,189,125,
-73,148,46,250,117,97,92,223,5,27,131,193,155,122,245,217,124,116,202,245,4,78,117,12,103,218,189,12,135,16,
-31,29,1,245,129,200,136,223,8,60,141,94,104,181,32,134,136,103,233,179,35,161,236,213,136,119,212,229,190,82,
-125,73,50,208,26,168,157,114,58,184,242,82,214,31,210,12,191,224,42,14,195,140,68,206,36,114,38,221,139,231,
-172,127,133,154,199,198,161,181,208,168,154,144,178,198,16,218,208,131,130,162,8,217,168,99,83,201,125,174,26,229,
-250,46,33,195,216,121,28,114,182,95,14,68,197,82,44,52,161,212,159,163,178,252,129,132,63,68,150,225,110,6,
-14,50,112,153,18,249,128,72,131,122,20,50,209,53,191,253,85,138,103,214,178,20,182,249,108,169,187,119,215,153,
-168,150,6,126,153,232,101,132,20,73,219,178,29,54,219,183,7,202,26,43,26,203,25,87,90,16,92,243,110,133,
-180,43,9,57,76,196,41,196,226,12,252,203,112,24,139,163,163,202,136,68,211,130,118,61,41,26,225,234,231,9,
-214,206,68,216,197,217,94,226,172,240,132,211,172,21,222,168,214,137,16,132,67,160,140,104,91,208,56,166,136,232,
-136,233,202,23,74,163,92,162,156,5,58,76,223,145,84,116,183,213,245,72,186,195,190,86,38,154,218,118,121,75,
-25,190,221,203,132,83,233,39,239,177,196,229,23,90,246,131,151,148,50,104,237,112,27,253,80,227,100,103,109,22,
-220,104,194,113,55,12,131,42,88,4,71,56,220,99,179,110,219,16,208,13,135,180,47,198,12,135,253,126,211,3,
-250,186,199,144,186,1,106,234,217,155,113,248,75,33,2,11,148,195,147,28,218,239,108,167,8,55,30,172,220,68,
-144,200,36,123,249,19,164,33,237,49,244,179,55,238,219,136,230,199,76,30,52,236,99,19,118,52,198,32,125,38,
-221,203,112,168,49,6,233,191,16,131,18,23,38,59,42,96,54,150,158,241,209,164,31,59,110,168,182,78,218,164,
-237,254,221,233,254,8,224,79,124,238,27,32,91,176,21,91,179,57,75,217,211,216,181,34,71,76,225,223,37,39,
-115,222,225,145,86,162,171,83,252,59,28,210,100,200,9,106,105,142,37,31,181,134,92,119,133,232,111,117,180,66,
-188,27,241,39,24,234,200,93,2,114,4,134,124,55,117,84,77,53,118,170,78,129,77,83,93,136,12,10,68,64,
-155,181,97,203,30,36,72,242,250,24,78,232,48,252,113,111,2,168,117,244,111,66,234,127,181,159,180,72,66,217,
-10,37,49,9,49,227,36,61,40,77,113,154,141,11,148,198,37,196,28,193,23,156,60,113,20,44,157,22,94,176,
-26,56,63,93,140,37,31,14,115,186,230,79,120,230,98,182,182,39,107,182,162,174,163,220,214,195,100,101,196,173,
-238,64,53,69,175,131,151,101,251,61,154,39,49,221,178,141,217,200,56,180,108,190,198,83,85,88,182,82,84,165,
-146,144,9,6,237,221,239,218,204,193,10,200,57,88,175,81,239,151,45,87,121,96,192,124,76,45,124,47,158,180,
-11,145,179,158,234,161,62,25,65,115,114,218,70,28,14,103,125,30,230,243,38,211,117,77,120,155,20,63,8,208,
-218,76,124,254,54,86,82,133,56,162,125,140,59,70,139,8,242,5,14,245,135,158,110,200,243,181,12,53,199,171,
-188,208,151,46,17,16,221,81,111,187,12,238,203,19,208,174,94,205,197,193,253,162,145,245,84,139,206,198,90,228,
-90,75,241,131,169,207,21,160,157,211,106,243,149,215,29,52,243,25,76,195,121,6,230,141,132,110,58,164,172,9,
-237,88,236,41,117,219,80,142,235,222,186,151,17,221,98,167,161,54,18,190,193,120,75,141,191,124,18,89,214,70,
-223,181,7,152,142,22,56,253,21,230,250,111,81,33,162,165,42,121,182,58,35,192,16,147,178,190,227,75,119,91,
-189,113,29,74,165,146,111,172,85,197,237,10,185,202,245,64,89,150,20,26,103,121,107,190,242,127,230,90,19,16,
-217,223,86,67,3,162,198,155,239,128,244,200,234,251,33,61,34,87,13,148,246,156,31,244,29,146,246,156,27,99,
-173,28,25,31,78,167,190,121,211,134,112,99,12,119,247,214,176,191,64,26,161,107,5,155,134,72,97,59,144,165,
-239,162,248,234,70,246,158,165,43,16,127,148,172,160,250,246,108,7,212,61,110,186,120,126,248,164,105,183,3,131,
-150,60,120,196,244,43,148,253,237,147,44,223,207,162,198,44,128,31,159,238,127,90,90,118,175,77,140,204,71,135,
-182,185,218,22,150,143,141,213,7,102,67,198,151,190,126,196,5,247,146,8,218,233,228,238,183,64,177,201,230,58,
-166,241,113,57,67,136,146,97,15,156,146,19,83,61,158,190,246,87,28,79,253,175,89,94,7,221,208,128,26,241,
-113,225,253,203,69,74,194,198,69,213,144,178,185,254,201,15,56,51,115,87,44,111,86,137,60,188,154,131,65,96,
-115,69,245,66,190,183,215,56,15,131,251,139,172,30,254,122,173,255,42,132,124,173,17,99,177,42,62,184,235,184,
-135,193,27,119,118,17,195,221,53,253,75,36,118,55,82,209,150,50,208,65,145,207,127,128,30,59,117,222,39,5,
-252,87,117,159,151,153,183,127,175,174,253,50,157,235,36,123,255,162,193,92,30,123,243,214,33,163,149,0,127,235,
-176,157,137,254,126,13,107,48,135,241,203,119,255,125,247,233,235,187,203,243,155,187,139,171,187,223,127,59,255,118,
-206,223,142,44,26,6,26,151,53,111,133,61,251,27,66,183,104,107,224,70,47,140,68,104,245,28,107,162,215,39,
-35,150,190,160,43,138,121,123,238,0,142,13,98,239,210,95,215,133,54,66,127,206,31,60,141,84,20,43,12,92,
-190,152,183,186,229,163,74,108,171,52,115,235,22,108,203,252,195,231,139,15,255,113,103,4,248,248,237,235,187,219,
-139,235,171,187,203,27,126,50,26,177,207,215,87,191,187,251,242,245,252,230,230,238,18,165,106,78,255,203,63,57,
-225,176,212,97,254,150,174,200,229,135,37,204,127,212,204,137,194,93,3,246,135,96,195,235,13,206,128,250,10,197,
-10,89,241,10,241,108,93,124,196,91,158,183,23,151,231,215,223,110,45,5,56,97,95,46,144,129,139,79,119,102,
-206,140,189,133,19,67,213,87,53,141,182,185,20,90,36,25,150,103,239,86,43,210,184,49,9,248,226,125,192,94,
-20,143,234,251,219,191,181,187,57,12,87,63,67,214,130,168,175,126,55,32,202,122,65,93,183,160,157,41,13,6,
-238,55,178,253,39,171,84,110,251,120,55,110,248,250,203,249,21,221,56,9,5,255,195,251,219,171,187,243,255,60,
-191,186,141,81,52,254,155,13,148,236,246,127,190,156,227,147,46,255,48,246,75,21,32,83,34,220,165,175,58,212,
-152,155,55,36,196,157,204,210,192,92,157,53,64,126,43,17,230,241,49,145,105,20,212,116,45,72,190,2,25,181,
-156,61,194,16,224,34,129,212,60,180,49,55,14,174,16,244,67,117,209,58,44,219,159,96,204,23,6,27,166,62,
-186,43,71,132,250,237,114,135,123,27,158,11,228,121,37,228,88,96,13,211,52,46,243,101,100,131,232,69,97,54,
-58,254,136,99,145,204,159,9,101,89,46,31,190,216,9,37,30,30,64,65,26,155,46,9,66,169,24,87,51,224,
-24,24,8,33,148,159,109,52,17,44,220,153,34,10,212,33,18,237,47,135,77,183,146,50,52,82,90,50,139,239,
-81,233,78,188,228,111,22,15,11,104,129,55,88,58,212,125,78,24,207,51,72,84,197,121,151,67,43,26,117,172,
-124,61,255,124,254,238,230,60,172,72,37,124,167,153,163,46,98,173,190,241,171,191,44,245,96,144,156,26,199,29,
-12,44,33,235,216,33,173,110,141,116,240,75,71,93,53,206,49,225,119,25,52,254,115,0,187,72,24,240,192,198,
-194,54,148,11,113,26,124,144,123,191,94,44,64,33,104,231,84,183,91,134,226,2,125,132,230,106,126,242,6,17,
-27,119,217,131,141,3,236,210,211,201,125,6,227,253,185,122,115,31,147,31,112,247,127,172,28,7,127,163,190,238,
-171,248,114,11,23,66,73,58,94,126,77,200,141,142,183,215,237,125,161,41,125,71,87,242,24,29,191,150,239,254,
-151,108,3,98,153,235,30,4,108,73,150,37,91,88,67,180,106,6,130,95,226,49,33,116,109,40,41,29,110,108,
-114,10,155,194,95,132,204,64,2,2,232,231,140,225,223,132,65,115,184,48,205,102,60,132,232,57,244,9,20,96,
-45,240,35,9,252,8,128,143,224,95,7,104,252,66,208,134,49,103,207,216,128,179,23,204,112,46,119,119,94,143,
-70,107,67,135,253,96,112,127,58,157,194,19,206,182,200,7,13,37,105,219,35,197,52,144,30,64,56,71,8,154,
-222,250,91,85,127,41,106,154,197,192,32,107,29,108,112,200,140,71,2,63,167,243,139,3,105,101,121,136,156,233,
-15,110,49,157,64,65,231,116,42,184,6,254,67,110,142,56,176,89,114,6,239,193,7,28,13,174,13,48,35,206,
-229,222,222,119,61,171,90,120,163,96,245,7,92,96,113,26,128,164,149,123,41,55,136,122,85,181,226,192,135,157,
-66,172,40,111,254,177,107,44,189,43,136,173,56,168,12,148,104,36,105,239,31,232,52,154,173,192,194,192,199,205,
-186,74,129,252,21,95,191,152,75,135,162,157,12,69,162,189,15,88,254,33,108,117,188,111,186,108,72,169,174,83,
-142,126,32,97,244,48,55,131,1,179,49,214,245,64,20,31,188,147,196,167,93,152,201,6,180,91,151,186,102,104,
-187,181,22,133,185,206,153,73,137,91,234,245,164,83,251,105,159,175,53,160,166,9,202,90,12,79,167,246,12,45,
-142,46,108,229,192,224,111,61,16,37,66,1,138,25,166,0,30,158,64,100,18,26,40,184,27,124,131,189,78,15,
-84,132,66,234,72,187,255,82,83,102,109,148,236,123,66,138,29,171,46,161,85,106,211,86,141,18,47,127,59,254,
-73,236,17,117,186,167,108,175,117,200,118,160,148,200,40,36,155,77,38,184,8,221,116,74,46,1,115,222,32,236,
-67,236,210,38,174,18,239,132,24,4,90,201,172,217,4,95,5,0,20,70,129,250,54,187,135,126,54,48,35,174,
-240,4,49,151,4,225,104,22,183,253,204,80,81,231,27,109,237,48,177,84,180,123,27,227,233,182,125,8,103,38,
-219,144,34,190,13,190,114,67,2,129,72,48,222,218,95,241,151,185,10,99,33,122,3,178,84,87,120,157,33,117,
-93,246,252,245,243,14,129,144,141,241,112,26,45,52,102,230,191,235,154,217,84,100,169,53,134,77,8,148,22,116,
-132,217,244,188,245,154,249,242,61,226,91,126,122,179,143,177,115,234,128,55,244,231,126,112,14,6,62,200,205,130,
-69,191,22,97,108,127,235,177,148,50,172,89,97,111,183,103,146,151,114,177,4,195,129,5,82,65,4,220,209,235,
-67,44,95,175,151,17,233,210,161,66,65,180,77,247,199,172,215,240,187,152,184,129,182,111,198,151,237,112,174,182,
-86,60,215,194,92,229,124,106,164,188,88,98,42,215,44,182,206,241,124,67,90,170,184,108,197,97,226,115,45,14,
-148,235,255,8,96,132,188,66,254,200,140,3,24,29,32,120,17,158,39,168,208,138,92,97,170,27,4,188,69,113,
-101,251,150,70,250,232,232,33,238,165,140,224,142,242,55,219,126,179,205,254,25,68,34,114,243,17,123,51,63,223,
-98,79,174,9,166,212,98,219,128,7,239,150,240,165,179,251,137,35,121,160,53,161,112,130,153,91,150,154,23,21,
-163,140,176,17,205,117,242,177,5,127,167,54,160,60,127,253,126,11,11,184,166,67,221,246,48,65,247,22,253,59,
-56,74,182,66,118,138,241,111,245,221,61,67,57,37,96,76,61,8,42,81,57,128,105,141,231,153,60,118,90,25,
-52,60,169,10,164,80,155,130,62,43,39,155,243,206,213,74,191,57,10,111,164,242,181,149,124,17,172,207,6,116,
-119,233,82,6,225,135,100,207,37,140,231,150,26,211,150,250,15,159,151,240,161,88,235,210,170,234,83,83,176,182,
-21,109,63,103,55,55,140,222,121,223,181,57,9,188,74,242,43,176,120,77,250,151,133,228,171,203,241,173,249,135,
-184,30,128,95,95,115,96,223,21,211,214,156,91,114,107,167,157,55,117,187,241,33,72,174,188,160,213,152,196,171,
-67,209,47,38,250,119,2,237,98,12,130,33,83,2,36,113,82,100,240,54,51,213,53,18,208,109,234,145,38,189,
-220,201,142,204,11,230,30,90,120,171,71,222,185,39,125,36,61,0,40,207,133,105,228,208,251,55,255,80,30,212,
-127,139,116,117,248,108,132,156,91,178,101,75,252,80,112,168,2,124,84,86,116,37,23,82,130,102,242,248,180,103,
-209,166,180,120,132,152,21,116,174,169,6,72,60,156,144,22,126,3,185,208,216,182,173,26,200,30,92,235,32,200,
-154,46,35,139,0,82,241,47,235,14,207,206,154,125,183,246,184,15,254,8,114,83,69,67,57,24,23,78,252,89,
-198,236,43,158,34,199,192,179,211,239,76,16,192,254,143,29,24,152,191,167,167,254,1,134,59,174,59,54,123,131,
-217,69,240,17,15,177,179,149,115,134,57,47,190,81,118,25,97,214,36,160,58,166,14,57,113,180,62,25,56,192,
-15,113,105,154,216,141,167,196,119,164,235,57,29,100,29,251,125,213,49,244,129,74,112,134,156,129,95,16,155,202,
-248,27,131,86,193,16,19,219,220,14,120,224,184,110,157,103,234,112,87,85,239,176,131,72,60,220,61,93,198,87,
-144,144,89,62,155,167,124,251,15,56,95,208,53,206,162,24,70,130,146,79,57,25,68,204,71,16,120,56,223,0,
-25,14,175,185,133,245,12,140,138,235,136,143,27,90,3,39,90,166,143,144,1,11,108,2,115,103,51,209,143,97,
-72,14,154,65,181,241,166,179,22,138,6,220,42,17,3,163,47,19,23,147,147,243,62,125,36,252,174,193,212,109,
-242,107,241,235,10,144,126,240,180,169,221,184,90,234,5,207,161,193,110,172,76,147,162,32,118,193,245,169,180,190,
-240,24,163,143,111,115,157,91,129,138,245,193,168,38,97,250,160,103,44,158,100,160,48,15,38,83,34,79,134,239,
-135,50,228,18,142,52,160,71,188,10,128,56,70,191,60,133,139,28,8,250,177,252,201,104,236,23,189,99,119,180,
-18,154,190,10,188,153,186,128,28,14,232,167,83,255,217,160,208,210,245,21,36,108,37,54,207,248,56,192,4,132,
-225,198,134,5,23,230,160,184,28,22,151,107,226,50,77,83,28,225,50,33,14,241,88,132,78,164,116,121,201,194,
-88,155,188,129,166,169,230,25,139,200,60,123,70,92,117,207,158,129,79,79,252,201,147,16,12,192,102,93,203,28,
-13,71,133,70,52,77,19,172,192,217,184,6,246,200,242,218,220,150,43,246,72,184,241,66,215,24,108,246,235,74,
-183,226,143,21,207,33,157,221,232,123,86,30,242,234,89,33,231,183,114,145,154,161,21,247,27,221,164,83,88,79,
-117,202,35,247,204,102,53,177,217,107,64,135,207,90,208,218,241,98,15,106,169,29,24,3,158,158,70,54,147,216,
-177,67,88,125,180,35,71,131,207,212,192,116,144,102,188,197,233,139,249,134,192,27,178,224,21,130,56,187,136,182,
-86,87,159,92,171,41,63,89,200,221,211,254,5,91,119,138,177,6,190,127,118,46,202,100,173,94,68,179,113,155,
-195,80,121,9,241,20,196,182,123,150,116,87,226,110,91,56,30,141,152,171,251,246,62,4,69,135,87,152,43,238,
-246,132,229,44,223,103,179,126,176,184,163,131,178,180,241,118,32,198,248,57,58,93,189,194,223,89,248,160,25,66,
-133,165,174,199,219,60,206,196,17,41,156,118,25,167,141,22,71,54,183,90,30,184,96,116,102,215,210,89,169,56,
-78,113,140,253,126,51,29,83,240,112,191,208,236,33,16,194,23,137,78,44,84,189,196,235,218,2,239,252,201,113,
-28,148,157,237,147,69,4,211,65,134,143,227,86,12,158,195,67,220,28,183,90,41,88,71,13,248,125,71,54,180,
-33,30,234,222,82,228,59,164,220,26,250,107,60,45,166,85,224,45,230,53,110,159,87,90,226,11,45,138,121,46,
-96,152,219,52,140,132,152,117,207,56,34,68,0,175,226,24,247,85,236,142,57,25,25,56,132,194,235,230,146,235,
-252,238,244,19,151,180,95,29,172,48,251,110,33,196,216,74,154,142,197,200,4,12,50,182,194,180,164,152,154,44,
-213,110,9,239,69,226,216,146,148,105,18,187,31,212,68,131,230,255,43,204,211,155,27,101,18,83,115,190,242,66,
-33,91,114,158,166,0,56,15,186,1,155,38,188,122,11,62,102,76,86,132,180,119,163,103,103,117,227,122,36,27,
-192,207,181,35,70,148,196,177,30,87,227,6,226,239,24,151,34,146,224,68,46,105,158,194,222,59,93,36,48,211,
-34,213,56,224,237,45,146,101,207,242,52,207,97,218,207,253,214,38,241,34,153,255,146,121,38,86,160,105,2,74,
-128,48,68,184,127,125,37,40,98,154,74,98,48,195,122,131,184,212,215,247,228,116,214,28,183,3,26,6,91,21,
-9,93,0,100,201,242,207,193,161,220,179,129,30,126,45,108,16,43,46,103,146,162,229,65,118,118,78,235,112,149,
-69,223,47,172,55,98,235,24,36,48,33,230,34,104,123,76,3,175,202,3,123,27,47,150,204,120,114,29,164,17,
-91,101,67,39,226,51,11,236,190,161,83,217,100,75,139,28,20,126,97,18,164,208,218,64,156,24,131,188,160,58,
-35,192,37,222,246,146,120,129,214,58,70,233,9,163,185,68,132,120,69,192,119,0,101,180,145,128,134,231,70,165,
-10,94,72,98,131,176,56,93,210,94,5,207,171,20,114,115,73,145,183,114,21,188,4,204,186,140,183,94,81,5,
-47,200,238,5,164,10,222,97,71,21,188,111,178,12,30,252,35,21,176,90,234,224,29,166,8,241,164,171,14,222,
-73,94,204,174,187,12,30,114,229,236,197,217,22,46,60,16,93,86,41,131,23,54,151,193,83,169,68,221,220,202,
-19,143,100,41,188,144,150,194,139,140,144,150,194,139,82,94,174,133,167,64,88,146,79,150,194,45,199,241,47,63,
-249,111,226,129,12,170,70,152,112,142,118,199,65,246,0,147,155,37,255,255,241,229,227,238,25,50,52,252,163,185,
-231,224,110,91,231,245,175,188,230,45,43,146,110,36,57,171,149,233,251,237,189,123,207,122,57,126,61,242,136,35,
-215,117,93,199,183,77,142,237,239,183,63,44,10,48,45,117,188,125,71,76,2,32,4,130,32,8,82,36,101,137,
-21,74,148,218,139,112,229,145,125,159,156,203,94,163,7,78,243,178,201,224,225,113,206,65,195,254,5,157,102,116,
-104,74,53,167,6,220,101,246,242,186,84,56,222,49,252,199,106,13,110,206,28,198,202,202,122,128,187,73,112,181,
-245,132,20,55,83,181,189,129,170,35,195,86,55,192,138,48,118,230,172,34,223,197,113,147,25,133,199,47,78,133,
-143,184,126,124,26,194,101,135,214,7,206,103,193,254,122,110,154,205,71,119,118,214,212,113,13,117,92,15,84,16,
-111,0,107,156,53,29,43,226,84,12,210,203,110,243,49,118,167,202,49,117,91,143,64,85,163,131,88,42,8,208,
-46,239,167,77,189,157,33,66,37,198,177,30,157,128,169,237,208,181,168,227,184,181,75,243,108,213,234,157,97,18,
-199,35,7,188,63,35,7,92,53,141,184,71,149,133,71,109,85,202,210,49,68,52,150,176,146,150,168,19,146,71,
-235,211,19,194,137,88,200,79,183,96,35,209,23,148,96,158,92,33,77,2,123,148,97,148,73,248,105,86,12,134,
-236,247,68,166,210,48,253,126,223,41,21,209,227,150,152,131,246,46,152,122,74,183,235,217,77,243,98,170,4,114,
-127,255,59,253,178,150,25,15,48,78,48,208,158,117,199,237,229,6,74,111,243,93,198,16,222,1,223,116,94,154,
-198,10,78,14,43,107,105,186,7,251,209,0,106,228,52,155,254,37,132,211,69,197,191,152,173,65,210,0,248,67,
-53,54,160,149,120,34,3,194,72,230,151,171,237,230,153,122,32,53,141,183,165,37,249,140,27,206,98,76,128,1,
-181,23,252,190,222,200,154,137,195,87,128,12,124,172,222,173,151,51,151,75,125,248,196,128,187,175,150,143,76,16,
-28,184,51,8,136,106,81,0,117,117,7,109,150,227,155,16,126,129,26,83,67,121,135,39,98,31,49,200,158,130,
-31,54,58,53,39,189,44,205,69,158,65,227,119,48,231,10,253,173,178,253,241,126,221,201,55,207,178,11,68,119,
-243,251,5,107,77,185,177,26,171,37,246,9,234,230,22,48,116,89,116,164,108,139,236,126,200,223,216,164,116,144,
-162,124,180,179,246,198,63,221,60,126,80,243,85,70,100,65,194,199,218,55,193,67,94,157,87,70,212,205,181,8,
-59,99,229,13,52,48,86,204,133,135,54,79,97,124,227,203,247,167,136,87,108,217,246,164,6,247,22,239,34,249,
-236,166,2,217,211,134,150,233,200,168,163,22,204,145,180,82,218,246,134,104,167,46,231,15,175,127,33,143,229,188,
-240,208,167,74,235,96,187,155,98,127,154,109,97,85,25,46,183,123,218,226,181,202,138,248,245,166,90,63,212,147,
-159,111,55,75,194,41,107,89,97,156,61,78,152,249,139,64,42,190,224,49,168,75,212,38,153,194,172,222,44,47,
-238,182,29,205,207,71,12,195,1,31,187,183,241,194,87,47,63,211,101,254,202,71,144,148,197,7,6,80,111,145,
-244,32,143,36,229,242,35,207,35,208,207,117,72,118,73,218,31,49,143,188,37,233,155,94,114,103,112,243,211,243,
-244,245,118,86,175,198,179,205,252,236,200,177,241,79,247,195,126,109,181,173,207,92,139,250,119,45,230,37,184,14,
-158,243,46,158,122,225,246,183,244,159,110,76,47,139,246,251,0,217,41,22,183,236,111,232,133,90,87,203,107,116,
-209,59,3,30,183,47,171,179,14,27,56,238,161,150,159,216,181,118,191,104,23,140,106,179,79,77,20,222,51,35,
-104,98,76,36,58,30,9,97,123,75,189,156,254,28,25,190,171,214,189,40,244,70,150,22,213,175,148,7,223,135,
-189,9,153,12,203,110,209,216,211,151,120,241,231,25,126,142,99,13,94,180,94,193,220,255,236,44,74,44,149,220,
-247,101,104,46,162,23,142,134,107,62,137,177,211,56,192,247,207,131,212,180,59,38,184,13,71,116,17,221,58,117,
-255,148,93,24,183,248,163,227,83,92,229,131,119,86,39,37,19,234,47,135,142,214,52,162,218,33,97,254,65,38,
-127,128,114,166,2,18,203,93,244,219,2,158,96,142,128,101,121,62,245,214,101,77,116,191,128,244,98,128,184,114,
-17,199,252,148,186,181,38,127,251,245,207,172,149,220,189,133,16,249,95,240,29,199,87,3,163,32,134,146,205,133,
-228,65,90,42,112,183,24,57,2,116,41,75,173,199,106,11,214,195,86,179,101,162,54,193,149,66,48,210,237,126,
-133,254,248,216,79,189,186,187,235,95,220,38,121,146,141,18,74,101,73,14,169,2,97,144,26,37,39,228,55,23,
-249,181,167,199,100,154,83,137,43,76,115,225,28,147,92,250,245,246,199,201,219,26,74,221,94,92,22,82,234,18,
-147,5,37,11,76,166,128,16,176,48,99,234,76,193,8,21,106,38,206,165,96,33,96,44,88,120,234,76,193,8,
-21,106,36,30,37,63,221,190,173,97,109,103,5,34,229,77,189,49,85,248,20,203,192,201,172,73,25,24,242,57,
-208,216,201,138,221,239,37,241,120,199,191,163,104,71,107,33,103,126,83,1,183,22,46,13,49,193,43,56,52,206,
-41,90,140,152,62,186,128,65,169,182,152,37,246,24,52,167,19,115,126,154,146,9,174,79,218,222,81,18,223,122,
-195,11,184,78,45,226,251,52,127,149,127,69,151,105,235,105,81,211,117,112,34,242,60,144,89,205,115,28,147,203,
-53,102,167,79,110,82,231,105,222,20,127,82,176,115,249,247,217,43,170,4,232,253,9,214,40,143,113,132,121,149,
-149,79,224,118,16,91,62,197,74,16,237,88,71,207,231,68,22,63,177,222,166,79,142,224,231,125,202,111,114,71,
-231,27,0,206,138,157,43,32,206,25,52,54,160,98,84,34,139,54,39,176,201,147,121,158,140,243,211,238,60,237,
-238,204,190,175,3,13,50,62,119,34,86,113,28,34,26,249,66,140,21,180,13,87,48,14,23,137,242,116,83,112,
-102,238,230,121,58,151,204,216,141,243,116,92,232,234,77,216,2,83,115,152,252,164,17,4,73,13,81,67,67,96,
-59,212,71,237,64,173,10,58,196,147,90,119,34,234,179,207,23,116,83,219,83,30,63,13,29,172,174,98,98,32,
-151,180,61,231,241,51,2,41,33,6,197,220,166,82,56,131,194,190,65,227,39,160,202,185,177,189,42,155,166,213,
-55,176,153,190,128,69,127,220,80,196,179,205,57,110,125,211,198,239,46,164,52,80,108,126,92,172,248,138,98,5,
-20,27,99,177,195,225,208,229,196,213,184,236,84,42,65,171,210,40,173,197,10,123,147,127,201,175,111,242,252,250,
-54,139,134,67,240,181,0,184,190,42,40,119,155,76,112,188,97,38,157,207,181,236,204,116,48,153,39,99,46,137,
-253,249,56,192,145,81,223,223,167,89,50,129,198,60,48,113,8,4,183,1,17,172,207,191,253,113,141,194,211,67,
-34,242,123,19,55,222,207,7,131,219,253,102,48,200,175,75,4,129,30,97,30,235,50,246,95,144,115,176,194,120,
-46,255,19,16,12,241,184,7,136,105,218,133,201,68,92,103,89,15,0,89,82,206,143,240,83,232,36,105,47,232,
-67,205,40,77,20,208,115,190,64,1,221,233,11,20,110,10,182,182,137,167,96,58,243,120,10,150,64,83,192,30,
-233,104,191,111,13,6,34,184,135,118,128,117,142,118,84,243,105,41,218,32,116,179,66,200,192,246,166,13,166,178,
-225,234,230,39,51,100,144,152,15,118,84,145,216,175,117,56,248,116,254,112,222,151,170,225,80,163,243,115,130,61,
-110,38,127,105,154,109,194,175,129,130,149,226,7,94,15,61,14,190,62,113,228,101,35,38,42,13,186,100,127,204,
-140,33,91,254,119,209,248,84,87,175,108,155,64,127,97,150,218,7,205,180,128,139,203,151,173,240,75,214,35,7,
-198,244,10,173,45,204,246,29,110,199,48,80,23,82,186,76,130,123,6,230,12,44,116,138,193,235,65,180,78,64,
-40,1,252,203,205,1,83,131,129,43,218,68,202,246,136,221,103,123,230,107,39,247,175,241,8,68,79,151,181,90,
-171,20,76,5,90,105,186,86,211,130,101,137,47,232,250,242,242,84,184,236,171,64,106,250,29,56,25,125,90,150,
-106,218,102,184,173,210,101,58,247,10,81,121,113,187,207,232,95,51,197,234,158,13,249,101,33,171,142,255,116,141,
-58,196,201,243,34,16,167,163,225,190,189,57,117,101,234,63,219,121,174,174,218,229,206,21,28,46,23,252,233,151,
-63,188,254,249,79,255,242,203,226,187,236,172,181,112,191,157,101,135,246,100,117,244,219,43,47,22,242,249,138,63,
-30,143,31,254,11,27,125,28,232,210,206,1,78,253,233,138,252,233,183,202,198,245,51,43,76,116,200,178,77,62,
-65,241,144,214,137,134,128,3,41,62,247,200,142,177,104,182,154,208,32,163,239,50,141,61,39,118,178,115,26,81,
-39,193,186,69,84,2,183,239,102,196,166,231,101,237,92,57,164,87,249,29,11,98,88,240,80,6,31,217,83,54,
-135,100,23,190,126,197,139,113,218,222,223,190,234,235,93,250,95,124,35,252,203,63,255,10,223,151,96,242,103,191,
-253,225,181,203,11,74,255,230,245,111,255,237,151,238,42,203,250,28,28,193,5,82,143,238,46,75,242,164,159,220,
-36,249,85,210,207,147,235,126,146,23,55,9,198,124,87,121,158,228,89,209,79,138,236,242,38,129,87,184,87,201,
-109,254,18,96,215,253,219,126,210,47,110,174,111,146,235,171,171,254,213,72,223,105,73,93,194,119,90,137,172,135,
-25,29,203,250,72,189,197,119,12,232,44,52,8,46,44,29,137,90,77,96,183,77,24,68,128,101,51,246,97,91,
-141,9,249,91,189,198,128,234,202,104,20,231,11,20,63,110,222,208,35,18,76,141,235,173,143,61,170,55,52,238,
-99,154,46,148,123,131,35,41,163,64,80,100,140,105,222,77,242,230,126,57,167,37,106,134,205,223,96,229,136,89,
-242,115,196,99,61,19,104,25,252,85,133,77,30,160,36,110,173,154,36,240,23,218,143,228,184,195,7,75,192,49,
-193,17,68,242,67,136,95,47,163,251,37,236,156,127,131,37,123,84,230,160,220,150,111,198,75,216,49,197,240,29,
-100,31,170,199,7,95,213,166,6,141,60,113,81,170,236,52,223,132,130,107,144,70,37,14,159,32,44,31,112,19,
-117,248,214,154,128,101,28,215,17,54,9,190,179,79,115,83,84,142,186,244,84,49,44,38,105,23,149,153,76,146,
-58,1,1,41,138,73,136,219,155,205,108,14,41,220,203,91,26,149,186,38,85,134,202,95,49,129,33,46,165,173,
-28,220,242,243,243,63,255,226,151,61,38,137,202,166,150,46,31,12,26,114,232,57,210,76,70,81,121,187,246,164,
-93,160,246,136,193,27,2,201,165,244,162,146,101,150,184,149,106,231,168,25,74,74,15,176,227,92,115,250,220,21,
-81,28,51,189,47,118,155,74,190,81,130,148,86,253,11,60,234,104,50,4,195,61,248,48,83,90,191,250,244,80,
-47,103,48,207,179,2,70,47,28,212,50,218,177,104,189,201,96,128,174,34,138,161,30,101,237,32,203,2,252,59,
-229,239,123,190,65,157,163,2,209,14,235,139,41,134,151,120,213,89,189,250,113,198,215,246,104,1,13,29,27,137,
-211,26,25,214,206,1,10,49,24,118,190,167,143,235,213,169,67,64,52,200,162,58,214,2,223,242,252,127,208,106,
-31,14,92,111,35,201,65,116,5,133,69,75,196,6,31,224,155,119,144,139,38,118,202,221,121,100,28,151,194,141,
-197,224,240,236,184,215,29,78,31,34,0,177,170,176,75,241,64,35,93,22,255,154,97,209,58,72,220,29,244,174,
-170,233,86,101,114,174,231,50,209,2,167,69,141,10,198,166,125,204,20,140,115,149,195,50,207,140,16,161,79,217,
-25,167,147,133,98,121,76,200,241,177,199,94,52,75,60,129,118,144,131,62,43,232,134,50,96,246,64,241,2,177,
-94,67,77,150,100,82,21,160,249,112,73,28,239,202,52,109,80,228,127,97,196,113,50,119,243,250,193,249,26,151,
-64,44,6,26,250,24,105,162,73,211,62,187,102,80,248,23,71,35,229,157,31,27,104,249,201,103,64,57,13,225,
-222,81,215,30,120,28,159,134,106,208,132,45,61,50,118,43,38,34,35,85,126,238,54,218,233,160,224,203,162,176,
-210,136,13,108,8,180,13,187,212,221,30,140,21,15,197,229,237,247,141,123,36,245,153,92,187,83,180,126,51,10,
-125,43,155,123,28,51,41,170,65,10,57,234,49,158,163,244,32,174,126,135,239,61,160,180,132,112,210,45,162,93,
-160,137,236,63,173,136,208,152,229,93,54,119,52,199,63,135,32,42,211,200,197,126,121,230,203,177,214,106,242,60,
-89,210,61,121,89,73,249,217,22,253,22,46,52,249,56,1,64,184,238,34,152,52,247,116,227,186,122,100,119,127,
-41,43,244,6,148,95,91,24,234,212,162,57,196,168,224,226,51,161,206,20,130,180,138,34,248,120,182,181,132,12,
-112,194,112,56,100,180,37,102,70,66,96,217,165,199,180,104,43,155,106,234,235,54,28,246,9,204,31,74,215,202,
-92,7,80,20,81,115,33,59,132,59,73,158,43,153,225,49,157,77,92,95,66,180,229,250,161,50,106,203,26,70,
-132,193,39,29,147,104,41,224,226,121,42,131,91,11,18,57,91,202,34,148,11,28,115,143,187,201,133,95,147,87,
-146,245,166,126,55,203,221,229,203,151,154,45,32,155,107,182,239,46,111,111,52,123,9,97,124,191,89,226,172,39,
-224,212,102,99,244,192,174,127,206,4,77,136,169,111,166,37,8,231,247,209,247,213,36,218,137,33,226,222,247,82,
-210,52,51,162,76,163,243,123,176,127,175,149,245,251,79,225,213,131,224,152,133,7,110,6,245,44,76,184,173,209,
-58,178,12,17,98,58,81,137,143,233,68,250,71,135,4,106,120,17,55,188,220,8,206,1,169,96,121,173,240,163,
-235,213,3,4,105,99,221,70,23,158,68,170,128,67,59,62,130,62,188,117,125,201,15,185,251,152,224,191,217,136,
-133,68,26,233,26,77,113,204,32,220,142,115,63,174,16,10,20,230,211,11,45,114,201,147,249,237,4,248,50,43,
-97,105,144,249,231,144,197,231,144,125,144,215,200,85,45,33,68,194,131,51,224,109,201,26,147,58,25,39,243,100,
-19,200,146,178,109,159,247,142,161,227,232,162,233,94,199,242,133,5,4,58,239,40,80,216,2,22,186,49,5,2,
-177,87,24,242,244,216,11,168,216,180,146,255,158,103,144,213,24,162,159,148,41,100,126,88,235,87,35,234,88,202,
-54,150,197,203,199,117,156,203,27,253,90,28,244,59,39,221,47,169,100,140,94,12,30,234,253,254,237,112,249,62,
-218,85,206,91,228,221,187,56,198,144,128,208,209,110,237,124,93,22,8,95,179,30,207,123,107,81,157,117,7,128,
-205,5,203,122,10,177,133,96,69,41,22,139,227,39,139,162,79,124,155,166,255,147,79,52,38,132,225,54,238,201,
-48,250,31,67,126,234,254,142,97,92,63,143,74,15,194,146,83,71,200,6,134,163,97,154,31,145,32,72,80,210,
-143,87,56,11,220,38,136,164,4,14,60,216,251,186,186,247,202,169,17,149,88,66,205,97,197,154,136,21,192,149,
-55,0,174,47,54,35,22,29,144,188,209,142,235,132,144,210,203,93,31,188,68,4,79,123,210,243,135,67,59,62,
-167,182,43,18,91,204,53,172,49,131,236,85,63,130,45,61,72,30,37,117,118,226,118,236,80,45,160,212,53,138,
-17,73,226,6,98,7,238,3,209,75,45,132,134,75,8,76,56,81,9,31,38,27,105,14,198,231,63,209,230,165,
-158,255,32,215,34,89,39,31,18,184,121,102,185,4,66,78,224,13,184,120,185,104,13,7,142,96,53,199,101,9,
-29,41,194,106,101,93,45,184,182,45,232,217,185,186,244,12,29,218,44,21,230,254,186,104,138,47,176,248,7,237,
-121,212,31,63,0,245,192,151,141,118,13,195,133,50,68,146,195,65,11,122,26,42,95,191,112,62,31,237,22,64,
-155,141,74,252,227,214,152,194,63,192,10,225,32,20,254,97,241,240,143,192,11,132,23,8,47,16,94,120,120,31,
-225,125,132,247,17,222,7,56,246,102,47,213,11,103,20,23,237,252,128,122,103,160,35,231,181,25,215,195,97,46,
-58,49,4,164,29,207,144,212,211,176,193,189,64,165,109,154,134,204,243,196,193,226,11,79,109,162,218,238,167,99,
-0,28,62,152,139,133,214,244,8,147,140,201,131,245,37,21,88,20,117,7,117,44,249,172,223,228,188,243,168,93,
-195,124,62,242,142,28,112,236,174,27,235,218,239,23,180,12,81,223,43,76,173,77,253,5,187,68,239,3,134,142,
-157,64,237,164,136,220,226,30,199,141,151,200,34,42,151,146,168,149,99,135,139,216,10,80,149,75,43,226,27,187,
-42,244,43,149,99,7,219,73,219,237,131,200,106,14,7,154,63,113,181,204,136,35,21,153,167,88,149,176,34,11,
-84,27,213,97,145,166,255,63,234,112,48,126,70,77,2,39,157,43,239,93,168,89,249,149,5,175,36,28,237,34,
-210,8,155,167,4,113,175,137,110,211,60,186,96,147,97,16,151,115,134,213,69,175,127,222,144,203,219,104,188,148,
-6,78,88,244,108,153,11,153,227,69,250,52,167,1,141,206,74,8,200,73,15,117,156,29,14,131,217,14,42,8,
-64,3,151,71,72,101,93,34,228,201,29,54,241,69,61,242,81,82,79,38,68,105,125,94,71,152,160,16,212,67,
-163,136,107,187,157,173,145,189,169,232,32,152,36,68,187,166,218,46,47,177,128,235,251,133,59,91,238,159,121,98,
-242,194,161,153,49,217,57,131,186,169,139,83,234,162,155,186,127,74,205,146,28,129,46,15,88,49,242,15,201,194,
-175,238,160,178,92,214,244,117,219,96,96,112,174,199,201,59,248,225,141,20,199,161,127,57,183,20,113,222,74,179,
-57,162,41,90,105,22,238,56,22,42,79,163,235,69,34,40,110,116,170,242,113,48,171,36,248,32,231,155,16,50,
-67,107,176,17,0,82,11,40,197,27,177,217,34,95,78,229,8,172,255,89,193,59,146,68,194,237,139,102,246,203,
-86,153,138,149,94,240,15,34,190,213,116,121,255,5,154,238,194,154,238,226,212,116,23,231,139,54,211,181,193,101,
-176,53,122,199,147,204,82,220,66,105,166,85,165,198,34,188,196,115,84,212,29,229,116,210,106,183,83,179,151,65,
-226,59,179,77,18,51,221,51,54,30,113,142,230,87,56,166,134,27,130,151,144,94,54,5,151,126,199,208,194,113,
-249,229,168,132,199,210,150,94,227,192,239,178,118,112,222,14,46,70,222,133,2,150,85,96,106,231,76,186,68,164,
-110,156,114,205,184,27,46,132,249,229,2,94,6,187,252,202,101,48,125,169,153,240,23,157,104,167,67,169,96,123,
-224,84,161,124,224,84,75,216,243,79,152,101,230,51,225,140,103,11,19,126,225,154,108,229,59,46,165,32,105,214,
-174,140,185,184,188,254,229,180,110,200,16,36,181,3,119,15,97,98,79,20,244,100,243,133,160,78,15,162,8,34,
-56,197,36,188,183,10,137,188,136,122,102,74,136,54,152,177,120,57,101,38,232,41,166,21,171,103,84,4,255,129,
-114,74,161,231,76,60,3,202,40,62,60,26,34,100,115,11,83,106,57,81,197,84,114,249,129,42,15,239,94,80,
-189,241,241,27,80,153,199,183,159,107,218,181,225,60,143,121,40,93,116,224,182,110,40,56,11,221,94,37,114,12,
-227,19,168,2,231,115,167,130,145,28,163,244,68,50,35,237,135,166,27,156,214,209,124,46,40,218,121,131,11,119,
-30,212,120,76,20,140,254,62,193,107,166,150,176,46,14,105,167,18,150,2,246,62,165,118,25,150,112,64,229,131,
-24,217,87,136,30,2,133,64,20,184,21,41,40,55,50,34,130,239,68,213,115,232,66,112,208,207,244,133,87,210,
-113,69,154,206,34,38,253,89,98,220,67,132,152,214,59,55,62,162,61,251,242,166,219,50,134,234,75,31,254,63,
-233,228,250,153,159,203,81,84,254,235,151,111,179,75,54,174,237,246,186,42,184,131,129,191,90,34,23,71,184,179,
-122,181,172,87,179,148,94,199,157,37,76,217,125,155,154,185,29,226,251,94,240,189,150,240,134,8,203,44,184,218,
-68,62,93,40,247,2,89,58,20,172,26,47,233,139,28,93,31,34,209,226,232,190,136,69,215,125,17,72,128,90,
-23,114,154,141,205,166,124,193,11,222,88,197,40,188,243,230,184,54,89,178,181,151,162,116,11,34,37,190,66,8,
-38,85,33,80,132,26,120,207,142,110,5,170,233,234,14,148,205,187,231,222,78,191,178,126,242,41,245,188,184,245,
-95,14,187,190,76,142,190,213,190,57,32,27,52,74,251,57,193,158,90,166,94,247,212,102,54,51,144,174,243,163,
-114,21,126,31,240,187,7,236,182,219,164,254,14,47,88,193,59,41,221,217,182,122,87,141,241,174,147,58,157,84,
-107,12,159,191,3,25,206,146,134,209,248,253,244,25,63,129,5,122,255,249,3,134,33,53,60,199,95,201,17,144,
-109,232,198,192,134,12,165,132,25,243,251,183,70,202,237,231,173,12,49,168,195,78,27,203,59,155,22,219,236,177,
-130,11,11,95,124,181,117,121,45,211,215,159,189,78,184,161,79,62,82,99,249,59,231,218,165,192,75,11,191,120,
-195,21,94,168,212,159,245,219,245,179,1,44,134,138,114,145,215,123,18,201,118,232,224,75,72,201,233,85,49,7,
-253,184,216,5,54,11,252,60,108,223,45,135,255,1,254,147,52,81,32,155,0,0
+31,139,8,0,0,0,0,0,2,3,205,125,121,127,219,184,181,232,255,249,20,140,58,181,201,136,146,69,217,201,
+100,68,81,249,37,182,51,205,187,217,26,39,183,189,85,85,135,150,104,155,182,44,106,72,202,203,200,154,207,254,
+206,2,128,224,38,203,105,223,210,233,140,69,224,224,224,224,224,108,216,251,79,15,62,237,127,253,159,207,135,198,
+121,122,53,29,60,233,227,31,99,234,207,206,188,70,48,107,96,66,224,79,224,207,85,144,250,198,248,220,143,147,
+32,245,26,223,190,190,109,189,196,220,52,76,167,193,224,240,232,243,110,215,248,244,254,240,192,248,239,48,184,9,
+226,254,14,103,60,233,39,233,29,254,61,137,38,119,198,210,56,141,102,105,235,212,191,10,167,119,61,35,241,103,
+73,43,9,226,240,212,53,78,252,241,229,89,28,45,102,147,214,56,154,70,113,207,248,83,119,140,255,184,134,252,
+14,130,192,53,210,224,54,109,249,211,240,108,214,51,198,193,44,13,98,215,184,242,227,179,16,190,187,157,249,173,
+107,204,253,201,36,156,157,245,140,142,107,172,158,156,59,80,43,3,180,78,162,52,141,174,36,220,234,201,159,162,
+105,0,213,249,179,107,63,1,168,10,18,58,29,64,114,18,197,147,0,190,186,243,91,35,137,166,225,196,248,211,
+243,231,207,93,35,188,242,207,130,86,28,204,32,151,42,156,135,183,193,212,79,131,73,69,94,235,42,250,189,53,
+142,195,100,222,10,38,103,65,82,1,146,203,5,234,146,212,79,23,73,235,196,143,179,38,164,209,188,103,56,207,
+145,126,98,37,113,183,103,132,41,176,68,99,149,239,251,132,226,116,158,64,91,22,200,38,192,49,143,146,48,13,
+35,224,148,127,2,13,89,164,200,79,68,200,12,137,195,179,243,84,126,148,153,17,159,157,248,102,199,166,127,218,
+207,45,141,209,64,142,225,112,41,98,85,43,246,39,225,34,161,12,73,103,248,59,144,233,236,97,130,98,238,41,
+245,80,123,12,0,113,52,77,138,173,20,189,148,229,159,44,160,255,102,82,138,24,37,83,123,19,78,210,243,158,
+177,71,31,231,1,55,132,191,164,112,116,152,26,192,119,230,95,5,173,186,74,171,129,100,205,79,244,198,188,0,
+208,39,138,9,47,145,9,148,148,175,241,137,20,31,39,47,62,79,42,196,109,207,199,127,220,39,186,196,63,25,
+47,226,4,191,230,81,72,226,254,164,192,100,228,233,147,26,138,123,231,209,53,118,125,85,101,207,199,248,79,125,
+81,127,156,134,215,65,117,217,23,62,254,227,62,73,99,80,225,211,40,6,165,162,159,40,253,255,99,66,75,45,
+196,219,223,17,202,223,223,17,70,4,173,0,154,20,167,202,98,64,234,147,254,36,188,54,194,137,215,208,36,183,
+49,120,251,249,8,52,168,213,223,129,92,128,17,26,139,96,154,6,55,88,10,188,134,211,125,217,16,66,224,53,
+94,236,53,6,253,29,134,16,232,199,83,63,73,188,134,108,47,90,49,209,191,136,241,247,40,186,106,69,139,180,
+49,128,250,56,189,2,32,4,211,216,212,242,5,101,26,250,28,79,181,58,244,236,147,116,214,48,38,126,234,183,
+230,225,12,8,111,12,222,7,167,105,185,218,53,101,58,141,193,167,255,122,84,137,110,99,240,5,121,83,221,186,
+56,24,131,120,81,153,193,23,250,109,252,250,238,109,117,75,17,62,51,82,141,193,17,253,238,25,253,100,238,207,
+180,220,198,224,32,76,128,21,179,96,12,198,17,164,2,178,7,18,81,2,102,111,158,14,158,236,236,24,103,225,
+105,251,34,49,58,237,110,187,99,180,192,33,165,243,164,183,179,115,22,166,231,139,19,48,3,87,59,23,51,32,
+232,36,136,207,118,24,246,137,121,186,152,141,209,166,153,167,214,50,60,53,211,187,121,16,157,26,193,237,60,138,
+211,196,243,64,66,78,46,160,218,198,214,150,200,186,138,38,139,105,240,20,114,64,160,131,211,112,22,76,26,214,
+146,83,219,178,220,169,105,173,130,105,18,24,25,74,134,69,140,178,74,192,201,137,109,255,106,98,45,249,183,57,
+28,217,167,92,120,121,13,150,251,204,205,80,220,132,179,73,116,83,172,250,204,227,244,98,133,103,211,232,196,159,
+150,161,57,189,8,157,4,211,211,50,44,166,50,45,103,94,122,30,38,171,179,54,244,38,53,111,101,101,188,179,
+136,84,46,104,51,43,108,193,10,55,14,210,69,60,51,36,172,17,152,169,61,179,99,107,169,82,18,51,178,23,
+196,253,167,179,97,52,226,95,41,253,66,180,190,39,72,140,131,223,22,97,28,228,57,40,18,145,75,79,23,91,
+91,190,37,234,243,1,233,211,142,133,233,161,76,11,69,26,98,61,245,102,193,141,113,24,199,81,108,54,246,253,
+217,44,74,13,32,127,34,250,215,216,110,52,163,102,99,187,97,185,233,121,28,221,24,167,32,63,147,192,107,124,
+248,116,240,237,253,225,241,199,79,95,143,223,126,250,246,241,160,97,159,174,16,223,212,67,218,189,165,104,118,111,
+185,90,185,216,134,97,103,212,30,251,211,169,57,149,194,97,43,182,5,220,192,153,71,128,206,104,24,140,36,187,
+18,115,246,106,214,11,172,149,61,181,179,146,129,205,188,91,9,40,172,82,102,18,21,225,70,188,2,131,107,34,
+116,228,117,220,168,31,183,167,193,236,44,61,119,163,102,211,74,204,24,25,175,200,88,153,75,167,55,84,20,11,
+12,133,62,214,250,242,240,26,98,170,195,171,48,5,187,11,98,129,50,211,62,14,48,49,241,244,143,251,251,37,
+240,135,18,174,252,219,247,97,146,6,179,32,150,48,122,210,253,189,18,201,85,65,203,244,202,92,253,163,173,127,
+172,1,155,199,81,26,33,199,20,141,170,174,90,192,28,185,53,224,144,232,47,166,233,7,29,212,233,212,161,132,
+128,56,7,169,184,61,99,85,8,147,143,139,43,48,90,240,125,127,63,235,119,238,239,33,197,255,8,159,22,203,
+230,87,192,34,36,121,102,92,45,146,212,56,9,12,95,132,107,224,130,103,84,156,68,185,196,240,153,236,106,82,
+239,58,18,3,72,201,232,194,36,22,221,32,182,207,253,217,100,10,127,65,136,108,8,92,18,59,180,167,18,59,
+105,165,222,237,86,78,32,64,4,132,1,66,179,24,96,11,26,66,251,53,176,54,101,96,163,63,145,41,54,203,
+153,214,214,86,69,17,33,215,214,18,100,0,40,91,92,97,22,168,25,86,10,65,77,56,3,239,50,27,163,182,
+16,243,80,90,145,155,65,156,89,95,192,163,217,137,237,111,179,177,191,0,215,103,27,139,89,50,15,198,225,105,
+24,76,12,65,185,65,117,183,13,115,187,25,196,205,134,5,252,134,12,138,62,97,204,225,129,236,73,252,241,106,
+181,18,108,203,41,197,16,89,65,228,133,201,55,41,89,166,128,180,164,21,59,245,129,58,6,122,43,123,68,193,
+44,147,155,48,29,159,155,170,189,138,9,99,31,236,189,211,19,144,108,147,176,114,203,61,137,3,255,210,165,252,
+110,57,223,214,89,151,3,222,125,0,88,251,232,170,146,66,53,122,40,42,222,235,56,246,239,116,77,128,65,72,
+192,216,84,89,219,177,92,89,143,63,159,79,239,84,69,9,56,33,233,197,148,112,100,156,120,84,13,74,100,61,
+89,23,65,154,144,19,204,60,149,43,77,37,90,208,16,172,103,216,135,4,55,4,195,169,64,134,225,168,76,167,
+212,177,120,17,212,234,24,12,4,164,90,230,85,77,233,19,235,220,149,203,70,65,117,190,202,46,155,3,153,165,
+89,5,229,15,172,205,180,83,87,43,80,5,73,34,195,162,93,0,163,147,37,55,108,162,184,130,186,182,34,243,
+85,41,169,167,242,74,52,177,78,88,229,36,213,41,110,73,6,42,202,87,32,104,207,23,201,121,198,60,70,83,
+81,207,176,156,166,122,68,40,107,125,189,5,195,36,106,190,241,99,208,108,105,221,51,85,47,219,103,144,227,171,
+10,167,200,22,234,202,123,200,235,172,160,134,171,173,173,171,65,7,226,215,50,29,44,205,131,171,188,163,206,17,
+233,161,204,186,96,196,96,232,25,176,93,53,27,230,12,98,33,203,64,8,158,184,136,146,36,60,129,168,73,167,
+199,184,10,174,162,248,206,104,52,27,83,208,124,8,15,83,138,223,219,198,159,39,134,82,23,3,196,30,211,0,
+234,27,240,63,16,109,41,248,68,211,50,210,8,44,246,24,108,8,64,77,67,0,107,131,172,213,53,201,210,162,
+102,73,59,12,48,199,249,248,27,140,162,158,135,65,237,106,19,111,24,205,188,135,117,184,190,48,80,81,167,223,
+255,41,205,166,8,23,2,181,137,199,222,66,197,103,103,50,40,139,161,115,174,3,73,44,211,113,198,234,71,5,
+33,166,163,242,212,253,74,97,243,134,141,205,39,112,237,76,105,114,166,149,84,139,108,225,153,181,81,152,145,39,
+106,173,21,196,47,91,78,72,217,220,235,118,248,127,204,52,222,223,87,89,37,173,77,196,163,42,111,206,164,17,
+95,164,247,144,100,123,45,7,43,162,146,158,226,28,70,58,185,6,100,150,115,107,43,247,173,21,194,225,227,20,
+20,204,168,142,39,114,86,60,207,101,221,144,231,115,132,45,87,85,148,157,45,102,129,133,98,111,40,26,23,182,
+90,198,160,227,146,44,99,62,248,195,92,227,68,154,106,4,183,73,79,201,53,75,241,42,228,0,98,133,38,77,
+38,246,59,185,46,16,53,10,54,3,26,199,90,234,9,29,183,150,73,108,80,9,56,153,147,231,87,178,229,88,
+171,255,24,7,55,87,130,215,211,105,197,136,32,139,188,47,131,187,117,113,118,129,45,79,215,145,143,61,85,140,
+23,129,121,157,82,56,160,166,12,202,154,80,47,125,122,147,235,42,34,9,130,22,129,133,207,161,32,210,32,29,
+173,118,129,179,22,198,213,225,12,140,147,102,206,116,166,97,57,107,85,151,89,66,231,22,27,171,211,61,45,140,
+79,203,225,122,201,226,160,231,174,53,180,25,144,210,169,44,105,121,115,30,78,3,179,24,115,90,15,99,27,22,
+203,180,32,98,95,109,214,53,117,210,56,93,39,132,128,96,115,75,233,13,71,90,168,166,24,86,21,172,17,116,
+57,67,148,199,220,10,207,47,3,118,209,42,248,243,96,163,246,113,130,184,216,176,130,128,139,129,238,181,178,78,
+15,138,64,6,171,198,108,142,106,185,150,41,242,178,20,209,107,210,74,116,10,244,215,80,45,66,38,155,169,151,
+72,171,202,112,3,87,89,52,160,17,13,122,169,10,139,192,9,146,114,225,210,74,43,39,102,36,234,75,137,57,
+7,189,140,112,26,245,101,212,84,43,124,63,245,188,217,98,58,213,203,103,113,178,142,130,203,94,71,225,4,24,
+182,178,151,171,145,221,221,96,198,10,59,245,219,107,251,4,162,130,4,152,7,217,129,61,159,250,41,46,70,216,
+11,223,93,248,222,204,191,14,207,252,52,138,219,11,0,121,125,134,163,251,52,122,31,221,0,59,33,10,5,81,
+147,5,52,80,153,84,128,252,246,218,91,248,237,43,31,199,230,59,102,52,15,98,255,62,12,238,49,198,58,141,
+110,239,199,16,157,92,5,247,215,160,103,64,180,53,252,103,242,207,157,222,200,28,254,243,230,159,147,127,182,71,
+77,235,85,251,217,43,51,241,79,253,56,148,80,101,160,251,159,172,29,235,254,126,136,140,179,27,139,217,229,44,
+186,153,53,236,206,200,197,230,121,223,94,195,160,28,249,28,6,56,245,28,141,201,16,183,229,143,15,0,227,10,
+126,120,203,153,127,21,244,84,9,81,101,227,21,164,236,142,56,221,22,137,61,68,126,127,63,199,149,221,183,211,
+200,79,77,85,140,218,9,117,65,194,222,232,21,253,23,203,118,71,150,226,117,143,107,202,152,19,206,205,87,61,
+127,114,31,77,238,207,163,89,0,45,122,213,8,163,164,209,51,53,6,190,234,221,4,39,81,114,15,99,245,24,
+122,158,154,173,56,47,128,174,252,241,253,77,56,131,128,99,182,184,37,190,52,162,244,28,100,114,100,13,59,163,
+213,74,182,117,40,254,182,145,144,17,7,188,85,89,77,106,225,59,80,35,153,42,24,96,59,29,43,95,78,73,
+193,176,152,160,87,82,152,205,20,160,44,194,187,27,138,176,110,32,236,95,223,189,85,2,29,220,130,222,79,50,
+43,49,6,167,50,177,161,9,0,207,254,86,68,17,232,115,101,50,216,167,115,63,249,28,71,115,158,34,225,116,
+27,61,169,69,8,134,240,115,228,113,50,253,206,244,115,12,210,47,7,23,56,172,130,38,98,146,71,229,86,99,
+210,13,105,128,5,134,44,193,37,40,13,0,39,221,176,140,200,56,62,78,22,32,75,199,199,229,146,194,12,112,
+53,182,32,31,28,120,27,126,126,186,153,225,87,16,167,119,118,8,214,227,246,211,41,120,161,182,248,121,127,175,
+184,19,166,193,85,198,149,208,235,216,83,182,243,50,168,237,79,105,150,7,57,20,202,40,133,135,212,28,223,18,
+2,185,204,32,12,120,203,89,217,228,148,176,78,250,145,179,231,158,232,87,179,193,190,164,97,229,166,173,149,42,
+42,176,246,142,148,166,113,116,122,26,4,16,180,208,98,140,108,4,177,104,31,23,238,212,122,12,206,7,36,246,
+105,12,66,119,32,190,92,150,12,19,133,69,43,33,39,230,32,246,185,137,226,203,32,62,162,117,181,94,3,23,
+202,56,165,125,145,52,108,254,153,244,186,118,28,204,3,63,237,117,236,108,125,183,215,248,211,233,233,105,195,254,
+109,225,79,195,244,174,231,116,108,94,89,39,139,36,214,213,233,55,173,246,114,95,114,194,36,56,89,156,245,104,
+180,106,79,66,212,83,254,0,111,165,83,239,225,56,199,191,235,61,239,116,236,113,52,191,83,64,82,12,161,89,
+96,94,241,167,224,194,9,24,96,148,96,251,218,159,170,104,113,49,195,137,11,49,56,230,145,42,151,241,228,178,
+4,213,154,96,204,34,62,131,224,111,220,116,149,198,11,220,197,212,36,72,63,49,46,69,135,171,133,183,146,205,
+72,28,208,227,201,111,210,38,12,36,76,36,216,211,105,178,88,235,200,31,90,75,204,230,4,66,176,90,173,160,
+201,249,213,4,174,63,19,12,213,122,161,158,2,175,134,37,27,35,242,74,247,83,170,108,107,75,6,223,212,139,
+141,251,123,241,201,61,217,176,50,63,174,149,205,17,231,214,16,167,133,147,185,222,66,82,227,32,33,177,101,202,
+196,23,242,87,99,163,42,132,225,103,206,102,137,28,97,180,228,32,129,153,173,55,92,34,230,105,192,124,215,105,
+28,83,99,54,1,94,108,145,63,153,188,69,81,201,218,67,251,114,236,92,171,72,152,144,34,228,179,148,52,209,
+159,153,224,173,8,12,37,144,126,180,53,29,201,201,131,158,161,243,36,167,40,96,205,240,147,59,67,111,55,88,
+61,29,142,173,184,236,126,89,3,239,132,16,20,22,120,35,132,193,166,118,50,164,85,66,32,182,79,212,96,16,
+242,35,80,240,23,227,224,120,240,29,166,31,248,169,159,95,145,222,218,210,51,88,66,9,133,190,150,163,64,4,
+7,218,184,115,193,227,154,240,103,113,225,123,159,132,246,139,220,70,181,207,203,53,221,131,98,213,107,224,106,40,
+169,43,113,127,47,170,254,91,112,242,235,251,98,126,177,222,58,160,154,74,43,193,73,77,100,215,160,217,204,241,
+134,122,231,44,72,5,48,242,142,133,88,108,67,96,80,185,142,69,57,218,194,11,49,150,188,239,71,136,3,133,
+229,216,172,66,213,85,21,213,81,138,94,153,88,157,211,86,237,223,1,123,113,59,20,1,53,114,147,43,194,124,
+179,110,211,111,171,168,184,188,113,206,43,236,97,8,237,11,27,134,46,194,168,131,41,58,85,166,81,56,13,171,
+76,200,235,105,28,248,147,59,67,64,52,172,117,250,4,189,191,78,81,10,168,255,134,5,13,8,115,197,134,36,
+53,91,9,218,100,204,227,48,138,113,98,92,109,2,108,200,25,15,225,224,40,206,164,148,25,244,29,27,170,142,
+240,104,225,44,76,206,3,182,94,137,76,37,94,126,246,105,15,75,158,51,23,200,12,105,155,139,86,57,244,46,
+32,102,2,0,79,231,190,8,158,58,125,136,97,78,95,93,244,225,191,189,139,1,241,212,19,137,205,230,69,175,
+213,186,64,71,162,89,99,98,70,209,240,234,75,150,89,23,113,133,96,13,111,102,34,197,180,220,34,251,121,203,
+203,103,127,26,64,100,5,14,12,217,162,166,103,144,117,31,37,119,76,41,132,185,70,101,213,109,214,152,26,204,
+43,109,162,16,20,54,6,15,170,207,193,136,28,16,209,51,104,51,196,90,157,146,208,250,39,16,250,23,123,134,
+67,50,151,167,141,184,105,156,228,149,195,148,118,114,30,158,166,204,34,1,36,227,10,154,93,229,160,55,58,51,
+27,151,225,20,70,78,103,134,216,198,199,192,64,176,136,5,33,66,189,10,103,126,138,237,170,136,169,202,205,34,
+210,27,165,22,233,61,87,22,185,188,42,42,233,211,186,255,131,159,158,183,129,146,130,190,137,66,101,105,180,92,
+125,219,82,65,140,169,82,79,19,99,21,244,73,89,134,188,190,38,14,32,7,217,7,136,131,38,40,37,200,102,
+179,119,209,106,21,36,253,162,36,230,150,182,200,98,181,129,170,67,31,70,179,138,230,99,74,95,22,118,85,153,
+97,78,20,142,179,110,36,254,98,63,114,150,209,104,134,178,15,105,144,197,228,49,218,2,251,120,4,160,122,60,
+154,1,23,19,180,202,217,212,211,53,13,27,143,171,228,140,103,209,171,178,196,240,75,200,159,133,203,239,199,37,
+126,19,119,4,132,148,166,227,172,59,223,10,235,197,36,144,91,177,86,69,184,106,108,171,21,243,86,161,205,58,
+169,40,156,185,170,178,102,179,67,81,254,2,109,64,198,112,202,4,54,11,55,134,109,109,54,12,105,109,141,22,
+100,85,240,132,197,11,0,57,89,206,71,231,141,116,179,233,86,218,137,10,208,157,42,201,47,88,248,161,70,226,
+200,163,143,199,88,206,106,16,198,153,75,211,152,195,233,198,156,51,192,175,249,211,187,223,113,175,161,170,56,71,
+242,160,107,41,75,236,216,235,244,210,169,50,203,206,134,102,25,221,181,16,202,204,201,104,140,178,201,66,14,112,
+161,66,183,107,53,174,35,23,134,80,167,168,112,12,43,43,138,88,30,162,104,2,81,176,121,252,110,135,28,46,
+131,192,93,226,166,192,128,86,61,29,252,79,23,255,179,107,71,167,167,16,21,216,115,4,98,107,121,74,76,235,
+210,30,150,142,171,248,151,181,140,172,30,122,57,68,133,204,146,252,188,192,141,45,142,123,129,115,30,60,44,129,
+204,225,5,45,103,54,61,51,11,230,212,74,131,245,140,19,177,250,163,240,247,64,40,0,239,62,95,81,177,60,
+64,75,7,208,100,68,5,51,186,210,156,130,111,195,109,243,160,61,100,241,105,186,193,4,172,59,78,176,107,53,
+27,151,39,32,67,20,92,162,81,251,22,206,210,151,180,245,7,65,44,151,57,195,44,112,42,121,112,201,60,232,
+98,51,29,201,132,75,100,66,215,189,204,49,193,25,94,226,216,241,180,235,101,76,16,49,208,148,145,236,34,88,
+87,34,153,34,146,93,144,198,102,19,188,44,54,158,178,135,225,136,232,197,97,145,73,93,198,68,242,142,85,208,
+180,42,22,47,25,70,114,82,240,150,164,46,159,35,121,140,178,77,129,52,114,229,13,40,159,57,68,140,35,123,
+137,194,215,107,80,38,238,133,110,172,170,66,17,217,1,98,164,102,11,51,91,21,72,43,53,40,74,48,11,111,
+234,39,151,98,238,72,83,245,162,26,243,98,96,41,8,254,24,25,8,43,92,88,162,197,215,42,170,29,84,4,
+158,82,91,197,184,90,3,24,230,11,55,155,35,87,143,152,116,194,100,188,132,13,80,3,151,175,240,33,188,128,
+38,184,20,210,145,220,10,23,96,98,33,225,2,28,16,82,3,198,103,194,250,87,89,230,188,71,168,114,128,194,
+19,207,163,36,253,192,190,152,170,40,117,73,126,48,167,77,2,167,183,202,132,193,239,252,24,12,15,230,148,7,
+45,118,197,104,197,226,129,116,185,82,133,172,48,27,194,146,0,53,22,231,153,114,19,4,50,77,173,76,224,110,
+159,52,56,156,6,248,101,54,196,49,13,185,84,203,159,98,104,85,38,60,15,37,134,89,21,141,89,1,89,94,
+14,54,227,158,217,232,162,111,66,86,129,114,189,133,136,56,143,33,155,249,36,24,48,82,211,47,184,196,245,8,
+86,82,193,73,236,223,16,239,196,228,17,148,207,171,99,97,116,142,253,88,193,126,20,203,234,40,5,69,144,116,
+208,165,159,57,101,145,225,152,148,103,68,178,164,196,30,151,155,250,73,202,63,49,0,40,73,111,203,177,121,78,
+86,88,44,252,157,155,223,45,205,102,137,73,225,10,14,137,41,226,10,70,169,57,229,92,158,72,148,51,198,185,
+60,78,179,115,161,72,175,62,114,145,243,217,57,8,78,179,65,48,190,210,73,37,168,67,95,18,194,185,80,94,
+186,107,208,102,201,204,102,203,105,16,178,0,228,151,178,60,53,119,146,155,88,41,151,168,234,249,92,17,171,128,
+137,132,167,30,79,166,234,26,184,245,192,228,10,129,106,147,43,128,181,40,121,96,252,138,70,31,119,189,186,180,
+1,23,98,176,226,150,143,87,149,155,112,59,86,111,56,202,118,19,168,94,196,117,1,101,201,165,237,18,219,246,
+160,102,49,90,18,41,98,187,173,212,29,160,115,101,234,139,42,86,113,209,13,33,236,101,121,105,165,215,181,121,
+85,166,231,172,70,184,36,103,15,119,71,150,185,107,129,159,124,178,179,243,39,35,137,22,241,56,248,0,181,131,
+197,255,246,229,189,199,7,138,218,87,254,28,207,173,137,67,73,234,116,146,1,255,219,217,49,90,173,150,241,193,
+15,103,198,235,57,142,143,124,90,178,120,31,157,133,99,204,34,40,90,59,51,196,17,53,207,80,198,16,58,80,
+88,194,55,119,239,38,230,182,118,114,109,27,104,210,138,166,183,80,174,108,203,182,187,147,60,32,31,174,58,194,
+179,86,107,234,97,168,124,73,60,194,246,110,246,134,79,125,173,41,43,142,186,149,11,127,90,164,27,150,142,22,
+105,190,248,233,60,217,23,39,82,215,148,213,142,255,229,139,243,249,180,135,43,207,206,177,201,242,96,37,160,215,
+199,151,65,202,223,26,82,92,147,225,153,58,207,112,186,47,221,66,214,95,120,234,206,51,94,236,233,89,160,62,
+254,244,205,93,26,96,63,103,40,158,233,101,118,140,151,90,237,160,50,1,192,2,22,157,33,168,161,127,93,4,
+11,204,2,21,210,178,62,188,254,251,241,219,47,175,63,28,30,29,191,251,120,252,215,111,135,223,14,177,120,199,
+69,89,124,14,245,164,227,115,168,29,194,146,151,140,38,81,117,161,209,167,224,232,107,120,133,136,59,25,25,72,
+222,87,80,180,128,1,222,33,147,193,88,96,219,59,157,14,144,188,171,1,79,238,192,80,134,227,34,100,13,14,
+55,87,255,235,201,197,34,73,177,79,64,69,50,58,50,220,97,50,7,103,35,198,188,36,21,25,165,122,31,80,
+111,227,233,66,98,245,114,165,243,104,255,253,187,253,255,58,70,78,29,124,251,242,250,235,187,79,31,143,63,28,
+1,212,110,167,163,131,189,255,244,241,215,227,207,95,14,143,142,142,63,0,47,243,176,63,63,151,100,1,95,249,
+212,35,198,129,168,58,129,162,54,76,178,28,79,156,226,80,153,96,61,50,12,127,9,32,144,60,1,199,179,179,
+207,135,30,105,125,253,60,24,95,26,83,180,21,57,38,29,1,227,130,248,75,144,204,129,206,138,222,26,43,20,
+251,136,33,207,105,110,219,187,131,247,135,199,95,223,125,56,252,244,237,171,104,16,29,92,215,64,62,191,131,230,
+191,123,123,76,160,4,178,199,32,146,230,191,5,39,98,46,201,128,193,144,49,129,166,98,75,21,25,34,246,87,
+240,95,193,200,103,135,2,209,161,129,89,76,12,240,9,16,241,4,198,21,26,73,95,51,146,212,240,54,149,206,
+182,4,205,194,52,4,47,245,123,0,230,212,180,140,37,101,107,166,246,128,86,81,140,215,128,244,47,193,116,14,
+180,201,253,78,137,241,54,140,161,93,210,234,230,240,46,230,224,55,3,94,190,193,81,84,14,53,241,132,141,43,
+157,78,230,200,5,24,242,253,167,165,174,196,164,172,171,249,237,119,183,190,232,185,52,12,162,172,80,250,202,194,
+171,39,101,66,81,250,49,6,125,31,69,115,51,133,174,7,137,187,154,23,169,197,13,4,144,243,122,6,14,31,
+139,241,108,133,94,214,114,159,228,74,132,167,134,153,153,21,225,182,13,136,118,140,78,17,57,131,155,79,249,12,
+106,59,76,168,200,225,213,60,189,171,2,149,18,133,222,27,143,15,152,141,33,72,206,81,10,145,254,213,200,248,
+44,104,2,205,89,160,187,238,25,68,171,241,27,89,55,16,152,0,241,182,27,150,91,137,184,130,6,224,45,173,
+129,148,224,87,165,148,26,139,151,231,36,134,21,66,49,170,49,149,248,184,33,99,180,144,198,252,94,201,19,156,
+32,190,194,163,18,108,235,249,18,129,159,150,165,126,90,125,175,96,79,53,107,52,35,84,33,102,178,5,79,115,
+156,169,34,190,200,58,37,138,107,113,179,101,129,225,194,60,9,38,122,41,163,149,199,88,33,157,178,212,192,171,
+244,48,143,34,18,170,83,248,254,92,141,206,173,236,47,225,123,49,164,70,102,102,29,33,39,13,74,165,112,160,
+247,102,1,17,102,108,170,162,85,96,101,199,214,108,22,184,80,144,47,8,100,141,173,173,156,147,129,79,112,43,
+117,90,136,241,170,220,188,128,3,74,219,88,26,180,163,134,20,198,54,120,76,87,237,191,87,86,149,66,213,240,
+232,221,193,225,235,247,199,111,190,189,125,123,248,229,248,232,221,63,48,4,113,94,212,113,244,243,241,254,167,143,
+95,191,124,122,255,30,160,127,125,253,238,35,66,183,95,214,129,163,223,126,125,240,191,190,29,125,253,112,248,241,
+235,241,231,195,47,251,240,23,181,119,227,50,228,205,234,98,154,103,53,53,84,116,6,133,70,212,183,52,132,2,
+164,229,150,183,140,146,186,186,149,136,124,21,250,32,113,26,214,103,101,14,149,49,228,74,243,10,153,127,107,182,
+74,13,183,13,181,124,86,145,151,97,177,42,250,187,44,180,143,138,244,140,166,134,191,70,180,139,6,161,28,15,
+14,40,228,124,200,209,148,108,42,171,96,181,245,108,27,111,128,98,204,171,161,188,157,70,111,195,219,96,98,58,
+214,234,42,105,27,76,21,22,200,26,84,132,57,96,222,32,80,21,155,10,224,223,107,252,91,93,76,92,99,110,
+203,206,105,245,164,252,171,28,85,208,60,230,126,62,108,76,74,49,80,109,236,9,54,45,104,207,162,155,162,253,
+27,79,33,172,149,45,54,107,194,210,98,153,106,40,168,37,9,82,133,11,104,243,6,53,62,53,53,128,148,53,
+84,73,89,67,168,86,93,163,6,197,16,121,163,208,38,39,114,31,35,32,25,17,163,31,39,204,20,39,211,245,
+58,63,45,11,232,73,102,246,167,81,130,102,60,227,65,173,96,240,176,180,61,134,18,65,85,3,87,134,152,40,
+122,176,157,133,56,191,174,157,136,137,43,69,47,35,170,167,77,48,52,202,162,80,17,27,207,25,159,62,31,126,
+180,36,84,130,155,79,183,113,214,100,219,122,80,94,109,163,139,250,173,69,92,85,97,176,224,80,57,76,167,254,
+63,3,130,110,124,12,119,190,223,224,117,48,63,45,133,203,156,70,60,182,104,159,71,73,186,194,57,155,32,152,
+93,211,101,66,59,55,73,33,110,207,38,75,218,56,155,66,147,42,100,94,27,82,83,102,103,237,118,187,81,40,
+197,60,242,104,102,77,49,196,20,36,89,85,192,237,147,112,230,199,119,120,82,17,202,109,251,184,138,197,14,96,
+91,14,183,10,5,162,89,52,15,112,50,163,176,46,95,209,119,15,182,34,152,52,220,181,177,105,67,181,66,19,
+76,3,9,128,208,180,42,48,175,177,38,133,200,208,173,105,25,137,244,191,217,52,253,242,160,54,13,207,101,135,
+225,174,201,110,82,238,182,205,26,77,180,1,198,215,48,84,129,128,26,241,209,94,44,1,130,104,43,248,81,49,
+174,170,26,106,252,136,181,36,54,4,41,170,114,180,72,101,33,169,67,155,49,60,16,177,75,198,112,186,27,3,
+130,195,135,53,0,239,127,161,171,48,92,35,127,96,252,123,198,63,2,232,125,183,13,198,235,26,43,183,126,252,
+164,168,18,59,79,54,18,132,71,59,38,21,110,136,187,159,212,142,18,50,99,219,73,26,147,177,170,49,133,52,
+151,1,195,49,178,243,96,204,201,25,27,97,154,24,13,52,114,189,126,58,104,24,243,56,58,129,84,16,15,127,
+226,207,83,154,226,224,85,194,24,137,170,181,177,25,45,109,210,163,228,111,97,122,206,214,179,183,109,21,109,106,
+132,169,16,88,233,165,22,39,76,191,249,220,170,113,30,98,80,187,193,8,185,98,249,177,176,218,174,237,198,41,
+11,220,38,177,135,54,64,162,41,164,96,194,95,69,238,35,115,114,0,82,153,158,66,151,101,19,171,150,106,93,
+133,99,8,229,122,8,78,151,167,183,98,185,49,91,37,81,179,57,182,54,35,91,14,80,0,19,11,75,134,144,
+55,5,228,0,209,217,155,52,13,72,250,14,127,250,70,85,3,32,167,217,180,106,131,153,147,59,244,174,249,146,
+184,149,160,6,124,206,74,67,81,254,233,52,194,93,10,198,78,54,215,92,59,174,197,21,132,16,6,195,10,178,
+194,142,201,6,157,132,60,235,74,63,250,198,75,250,81,221,134,172,2,116,199,68,220,51,227,37,72,44,148,112,
+107,149,224,14,71,249,90,15,24,106,87,127,109,17,147,248,52,24,32,98,203,216,50,156,58,106,52,86,225,229,
+155,239,112,149,19,72,131,58,159,105,83,242,77,227,214,130,132,61,183,22,7,118,248,48,67,49,2,28,93,188,
+227,179,144,14,152,156,53,121,221,53,121,187,50,175,146,134,213,198,145,63,181,24,164,125,190,40,238,191,198,95,
+182,209,129,255,91,235,167,29,209,220,240,10,202,126,116,117,229,131,237,1,131,100,179,217,193,184,5,98,222,42,
+125,125,108,192,88,167,3,99,174,20,3,186,55,95,63,30,31,254,55,12,88,123,16,184,122,63,45,129,142,149,
+141,183,209,194,111,157,156,213,247,10,79,169,217,78,129,178,104,179,56,108,174,159,172,227,25,204,253,104,49,157,
+24,120,129,28,226,146,119,125,10,148,237,172,89,4,130,145,82,93,156,84,227,94,217,101,194,8,34,53,234,162,
+180,213,218,254,226,43,141,184,199,14,162,155,26,223,201,182,123,30,211,95,113,60,196,180,10,147,157,82,87,48,
+220,164,117,90,20,84,136,57,218,144,228,242,108,33,252,178,42,157,138,190,12,3,178,61,67,129,94,130,107,4,
+87,130,30,186,167,57,104,219,152,130,51,251,76,89,113,120,118,22,196,193,164,199,211,149,54,121,88,224,135,22,
+233,136,1,96,157,96,110,103,139,55,48,230,40,211,209,46,87,38,231,141,113,8,82,191,244,99,21,163,151,58,
+2,100,221,27,119,211,183,249,163,58,233,7,250,200,184,191,55,158,150,88,81,221,115,20,140,74,102,151,217,71,
+29,98,109,198,137,47,135,239,15,95,31,29,110,87,211,140,125,112,176,136,121,201,71,143,216,96,204,90,174,87,
+137,142,91,158,179,222,168,147,193,20,229,171,236,123,213,235,129,149,3,142,154,22,18,130,98,251,242,246,87,92,
+201,80,162,177,82,62,196,90,214,155,224,12,58,237,157,92,242,170,218,58,144,49,146,35,181,125,136,17,208,74,
+86,112,58,183,246,252,211,50,251,44,8,52,175,50,66,58,207,129,113,192,33,198,179,90,220,167,69,92,149,161,
+214,56,30,239,118,209,175,102,251,68,170,34,119,168,44,245,79,166,21,142,93,41,201,149,127,25,28,19,144,89,
+231,211,41,87,163,113,183,203,68,118,159,191,168,9,129,171,130,51,128,174,141,197,116,130,199,24,42,213,7,6,
+10,245,5,163,190,224,16,233,98,61,98,226,28,242,203,28,115,244,242,202,48,59,183,135,7,111,94,190,220,237,
+118,140,127,25,144,62,128,240,198,129,49,64,79,251,168,167,99,85,155,67,236,130,24,18,163,224,31,11,46,178,
+81,68,54,60,163,141,203,6,238,190,93,51,133,244,148,234,182,114,157,90,51,245,25,144,16,1,141,45,103,243,
+62,196,203,249,30,234,67,198,106,226,31,100,226,75,11,184,203,44,161,180,127,113,40,22,142,48,140,236,220,190,
+125,59,218,148,71,26,87,4,166,22,116,36,214,81,49,220,47,168,221,202,50,139,138,148,13,145,32,246,191,34,
+179,245,229,253,161,57,247,239,166,145,63,169,143,150,50,112,242,106,181,138,11,241,173,211,177,170,87,35,116,28,
+50,68,238,172,25,18,104,93,32,232,107,99,64,254,94,142,112,140,38,132,178,235,7,8,241,98,38,55,116,8,
+20,149,195,156,252,200,232,191,241,200,174,94,130,226,237,7,228,69,83,76,89,233,131,250,41,135,159,121,166,244,
+115,140,146,155,123,31,80,115,189,200,176,132,179,217,68,189,84,109,91,163,223,117,177,106,85,220,42,174,241,3,
+249,209,170,167,121,188,235,32,134,113,226,77,48,17,139,78,141,53,38,133,98,58,186,212,243,145,86,231,17,246,
+36,199,208,100,113,66,211,161,102,199,46,139,164,181,118,173,25,247,229,44,102,180,213,105,12,113,214,25,54,16,
+165,190,103,12,121,231,188,113,30,142,228,207,105,52,26,114,231,141,134,4,213,110,183,71,213,202,72,187,15,15,
+130,41,140,161,214,104,98,166,19,229,57,21,60,181,103,152,40,169,187,24,126,148,245,101,189,158,8,146,193,130,
+101,106,98,244,251,104,199,238,55,210,3,70,163,166,34,245,34,221,154,34,164,191,187,245,163,111,44,43,16,14,
+42,26,132,145,167,32,91,131,211,39,109,214,143,213,53,9,254,224,79,241,86,21,232,205,9,246,1,42,240,58,
+137,173,155,234,170,23,213,82,236,35,206,107,112,155,148,64,134,182,145,53,26,70,47,242,44,71,61,251,234,22,
+127,87,15,72,241,63,130,56,194,102,38,198,176,115,219,233,140,134,180,203,113,4,85,226,110,103,22,106,99,26,
+166,65,236,79,219,6,158,29,20,19,141,97,98,252,253,211,151,96,82,68,120,19,2,251,113,62,50,154,65,68,
+26,0,59,1,22,44,32,77,81,210,30,41,204,32,40,156,16,49,204,223,129,130,4,251,153,246,25,183,235,157,
+212,36,248,123,20,35,189,160,121,146,101,54,83,67,86,150,167,213,234,61,23,12,54,30,112,88,25,174,26,199,
+21,253,59,142,10,135,7,17,228,0,29,106,114,110,189,50,94,23,253,15,158,44,169,85,19,1,93,183,171,74,
+254,47,66,113,49,171,73,196,192,80,175,204,232,85,53,119,35,255,0,173,28,70,236,110,174,235,93,205,38,166,
+27,219,22,209,68,108,198,57,57,174,36,161,89,211,33,154,51,214,217,126,241,208,124,34,142,136,209,8,98,65,
+221,146,64,220,76,82,251,138,100,109,120,65,28,194,152,25,155,123,1,163,202,12,184,166,167,8,112,100,252,203,
+163,58,220,205,93,23,20,124,200,37,189,255,199,209,81,15,47,30,157,250,103,60,181,107,190,63,122,195,106,103,
+25,184,95,241,165,129,55,11,37,182,225,64,235,232,98,171,34,142,161,201,198,134,131,75,99,111,52,52,181,20,
+140,89,59,111,45,244,8,123,224,16,76,113,100,99,215,26,173,85,220,247,191,39,73,166,178,120,243,112,173,43,
+90,163,171,89,185,71,105,231,38,222,178,255,104,71,137,60,78,54,210,205,218,153,109,218,96,85,19,211,174,157,
+243,86,123,42,137,134,45,195,116,176,67,112,110,250,161,232,80,186,211,110,165,39,125,64,171,214,69,11,133,112,
+97,15,195,5,51,31,47,144,56,1,133,240,123,19,220,42,132,40,162,145,50,216,172,139,25,114,142,177,235,62,
+200,16,209,138,1,8,16,134,18,122,20,177,177,197,169,236,240,75,238,238,75,30,58,82,191,94,54,155,224,91,
+177,107,201,64,162,121,164,31,96,58,152,140,209,191,25,147,179,181,28,120,63,70,186,102,181,31,22,236,255,72,
+68,142,100,234,129,120,180,62,240,198,23,100,106,22,112,215,172,114,201,105,166,160,98,37,45,3,195,71,161,8,
+236,136,150,56,219,167,113,116,181,127,238,211,188,151,201,56,134,157,145,85,191,56,70,12,83,27,236,178,102,57,
+86,205,142,52,89,35,174,11,191,217,94,111,112,24,22,247,143,227,22,70,84,5,241,239,94,125,72,32,85,92,
+200,115,95,67,178,206,82,16,147,245,101,217,37,47,175,247,12,117,142,139,206,122,200,53,231,96,28,132,215,56,
+163,158,70,145,145,156,71,113,218,110,84,110,234,252,241,192,89,219,31,75,1,218,187,217,27,162,32,147,211,206,
+218,1,73,202,27,239,230,186,201,94,63,132,65,191,53,214,160,187,107,161,37,15,246,105,250,7,29,23,46,127,
+225,83,98,170,19,88,42,108,234,179,93,27,76,33,30,18,226,9,69,20,124,186,10,97,93,21,40,186,159,149,
+140,149,198,12,90,215,214,207,121,233,195,220,131,74,85,144,162,35,154,207,209,100,177,24,46,25,103,212,84,35,
+81,91,196,50,76,78,53,166,220,4,148,134,215,218,24,113,183,22,113,110,208,160,225,182,203,178,100,243,8,100,
+227,74,119,215,84,74,1,207,250,234,96,188,145,155,230,174,157,212,44,86,242,131,154,155,141,109,53,221,181,133,
+152,55,64,38,249,215,143,171,237,186,237,44,251,95,246,1,63,94,112,74,3,65,176,217,217,36,34,159,20,179,
+141,36,130,224,212,240,167,240,151,14,39,49,168,60,249,211,94,167,170,254,116,188,160,151,46,89,253,104,121,192,
+44,242,205,46,117,151,58,47,95,203,124,93,173,113,4,146,171,233,199,58,226,159,223,145,25,31,194,132,194,239,
+167,198,151,241,53,36,254,180,212,170,90,217,198,62,84,68,201,185,26,87,255,252,254,159,238,32,205,176,38,218,
+129,191,77,134,184,37,145,126,120,114,60,171,236,8,247,31,209,182,16,93,15,220,77,138,30,210,98,189,134,165,
+185,17,6,117,10,9,203,15,106,133,225,161,57,72,253,42,184,18,14,101,141,51,234,108,69,116,221,122,202,99,
+166,138,196,133,19,185,19,243,16,59,58,163,186,173,188,101,57,164,171,58,140,109,70,177,45,200,75,122,74,15,
+79,231,240,145,249,203,85,85,240,162,237,0,214,99,152,253,109,140,160,245,148,111,15,68,53,250,137,151,2,42,
+28,109,215,44,78,244,164,251,115,31,203,186,154,19,50,143,100,213,80,225,26,9,126,237,118,30,197,168,131,90,
+182,84,204,0,255,251,228,22,47,177,41,242,199,250,193,102,252,189,212,223,239,127,180,191,255,174,250,187,122,158,
+207,177,203,221,106,173,29,203,172,249,95,175,114,94,98,51,119,156,181,0,154,174,62,234,246,11,254,155,174,90,
+56,105,193,40,244,210,226,231,234,255,194,180,244,255,75,133,89,62,121,28,207,182,191,241,245,244,98,72,194,92,
+130,228,245,28,91,213,237,41,213,246,119,137,33,228,52,58,17,129,61,223,123,148,109,137,24,225,81,55,209,112,
+237,136,241,206,133,127,237,243,125,13,219,185,202,197,205,121,98,19,63,223,151,247,237,203,123,177,95,148,95,53,
+128,111,19,171,180,116,22,21,47,206,91,59,250,165,237,190,188,105,87,110,185,126,242,192,234,135,56,111,205,251,
+195,26,182,145,43,94,123,122,117,205,190,20,141,134,148,206,31,160,162,11,217,168,162,71,219,203,78,238,181,221,
+110,139,226,92,168,130,136,7,47,15,144,8,230,73,133,176,65,116,250,17,58,129,14,131,227,110,106,122,8,140,
+194,206,223,212,161,216,39,181,113,68,110,215,253,160,234,118,132,7,214,164,233,241,149,137,92,151,46,227,108,85,
+225,172,137,207,180,211,162,124,85,34,12,41,245,10,44,151,47,19,192,20,35,154,78,2,21,245,61,238,172,155,
+126,130,58,141,195,43,180,82,192,185,159,150,21,164,174,218,162,194,137,129,241,109,70,204,74,70,81,223,173,71,
+156,49,115,203,27,189,203,71,235,51,32,253,86,17,58,250,17,142,47,117,149,193,67,8,180,143,148,174,193,232,
+227,118,5,220,243,135,95,205,166,91,133,26,140,211,42,143,95,93,60,242,112,5,3,218,53,204,248,91,173,13,
+240,63,201,20,109,131,3,247,133,35,110,58,35,212,165,36,128,38,190,59,10,166,1,62,133,240,122,58,53,183,
+219,242,69,238,237,236,110,80,177,225,180,116,4,78,223,7,200,48,185,157,128,5,205,55,105,223,102,89,252,43,
+119,109,174,220,26,56,60,82,76,23,238,168,39,138,182,175,162,5,68,219,96,234,193,189,20,119,162,90,143,197,
+179,152,23,176,124,155,63,26,199,52,240,175,131,127,11,77,26,45,198,231,116,32,227,223,108,19,33,10,102,147,
+135,168,209,148,74,203,169,56,3,169,93,143,83,216,70,252,253,237,231,35,58,127,90,62,91,190,250,238,214,222,
+165,130,27,96,157,236,252,208,234,137,126,149,17,30,58,127,11,78,112,17,7,198,17,120,151,185,218,138,168,237,
+21,135,228,95,195,83,62,150,142,143,66,107,50,150,157,199,254,114,184,255,233,203,1,30,62,84,187,46,241,88,
+118,87,91,3,194,193,108,44,15,183,231,175,49,41,101,211,64,174,112,117,64,225,122,15,117,78,158,89,254,21,
+175,72,170,242,201,79,181,35,245,149,62,57,119,80,171,68,224,15,249,225,220,205,8,71,120,160,108,146,228,143,
+113,152,185,173,177,229,118,91,224,73,157,242,177,47,253,246,163,162,124,28,165,209,220,48,127,90,230,171,93,37,
+128,137,157,69,85,31,173,18,235,123,253,245,12,146,244,129,87,219,201,15,221,133,145,187,31,228,131,127,155,181,
+149,246,129,195,39,152,64,60,133,135,228,207,233,194,234,69,26,161,221,197,251,197,170,239,10,201,113,129,188,128,
+201,222,246,51,94,169,235,95,169,210,6,187,8,112,151,41,239,25,54,18,100,82,118,9,207,218,253,247,128,240,
+77,48,246,193,226,224,182,35,12,82,18,52,222,17,160,194,55,119,34,192,125,71,243,52,55,193,137,188,219,210,
+134,15,188,35,6,143,10,208,196,49,22,203,61,193,98,224,42,135,225,27,251,7,31,219,79,242,179,118,49,237,
+222,32,20,193,213,9,56,241,16,87,33,64,55,253,4,10,240,57,48,186,75,158,35,87,72,195,35,176,83,3,
+130,87,162,35,76,219,5,213,132,154,57,200,60,162,235,206,80,76,212,22,94,35,48,249,53,250,236,245,247,196,
+140,236,5,191,201,129,79,211,139,183,188,233,23,221,10,183,209,235,244,88,102,177,181,229,203,231,116,124,64,250,
+180,195,247,162,170,39,118,68,26,93,48,170,189,208,221,216,103,214,157,134,208,74,190,234,205,216,110,52,163,102,
+99,155,238,141,196,75,238,78,219,56,146,244,26,31,62,29,124,123,127,120,252,241,211,215,227,183,159,190,125,60,
+104,216,167,43,122,89,212,67,218,189,165,184,34,174,183,92,173,92,108,195,176,51,226,59,235,166,242,246,56,91,
+139,230,169,129,51,143,0,157,209,48,123,93,47,49,103,175,102,189,192,90,225,165,189,170,100,96,51,239,228,141,
+118,88,165,204,92,241,27,68,155,240,74,94,90,30,121,29,55,234,171,51,100,184,94,153,152,49,50,94,145,177,
+178,204,165,179,225,171,82,31,131,197,95,23,254,44,213,223,30,194,147,52,19,153,129,79,1,49,247,223,255,227,
+111,135,51,100,104,238,161,162,44,149,33,149,132,224,40,155,231,52,196,165,159,116,33,110,203,113,213,71,246,146,
+14,116,235,103,28,51,90,43,85,74,93,108,235,237,117,126,121,225,102,233,227,115,63,254,224,207,233,241,148,236,
+21,39,55,236,227,54,110,156,228,44,129,226,187,77,85,235,134,161,165,161,205,46,57,20,196,232,23,29,102,36,
+15,155,77,245,49,42,222,64,92,38,94,220,96,202,215,247,122,157,85,101,133,48,66,202,223,164,42,158,92,188,
+246,26,13,213,198,57,180,113,222,207,8,81,47,204,210,149,197,57,70,148,201,224,23,173,226,235,166,87,102,142,
+214,182,249,8,88,53,82,47,35,199,215,213,244,222,196,97,26,96,70,70,49,186,63,245,156,34,183,118,224,85,
+176,35,223,219,154,40,100,100,140,134,26,146,102,147,222,23,90,67,199,183,175,111,105,62,71,123,28,139,186,58,
+99,202,212,227,148,182,124,58,152,95,115,39,158,80,85,170,61,162,40,177,6,37,228,117,10,50,98,61,192,4,
+173,102,154,95,150,151,115,203,155,137,51,50,56,229,254,158,192,50,106,24,254,254,190,150,42,130,199,125,233,249,
+199,175,132,218,153,250,125,170,66,84,249,166,220,63,254,208,174,199,21,215,226,254,241,7,255,224,68,253,221,33,
+218,129,144,165,210,78,91,249,86,8,95,142,170,148,151,46,12,202,189,35,162,149,166,163,140,137,150,64,247,201,
+6,147,207,197,244,113,52,141,226,131,96,14,148,22,18,191,250,39,90,210,76,154,168,44,9,135,25,135,179,52,
+190,35,13,164,174,145,178,52,37,155,241,179,32,20,66,221,40,201,172,14,109,183,226,187,171,179,247,82,192,85,
+207,167,129,231,116,100,25,220,94,169,63,24,86,184,246,94,123,73,108,145,242,117,219,82,62,86,89,183,228,159,
+194,58,32,142,41,65,185,194,23,55,18,14,153,68,151,49,79,181,27,207,117,152,29,71,60,16,82,137,156,26,
+244,197,215,245,17,198,6,117,120,33,86,220,193,236,122,124,7,130,107,217,9,15,74,240,167,168,19,164,230,122,
+194,64,62,31,44,153,173,103,214,87,242,133,69,74,115,82,248,173,110,238,167,76,254,83,143,227,171,38,190,217,
+205,215,40,65,2,143,46,223,148,94,131,171,230,105,47,126,91,74,147,114,149,90,16,214,178,152,240,139,129,249,
+52,126,25,240,85,57,163,151,73,182,188,188,151,181,69,154,72,241,122,130,74,148,150,182,242,205,134,138,156,28,
+181,217,173,236,74,27,164,217,64,147,243,254,232,64,86,75,223,2,135,86,43,119,203,128,47,112,151,96,31,131,
+52,25,251,243,224,16,7,87,226,253,27,202,248,53,246,231,231,225,120,63,141,167,148,167,161,230,83,201,65,50,
+54,181,103,216,51,170,182,182,158,150,219,98,85,81,166,165,229,248,166,233,187,120,61,176,178,251,249,242,251,146,
+195,199,253,79,153,21,126,254,203,26,149,249,43,223,78,157,161,16,215,85,147,182,136,223,125,199,18,191,60,39,
+103,121,68,234,58,133,100,147,148,233,35,126,11,77,164,44,209,245,226,171,241,118,26,221,77,142,210,32,156,157,
+4,241,89,35,103,216,248,79,125,101,191,230,173,157,172,83,60,228,33,88,147,23,47,145,87,131,243,172,22,103,
+254,145,141,13,245,167,62,199,236,88,226,201,173,92,102,13,89,212,179,127,161,5,136,250,158,151,209,133,217,0,
+28,47,127,241,27,117,50,144,211,80,29,159,146,107,169,126,162,138,204,171,129,3,145,193,182,169,121,80,91,19,
+17,43,239,9,219,39,139,112,58,217,71,132,87,254,92,10,123,222,26,41,88,186,23,90,66,170,231,20,164,8,
+105,31,66,117,180,20,212,244,169,15,140,109,180,146,32,158,7,120,23,67,208,176,27,13,203,214,161,196,43,188,
+26,204,142,37,158,173,83,119,142,203,56,64,234,231,170,58,86,208,98,130,151,69,143,46,73,215,140,250,211,220,
+171,2,90,220,34,159,100,153,224,213,90,65,146,150,74,218,164,47,171,154,222,212,72,213,93,194,217,111,98,240,
+7,89,158,214,0,17,203,237,236,86,6,60,249,49,2,150,229,241,212,37,68,80,217,83,84,29,247,162,143,121,
+252,16,139,186,202,191,212,146,47,191,190,209,165,100,120,9,33,242,86,247,249,115,123,227,68,171,16,67,13,197,
+179,64,89,68,148,107,192,240,98,228,81,66,29,179,116,233,209,95,34,141,103,193,212,206,100,66,190,250,137,201,
+137,183,124,139,246,56,111,167,122,195,225,238,206,75,219,177,59,35,155,126,117,108,7,126,117,41,205,25,141,236,
+18,248,207,59,206,11,5,15,63,91,14,149,120,142,191,185,176,195,16,88,250,40,93,140,47,67,40,245,114,103,
+175,43,74,237,225,207,46,253,236,226,207,86,151,74,81,178,64,70,208,157,44,217,17,68,81,65,174,130,11,118,
+21,18,135,126,239,113,65,149,204,169,14,23,236,2,65,175,211,203,112,150,68,51,32,201,81,237,198,95,93,245,
+75,208,224,40,102,56,130,25,50,13,240,208,123,4,79,153,177,247,247,226,7,190,246,137,127,71,226,145,149,134,
+92,132,229,222,194,233,33,6,232,25,141,38,255,162,201,136,73,226,21,16,184,153,44,118,108,253,113,13,241,90,
+131,246,42,7,143,68,178,151,8,88,240,8,193,36,140,249,222,40,47,147,136,87,45,167,231,108,160,50,85,154,
+102,41,213,193,129,200,93,95,140,106,238,196,203,205,154,216,101,53,171,95,207,96,60,32,139,223,102,201,158,231,
+188,234,244,168,17,192,247,91,124,84,59,151,199,111,89,116,220,91,48,59,152,235,222,54,51,0,139,31,210,240,
+238,158,17,88,243,150,249,54,185,101,229,121,182,75,223,177,227,241,33,227,201,45,51,246,44,75,104,58,156,116,
+162,37,117,71,46,162,168,50,2,177,99,159,57,246,137,83,86,231,201,26,101,22,186,14,48,136,248,153,39,200,
+234,230,67,68,141,190,138,28,69,104,85,94,151,243,112,146,200,105,197,93,254,56,243,206,156,214,153,248,56,241,
+78,156,214,73,87,155,189,41,244,192,68,123,111,164,212,9,42,19,58,34,132,142,192,126,8,115,253,64,189,10,
+60,196,247,186,135,130,212,59,249,221,165,135,39,110,157,230,45,196,175,91,91,248,163,79,29,182,181,117,231,52,
+239,40,17,127,244,229,120,154,132,87,20,238,112,111,240,51,63,80,244,206,225,206,150,172,84,93,235,169,155,88,
+59,182,186,119,21,237,177,130,104,6,241,51,220,117,166,117,254,131,133,0,166,25,156,229,139,117,55,40,214,133,
+98,39,88,108,133,255,171,13,129,165,112,105,67,41,27,165,202,42,190,115,166,75,161,57,222,114,94,252,236,56,
+47,94,118,172,193,0,108,45,36,188,120,222,165,175,151,246,152,156,16,33,121,184,94,64,167,13,7,237,51,251,
+68,84,175,230,149,100,128,35,188,190,124,123,221,205,222,136,226,152,7,6,14,101,194,85,64,52,141,162,203,197,
+156,84,8,43,177,200,238,141,189,147,251,179,126,255,229,125,220,239,59,47,72,102,128,143,48,142,5,235,66,34,
+0,95,94,247,249,139,103,226,95,74,196,199,214,114,148,201,73,57,253,121,121,97,58,113,114,39,152,241,163,60,
+210,195,79,64,73,90,102,65,135,148,151,38,8,208,156,7,32,64,157,30,128,240,38,32,107,113,115,2,162,115,
+214,156,128,36,208,16,208,36,30,137,128,185,24,12,88,91,91,147,62,182,217,90,82,203,39,174,224,134,136,4,
+4,99,57,177,62,238,215,134,178,165,167,76,53,151,65,100,158,235,94,37,63,149,148,119,7,55,207,206,159,237,
+138,166,41,87,67,35,115,74,75,226,241,103,213,109,116,100,86,139,179,120,238,239,156,231,67,243,193,215,13,71,
+94,122,196,52,230,235,184,71,108,143,25,49,30,185,249,79,193,200,95,181,90,89,49,128,126,96,148,186,187,107,
+185,21,201,221,189,95,42,211,247,152,143,28,24,219,56,115,83,21,102,123,42,204,166,52,96,23,66,122,29,17,
+220,115,162,195,137,93,109,136,65,243,65,52,79,64,89,34,97,235,231,21,254,234,247,189,110,21,73,157,123,204,
+189,239,220,51,94,125,112,127,132,231,87,204,108,90,171,178,73,133,161,64,37,76,237,108,90,126,90,226,1,94,
+239,237,149,137,235,108,148,148,137,126,77,158,124,50,172,60,85,83,53,194,173,164,174,163,143,189,242,89,78,247,
+37,240,23,255,209,135,88,214,90,41,124,127,116,80,98,199,143,180,168,134,28,199,233,22,201,169,238,184,199,119,
+167,54,51,245,131,202,163,198,76,5,186,157,98,114,54,93,240,241,240,235,209,254,235,207,135,221,118,167,81,89,
+184,186,42,167,134,123,98,118,244,241,141,175,152,115,41,227,72,242,254,131,109,194,204,219,69,71,215,122,200,193,
+129,61,157,101,171,22,143,161,141,218,167,205,48,209,189,39,149,29,195,89,91,117,29,193,217,16,112,16,196,90,
+118,84,250,162,96,54,38,39,147,173,101,106,242,108,235,131,157,114,68,109,23,230,45,44,23,176,181,3,66,99,
+74,90,107,103,14,105,183,67,221,132,24,20,92,85,188,98,38,208,240,99,102,249,229,215,94,215,174,90,191,237,
+237,174,70,118,119,195,21,225,195,79,111,113,189,4,127,190,121,247,245,200,115,56,108,255,11,190,106,224,61,239,
+116,120,196,112,229,39,151,137,55,132,65,169,189,107,255,108,59,207,237,93,199,126,177,107,59,221,159,109,140,249,
+158,59,48,74,237,116,119,237,110,103,239,103,123,175,243,203,115,251,165,243,11,164,189,216,125,185,107,239,118,127,
+126,241,179,253,226,249,243,221,231,163,108,77,75,99,191,190,166,101,139,249,48,141,199,98,126,36,76,113,141,129,
+166,135,84,16,220,213,225,136,84,127,60,94,92,21,131,8,186,33,140,194,142,20,23,155,32,243,93,118,125,24,
+181,213,18,1,196,36,120,0,98,17,31,83,21,54,254,58,9,83,25,123,248,199,228,247,121,231,66,28,4,199,
+1,133,34,204,189,91,68,204,229,113,87,209,241,233,84,190,167,78,163,174,99,108,28,33,179,247,49,31,219,105,
+67,207,224,223,140,97,184,78,121,76,247,63,219,240,95,232,63,162,99,40,42,198,128,99,140,30,68,124,15,32,
+126,221,179,78,167,139,228,252,24,75,154,84,102,149,97,155,30,159,76,163,241,37,167,47,225,243,220,79,206,101,
+83,85,11,20,61,205,174,155,209,78,227,77,40,56,7,106,50,138,203,53,16,202,115,220,188,91,92,181,166,68,
+183,217,12,45,236,18,92,179,111,57,90,81,113,214,196,204,24,195,100,18,119,145,153,246,216,14,109,156,217,195,
+240,193,38,108,199,113,112,6,191,240,137,22,87,99,169,167,126,185,69,230,207,24,64,3,118,69,95,121,31,94,
+255,125,255,211,193,161,201,32,150,171,90,233,57,253,190,2,7,205,17,221,164,49,202,169,230,158,232,23,104,61,
+173,191,6,183,41,153,20,211,114,153,102,17,183,82,235,60,234,6,151,126,247,81,113,94,240,239,103,94,215,106,
+54,69,27,69,177,151,45,245,45,152,32,74,231,248,143,233,86,77,151,97,114,16,31,195,72,105,222,163,139,24,
+96,156,167,19,104,61,245,160,149,208,131,68,154,57,238,247,209,84,88,77,124,224,35,244,224,147,9,248,23,125,
+159,154,178,67,61,143,10,88,75,94,143,35,205,194,187,190,228,45,191,234,145,75,81,32,11,29,21,197,173,80,
+190,154,220,177,40,7,194,206,8,71,136,102,216,162,0,211,234,119,172,176,153,21,120,76,253,70,214,236,213,138,
+219,173,81,178,18,188,66,25,99,46,17,26,126,13,148,187,183,239,8,78,44,51,236,158,204,108,54,93,73,8,
+145,193,225,89,94,235,86,229,74,68,130,144,170,162,74,9,71,195,186,128,255,213,220,162,110,32,113,119,16,190,
+180,134,15,143,147,113,125,38,6,90,96,180,168,83,65,216,114,58,38,11,54,157,140,142,36,239,218,21,17,69,
+155,178,212,140,78,167,68,150,200,41,98,76,76,182,162,29,91,1,40,5,89,101,117,21,212,80,56,76,19,24,
+47,82,116,171,161,137,44,210,148,177,0,197,71,184,90,96,172,219,106,169,44,178,191,224,113,60,57,118,19,252,
+193,241,154,40,1,57,24,104,100,213,136,46,26,171,254,89,42,167,176,229,145,167,28,74,223,64,211,79,242,3,
+152,163,0,239,73,32,251,125,153,231,146,46,168,108,202,117,101,102,211,227,198,186,44,164,10,159,247,18,170,86,
+78,65,209,128,14,153,59,81,165,13,0,86,161,107,121,47,87,154,20,15,132,201,187,191,87,230,145,216,167,125,
+85,27,69,221,110,90,69,219,202,226,222,108,10,202,1,159,40,228,145,198,72,140,66,131,184,249,53,182,119,133,
+212,82,134,39,212,194,90,22,56,209,249,97,70,148,28,36,47,85,177,162,121,252,103,85,136,202,178,200,5,31,
+144,29,217,187,27,198,90,179,241,29,112,41,241,156,14,199,5,51,24,170,96,52,35,39,152,160,253,144,132,243,
+46,34,71,4,102,240,117,18,250,9,155,251,61,49,67,175,37,137,25,44,145,198,14,42,203,230,16,3,55,191,
+10,232,78,150,130,176,89,22,79,243,130,33,203,1,98,130,39,16,14,6,42,91,229,49,34,1,160,163,107,229,
+97,81,86,98,127,34,219,54,24,136,201,104,127,18,46,146,172,49,47,10,169,72,98,1,70,71,7,233,158,248,
+249,44,3,211,112,76,130,177,183,43,66,180,233,252,220,215,216,214,81,136,40,7,107,202,131,100,165,0,139,196,
+153,33,120,169,39,9,58,43,202,98,42,23,200,99,111,214,131,11,124,249,226,108,171,226,240,42,112,188,189,95,
+126,201,62,187,240,233,100,159,187,222,222,203,159,179,207,61,8,227,119,213,20,103,56,198,77,253,116,155,28,140,
+248,24,32,11,49,213,202,180,8,194,121,61,250,212,31,11,1,14,82,220,174,44,133,146,70,70,44,7,146,231,
+96,84,126,147,92,153,71,55,65,236,230,30,245,4,195,44,112,224,102,80,137,162,24,110,83,180,78,60,40,100,
+8,209,161,240,244,183,218,76,89,117,13,0,8,30,135,242,161,125,77,17,151,24,213,114,46,207,21,94,123,102,
+216,239,235,122,215,124,105,237,72,16,209,4,116,237,88,197,219,105,228,167,47,246,184,146,225,181,141,255,224,237,
+52,72,36,194,8,213,80,197,241,3,211,117,63,183,152,97,42,64,152,197,64,57,71,87,86,243,176,51,2,91,
+166,83,168,145,53,116,214,101,118,215,101,238,2,189,26,93,254,20,66,36,124,173,10,172,45,73,35,68,221,39,
+246,25,110,14,207,209,210,98,217,126,102,230,83,79,172,29,165,94,121,250,170,10,64,234,89,77,129,110,101,1,
+72,141,181,2,5,178,103,24,242,152,108,5,50,178,105,38,63,226,17,164,127,2,209,79,139,33,196,248,48,244,
+212,170,74,216,20,101,149,100,241,244,113,216,116,196,138,126,40,12,244,149,39,212,207,246,133,143,190,232,159,135,
+247,247,151,131,105,4,195,52,79,74,228,240,10,227,10,240,102,152,109,45,231,158,108,203,5,166,207,153,143,207,
+204,185,96,157,110,14,32,215,145,185,204,167,66,110,87,230,50,83,244,92,244,159,76,74,86,227,101,171,245,127,
+178,198,213,42,247,4,48,238,201,208,248,127,2,223,19,239,15,12,227,118,29,203,149,73,88,114,226,81,166,74,
+67,111,40,184,44,65,48,73,100,9,61,158,225,40,48,181,169,60,253,0,199,67,150,168,70,189,103,94,38,68,
+56,143,157,102,226,48,99,78,52,181,4,106,188,158,64,237,117,121,99,100,218,39,122,173,37,183,9,83,92,73,
+119,184,146,20,81,122,203,20,154,63,24,232,254,185,165,171,34,161,149,165,250,138,41,140,94,240,71,228,186,58,
+63,160,42,209,102,79,152,29,221,85,139,164,150,167,24,35,40,105,170,20,221,113,175,8,94,180,66,192,112,9,
+153,198,152,168,132,12,147,53,106,86,154,205,191,165,205,75,98,230,45,180,47,236,185,253,155,157,92,249,211,41,
+0,242,143,107,127,106,227,21,140,97,180,72,198,17,12,77,108,58,129,199,171,113,53,61,56,215,123,80,162,243,
+66,87,34,244,80,102,169,48,235,235,133,42,78,203,62,191,101,154,71,250,248,27,64,247,101,89,107,169,16,94,
+100,8,17,100,181,202,10,74,24,42,31,62,245,228,183,181,188,0,216,206,200,197,255,120,168,88,164,102,128,234,
+130,112,184,248,31,38,15,255,35,210,187,152,222,197,244,238,136,84,75,164,239,98,250,46,166,239,98,58,252,186,
+64,109,150,84,61,245,52,198,145,73,38,135,58,212,82,71,158,228,102,51,28,12,28,193,19,13,128,184,35,17,
+18,123,20,26,220,11,228,234,93,163,192,84,15,129,179,120,160,86,21,213,214,215,142,1,112,177,98,85,44,39,
+77,9,12,50,240,100,108,102,75,124,155,86,178,82,55,51,44,78,176,171,190,164,241,8,61,133,252,108,36,13,
+57,228,177,185,86,210,117,127,127,65,211,16,216,167,50,173,32,109,164,207,108,18,165,13,24,176,209,178,66,25,
+220,210,120,102,9,146,170,172,4,205,95,0,53,68,170,239,177,193,165,233,58,200,242,189,150,79,120,155,158,95,
+180,43,190,199,6,118,19,216,130,13,34,169,193,77,0,232,113,168,89,115,93,238,137,160,179,22,137,98,161,33,
+23,200,54,106,195,69,171,245,255,71,27,86,154,157,201,68,2,7,157,114,94,63,148,171,244,103,233,57,207,36,
+228,118,17,229,130,121,24,18,52,77,21,221,182,28,107,135,69,134,147,196,74,180,134,106,199,220,125,150,5,195,
+188,26,141,87,195,120,127,252,97,234,101,118,196,24,207,202,106,243,178,128,38,27,149,120,217,240,69,166,122,252,
+57,24,20,71,59,56,149,225,79,250,158,99,33,148,110,18,225,155,204,161,138,47,32,170,20,81,146,41,6,68,
+173,240,89,104,61,19,110,121,71,166,90,76,95,146,6,180,2,172,53,180,95,24,36,128,49,148,205,134,32,7,
+11,120,187,106,226,78,43,247,103,30,152,60,197,169,150,37,131,241,232,194,169,135,238,150,161,187,245,208,187,101,
+104,166,36,151,180,71,251,59,200,62,216,23,106,118,7,152,5,255,74,93,215,59,12,4,206,19,163,29,124,150,
+139,55,82,228,67,127,247,76,135,104,58,149,48,113,14,166,91,9,115,225,229,99,33,183,28,93,95,136,48,85,
+116,58,53,57,31,204,102,32,88,145,39,187,16,62,6,186,192,90,144,208,210,19,92,105,141,72,108,105,66,149,
+126,209,126,154,240,207,89,242,146,40,17,225,246,142,26,253,178,84,182,132,148,238,168,193,181,251,88,209,229,253,
+23,40,186,23,186,232,94,148,69,247,226,217,69,149,232,234,193,101,97,107,244,146,7,153,174,48,11,174,54,172,
+114,179,88,132,167,120,114,69,189,220,87,54,104,205,109,167,94,242,36,205,28,199,174,217,54,201,225,200,173,31,
+177,177,199,201,141,175,208,167,22,55,4,227,124,236,84,21,156,202,29,67,23,188,1,103,56,29,185,80,45,109,
+233,213,12,56,134,22,85,201,78,117,114,119,164,246,241,248,243,149,60,126,162,24,160,253,230,69,87,181,113,202,
+83,126,183,56,17,38,167,11,120,26,108,111,195,105,176,108,81,211,142,3,104,95,76,59,29,180,37,83,253,192,
+169,182,144,74,7,78,181,18,218,249,39,62,213,34,22,119,9,51,158,45,180,121,193,213,166,237,33,167,65,236,
+138,76,26,181,107,71,234,168,184,88,254,229,223,218,134,12,78,224,174,38,245,16,72,244,19,5,166,216,124,33,
+179,74,7,81,100,70,254,20,147,192,173,109,189,177,92,13,146,207,76,9,32,185,37,64,203,167,83,102,34,91,
+108,144,209,114,197,25,21,145,47,15,168,228,202,211,222,96,137,128,79,8,232,249,185,99,28,2,44,191,17,69,
+65,203,19,85,18,25,93,85,165,152,135,15,183,90,26,115,240,248,13,31,78,168,64,42,15,183,44,171,242,36,
+142,226,33,19,192,38,22,215,21,253,244,105,226,44,140,164,200,227,52,62,129,42,210,197,81,93,145,195,95,34,
+75,157,72,150,153,120,112,62,94,224,141,45,218,73,91,217,134,177,63,251,42,196,76,108,156,58,205,159,52,225,
+241,15,24,100,16,250,83,248,55,89,76,211,4,196,249,212,203,40,116,69,178,180,41,184,161,16,119,29,2,148,
+12,98,196,190,66,26,3,225,25,53,200,194,160,84,20,228,219,154,48,67,92,114,171,206,161,11,128,149,153,29,
+28,47,94,225,197,87,156,73,218,133,72,175,5,198,61,68,249,123,160,189,194,51,190,75,85,189,82,91,253,45,
+217,21,111,107,200,43,121,207,89,141,208,162,216,195,189,145,229,62,124,1,88,225,46,131,199,222,2,166,63,172,
+134,23,38,120,70,237,29,96,218,133,24,185,171,38,146,244,110,26,180,197,77,43,248,184,119,56,155,134,179,160,
+69,75,125,219,116,3,197,7,255,82,190,11,103,92,135,73,120,50,13,106,144,85,223,95,84,186,137,227,129,219,
+75,180,108,196,68,203,221,143,191,226,4,41,167,235,67,240,182,10,122,13,112,253,157,27,249,155,71,182,191,80,
+175,243,3,234,219,15,92,215,1,220,195,199,185,212,3,141,143,120,71,83,85,131,70,125,131,71,191,245,155,71,
+240,166,155,88,149,167,65,107,48,169,121,225,27,175,235,96,88,115,211,7,69,243,221,80,221,176,242,37,47,15,
+188,105,189,142,19,2,213,15,113,65,18,42,185,208,168,186,22,112,205,37,59,36,46,223,40,223,64,194,12,186,
+148,44,132,207,233,93,125,171,181,155,226,244,123,143,106,235,145,215,22,177,108,226,173,179,44,152,85,221,37,236,
+4,52,207,172,190,255,77,220,206,210,51,186,118,101,190,240,155,61,168,179,26,128,79,137,100,79,10,87,67,113,
+60,209,211,30,59,182,215,144,115,68,86,170,167,217,36,228,43,200,23,106,33,218,60,180,80,229,219,218,170,122,
+11,69,22,12,200,54,59,221,0,239,163,82,86,133,76,218,218,123,241,22,241,116,189,57,92,243,104,68,56,67,
+19,166,110,60,99,4,135,211,0,191,204,109,127,187,238,110,116,40,215,62,7,175,6,133,161,250,53,64,120,243,
+152,184,130,125,59,245,175,252,19,188,114,43,108,141,253,57,14,94,219,208,242,237,234,210,138,166,147,104,114,215,
+6,23,1,42,189,127,142,35,3,196,187,142,46,121,165,208,6,104,249,146,189,7,209,34,111,227,224,58,186,212,
+120,11,205,174,129,174,121,138,112,157,1,198,60,148,255,109,247,225,194,154,9,174,113,24,235,173,15,90,145,196,
+191,14,38,79,27,238,131,119,25,174,177,194,82,88,233,74,35,217,205,194,30,85,95,70,90,122,48,152,110,251,
+171,33,212,203,147,106,173,105,145,246,44,51,222,151,182,91,190,120,107,109,215,128,218,226,86,43,188,153,140,116,
+87,92,56,122,34,84,216,240,79,193,216,25,97,186,157,24,120,36,99,99,9,81,134,161,234,210,198,250,27,230,
+170,110,122,35,11,170,221,239,118,3,35,157,232,6,108,134,80,173,202,24,36,179,188,231,184,107,35,164,231,242,
+42,173,125,40,159,181,13,94,207,231,186,230,228,112,209,13,115,244,84,217,28,235,2,95,144,57,36,96,208,41,
+223,68,167,95,143,87,184,122,78,180,12,12,96,127,135,99,188,1,252,66,69,196,191,231,233,213,116,240,191,1,
+111,201,5,107,208,210,0,0
 };
@@ -5,24 +5,32 @@
 #include "../../../System/GameContext.h"
 #include "../../../DebugUtils.h"
 #include "Renderer.h"
+#include "../../../Helper/FrameBufferView.h"
+#include "../../../Helper/FixedTrig.h"
+#include "../../../Helper/ShadeBuffer.h"
 
 AuroraWeatherEffect::AuroraWeatherEffect(GameContext& context)
     : WeatherEffectBase(context) {
     debugPrint("WEATHER", "AuroraWeatherEffect created");
 }
 
+AuroraWeatherEffect::~AuroraWeatherEffect() {
+    if (_holdsShades) ShadeBuffer::getInstance()->release();
+}
+
 void AuroraWeatherEffect::init(unsigned long currentTime) {
     if (!_context.renderer) return;
     int screenW = _context.renderer->getWidth();
     int screenH = _context.renderer->getHeight();
+    _rng.seedFrom(Rng::STREAM_AURORA);
 
     for(int i = 0; i < MAX_CURTAINS; ++i) {
-        _curtains[i].baseY = (float)random(5, screenH / 3); // Start Y position
-        _curtains[i].amplitude = (float)random(4, 12);
-        _curtains[i].frequency = (float)random(4, 10) / 100.0f;
-        _curtains[i].speed = ((float)random(3, 11) / 100.0f) * 0.7f; // Reduced speed by 30%
-        _curtains[i].timeOffset = (float)random(0, 1000);
-        _curtains[i].thickness = (float)random(2, 5);
+        _curtains[i].baseY = (float)_rng.range(5, screenH / 3); // Start Y position
+        _curtains[i].amplitude = (float)_rng.range(4, 12);
+        _curtains[i].frequency = (float)_rng.range(4, 10) / 100.0f;
+        _curtains[i].speed = ((float)_rng.range(3, 11) / 100.0f) * 0.7f; // Reduced speed by 30%
+        _curtains[i].timeOffset = (float)_rng.range(0, 1000);
+        _curtains[i].thickness = (float)_rng.range(2, 5);
     }
     _globalAlpha = 1.0f;
     _isFadingOut = false;
@@ -55,32 +63,37 @@ void AuroraWeatherEffect::update(unsigned long currentTime) {
 }
 
 void AuroraWeatherEffect::drawBackground() {
-    if (!_context.renderer || !_context.display || _globalAlpha <= 0.0f) return;
-    U8G2* u8g2 = _context.display;
-    Renderer& renderer = *_context.renderer;
-
-    uint8_t originalColor = u8g2->getDrawColor();
-    u8g2->setDrawColor(2); // Use XOR for transparency
+    if (!_context.renderer || _globalAlpha <= 0.0f) return;
+    FrameBufferView view(*_context.renderer);
+    if (!view.isValid()) return;
+    ShadeBuffer* shades = ShadeBuffer::getInstance();
+    if (!_holdsShades && !(_holdsShades = shades->acquire())) return;
+    shades->begin();
 
-    int screenW = renderer.getWidth();
+    int screenW = view.getWidth();
 
     for(int i = 0; i < MAX_CURTAINS; ++i) {
         const auto& curtain = _curtains[i];
-        for (float x = 0; x < screenW; x += 1.0f) {
-            // Dither based on X position and global alpha
-            if (random(100) > (x / screenW * 70 + 30) * _globalAlpha) continue;
+        int thickness = static_cast<int>(curtain.thickness);
+        // The wave's phase in 1/256 angle units, so the per-column step keeps
+        // its precision across the screen.
+        uint32_t phase = (uint32_t)FixedTrig::fromRadians(curtain.timeOffset) << 8;
+        const uint32_t phaseStep = (uint32_t)lroundf(curtain.frequency * FixedTrig::UNITS_PER_RADIAN * 256.0f);
+        for (float x = 0; x < screenW; x += 1.0f, phase += phaseStep) {
+            // Shade based on X position and global alpha
+            float coverage = std::min(1.0f, (x / screenW * 0.7f + 0.3f) * _globalAlpha);
+            uint8_t shade = (uint8_t)lroundf(coverage * 255.0f);
 
-            float y_offset = sin(x * curtain.frequency + curtain.timeOffset) * curtain.amplitude;
+            float y_offset = FixedTrig::sinF((FixedTrig::Angle)(phase >> 8)) * curtain.amplitude;
             float y_pos = curtain.baseY + y_offset;
 
-            for(int t = 0; t < curtain.thickness; ++t) {
-                int drawX = renderer.getXOffset() + static_cast<int>(round(x));
-                int drawY = renderer.getYOffset() + static_cast<int>(round(y_pos + t - curtain.thickness / 2.0f));
-                u8g2->drawPixel(drawX, drawY);
-            }
+            // The curtain's rows are consecutive.
+            int drawY = static_cast<int>(round(y_pos - curtain.thickness / 2.0f));
+            shades->vSpan(static_cast<int>(round(x)), drawY, thickness, shade);
         }
     }
-    u8g2->setDrawColor(originalColor);
+    // XOR for transparency
+    shades->quantize(view, FrameBufferView::XOR);
 }
 
 void AuroraWeatherEffect::drawForeground() {}
@@ -2,11 +2,12 @@
 #define AURORA_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
+#include "../../../Helper/Rng.h"
 
 class AuroraWeatherEffect : public WeatherEffectBase {
 public:
     AuroraWeatherEffect(GameContext& context);
-    ~AuroraWeatherEffect() override = default;
+    ~AuroraWeatherEffect() override;
 
     void init(unsigned long currentTime) override;
     void update(unsigned long currentTime) override;
@@ -28,6 +29,8 @@ private:
 
     static const int MAX_CURTAINS = 3;
     Curtain _curtains[MAX_CURTAINS];
+    Rng _rng;
+    bool _holdsShades = false; // ShadeBuffer acquired
     
     float _globalAlpha; // 0.0 (transparent) to 1.0 (opaque)
     bool _isFadingOut = false;
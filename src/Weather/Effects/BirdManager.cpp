@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include "../../Helper/ScaledBlitter.h"
 
 // 5px width, 6px total height, 2 frames of 5x3 each
 const unsigned char epd_bitmap_New_Piskel_Birds[] PROGMEM = {
@@ -216,19 +217,7 @@ void BirdManager::drawScaledBird(const Bird& bird, float scale) {
     int drawY = _renderer.getYOffset() + static_cast<int>(round(bird.currentY)) - (scaledH - BIRD_SPRITE_HEIGHT) / 2;
     
     const unsigned char* framePtr = _birdBitmap + (bird.currentFrame * BIRD_BYTES_PER_FRAME);
-
-    for (int destY = 0; destY < scaledH; ++destY) {
-        for (int destX = 0; destX < scaledW; ++destX) {
-            int srcX = static_cast<int>(floor(static_cast<float>(destX) / scale));
-            int srcY = static_cast<int>(floor(static_cast<float>(destY) / scale));
-
-            if (srcX >= 0 && srcX < BIRD_SPRITE_WIDTH && srcY >= 0 && srcY < BIRD_SPRITE_HEIGHT) {
-                const unsigned char* bytePtr = framePtr + (srcY * ((BIRD_SPRITE_WIDTH + 7) / 8)) + (srcX / 8);
-                unsigned char byteVal = pgm_read_byte(bytePtr);
-                 if ((byteVal >> (srcX % 8)) & 0x01) {
-                    u8g2->drawPixel(drawX + destX, drawY + destY);
-                }
-            }
-        }
-    }
+    ScaledBlitter::draw(u8g2, drawX, drawY, framePtr, BIRD_SPRITE_WIDTH, BIRD_SPRITE_HEIGHT, scale,
+                        _renderer.getXOffset(), _renderer.getYOffset(),
+                        _renderer.getXOffset() + _renderer.getWidth(), _renderer.getYOffset() + _renderer.getHeight());
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "CloudSprite.h"
+#include <algorithm>
+#include <cmath>
+#include "../../DebugUtils.h"
+
+void CloudSprite::clear() {
+    memset(_columns, 0, sizeof(_columns));
+    _first = COLUMNS;
+    _last = 0;
+}
+
+void CloudSprite::addCircle(int centerX, int centerY, float radius, int rowLimit) {
+    float r = std::max(1.0f, radius);
+    int rInt = static_cast<int>(round(r));
+    bool clipped = false;
+    for (int dy = -rInt; dy <= rInt; ++dy) {
+        int row = centerY + dy;
+        if (row >= rowLimit) continue;
+        float spanSquared = r * r - dy * dy;
+        if (spanSquared < 0) continue;
+        int span = static_cast<int>(round(sqrtf(spanSquared)));
+        int bit = row - MIN_ROW;
+        int first = centerX - span - MIN_COLUMN;
+        int last = centerX + span - MIN_COLUMN + 1;
+        if (bit < 0 || bit >= 32 || first < 0 || last > COLUMNS) {
+            clipped = true;
+            if (bit < 0 || bit >= 32) continue;
+            first = std::max(first, 0);
+            last = std::min(last, COLUMNS);
+        }
+        for (int column = first; column < last; ++column) _columns[column] |= 1u << bit;
+        _first = std::min(_first, first);
+        _last = std::max(_last, last);
+    }
+    if (clipped) debugPrint("WEATHER", "CloudSprite: circle runs past the sprite frame, clipped.");
+}
+
+void CloudSprite::draw(FrameBufferView& view, int x, int y, FrameBufferView::Op op) const {
+    if (_first >= _last) return;
+    view.blitColumns(x + MIN_COLUMN + _first, y + MIN_ROW, _columns + _first, _last - _first, op);
+}
@@ -0,0 +1,29 @@
+#ifndef CLOUD_SPRITE_H
+#define CLOUD_SPRITE_H
+
+#include <Arduino.h>
+#include "../../Helper/FrameBufferView.h"
+
+// A cloud's union of circles, rasterized once when the cloud is shaped and
+// then drawn as one column blit wherever the cloud has drifted to. Positions
+// are relative to the cloud's anchor: its x and its base line y.
+class CloudSprite {
+public:
+    // The frame a cloud can occupy around its anchor.
+    static const int MIN_COLUMN = -16;
+    static const int COLUMNS = 32;
+    static const int MIN_ROW = -26; // 32 rows: MIN_ROW .. MIN_ROW + 31
+
+    void clear();
+    // Adds a filled circle, scanline for scanline as the effects used to
+    // draw it; rows at or below rowLimit are left out.
+    void addCircle(int centerX, int centerY, float radius, int rowLimit);
+    void draw(FrameBufferView& view, int x, int y, FrameBufferView::Op op) const;
+
+private:
+    uint32_t _columns[COLUMNS] = {}; // Bit n: row MIN_ROW + n
+    int _first = COLUMNS;            // Non-empty columns, end exclusive
+    int _last = 0;
+};
+
+#endif // CLOUD_SPRITE_H
@@ -6,6 +6,7 @@
 #include "../../../DebugUtils.h"
 #include "SerialForwarder.h"
 #include "Renderer.h"
+#include "../../../Helper/FrameBufferView.h"
 
 
 CloudyWeatherEffect::CloudyWeatherEffect(GameContext& context) // Takes GameContext
@@ -23,7 +24,7 @@ void CloudyWeatherEffect::init(unsigned long currentTime) {
         _clouds[i].x = (float)random(0, screenW);
         _clouds[i].y = (float)random(CLOUD_VERTICAL_OFFSET, screenH_half - (int)(MAX_BASE_CLOUD_RADIUS * 1.5f) - 10 + CLOUD_VERTICAL_OFFSET);
         _clouds[i].speed = (float)random(CLOUD_SPEED_MIN_TENTHS, CLOUD_SPEED_MAX_TENTHS + 1) / 10.0f;
-        _clouds[i].circles.clear();
+        _clouds[i].sprite.clear();
 
         int numCircles = random(MIN_CIRCLES_PER_CLOUD, MAX_CIRCLES_PER_CLOUD + 1);
         float baseRadius = MIN_BASE_CLOUD_RADIUS + (float)random(0, (int)((MAX_BASE_CLOUD_RADIUS - MIN_BASE_CLOUD_RADIUS) * 100) + 1) / 100.0f;
@@ -32,18 +33,17 @@ void CloudyWeatherEffect::init(unsigned long currentTime) {
         bool firstCircle = true;
 
         for (int j = 0; j < numCircles; ++j) {
-            CloudCircle circle;
-            circle.relativeX = (float)random(- (int)(baseRadius * MAX_CIRCLE_OFFSET_X_FACTOR), (int)(baseRadius * MAX_CIRCLE_OFFSET_X_FACTOR) + 1);
-            circle.relativeY = (float)random(- (int)(baseRadius * MAX_CIRCLE_OFFSET_Y_FACTOR_ABOVE), (int)(baseRadius * MAX_CIRCLE_OFFSET_Y_FACTOR_BELOW) +1 );
+            int relativeX = random(- (int)(baseRadius * MAX_CIRCLE_OFFSET_X_FACTOR), (int)(baseRadius * MAX_CIRCLE_OFFSET_X_FACTOR) + 1);
+            int relativeY = random(- (int)(baseRadius * MAX_CIRCLE_OFFSET_Y_FACTOR_ABOVE), (int)(baseRadius * MAX_CIRCLE_OFFSET_Y_FACTOR_BELOW) +1 );
             
             float radiusVariation = MIN_CIRCLE_RADIUS_VARIATION_FACTOR + (float)random(0, (int)((MAX_CIRCLE_RADIUS_VARIATION_FACTOR - MIN_CIRCLE_RADIUS_VARIATION_FACTOR) * 100) + 1) / 100.0f;
-            circle.radius = baseRadius * radiusVariation;
-            circle.radius = std::max(2.0f, circle.radius);
-            _clouds[i].circles.push_back(circle);
+            float radius = std::max(2.0f, baseRadius * radiusVariation);
+            // Flat bottom: nothing at or below the cloud's base line.
+            _clouds[i].sprite.addCircle(relativeX, relativeY, radius, 0);
 
-            float c_left = circle.relativeX - circle.radius;
-            float c_right = circle.relativeX + circle.radius;
-            float c_top_relative_to_flat_bottom = circle.relativeY - circle.radius;
+            float c_left = relativeX - radius;
+            float c_right = relativeX + radius;
+            float c_top_relative_to_flat_bottom = relativeY - radius;
 
             if (firstCircle) {
                 cloudMinRelX = c_left; cloudMaxRelX = c_right; cloudMinRelY = c_top_relative_to_flat_bottom; firstCircle = false;
@@ -93,43 +93,19 @@ void CloudyWeatherEffect::update(unsigned long currentTime) {
 }
 
 void CloudyWeatherEffect::drawBackground() {
-    if (!_context.renderer || !_context.display) return;
-    U8G2* u8g2 = _context.display;
-    Renderer& renderer = *_context.renderer;
-
-    uint8_t originalColor = u8g2->getDrawColor();
-    u8g2->setDrawColor(1);
+    if (!_context.renderer) return;
+    FrameBufferView view(*_context.renderer);
+    if (!view.isValid()) return;
 
-    int screenTopOffset = renderer.getYOffset();
-    int cloudBottomRenderLimit_abs = screenTopOffset + renderer.getHeight() / 2 - 5 + CLOUD_VERTICAL_OFFSET;
+    int cloudBottomRenderLimit = view.getHeight() / 2 - 5 + CLOUD_VERTICAL_OFFSET;
+    view.clipTo(0, 0, view.getWidth(), cloudBottomRenderLimit);
 
     for (int i = 0; i < MAX_CLOUDS; ++i) {
         if (_clouds[i].active) {
-            int cloudFlatBottomY_abs = screenTopOffset + static_cast<int>(round(_clouds[i].y));
-            for (const auto& circle : _clouds[i].circles) {
-                float r = circle.radius; if (r < 1.0f) r = 1.0f;
-                int R_int = static_cast<int>(round(r));
-                int absCircleCenterX = renderer.getXOffset() + static_cast<int>(round(_clouds[i].x + circle.relativeX));
-                int absCircleCenterY = cloudFlatBottomY_abs + static_cast<int>(round(circle.relativeY));
-
-                for (int y_scan_relative_to_circle_center = -R_int; y_scan_relative_to_circle_center <= R_int; ++y_scan_relative_to_circle_center) {
-                    int current_y_scan_abs = absCircleCenterY + y_scan_relative_to_circle_center;
-                    if (current_y_scan_abs >= cloudFlatBottomY_abs) continue;
-                    if (current_y_scan_abs >= cloudBottomRenderLimit_abs) continue;
-                    if (current_y_scan_abs < screenTopOffset - R_int) continue; // Also check against screenTopOffset
-                    float x_span_squared = (r * r) - (y_scan_relative_to_circle_center * y_scan_relative_to_circle_center);
-                    if (x_span_squared < 0) continue;
-                    float x_span_float = sqrtf(x_span_squared);
-                    if (isnan(x_span_float)) continue;
-                    int x_span_int = static_cast<int>(round(x_span_float));
-                    if (x_span_int > 0) {
-                        u8g2->drawHLine(absCircleCenterX - x_span_int, current_y_scan_abs, x_span_int * 2 + 1);
-                    } else { u8g2->drawPixel(absCircleCenterX, current_y_scan_abs); }
-                }
-            }
+            _clouds[i].sprite.draw(view, static_cast<int>(round(_clouds[i].x)), static_cast<int>(round(_clouds[i].y)),
+                                   FrameBufferView::SET);
         }
     }
-    u8g2->setDrawColor(originalColor);
 }
 
 void CloudyWeatherEffect::drawForeground() {}
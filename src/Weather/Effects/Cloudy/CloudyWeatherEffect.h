@@ -2,7 +2,7 @@
 #define CLOUDY_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
-#include <vector>
+#include "../CloudSprite.h"
 // GameContext is included via WeatherEffectBase.h
 
 class CloudyWeatherEffect : public WeatherEffectBase {
@@ -18,16 +18,11 @@ public:
     WeatherType getType() const override;
 
 private:
-    struct CloudCircle {
-        float relativeX;
-        float relativeY;
-        float radius;
-    };
     struct Cloud {
         float x;
         float y;
         float speed;
-        std::vector<CloudCircle> circles;
+        CloudSprite sprite; // Baked in init(); respawning only moves the cloud
         bool active;
         float minRelativeX;
         float maxRelativeX;
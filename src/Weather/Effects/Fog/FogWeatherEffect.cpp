@@ -2,37 +2,57 @@
 #include <U8g2lib.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
 #include "../../../System/GameContext.h"
 #include "../../../DebugUtils.h"
 #include "Renderer.h"
+#include "../../../Helper/FrameBufferView.h"
+#include "../../../Helper/ShadeBuffer.h"
+
+namespace {
+// Upper bound of the fog's wavy top edge; the edge sits up to 15 rows lower.
+int fogTopRow(int screenH) { return screenH / 2 - 5; }
+}
 
 FogWeatherEffect::FogWeatherEffect(GameContext& context)
     : WeatherEffectBase(context) {
-    _fogNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _fogNoise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _fogNoise.SetFrequency(0.08f);
-    _fogNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
+    _fogNoise.SetFractalType(FixedNoise::FractalType_FBm);
     _fogNoise.SetFractalOctaves(2);
     _fogNoise.SetFractalLacunarity(2.0f);
     _fogNoise.SetFractalGain(0.5f);
 
-    _edgeNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    _edgeNoise.SetNoiseType(FixedNoise::NoiseType_Perlin);
     _edgeNoise.SetFrequency(0.04f); // Low frequency for smooth top edge
     _edgeNoise.SetFractalOctaves(1);
 }
 
+FogWeatherEffect::~FogWeatherEffect() {
+    if (_holdsShades) ShadeBuffer::getInstance()->release();
+}
+
 void FogWeatherEffect::init(unsigned long currentTime) {
-    _fogNoise.SetSeed(random(0, 10000));
-    _noiseOffsets[0] = (float)random(0, 500);
-    _noiseOffsets[1] = (float)random(1000, 1500);
-    _noiseOffsets[2] = (float)random(2000, 2500);
+    _rng.seedFrom(Rng::STREAM_FOG);
+    _fogNoise.SetSeed(_rng.range(0, 10000));
+    _noiseOffsets[0] = (float)_rng.range(0, 500);
+    _noiseOffsets[1] = (float)_rng.range(1000, 1500);
+    _noiseOffsets[2] = (float)_rng.range(2000, 2500);
 
     // Speeds for parallax effect - increased base speed
     _scrollSpeeds[0] = 0.02f; 
     _scrollSpeeds[1] = 0.032f;
     _scrollSpeeds[2] = 0.048f;
 
-    _edgeNoise.SetSeed(random(10000, 20000));
-    _edgeNoiseOffset = (float)random(0, 500);
+    _edgeNoise.SetSeed(_rng.range(10000, 20000));
+    _edgeNoiseOffset = (float)_rng.range(0, 500);
+
+    // New seeds: render the layers again on the next draw.
+    _fogLayers[0].filled = false;
+    _fogLayers[1].filled = false;
+    _edgeLayer.filled = false;
 
     _isFadingIn = true;
     _isFadingOut = false;
@@ -92,32 +112,131 @@ void FogWeatherEffect::drawBackground() {
     // Fog is drawn in the foreground to obscure objects
 }
 
-void FogWeatherEffect::drawForeground() {
-    if (!_context.renderer || !_context.display || _densityThreshold >= 1.0f) return;
-    U8G2* u8g2 = _context.display;
-    Renderer& renderer = *_context.renderer;
+bool FogWeatherEffect::prepareLayers(int screenW, int screenH) {
+    if (screenW == _layerWidth && screenH == _layerHeight) {
+        return _fogLayers[0].density && _fogLayers[1].density && _edgeLayer.density;
+    }
+    _layerWidth = screenW;
+    _layerHeight = screenH;
+
+    // One column per cell, plus one to interpolate the rightmost cell.
+    const int columns = (screenW - 1) / CELL_SIZE + 2;
+    // The fog never starts above its highest possible top edge.
+    const int rowOrigin = std::max(0, fogTopRow(screenH));
+    const int rows = screenH - rowOrigin;
+    if (screenW <= 0 || rows <= 0) return false;
+
+    bool allocated = allocateLayer(_fogLayers[0], &_fogNoise, 0.04f, rowOrigin, rows, columns);
+    allocated = allocateLayer(_fogLayers[1], &_fogNoise, 0.08f, rowOrigin, rows, columns) && allocated;
+    allocated = allocateLayer(_edgeLayer, &_edgeNoise, 0.05f, 0, 1, columns) && allocated;
+    if (!allocated) {
+        debugPrintf("WEATHER", "Fog: Failed to allocate noise layers for %dx%d.", screenW, screenH);
+    }
+    return allocated;
+}
+
+bool FogWeatherEffect::allocateLayer(NoiseLayer& layer, FixedNoise* noise, float scale, int rowOrigin, int rows, int columns) {
+    layer.noise = noise;
+    layer.scale = scale;
+    layer.rowOrigin = rowOrigin;
+    layer.rows = rows;
+    layer.columns = columns;
+    layer.filled = false;
+    layer.density.reset(new (std::nothrow) uint8_t[(size_t)rows * columns]);
+    return layer.density != nullptr;
+}
+
+// Texture column k holds the noise at x = k * CELL_SIZE * scale. The screen's
+// leftmost cell falls between columns firstColumn and firstColumn + 1, at
+// 'fraction'. Columns that scrolled into view are rendered into the slots of
+// those that scrolled out.
+void FogWeatherEffect::scrollLayer(NoiseLayer& layer, float offset, float& fraction) {
+    float position = offset / (CELL_SIZE * layer.scale);
+    float whole = floorf(position);
+    fraction = position - whole;
+    long first = (long)whole;
 
-    uint8_t originalColor = u8g2->getDrawColor();
-    u8g2->setDrawColor(2); // Use XOR for transparency
+    if (!layer.filled || labs(first - layer.firstColumn) >= layer.columns) {
+        for (long column = first; column < first + layer.columns; ++column) renderColumn(layer, column);
+    } else if (first > layer.firstColumn) {
+        for (long column = layer.firstColumn + layer.columns; column < first + layer.columns; ++column) renderColumn(layer, column);
+    } else {
+        for (long column = first; column < layer.firstColumn; ++column) renderColumn(layer, column);
+    }
+    layer.firstColumn = first;
+    layer.filled = true;
+}
+
+void FogWeatherEffect::renderColumn(NoiseLayer& layer, long column) {
+    uint8_t* density = columnAt(layer, column);
+    float noiseX = (float)column * CELL_SIZE * layer.scale;
+    int16_t samples[32];
+    for (int row = 0; row < layer.rows; row += 32) {
+        int count = std::min(32, layer.rows - row);
+        layer.noise->GetNoiseRow(noiseX, (layer.rowOrigin + row) * layer.scale, 0.0f, layer.scale, count, samples);
+        // NORMALIZE NOISE from [-SAMPLE_ONE, SAMPLE_ONE] to [0, 255]
+        for (int i = 0; i < count; ++i) {
+            int32_t n = (int32_t)samples[i] + FixedNoise::SAMPLE_ONE;
+            density[row + i] = (uint8_t)((n * 255 + FixedNoise::SAMPLE_ONE) / (2 * FixedNoise::SAMPLE_ONE));
+        }
+    }
+}
+
+uint8_t* FogWeatherEffect::columnAt(const NoiseLayer& layer, long column) {
+    long slot = column % layer.columns;
+    if (slot < 0) slot += layer.columns;
+    return layer.density.get() + slot * layer.rows;
+}
+
+void FogWeatherEffect::drawForeground() {
+    if (!_context.renderer || _densityThreshold >= 1.0f) return;
+    FrameBufferView view(*_context.renderer);
+    if (!view.isValid()) return;
+    const int screenW = view.getWidth();
+    const int screenH = view.getHeight();
+    if (!prepareLayers(screenW, screenH)) return;
+    ShadeBuffer* shades = ShadeBuffer::getInstance();
+    if (!_holdsShades && !(_holdsShades = shades->acquire())) return;
+    shades->begin();
 
     // Define the vertical zone where fog can appear and fade.
-    const int baseFogY = renderer.getHeight() / 2 - 5;
+    const int baseFogY = fogTopRow(screenH);
     const int fogHeightVariation = 15;
     const int fogVerticalFadeHeight = 10;
-    const int step = 2; // Use a 2x2 grid for dithering
+    const int step = CELL_SIZE; // Use a 2x2 grid for shading
+    const float toUnit = 1.0f / 255.0f;
+    const float intensityScale = 1.0f / (1.0f - _densityThreshold);
+
+    float coarseFraction, fineFraction, edgeFraction;
+    scrollLayer(_fogLayers[0], _noiseOffsets[0], coarseFraction);
+    scrollLayer(_fogLayers[1], _noiseOffsets[1], fineFraction);
+    scrollLayer(_edgeLayer, _edgeNoiseOffset, edgeFraction);
+    const int rowOrigin = _fogLayers[0].rowOrigin;
 
-    float scales[] = {0.04f, 0.08f, 0.12f};
-    
     // Iterate by columns (x) first to determine the start Y for each column
-    for (int x = 0; x < renderer.getWidth(); x += step) {
-        // Calculate the wavy top edge of the fog for this column 'x'
-        float edgeNoiseVal = (_edgeNoise.GetNoise(x * 0.05f + _edgeNoiseOffset, 0.0f) + 1.0f) * 0.5f; // Normalize to 0-1
+    for (int cell = 0; cell * step < screenW; ++cell) {
+        const int x = cell * step;
+
+        // The wavy top edge of the fog for this column 'x', between two texture columns
+        const uint8_t* edgeLeft = columnAt(_edgeLayer, _edgeLayer.firstColumn + cell);
+        const uint8_t* edgeRight = columnAt(_edgeLayer, _edgeLayer.firstColumn + cell + 1);
+        float edgeNoiseVal = (edgeLeft[0] + (edgeRight[0] - edgeLeft[0]) * edgeFraction) * toUnit;
         int columnStartY = baseFogY + (int)(edgeNoiseVal * fogHeightVariation);
-        
-        // Now iterate downwards from that start Y for this column
-        for (int y = columnStartY; y < renderer.getHeight(); y += step) {
-            if (y < 0) continue; 
 
+        const uint8_t* coarseLeft = columnAt(_fogLayers[0], _fogLayers[0].firstColumn + cell);
+        const uint8_t* coarseRight = columnAt(_fogLayers[0], _fogLayers[0].firstColumn + cell + 1);
+        const uint8_t* fineLeft = columnAt(_fogLayers[1], _fogLayers[1].firstColumn + cell);
+        const uint8_t* fineRight = columnAt(_fogLayers[1], _fogLayers[1].firstColumn + cell + 1);
+
+        // Now iterate downwards from that start Y for this column, working
+        // out the shades of the whole cell column before handing it over
+        int firstY = columnStartY;
+        if (firstY < 0) firstY += ((-firstY + step - 1) / step) * step;
+        const int lastY = std::min(screenH, (int)ShadeBuffer::HEIGHT);
+        if (firstY >= lastY) continue;
+        uint8_t columnShades[ShadeBuffer::HEIGHT];
+        memset(columnShades, 0, lastY - firstY);
+        for (int y = firstY; y < lastY; y += step) {
             // Calculate a vertical fade factor based on distance from the wavy top.
             float verticalFadeFactor = 1.0f;
             int distanceFromWavyTop = y - columnStartY;
@@ -126,39 +245,33 @@ void FogWeatherEffect::drawForeground() {
             }
 
             // Combine noise from multiple layers for a more volumetric feel
-            // NORMALIZE NOISE from [-1, 1] to [0, 1] range
-            float n1 = (_fogNoise.GetNoise(x * scales[0] + _noiseOffsets[0], y * scales[0]) + 1.0f) * 0.5f;
-            float n2 = (_fogNoise.GetNoise(x * scales[1] + _noiseOffsets[1], y * scales[1]) + 1.0f) * 0.5f;
+            const int row = y - rowOrigin;
+            float n1 = (coarseLeft[row] + (coarseRight[row] - coarseLeft[row]) * coarseFraction) * toUnit;
+            float n2 = (fineLeft[row] + (fineRight[row] - fineLeft[row]) * fineFraction) * toUnit;
             
             // Weighted average of noise values
             float combinedNoise = (n1 * 0.6f) + (n2 * 0.4f);
             
             if (combinedNoise > _densityThreshold) {
                 // Calculate base intensity based on noise
-                float baseIntensity = (combinedNoise - _densityThreshold) / (1.0f - _densityThreshold);
+                float baseIntensity = (combinedNoise - _densityThreshold) * intensityScale;
                 
                 // Modulate intensity with the vertical fade factor
                 float finalIntensity = baseIntensity * verticalFadeFactor;
                 finalIntensity = std::min(1.0f, finalIntensity);
 
                 if (finalIntensity > 0.0f) {
-                    // Determine number of random pixels to draw in this cell based on final intensity
-                    int pixelsToDraw = static_cast<int>(round(finalIntensity * (step * step * 0.75f)));
-
-                    // Draw the random pixels
-                    for (int p = 0; p < pixelsToDraw; ++p) {
-                        int px = x + random(0, step); 
-                        int py = y + random(0, step); 
-                        if (px < renderer.getWidth() && py < renderer.getHeight()) {
-                            u8g2->drawPixel(renderer.getXOffset() + px, renderer.getYOffset() + py);
-                        }
-                    }
+                    // Up to three quarters of the cell's pixels light up
+                    const uint8_t shade = (uint8_t)lroundf(finalIntensity * 0.75f * 255.0f);
+                    const int end = std::min(lastY, y + step);
+                    for (int cellY = y; cellY < end; ++cellY) columnShades[cellY - firstY] = shade;
                 }
             }
         }
+        for (int dx = 0; dx < step; ++dx) shades->column(x + dx, firstY, columnShades, lastY - firstY);
     }
-    
-    u8g2->setDrawColor(originalColor);
+    // XOR for transparency
+    shades->quantize(view, FrameBufferView::XOR);
 }
 
 WeatherType FogWeatherEffect::getType() const {
@@ -2,12 +2,14 @@
 #define FOG_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
-#include "FastNoiseLite.h"
+#include "../../../Helper/FixedNoise.h"
+#include "../../../Helper/Rng.h"
+#include <memory>
 
 class FogWeatherEffect : public WeatherEffectBase {
 public:
     FogWeatherEffect(GameContext& context);
-    ~FogWeatherEffect() override = default;
+    ~FogWeatherEffect() override;
 
     void init(unsigned long currentTime) override;
     void update(unsigned long currentTime) override;
@@ -18,13 +20,41 @@ public:
     void startFadeOut(unsigned long duration) override;
 
 private:
-    FastNoiseLite _fogNoise;
-    FastNoiseLite _edgeNoise; // For creating a soft top edge
+    // A noise layer rendered once into a wrap-around texture of density
+    // columns, one per fog cell. The fog only scrolls horizontally, so each
+    // frame samples it at the scrolled offset and renders just the columns
+    // that scrolled into view.
+    struct NoiseLayer {
+        FixedNoise* noise = nullptr;
+        float scale = 0.0f;      // Noise units per screen pixel
+        int rowOrigin = 0;       // Screen row of texture row 0
+        int rows = 0;
+        int columns = 0;         // Ring size
+        long firstColumn = 0;    // Noise column of the leftmost cell on screen
+        bool filled = false;
+        std::unique_ptr<uint8_t[]> density; // columns x rows, column-major, 0..255
+    };
+
+    bool prepareLayers(int screenW, int screenH);
+    bool allocateLayer(NoiseLayer& layer, FixedNoise* noise, float scale, int rowOrigin, int rows, int columns);
+    void scrollLayer(NoiseLayer& layer, float offset, float& fraction);
+    void renderColumn(NoiseLayer& layer, long column);
+    static uint8_t* columnAt(const NoiseLayer& layer, long column);
+
+    FixedNoise _fogNoise;
+    FixedNoise _edgeNoise; // For creating a soft top edge
+    Rng _rng;
+    bool _holdsShades = false; // ShadeBuffer acquired
 
     float _noiseOffsets[3]; // For 3 layers of fog
     float _edgeNoiseOffset = 0.0f;
     float _scrollSpeeds[3];
     float _densityThreshold;
+
+    NoiseLayer _fogLayers[2]; // Coarse and fine fog, scrolled by _noiseOffsets[0] and [1]
+    NoiseLayer _edgeLayer;    // One row: the wavy top edge
+    int _layerWidth = 0;      // Screen size the layers were made for
+    int _layerHeight = 0;
     
     // Fade state
     bool _isFadingIn = false;
@@ -36,6 +66,7 @@ private:
     float _fadeStartDensity = 0.0f;
 
     // Constants
+    static const int CELL_SIZE = 2; // Fog is shaded in 2x2 cells
     static constexpr float BASE_DENSITY_THRESHOLD = 0.45f;
     static constexpr float FADE_IN_START_THRESHOLD = 1.1f;
     static constexpr float FADE_OUT_END_THRESHOLD = 1.1f;
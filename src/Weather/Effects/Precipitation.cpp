@@ -0,0 +1,85 @@
+#include "Precipitation.h"
+#include <algorithm>
+#include "../../DebugUtils.h"
+
+Precipitation::Precipitation(const Config& config) : _config(config) {
+    _speedCount = std::max(1, std::min(MAX_SPEEDS, _config.speedMax - _config.speedMin));
+    for (int i = 0; i < _speedCount; ++i) _speeds[i] = (int16_t)toFixed((_config.speedMin + i) * _config.speedUnit);
+}
+
+bool Precipitation::init(int width, int height) {
+    if (!_storage) {
+        const int n = _config.maxParticles;
+        _storage.reset(new (std::nothrow) int16_t[n * 4]);
+        _variant.reset(new (std::nothrow) uint8_t[n]);
+        if (!_storage || !_variant) {
+            debugPrint("WEATHER", "FATAL: Failed to allocate memory for precipitation!");
+            _storage.reset();
+            _variant.reset();
+            return false;
+        }
+        _x = _storage.get();
+        _y = _x + n;
+        _speed = _y + n;
+        _drift = _speed + n;
+    }
+    _width = width;
+    _height = height;
+    _rng.seedFrom(Rng::STREAM_PRECIPITATION);
+    for (int i = 0; i < _config.maxParticles; ++i) {
+        respawn(i);
+        _y[i] = (int16_t)(_rng.range(-height, -5) * ONE);
+    }
+    return true;
+}
+
+int Precipitation::countFor(uint8_t density) const {
+    return std::min(_config.maxParticles, (_config.maxParticles * density) / 100);
+}
+
+void Precipitation::update(int count, int windStep) {
+    if (!_storage) return;
+    count = std::min(count, _config.maxParticles);
+    const int16_t step = (int16_t)windStep;
+    int16_t* __restrict x = _x;
+    int16_t* __restrict y = _y;
+    const int16_t* __restrict speed = _speed;
+    const int16_t* __restrict drift = _drift;
+    for (int i = 0; i < count; ++i) {
+        y[i] += speed[i];
+        x[i] += drift[i] * step;
+    }
+
+    const int bottom = (_height + _config.bottomMargin) * ONE;
+    const int left = -_config.sideMargin * ONE;
+    const int right = (_width + _config.sideMargin) * ONE;
+    for (int i = 0; i < count; ++i) {
+        if (y[i] <= bottom && x[i] >= left && x[i] <= right) continue;
+        if (y[i] > bottom || !_config.wrapX) respawn(i);
+        else x[i] = (int16_t)(x[i] < left ? right - ONE : left + ONE);
+    }
+}
+
+void Precipitation::drawSpans(FrameBufferView& view, int count, int length, FrameBufferView::Op op) const {
+    if (!_storage) return;
+    count = std::min(count, _config.maxParticles);
+    const int CHUNK = 32;
+    int16_t xs[CHUNK];
+    int16_t ys[CHUNK];
+    for (int first = 0; first < count; first += CHUNK) {
+        const int n = std::min(CHUNK, count - first);
+        for (int i = 0; i < n; ++i) {
+            xs[i] = (int16_t)((_x[first + i] + ONE / 2) >> FRACTION_BITS);
+            ys[i] = (int16_t)((_y[first + i] + ONE / 2) >> FRACTION_BITS);
+        }
+        view.vSpans(xs, ys, n, length, op);
+    }
+}
+
+void Precipitation::respawn(int i) {
+    _x[i] = (int16_t)(_rng.range(0, _width) * ONE);
+    _y[i] = (int16_t)(_rng.range(_config.respawnTop, _config.respawnBottom + 1) * ONE);
+    _speed[i] = _speeds[_rng.range(0, _speedCount)];
+    _drift[i] = (int16_t)_rng.range(_config.driftMin, _config.driftMax);
+    _variant[i] = (uint8_t)_rng.range(0, std::max(1, _config.variants));
+}
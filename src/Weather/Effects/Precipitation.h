@@ -0,0 +1,84 @@
+#ifndef PRECIPITATION_H
+#define PRECIPITATION_H
+
+#include <Arduino.h>
+#include <memory>
+#include "../../Helper/FrameBufferView.h"
+#include "../../Helper/Rng.h"
+
+// The falling particles of rain, heavy rain, snow and the storm: one engine,
+// configured per effect. Particles are kept as parallel int16 arrays in
+// fixed point (FRACTION_BITS), so moving them all is one tight loop without
+// calls or floats; only the few that leave the screen are respawned, from
+// the engine's own Rng instead of random().
+//
+// A particle falls by its speed each update and drifts sideways by its drift
+// weight times the frame's wind step. Below the bottom it respawns above the
+// screen; past a side it respawns too, or with wrapX re-enters from the
+// other side.
+class Precipitation {
+public:
+    static const int FRACTION_BITS = 6;
+    static const int ONE = 1 << FRACTION_BITS; // One pixel
+    static const int MAX_SPEEDS = 16;
+
+    struct Config {
+        int maxParticles;
+        // Speed: a whole number of speedUnit pixels per update, from
+        // speedMin up to speedMax - 1.
+        int speedMin;
+        int speedMax;
+        float speedUnit;
+        // Drift weight, from driftMin up to driftMax - 1.
+        int driftMin;
+        int driftMax;
+        int variants;       // Each respawn picks variant 0 .. variants - 1
+        int respawnTop;     // Respawn rows, both included, above the screen
+        int respawnBottom;
+        int bottomMargin;   // Rows past the bottom edge before a respawn
+        int sideMargin;     // Columns past a side edge
+        bool wrapX;
+    };
+
+    explicit Precipitation(const Config& config);
+
+    // Allocates the particles on first use and scatters them all above the
+    // screen. False if the memory is not there.
+    bool init(int width, int height);
+    bool isReady() const { return _x != nullptr; }
+
+    // Moves the first count particles; windStep is the sideways step of a
+    // drift weight of one, in fixed point.
+    void update(int count, int windStep);
+    // Draws the first count particles as vertical spans of length pixels.
+    void drawSpans(FrameBufferView& view, int count, int length, FrameBufferView::Op op) const;
+
+    // Particles for a density of 0..100 percent.
+    int countFor(uint8_t density) const;
+
+    // Rounded to the nearest pixel.
+    int pixelX(int i) const { return (_x[i] + ONE / 2) >> FRACTION_BITS; }
+    int pixelY(int i) const { return (_y[i] + ONE / 2) >> FRACTION_BITS; }
+    uint8_t variant(int i) const { return _variant[i]; }
+
+    static int toFixed(float pixels) { return (int)lroundf(pixels * ONE); }
+
+private:
+    Config _config;
+    int16_t _speeds[MAX_SPEEDS];
+    int _speedCount = 1;
+    int _width = 0;
+    int _height = 0;
+    Rng _rng;
+
+    std::unique_ptr<int16_t[]> _storage; // x, y, speed and drift runs
+    int16_t* _x = nullptr;
+    int16_t* _y = nullptr;
+    int16_t* _speed = nullptr;
+    int16_t* _drift = nullptr;
+    std::unique_ptr<uint8_t[]> _variant;
+
+    void respawn(int i);
+};
+
+#endif // PRECIPITATION_H
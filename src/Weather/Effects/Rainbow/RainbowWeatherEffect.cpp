@@ -5,6 +5,8 @@
 #include <memory>    
 #include "../../../System/GameContext.h" // Ensure GameContext is known
 #include "../../../DebugUtils.h"
+#include "../../../Helper/FixedTrig.h"
+#include "../../../Helper/FrameBufferView.h"
 #include "SerialForwarder.h"
 
 
@@ -34,14 +36,16 @@ void RainbowWeatherEffect::init(unsigned long currentTime) {
     initCloudsRainbow(currentTime);
     if (_sparkleParticleSystem) _sparkleParticleSystem->reset();
     _lastSparkleSpawnTime = currentTime;
+    _lastSparkleUpdateTime = currentTime;
 }
 
 void RainbowWeatherEffect::update(unsigned long currentTime) {
     updateCloudsRainbow(currentTime);
     updateSparkles(currentTime);
     if (_sparkleParticleSystem) {
-        _sparkleParticleSystem->update(currentTime, 33); 
+        _sparkleParticleSystem->update(currentTime, currentTime - _lastSparkleUpdateTime);
     }
+    _lastSparkleUpdateTime = currentTime;
 }
 
 bool RainbowWeatherEffect::isCoordOverRainbow(int screenX, int screenY) const {
@@ -85,11 +89,10 @@ void RainbowWeatherEffect::updateSparkles(unsigned long currentTime) {
                     int band = random(0, _numRainbowBands);
                     int radius = static_cast<int>(_rainbowStartRadius + band * (_rainbowBandThickness + _rainbowBandSpacing) + random(0, _rainbowBandThickness + 1));
                     
-                    float angleDeg = (float)random(20, 161); 
-                    float angleRad = angleDeg * PI / 180.0f;
+                    FixedTrig::Angle angle = FixedTrig::fromDegrees((float)random(20, 161));
 
-                    float spawnX = (float)_rainbowCenterX + cos(angleRad) * radius;
-                    float spawnY = (float)_rainbowCenterY - abs(sin(angleRad) * radius); 
+                    float spawnX = (float)_rainbowCenterX + FixedTrig::cosF(angle) * radius;
+                    float spawnY = (float)_rainbowCenterY - abs(FixedTrig::sinF(angle) * radius); 
 
                     spawnX = std::max(2.0f, std::min((float)_context.renderer->getWidth() - 3.0f, spawnX));
                     spawnY = std::max(2.0f, std::min((float)_context.renderer->getHeight() - 5.0f, spawnY));
@@ -145,6 +148,7 @@ void RainbowWeatherEffect::initCloudsRainbow(unsigned long currentTime) {
             _clouds[i].y = (float)random(cloudMinY, cloudMaxY + 1); 
             _clouds[i].speed = (float)random(CLOUD_SPEED_MIN_TENTHS_RB, CLOUD_SPEED_MAX_TENTHS_RB + 1) / 10.0f;
             _clouds[i].circles.clear();
+            _clouds[i].sprite.clear();
 
             int numCircles = random(MIN_CIRCLES_PER_CLOUD_RB, MAX_CIRCLES_PER_CLOUD_RB + 1);
             float baseRadius = MIN_BASE_CLOUD_RADIUS_RB + (float)random(0, (int)((MAX_BASE_CLOUD_RADIUS_RB - MIN_BASE_CLOUD_RADIUS_RB) * 100) + 1) / 100.0f;
@@ -161,6 +165,9 @@ void RainbowWeatherEffect::initCloudsRainbow(unsigned long currentTime) {
                 circle.radius = baseRadius * radiusVariation;
                 circle.radius = std::max(1.5f, circle.radius); 
                 _clouds[i].circles.push_back(circle);
+                // Each circle stops a radius below the base line.
+                _clouds[i].sprite.addCircle((int)circle.relativeX, (int)circle.relativeY, circle.radius,
+                                            static_cast<int>(round(std::max(1.0f, circle.radius))));
 
                 float c_left = circle.relativeX - circle.radius;
                 float c_right = circle.relativeX + circle.radius;
@@ -215,49 +222,27 @@ void RainbowWeatherEffect::updateCloudsRainbow(unsigned long currentTime) {
 }
 
 void RainbowWeatherEffect::drawCloudsRainbow() {
-    if (!_context.renderer || !_context.display) return;
-    U8G2* u8g2 = _context.display;
+    if (!_context.renderer) return;
+    FrameBufferView view(*_context.renderer);
+    if (!view.isValid()) return;
     Renderer& renderer = *_context.renderer;
 
-    uint8_t originalColor = u8g2->getDrawColor();
-    int screenTopOffset = renderer.getYOffset();
-    // int cloudBottomRenderLimit_abs = renderer.getYOffset() + renderer.getHeight();  // Not strictly used with current logic
-
     for (int i = 0; i < MAX_CLOUDS_RAINBOW; ++i) {
         if (_clouds[i].active) {
-            int cloudBaseLineY_abs = screenTopOffset + static_cast<int>(round(_clouds[i].y)); 
+            int cloudX = static_cast<int>(round(_clouds[i].x));
+            int cloudBaseLineY = static_cast<int>(round(_clouds[i].y));
+            // XOR where the cloud crosses a band, so the rainbow shows through.
+            bool overRainbow = false;
             for (const auto& circle : _clouds[i].circles) {
-                float r = circle.radius; if (r < 1.0f) r = 1.0f;
-                int R_int = static_cast<int>(round(r));
-                int absCircleCenterX = renderer.getXOffset() + static_cast<int>(round(_clouds[i].x + circle.relativeX));
-                int absCircleCenterY = cloudBaseLineY_abs + static_cast<int>(round(circle.relativeY)); 
-
-                bool overRainbow = isCoordOverRainbow(absCircleCenterX, absCircleCenterY);
-                u8g2->setDrawColor(overRainbow ? 2 : 1); 
-
-                for (int y_scan_offset = -R_int; y_scan_offset <= R_int; ++y_scan_offset) {
-                    int current_y_scan_abs = absCircleCenterY + y_scan_offset;
-                    
-                    if (current_y_scan_abs >= cloudBaseLineY_abs + R_int) continue; 
-                    if (current_y_scan_abs < screenTopOffset) continue;
-                    if (current_y_scan_abs >= screenTopOffset + renderer.getHeight()) continue;
-
-                    float x_span_squared = (r * r) - (y_scan_offset * y_scan_offset);
-                    if (x_span_squared < 0) continue;
-                    float x_span_float = sqrtf(x_span_squared);
-                    if (isnan(x_span_float)) continue;
-                    int x_span_int = static_cast<int>(round(x_span_float));
-
-                    if (x_span_int > 0) {
-                        u8g2->drawHLine(absCircleCenterX - x_span_int, current_y_scan_abs, x_span_int * 2 + 1);
-                    } else { 
-                        u8g2->drawPixel(absCircleCenterX, current_y_scan_abs); 
-                    }
+                if (isCoordOverRainbow(renderer.getXOffset() + cloudX + (int)circle.relativeX,
+                                       renderer.getYOffset() + cloudBaseLineY + (int)circle.relativeY)) {
+                    overRainbow = true;
+                    break;
                 }
             }
+            _clouds[i].sprite.draw(view, cloudX, cloudBaseLineY, overRainbow ? FrameBufferView::XOR : FrameBufferView::SET);
         }
     }
-    u8g2->setDrawColor(originalColor);
 }
 
 void RainbowWeatherEffect::drawBackground() {
@@ -2,6 +2,7 @@
 #define RAINBOW_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
+#include "../CloudSprite.h"
 #include <vector> // For cloud circles
 #include "../../../ParticleSystem.h" // For sparkle effect
 #include <memory> // For unique_ptr
@@ -37,6 +38,7 @@ private:
         float y;
         float speed;
         std::vector<CloudCircle> circles;
+        CloudSprite sprite; // The circles, baked in initCloudsRainbow()
         bool active;
         float minRelativeX; 
         float maxRelativeX; 
@@ -68,6 +70,7 @@ private:
     // Sparkle Effect
     std::unique_ptr<ParticleSystem> _sparkleParticleSystem;
     unsigned long _lastSparkleSpawnTime = 0;
+    unsigned long _lastSparkleUpdateTime = 0; // Sparkles move by the time since
     static const unsigned long SPARKLE_SPAWN_INTERVAL_MS = 600; // Slower spawn rate
     static const int MAX_SPARKLES_PER_BURST = 2; // Fewer sparkles per burst
 
@@ -2,6 +2,7 @@
 #define RAINY_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
+#include "../Precipitation.h"
 // GameContext is included via WeatherEffectBase.h
 
 class RainyWeatherEffect : public WeatherEffectBase {
@@ -17,14 +18,12 @@ public:
     WeatherType getType() const override;
 
 private:
-    struct RainDrop { int x; int y; int speed; };
-    static const int MAX_RAIN_DROPS = 30; 
-    RainDrop* _rainDrops = nullptr; // MODIFIED: Changed from static array to pointer
+    static const int MAX_RAIN_DROPS = 30;
+    static const int MAX_HEAVY_RAIN_DROPS = 48;
     bool _isHeavyRain;
-    
-    void initRainDrops();
-    void updateRainDrops();
-    void drawRain(uint8_t speed_factor);
+    Precipitation _rain;
+
+    static Precipitation::Config rainConfig(bool isHeavy);
 };
 
 #endif // RAINY_WEATHER_EFFECT_H
\ No newline at end of file
@@ -6,15 +6,21 @@
 #include "../../WeatherManager.h" 
 #include "SerialForwarder.h"
 #include "Renderer.h"
-#include <iterator>
+#include "../../../Helper/FrameBufferView.h"
 
 extern WeatherManager* weatherManager_ptr; 
 
+// The flakes are the '.' and '*' glyphs of u8g2_font_4x6_tf and the '*' of
+// u8g2_font_5x7_tf, which the effect used to draw with drawStr(). Rows are
+// LSB-first, `top` rows below the glyph origin with the font positioned at
+// the top (the mode DialogBox leaves U8g2 in).
+const SnowyWeatherEffect::FlakeShape SnowyWeatherEffect::FLAKE_DOT = {4, 1, {0x02}};
+const SnowyWeatherEffect::FlakeShape SnowyWeatherEffect::FLAKE_STAR = {1, 3, {0x05, 0x02, 0x05}};
+const SnowyWeatherEffect::FlakeShape SnowyWeatherEffect::FLAKE_LARGE_STAR = {1, 5, {0x04, 0x15, 0x0E, 0x15, 0x04}};
+
 // Constructor now takes GameContext
 SnowyWeatherEffect::SnowyWeatherEffect(GameContext& context, bool isHeavy)
-    : WeatherEffectBase(context), _isHeavySnow(isHeavy) {
-    _snowFont = u8g2_font_4x6_tf;
-    _largeSnowFont = u8g2_font_5x7_tf;
+    : WeatherEffectBase(context), _isHeavySnow(isHeavy), _snow(snowConfig(isHeavy)) {
     if (_context.serialForwarder) {
         _context.serialForwarder->printf("%sWeatherEffect created\n", _isHeavySnow ? "HeavySnow" : "Snowy");
     }
@@ -22,89 +28,78 @@ SnowyWeatherEffect::SnowyWeatherEffect(GameContext& context, bool isHeavy)
 
 SnowyWeatherEffect::~SnowyWeatherEffect() {
     debugPrintf("WEATHER", "%sWeatherEffect destroyed, freeing buffers.", _isHeavySnow ? "HeavySnow" : "Snowy");
-    if (_snowFlakes != nullptr) {
-        delete[] _snowFlakes;
-        _snowFlakes = nullptr;
-    }
+}
+
+// Flakes fall 0.3..0.6 px per update (heavy snow: 0.6..1.4), each with its
+// own share of the wind, -0.4..0.4, and wrap around the sides. Variant 0 is
+// a dot, the others a star.
+Precipitation::Config SnowyWeatherEffect::snowConfig(bool isHeavy) {
+    Precipitation::Config config = {};
+    config.maxParticles = MAX_SNOW_FLAKES;
+    config.speedMin = 3;
+    config.speedMax = isHeavy ? 8 : 7;
+    config.speedUnit = isHeavy ? 0.2f : 0.1f;
+    config.driftMin = -4;
+    config.driftMax = 5;
+    config.variants = 3;
+    config.respawnTop = -20;
+    config.respawnBottom = -6;
+    config.bottomMargin = 5;
+    config.sideMargin = 5;
+    config.wrapX = true;
+    return config;
 }
 
 void SnowyWeatherEffect::init(unsigned long currentTime) {
-    if (_snowFlakes == nullptr) {
-        _snowFlakes = new (std::nothrow) SnowFlake[MAX_SNOW_FLAKES];
-        if (_snowFlakes == nullptr) {
+    if (!_context.renderer) return;
+    if (!_growth) {
+        _growth.reset(new (std::nothrow) FlakeGrowth[MAX_SNOW_FLAKES]);
+        if (!_growth) {
             debugPrint("WEATHER", "FATAL: Failed to allocate memory for snow flakes!");
             return;
         }
         debugPrintf("WEATHER", "%sWeatherEffect: Allocated buffers.", _isHeavySnow ? "HeavySnow" : "Snowy");
     }
-    initSnowFlakes();
+    if (!_snow.init(_context.renderer->getWidth(), _context.renderer->getHeight())) return;
+    initGrowth(currentTime);
     if (_context.serialForwarder) {
         _context.serialForwarder->printf("%sWeatherEffect init\n", _isHeavySnow ? "HeavySnow" : "Snowy");
     }
 }
 
-void SnowyWeatherEffect::initSnowFlakes() {
-    if (!_context.renderer || !_snowFlakes) return;
-    int screenW = _context.renderer->getWidth();
-    int screenH = _context.renderer->getHeight();
-    unsigned long currentTime = millis();
-
+void SnowyWeatherEffect::initGrowth(unsigned long currentTime) {
+    _rng.seedFrom(Rng::STREAM_WEATHER);
     for (int i = 0; i < MAX_SNOW_FLAKES; ++i) {
-        _snowFlakes[i] = {
-            (float)random(0, screenW),
-            (float)random(-screenH, -5),
-            (float)random(3, _isHeavySnow ? 8 : 7) / 10.0f, 
-            (float)random(-4, 5) / 10.0f, 
-            (random(0,3) == 0) ? '.' : '*',
-            (random(100) < 15), // canGrow
+        _growth[i] = {
+            _rng.percent(15), // canGrow
             false, // isGrowing
             1.0f, // currentSizeMultiplier
-            currentTime + random(2000, 8001) // nextSizeChangeTime
+            currentTime + _rng.range(2000, 8001) // nextSizeChangeTime
         };
     }
-    if (_context.serialForwarder) _context.serialForwarder->println("Snowflakes initialized/re-initialized.");
 }
 
 void SnowyWeatherEffect::update(unsigned long currentTime) {
-    updateSnowFlakes(currentTime);
+    if (!_growth || !_snow.isReady()) return;
+    uint8_t speed_factor = _isHeavySnow ? 2 : 1;
+    int count = _snow.countFor(_particleDensity);
+    // Weight w drifts a flake by w / 10 times 1.2x the wind factor.
+    _snow.update(count, Precipitation::toFixed(_currentWindFactor * speed_factor * 0.12f));
+    updateGrowth(currentTime, count);
 }
 
-void SnowyWeatherEffect::updateSnowFlakes(unsigned long currentTime) {
-    if (!_context.renderer || !_snowFlakes) return;
-    int screenW = _context.renderer->getWidth();
-    int screenH = _context.renderer->getHeight();
-    uint8_t speed_factor = _isHeavySnow ? 2 : 1;
-    uint8_t current_density = _particleDensity;
-    uint8_t flakes_to_update = (MAX_SNOW_FLAKES * current_density) / 100;
-    flakes_to_update = std::min((int)MAX_SNOW_FLAKES, (int)flakes_to_update);
-
-    for (int i = 0; i < flakes_to_update; ++i) {
-        SnowFlake& flake = _snowFlakes[i];
-        flake.y += flake.speedY * speed_factor;
-        flake.x += (_currentWindFactor * flake.speedXFactor * speed_factor * 1.2f); 
-
-        if (flake.canGrow) {
-            if (currentTime >= flake.nextSizeChangeTime) {
-                flake.isGrowing = !flake.isGrowing;
-                flake.nextSizeChangeTime = currentTime + random(2000, 8001);
-            }
-            
-            float targetSize = flake.isGrowing ? 1.5f : 1.0f;
-            // Simple linear interpolation for smooth transition
-            flake.currentSizeMultiplier += (targetSize - flake.currentSizeMultiplier) * 0.05f;
+void SnowyWeatherEffect::updateGrowth(unsigned long currentTime, int count) {
+    for (int i = 0; i < count; ++i) {
+        FlakeGrowth& growth = _growth[i];
+        if (!growth.canGrow) continue;
+        if (currentTime >= growth.nextSizeChangeTime) {
+            growth.isGrowing = !growth.isGrowing;
+            growth.nextSizeChangeTime = currentTime + _rng.range(2000, 8001);
         }
 
-        if (flake.y > screenH + 5) {
-            flake.x = (float)random(0, screenW);
-            flake.y = (float)random(-20, -5);
-            flake.speedY = (float)random(3, _isHeavySnow ? 8 : 7) / 10.0f;
-            flake.speedXFactor = (float)random(-4, 5) / 10.0f;
-            flake.displayChar = (random(0,3) == 0) ? '.' : '*';
-        } else if (flake.x < -5) {
-            flake.x = screenW + 4;
-        } else if (flake.x > screenW + 5) {
-            flake.x = -4;
-        }
+        float targetSize = growth.isGrowing ? 1.5f : 1.0f;
+        // Simple linear interpolation for smooth transition
+        growth.currentSizeMultiplier += (targetSize - growth.currentSizeMultiplier) * 0.05f;
     }
 }
 
@@ -115,52 +110,38 @@ void SnowyWeatherEffect::drawForeground() {
 }
 
 void SnowyWeatherEffect::drawSnow() {
-    if (!_context.renderer || !_context.display || !_snowFlakes) return;
-    U8G2* u8g2 = _context.display;
-    Renderer& renderer = *_context.renderer;
-
-
-    uint8_t current_density = _particleDensity;
-    uint8_t flakes_to_draw = (MAX_SNOW_FLAKES * current_density) / 100;
-    flakes_to_draw = std::min((int)MAX_SNOW_FLAKES, (int)flakes_to_draw);
-
-    uint8_t originalColor = u8g2->getDrawColor();
-    u8g2->setDrawColor(1); 
+    if (!_context.renderer || !_growth || !_snow.isReady()) return;
+    FrameBufferView view(*_context.renderer);
+    if (!view.isValid()) return;
 
+    int flakes_to_draw = _snow.countFor(_particleDensity);
     for (int i = 0; i < flakes_to_draw; ++i) {
-        const SnowFlake& flake = _snowFlakes[i];
-        int x_local = static_cast<int>(round(flake.x));
-        int y_local = static_cast<int>(round(flake.y));
+        const FlakeGrowth& growth = _growth[i];
+        int x_local = _snow.pixelX(i);
+        int y_local = _snow.pixelY(i);
 
-        if (x_local >= 0 && x_local < renderer.getWidth() &&
-            y_local >= 0 && y_local < renderer.getHeight()) {
+        if (x_local >= 0 && x_local < view.getWidth() &&
+            y_local >= 0 && y_local < view.getHeight()) {
             
-            char str[2] = {flake.displayChar, '\0'};
-            const uint8_t* fontToUse = _snowFont;
-
-            if (flake.canGrow) {
-                if (flake.currentSizeMultiplier >= 1.4f) {
-                    fontToUse = _largeSnowFont;
-                    str[0] = '*';
-                } else if (flake.currentSizeMultiplier >= 1.2f) {
-                    fontToUse = _snowFont;
-                    str[0] = '*';
+            const FlakeShape* shape = (_snow.variant(i) == 0) ? &FLAKE_DOT : &FLAKE_STAR;
+
+            if (growth.canGrow) {
+                if (growth.currentSizeMultiplier >= 1.4f) {
+                    shape = &FLAKE_LARGE_STAR;
+                } else if (growth.currentSizeMultiplier >= 1.2f) {
+                    shape = &FLAKE_STAR;
                 } else {
-                    fontToUse = _snowFont;
-                    str[0] = '.';
+                    shape = &FLAKE_DOT;
                 }
             }
             
-            u8g2->setFont(fontToUse);
-            // Draw directly with u8g2, applying the renderer's offsets manually
-            u8g2->drawStr(renderer.getXOffset() + x_local, renderer.getYOffset() + y_local, str);
+            for (uint8_t row = 0; row < shape->height; ++row) {
+                for (uint8_t bits = shape->rows[row], col = 0; bits; bits >>= 1, ++col) {
+                    if (bits & 0x01) view.setPixel(x_local + col, y_local + shape->top + row);
+                }
+            }
         }
     }
-
-    if (_context.defaultFont) {
-         u8g2->setFont(_context.defaultFont);
-    }
-    u8g2->setDrawColor(originalColor);
 }
 
 WeatherType SnowyWeatherEffect::getType() const {
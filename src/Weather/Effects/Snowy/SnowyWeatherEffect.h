@@ -2,6 +2,8 @@
 #define SNOWY_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
+#include "../Precipitation.h"
+#include <memory>
 
 class SnowyWeatherEffect : public WeatherEffectBase {
 public:
@@ -15,27 +17,33 @@ public:
     WeatherType getType() const override;
 
 private:
-    struct SnowFlake {
-        float x;
-        float y;
-        float speedY;
-        float speedXFactor;
-        char displayChar;
-        // Growth properties
+    // Flakes that slowly swell to a large star and back; indexed like the
+    // flakes in _snow. Falling and drifting is left to _snow.
+    struct FlakeGrowth {
         bool canGrow;
         bool isGrowing;
         float currentSizeMultiplier;
         unsigned long nextSizeChangeTime;
     };
-    
+
     static const int MAX_SNOW_FLAKES = 40;
-    SnowFlake* _snowFlakes = nullptr; // MODIFIED: Changed from static array to pointer
     bool _isHeavySnow;
-    const uint8_t* _snowFont = nullptr;
-    const uint8_t* _largeSnowFont = nullptr;
+    Precipitation _snow;
+    std::unique_ptr<FlakeGrowth[]> _growth;
+    Rng _rng;
+
+    struct FlakeShape {
+        uint8_t top;
+        uint8_t height;
+        uint8_t rows[5];
+    };
+    static const FlakeShape FLAKE_DOT;
+    static const FlakeShape FLAKE_STAR;
+    static const FlakeShape FLAKE_LARGE_STAR;
 
-    void initSnowFlakes();
-    void updateSnowFlakes(unsigned long currentTime);
+    static Precipitation::Config snowConfig(bool isHeavy);
+    void initGrowth(unsigned long currentTime);
+    void updateGrowth(unsigned long currentTime, int count);
     void drawSnow();
 };
 
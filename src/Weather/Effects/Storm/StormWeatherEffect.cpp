@@ -6,20 +6,33 @@
 #include "../../../System/GameContext.h" // Ensure GameContext is known for _context usage
 #include "../../../DebugUtils.h"
 #include "SerialForwarder.h"
+#include "Renderer.h"
+#include "../../../Helper/FrameBufferView.h"
 
+// Frames are read straight out of the sheets: their counts must fit.
+static_assert(sizeof(epd_bitmap_strike1) >= STRIKE1_FRAME_COUNT * STRIKE1_BYTES_PER_FRAME, "strike1 sheet is short of frames");
+static_assert(sizeof(epd_bitmap_strike2) >= STRIKE2_FRAME_COUNT * STRIKE2_BYTES_PER_FRAME, "strike2 sheet is short of frames");
+static_assert(sizeof(epd_bitmap_strike3) >= STRIKE3_FRAME_COUNT * STRIKE3_BYTES_PER_FRAME, "strike3 sheet is short of frames");
 
 StormWeatherEffect::StormWeatherEffect(GameContext &context) // Takes GameContext
-    : WeatherEffectBase(context)
+    : WeatherEffectBase(context), _rain(rainConfig())
 { // Pass context to base
     _activeStrikes.reserve(MAX_SIMULTANEOUS_STRIKES);
     if (_context.serialForwarder)
         _context.serialForwarder->println("StormWeatherEffect created");
 }
 
+StormWeatherEffect::~StormWeatherEffect()
+{
+    TweenSystem::getInstance()->cancelOwnedBy(this);
+}
+
 void StormWeatherEffect::init(unsigned long currentTime)
 {
-    initRainDrops();
+    if (_context.renderer)
+        _rain.init(_context.renderer->getWidth(), _context.renderer->getHeight());
     initWindLines();
+    TweenSystem::getInstance()->cancelOwnedBy(this);
     _activeStrikes.clear();
     _lastStrikeTriggerTime = currentTime;
     _strikeCountLast10s = 0;
@@ -34,7 +47,8 @@ void StormWeatherEffect::init(unsigned long currentTime)
 
 void StormWeatherEffect::update(unsigned long currentTime)
 {
-    updateRainDrops();
+    _rain.update(_rain.countFor(_particleDensity),
+                 static_cast<int>(round(_currentWindFactor * 2 * 0.7f)) * Precipitation::ONE);
     updateWindLines();
     updateLightningStrikes();
 
@@ -66,73 +80,24 @@ void StormWeatherEffect::update(unsigned long currentTime)
     }
 }
 
-void StormWeatherEffect::initRainDrops()
-{
-    if (!_context.renderer)
-        return;
-    int screenW = _context.renderer->getWidth();
-    int screenH = _context.renderer->getHeight();
-    for (int i = 0; i < MAX_RAIN_DROPS_STORM; ++i)
-    {
-        _rainDrops[i] = {(int)random(0, screenW), (int)random(-screenH, -5), (int)random(2, 5)};
-    }
-}
-
-void StormWeatherEffect::updateRainDrops()
-{
-    if (!_context.renderer)
-        return;
-    int screenW = _context.renderer->getWidth();
-    int screenH = _context.renderer->getHeight();
-    uint8_t speed_factor = 2;
-    uint8_t current_density = _particleDensity;
-    uint8_t drops_to_update = (MAX_RAIN_DROPS_STORM * current_density) / 100;
-    drops_to_update = std::min((int)MAX_RAIN_DROPS_STORM, (int)drops_to_update);
-
-    for (int i = 0; i < drops_to_update; ++i)
-    {
-        int current_speed = std::abs(_rainDrops[i].speed);
-        if (current_speed == 0)
-            current_speed = 1;
-        _rainDrops[i].y += current_speed * speed_factor;
-        _rainDrops[i].x += static_cast<int>(round(_currentWindFactor * speed_factor * 0.7f));
-
-        if (_rainDrops[i].y > screenH || _rainDrops[i].x < -10 || _rainDrops[i].x > screenW + 10)
-        {
-            _rainDrops[i].x = (int)random(0, screenW);
-            _rainDrops[i].y = -(int)random(5, 30);
-            _rainDrops[i].speed = (int)random(2, 5);
-        }
-    }
-}
-
-void StormWeatherEffect::drawRain()
+// Heavy rain, driven harder by the wind: drops fall 4, 6 or 8 px per
+// update and respawn further up.
+Precipitation::Config StormWeatherEffect::rainConfig()
 {
-    if (!_context.renderer || !_context.display)
-        return;
-    U8G2 *u8g2 = _context.display;
-    Renderer &renderer = *_context.renderer;
-
-    int screenW = renderer.getWidth();
-    int screenH = renderer.getHeight();
-    uint8_t current_density = _particleDensity;
-    uint8_t drops_to_draw = (MAX_RAIN_DROPS_STORM * current_density) / 100;
-    drops_to_draw = std::min((int)MAX_RAIN_DROPS_STORM, (int)drops_to_draw);
-
-    for (int i = 0; i < drops_to_draw; ++i)
-    {
-        int x_local = _rainDrops[i].x;
-        int y1_local = _rainDrops[i].y;
-        int y2_local = y1_local + 3;
-        if (x_local >= 0 && x_local < screenW &&
-            ((y1_local >= 0 && y1_local < screenH) || (y2_local >= 0 && y2_local < screenH) || (y1_local < 0 && y2_local >= screenH)))
-        {
-            int draw_y1 = std::max(0, std::min(screenH - 1, y1_local));
-            int draw_y2 = std::max(0, std::min(screenH - 1, y2_local));
-            if (draw_y1 <= draw_y2)
-                renderer.drawLine(x_local, draw_y1, x_local, draw_y2);
-        }
-    }
+    Precipitation::Config config = {};
+    config.maxParticles = MAX_RAIN_DROPS_STORM;
+    config.speedMin = 2;
+    config.speedMax = 5;
+    config.speedUnit = 2.0f;
+    config.driftMin = 1;
+    config.driftMax = 2;
+    config.variants = 1;
+    config.respawnTop = -29;
+    config.respawnBottom = -5;
+    config.bottomMargin = 0;
+    config.sideMargin = 10;
+    config.wrapX = false;
+    return config;
 }
 
 void StormWeatherEffect::initWindLines()
@@ -197,28 +162,20 @@ void StormWeatherEffect::updateWindLines()
     }
 }
 
-void StormWeatherEffect::drawWindLines()
+void StormWeatherEffect::drawWindLines(FrameBufferView &view)
 {
-    if (!_context.renderer)
-        return;
-    Renderer &renderer = *_context.renderer;
-    int screenW = renderer.getWidth();
-    int screenH = renderer.getHeight();
+    int screenW = view.getWidth();
+    int screenH = view.getHeight();
     for (int i = 0; i < MAX_WIND_LINES_STORM; ++i)
     {
-        int x1_abs = renderer.getXOffset() + _windLines[i].x1;
-        int y1_abs = renderer.getYOffset() + _windLines[i].y1;
-        int x2_abs = renderer.getXOffset() + _windLines[i].x2;
-        int y2_abs = renderer.getYOffset() + _windLines[i].y2;
-
-        bool isLineOnScreen = !((x1_abs < renderer.getXOffset() && x2_abs < renderer.getXOffset()) ||
-                                (x1_abs >= renderer.getXOffset() + screenW && x2_abs >= renderer.getXOffset() + screenW) ||
-                                (y1_abs < renderer.getYOffset() && y2_abs < renderer.getYOffset()) ||
-                                (y1_abs >= renderer.getYOffset() + screenH && y2_abs >= renderer.getYOffset() + screenH));
+        const auto &windLine = _windLines[i];
+        bool isLineOnScreen = !((windLine.x1 < 0 && windLine.x2 < 0) ||
+                                (windLine.x1 >= screenW && windLine.x2 >= screenW) ||
+                                (windLine.y1 < 0 && windLine.y2 < 0) ||
+                                (windLine.y1 >= screenH && windLine.y2 >= screenH));
         if (isLineOnScreen)
         {
-            // Use local coordinates for renderer.drawLine
-            renderer.drawLine(_windLines[i].x1, _windLines[i].y1, _windLines[i].x2, _windLines[i].y2);
+            view.line(windLine.x1, windLine.y1, windLine.x2, windLine.y2, FrameBufferView::XOR);
         }
     }
 }
@@ -292,9 +249,13 @@ void StormWeatherEffect::triggerLightning(unsigned long currentTime)
             newStrike.screenFlash = (random(100) < 15);
         }
         newStrike.type = selectedStrikeType;
-        newStrike.animator.reset(new Animator(renderer, strikeBitmap, frameWidth, frameHeight, frameCount, bytesPerFrame, newStrike.x, newStrike.y, STRIKE_ANIM_FRAME_DURATION_MS, 1));
+        newStrike.bitmap = strikeBitmap;
+        newStrike.frameWidth = frameWidth;
+        newStrike.frameHeight = frameHeight;
+        newStrike.bytesPerFrame = bytesPerFrame;
+        newStrike.frames = TweenSystem::getInstance()->start(TweenSystem::frames(frameCount, STRIKE_ANIM_FRAME_DURATION_MS), this);
 
-        if (newStrike.animator)
+        if (newStrike.frames != NO_TWEEN)
         {
             _activeStrikes.push_back(std::move(newStrike));
             _strikeCountLast10s++;
@@ -306,7 +267,7 @@ void StormWeatherEffect::triggerLightning(unsigned long currentTime)
         else
         {
             if (_context.serialForwarder)
-                _context.serialForwarder->println("Storm: Failed to create lightning animator!");
+                _context.serialForwarder->println("Storm: Failed to start lightning frames!");
         }
     }
 }
@@ -315,7 +276,7 @@ void StormWeatherEffect::updateLightningStrikes()
 {
     for (auto it = _activeStrikes.begin(); it != _activeStrikes.end();)
     {
-        if (!it->animator || !it->animator->update())
+        if (!TweenSystem::getInstance()->isActive(it->frames))
         {
             it = _activeStrikes.erase(it);
         }
@@ -328,11 +289,17 @@ void StormWeatherEffect::updateLightningStrikes()
 
 void StormWeatherEffect::drawLightningStrikes()
 {
+    Renderer *renderer = _context.renderer;
+    U8G2 *u8g2 = renderer ? renderer->getU8G2() : nullptr;
+    if (!u8g2)
+        return;
+    TweenSystem *tweens = TweenSystem::getInstance();
     for (auto &strike : _activeStrikes)
     {
-        if (strike.animator)
+        if (tweens->isActive(strike.frames))
         {
-            strike.animator->draw();
+            const unsigned char *frame = strike.bitmap + tweens->frame(strike.frames) * strike.bytesPerFrame;
+            u8g2->drawXBMP(renderer->getXOffset() + strike.x, renderer->getYOffset() + strike.y, strike.frameWidth, strike.frameHeight, frame);
         }
     }
 }
@@ -366,12 +333,11 @@ void StormWeatherEffect::drawForeground()
         }
     }
 
-    uint8_t originalColor = u8g2->getDrawColor();
-
-    u8g2->setDrawColor(2);
-    drawRain();
-    drawWindLines();
+    FrameBufferView view(renderer);
+    _rain.drawSpans(view, _rain.countFor(_particleDensity), 4, FrameBufferView::XOR);
+    drawWindLines(view);
 
+    uint8_t originalColor = u8g2->getDrawColor();
     if (fullscreenStrikeActive)
         u8g2->setDrawColor(2);
     else
@@ -380,8 +346,7 @@ void StormWeatherEffect::drawForeground()
 
     if (isFlashing())
     {
-        u8g2->setDrawColor(2);
-        u8g2->drawBox(renderer.getXOffset(), renderer.getYOffset(), renderer.getWidth(), renderer.getHeight());
+        view.fill(0, 0, view.getWidth(), view.getHeight(), FrameBufferView::XOR);
     }
 
     u8g2->setDrawColor(originalColor);
@@ -2,20 +2,20 @@
 #define STORM_WEATHER_EFFECT_H
 
 #include "../WeatherEffectBase.h"
+#include "../Precipitation.h"
 // #include "../Rainy/RainyWeatherEffect.h" // No longer directly needed if rain logic is self-contained or duplicated slightly
-#include "../../../Animator.h" 
+#include "../../../Helper/TweenSystem.h"
 #include <vector>
 #include <memory>
 #include "../../../System/GameContext.h" // <<< NEW INCLUDE
 
-// Forward declarations
-// class Animator; // Already included
+class FrameBufferView;
 
 class StormWeatherEffect : public WeatherEffectBase {
 public:
     // Constructor now takes GameContext
     StormWeatherEffect(GameContext& context); 
-    ~StormWeatherEffect() override = default;
+    ~StormWeatherEffect() override;
 
     void init(unsigned long currentTime) override;
     void update(unsigned long currentTime) override;
@@ -24,16 +24,17 @@ public:
     WeatherType getType() const override;
 
 private:
-    struct RainDrop { int x; int y; int speed; };
-    static const int MAX_RAIN_DROPS_STORM = 30; 
-    RainDrop _rainDrops[MAX_RAIN_DROPS_STORM];
+    static const int MAX_RAIN_DROPS_STORM = 48;
+    Precipitation _rain;
     
     struct WindLine { int x1, y1, x2, y2; };
     static const int MAX_WIND_LINES_STORM = 7; 
     WindLine _windLines[MAX_WIND_LINES_STORM];
 
     struct LightningStrike {
-        std::unique_ptr<Animator> animator;
+        TweenHandle frames = NO_TWEEN;
+        const unsigned char* bitmap = nullptr;
+        int frameWidth = 0; int frameHeight = 0; size_t bytesPerFrame = 0;
         int x = 0; int y = 0; StrikeType type; bool screenFlash = false;
     };
     static const int MAX_SIMULTANEOUS_STRIKES = 3;
@@ -51,13 +52,11 @@ private:
     static const int MAX_FULLSCREEN_STRIKES_PER_MINUTE = 2;
     static const unsigned long STRIKE_ANIM_FRAME_DURATION_MS = 80;
 
-    void initRainDrops();
-    void updateRainDrops();
-    void drawRain();
+    static Precipitation::Config rainConfig();
 
     void initWindLines();
     void updateWindLines();
-    void drawWindLines();
+    void drawWindLines(FrameBufferView& view);
 
     void triggerLightning(unsigned long currentTime);
     void updateLightningStrikes();
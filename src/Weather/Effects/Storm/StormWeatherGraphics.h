@@ -86,10 +86,10 @@ const unsigned char epd_bitmap_strike2 [] PROGMEM = {
 };
 
 #define STRIKE3_SPRITESHEET_WIDTH 128
-#define STRIKE3_SPRITESHEET_HEIGHT 225
+#define STRIKE3_SPRITESHEET_HEIGHT 90
 #define STRIKE3_FRAME_WIDTH 128
 #define STRIKE3_FRAME_HEIGHT 45
-#define STRIKE3_FRAME_COUNT 5
+#define STRIKE3_FRAME_COUNT 2 // The sheet was exported with 2 of its 5 frames
 #define STRIKE3_BYTES_PER_FRAME ((STRIKE3_FRAME_WIDTH + 7) / 8 * STRIKE3_FRAME_HEIGHT)
 const unsigned char epd_bitmap_strike3 [] PROGMEM = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -6,6 +6,7 @@
 #include <algorithm> 
 #include "../../../System/GameContext.h"
 #include "../../../DebugUtils.h"
+#include "../../../Helper/FixedTrig.h"
 
 // Constructor now takes GameContext
 SunnyWeatherEffect::SunnyWeatherEffect(GameContext& context)
@@ -98,14 +99,19 @@ void SunnyWeatherEffect::drawBackground() {
         return code;
     };
 
+    const FixedTrig::Angle rayPhase = FixedTrig::fromRadians(_sunRayAnimationPhase);
+    const FixedTrig::Angle wobblePhase = FixedTrig::fromRadians(_sunRayAnimationPhase * 2.5f);
+    const FixedTrig::Angle wobbleStep = FixedTrig::fromRadians(0.7f);
     for (int i = 0; i < SUN_NUM_RAYS; ++i) {
-        float angle = (TWO_PI / SUN_NUM_RAYS) * i + _sunRayAnimationPhase;
-        float rayLengthVariation = SUN_RAY_LENGTH_VARIATION * sin(_sunRayAnimationPhase * 2.5f + i * 0.7f);
-
-        int x1 = sunDrawX + static_cast<int>(round(cos(angle) * (SUN_INNER_RADIUS + 1)));
-        int y1 = sunDrawY + static_cast<int>(round(sin(angle) * (SUN_INNER_RADIUS + 1)));
-        int x2 = sunDrawX + static_cast<int>(round(cos(angle) * (SUN_OUTER_RADIUS + rayLengthVariation)));
-        int y2 = sunDrawY + static_cast<int>(round(sin(angle) * (SUN_OUTER_RADIUS + rayLengthVariation)));
+        FixedTrig::Angle angle = (FixedTrig::Angle)(rayPhase + (uint32_t)i * 65536u / SUN_NUM_RAYS);
+        float rayLengthVariation = SUN_RAY_LENGTH_VARIATION * FixedTrig::sinF((FixedTrig::Angle)(wobblePhase + i * wobbleStep));
+        float c = FixedTrig::cosF(angle);
+        float s = FixedTrig::sinF(angle);
+
+        int x1 = sunDrawX + static_cast<int>(round(c * (SUN_INNER_RADIUS + 1)));
+        int y1 = sunDrawY + static_cast<int>(round(s * (SUN_INNER_RADIUS + 1)));
+        int x2 = sunDrawX + static_cast<int>(round(c * (SUN_OUTER_RADIUS + rayLengthVariation)));
+        int y2 = sunDrawY + static_cast<int>(round(s * (SUN_OUTER_RADIUS + rayLengthVariation)));
         
         int outcode1 = computeOutCode(x1, y1);
         int outcode2 = computeOutCode(x2, y2);
@@ -20,6 +20,7 @@
 #include "Effects/Aurora/AuroraWeatherEffect.h"
 #include "Effects/BirdManager.h" 
 #include "../System/GameContext.h"
+#include "../System/FrameProfiler.h"
 #include <map>
 
 
@@ -216,17 +217,24 @@ void WeatherManager::update(unsigned long currentTime) {
 void WeatherManager::drawBackground(bool allowDrawing) {
     if (!allowDrawing || !_context.gameStats) return; 
     
+    uint32_t start = FrameProfiler::nowMicros();
     for(const auto& effect : _activeEffects) {
         effect->drawBackground();
     }
+    _effectsDrawUs = FrameProfiler::nowMicros() - start;
 }
 
 void WeatherManager::drawForeground(bool allowDrawing) {
     if (!allowDrawing || !_context.gameStats) return; 
     
+    uint32_t start = FrameProfiler::nowMicros();
     for(const auto& effect : _activeEffects) {
         effect->drawForeground();
     }
+    if (_context.frameProfiler && !_activeEffects.empty()) {
+        _context.frameProfiler->record(FrameProfiler::PHASE_EFFECTS, _effectsDrawUs + FrameProfiler::nowMicros() - start);
+    }
+    _effectsDrawUs = 0;
     if (_birdManager) { 
         _birdManager->draw();
     }
@@ -56,6 +56,7 @@ private:
     unsigned long _currentWeatherDuration = 0;
     RainIntensityState _rainIntensityState = RainIntensityState::NONE;
     uint8_t _currentParticleDensity = 0;
+    uint32_t _effectsDrawUs = 0; // drawBackground() time, reported with drawForeground()
 
     float _actualWindFactor = 0.0f;
     float _targetWindFactor = 0.0f;